@@ -318,6 +318,97 @@ namespace thimble {
          */
         bool decode( BinaryVector & m ) const;
 
+        /**
+         * @brief
+         *            Rounds many vectors to their nearest codewords at
+         *            once.
+         *
+         * @details
+         *            The implementation of this function is wrapped around
+         *            the \link BCHCodeBase::roundBatch()\endlink function
+         *            which processes the vectors in bit-sliced groups of
+         *            64.
+         *
+         * @param c
+         *            Array of <i>num</i> vectors each of length
+         *            <i>n=</i>\link getBlockLength()\endlink. On output,
+         *            the vectors that could be rounded are replaced by
+         *            their nearest codeword; the others are left
+         *            unchanged.
+         *
+         * @param success
+         *            Array that can hold at least <i>num</i> flags; on
+         *            output, <code>success[l]</code> indicates whether
+         *            <code>c[l]</code> was successfully rounded.
+         *
+         * @param num
+         *            The number of vectors in <i>c</i>.
+         *
+         * @return
+         *            The number of vectors that were successfully
+         *            rounded.
+         *
+         * @warning
+         *            If any of the vectors is of length different from
+         *            <i>n=</i>\link getBlockLength()\endlink, an error
+         *            message is printed to <code>stderr</code> and the
+         *            program exits with status 'EXIT_FAILURE'.
+         *
+         * @warning
+         *            If not enough memory could be provided, an error
+         *            message is printed to <code>stderr</code> and the
+         *            program exits with status 'EXIT_FAILURE'.
+         *
+         * @see BCHCode::round()
+         * @see BCHCodeBase::roundBatch()
+         */
+        int roundBatch( BinaryVector *c , bool *success , int num ) const;
+
+        /**
+         * @brief
+         *            Decodes many vectors at once.
+         *
+         * @details
+         *            Does the same as calling \link decode()\endlink for
+         *            each of the <i>num</i> vectors in <i>m</i> but
+         *            rounds them via \link roundBatch()\endlink.
+         *
+         * @param m
+         *            Array of <i>num</i> vectors each of length
+         *            <i>n=</i>\link getBlockLength()\endlink. On output,
+         *            each successfully decoded vector contains its
+         *            message in the first
+         *            <i>k=</i>\link getDimension()\endlink entries; the
+         *            other vectors are left unchanged.
+         *
+         * @param success
+         *            Array that can hold at least <i>num</i> flags; on
+         *            output, <code>success[l]</code> indicates whether
+         *            <code>m[l]</code> was successfully decoded.
+         *
+         * @param num
+         *            The number of vectors in <i>m</i>.
+         *
+         * @return
+         *            The number of vectors that were successfully
+         *            decoded.
+         *
+         * @warning
+         *            If any of the vectors is of length different from
+         *            <i>n=</i>\link getBlockLength()\endlink, an error
+         *            message is printed to <code>stderr</code> and the
+         *            program exits with status 'EXIT_FAILURE'.
+         *
+         * @warning
+         *            If not enough memory could be provided, an error
+         *            message is printed to <code>stderr</code> and the
+         *            program exits with status 'EXIT_FAILURE'.
+         *
+         * @see BCHCode::decode()
+         * @see BCHCodeBase::decodeBatch()
+         */
+        int decodeBatch( BinaryVector *m , bool *success , int num ) const;
+
         /**
          * @brief
          *            Creates a random code word.
@@ -33,12 +33,18 @@
 
 #include <thimble/dllcompat.h>
 #include <thimble/math/numbertheory/BinaryPolynomial.h>
+#include <thimble/math/numbertheory/SmallBinaryField.h>
 
+#include <stdint.h>
 #include <vector>
 
 #ifdef THIMBLE_BUILD_DLL
 template class THIMBLE_DLL std::allocator<thimble::BinaryPolynomial>;
 template class THIMBLE_DLL std::vector<thimble::BinaryPolynomial,std::allocator<thimble::BinaryPolynomial> >;
+template class THIMBLE_DLL std::allocator<uint32_t>;
+template class THIMBLE_DLL std::vector<uint32_t,std::allocator<uint32_t> >;
+template class THIMBLE_DLL std::allocator<uint64_t>;
+template class THIMBLE_DLL std::vector<uint64_t,std::allocator<uint64_t> >;
 #endif
 
 /**
@@ -111,6 +117,170 @@ namespace thimble {
          */
         std::vector<BinaryPolynomial> powers_of_X_mod_f;
 
+        /**
+         * @brief
+         *             Indicates whether the field \f$GF(2)[X]/(f(X))\f$
+         *             is small enough such that error-correction can be
+         *             performed via the tables held by
+         *             <i>\link gf\endlink</i>,
+         *             <i>\link syndromeTables\endlink</i> and
+         *             <i>\link chienMasks\endlink</i>.
+         *
+         * @details
+         *             If <code>false</code>, the \link round()\endlink
+         *             function falls back to arithmetic with
+         *             \link BinaryPolynomial binary polynomials\endlink
+         *             modulo <i>\link f\endlink</i>.
+         */
+        bool hasSmallField;
+
+        /**
+         * @brief
+         *             The finite field defined by
+         *             <i>\link f\endlink</i> in which the syndromes, the
+         *             error-locator polynomial and its roots are computed
+         *             if <i>\link hasSmallField\endlink</i> is
+         *             <code>true</code>.
+         *
+         * @details
+         *             Elements of the field are represented by the
+         *             coefficient bits of their polynomial representant
+         *             modulo <i>\link f\endlink</i>; in particular,
+         *             \f$\beta=X~mod~f(X)\f$ is represented by the
+         *             first word of <code>powers_of_X_mod_f[1]</code>.
+         */
+        SmallBinaryField gf;
+
+        /**
+         * @brief
+         *             Tables for the byte-wise computation of the odd
+         *             partial syndromes.
+         *
+         * @details
+         *             For the <i>l</i>th odd syndrome
+         *             \f$S_{2l+1}=c(\beta^{2l+1})\f$, the entries
+         *             <code>syndromeTables[257*l+v]</code> where
+         *             <i>v=0,...,255</i> contain the evaluation of the
+         *             polynomial whose coefficients are the bits of
+         *             <i>v</i> at \f$\beta^{2l+1}\f$; the entry
+         *             <code>syndromeTables[257*l+256]</code> contains
+         *             \f$\beta^{8\cdot(2l+1)}\f$ which is used to
+         *             shift the evaluation by one byte in Horner's
+         *             method.
+         */
+        std::vector<uint32_t> syndromeTables;
+
+        /**
+         * @brief
+         *             Bit-sliced tables for evaluating the error-locator
+         *             polynomial at 64 consecutive powers of
+         *             \f$\beta\f$ at once.
+         *
+         * @details
+         *             Let <i>m</i> be the degree of
+         *             <i>\link f\endlink</i>. For
+         *             <i>j=1,...,\link getErrorTolerance()\endlink</i>,
+         *             <i>a=0,...,m-1</i> and <i>b=0,...,m-1</i> the
+         *             <i>s</i>th bit of the entry at the index
+         *             <code>((j-1)*m+a)*m+b</code> is the <i>b</i>th
+         *             coefficient of \f$X^a\cdot\beta^{j\cdot s}\f$
+         *             (where <i>s=0,...,63</i>). Since multiplication
+         *             with a field element is linear over
+         *             \f$GF(2)\f$, these words allow to evaluate a term
+         *             \f$\lambda_j\cdot\beta^{j\cdot(i+s)}\f$ for
+         *             all 64 values of <i>s</i> by XORing the rows that
+         *             correspond to the non-zero bits of
+         *             \f$\lambda_j\cdot\beta^{j\cdot i}\f$.
+         *
+         *             If the tables would become too large, the vector
+         *             is left empty and the Chien search evaluates the
+         *             error-locator polynomial at one power of
+         *             \f$\beta\f$ after the other.
+         */
+        std::vector<uint64_t> chienMasks;
+
+        /**
+         * @brief
+         *             Table for computing the check bits of a message
+         *             byte-wise via a linear feedback shift register.
+         *
+         * @details
+         *             Let <i>r</i> be the degree of the generator
+         *             polynomial <i>\link g\endlink</i> and
+         *             <i>W</i> be the number of 32-bit words needed to
+         *             hold <i>r</i> bits. If \f$r\geq 8\f$, the
+         *             <i>W</i> words starting at the index <i>W*v</i>
+         *             (where <i>v=0,...,255</i>) contain the
+         *             coefficients of \f$v(X)\cdot X^r~rem~g(X)\f$
+         *             where \f$v(X)\f$ is the polynomial whose
+         *             coefficients are the bits of <i>v</i>; otherwise,
+         *             the vector is empty and the check bits are
+         *             computed bit by bit.
+         */
+        std::vector<uint32_t> lfsrTable;
+
+        /**
+         * @brief
+         *             Initializes <i>\link lfsrTable\endlink</i> after
+         *             the generator polynomial <i>\link g\endlink</i> has
+         *             been computed.
+         *
+         * @warning
+         *             If not enough memory could be provided, an error
+         *             message is printed to <code>stderr</code> and the
+         *             program exits with status 'EXIT_FAILURE'.
+         */
+        void initEncoder();
+
+        /**
+         * @brief
+         *             Initializes <i>\link hasSmallField\endlink</i>,
+         *             <i>\link gf\endlink</i>,
+         *             <i>\link syndromeTables\endlink</i> and
+         *             <i>\link chienMasks\endlink</i> after the members
+         *             <i>\link n\endlink</i>, <i>\link d\endlink</i> and
+         *             <i>\link f\endlink</i> have been computed.
+         *
+         * @warning
+         *             If not enough memory could be provided, an error
+         *             message is printed to <code>stderr</code> and the
+         *             program exits with status 'EXIT_FAILURE'.
+         */
+        void initSmallField();
+
+        /**
+         * @brief
+         *             Computes the partial syndromes of a received word
+         *             by table look-ups in
+         *             <i>\link syndromeTables\endlink</i>.
+         *
+         * @details
+         *             The function requires that
+         *             <i>\link hasSmallField\endlink</i> is
+         *             <code>true</code>. The odd syndromes are
+         *             evaluated by Horner's method processing 8 bits of
+         *             <i>c</i> per step; the even syndromes are obtained
+         *             via \f$S_{2j}=S_j^2\f$.
+         *
+         * @param S
+         *             On output, contains the syndromes
+         *             \f$S_{j+1}=c(\beta^{j+1})\f$ at the index
+         *             \f$j=0,...,2\nu-1\f$ where
+         *             \f$\nu=\f$\link getErrorTolerance()\endlink.
+         *             Must be able to hold at least \f$2\nu\f$
+         *             elements.
+         *
+         * @param c
+         *             The received word; a polynomial of degree smaller
+         *             than <i>\link n\endlink</i>.
+         *
+         * @return
+         *             <code>true</code> if all syndromes are zero, i.e.,
+         *             if <i>c</i> is a codeword; otherwise
+         *             <code>false</code>.
+         */
+        bool syndromes( uint32_t *S , const BinaryPolynomial & c ) const;
+
         /**
          * @brief
          *             Determines the non-zero roots of a polynomial
@@ -182,6 +352,97 @@ namespace thimble {
         std::vector<int> chienSearch
         ( const std::vector<BinaryPolynomial> & Lambda ) const;
 
+        /**
+         * @brief
+         *             Determines the non-zero roots of a polynomial
+         *             with coefficients in the field
+         *             <i>\link gf\endlink</i>.
+         *
+         * @details
+         *             Does the same as
+         *             \link chienSearch(const std::vector<BinaryPolynomial>&)const\endlink
+         *             but requires <i>\link hasSmallField\endlink</i> to
+         *             be <code>true</code>; the polynomial is evaluated at
+         *             64 consecutive powers of \f$\beta\f$ at once using
+         *             the bit-sliced tables
+         *             <i>\link chienMasks\endlink</i>.
+         *
+         * @param Lambda
+         *             An array of length <i>t+1</i>
+         *             (where <i>t</i>\f$\leq\f$\link getErrorTolerance()\endlink)
+         *             such that the entry <code>Lambda[j]</code>
+         *             is the <i>j</i>th coefficient \f$\lambda_j\f$ of the
+         *             polynomial \f$\Lambda(X)\f$.
+         *
+         * @return
+         *             The error locations, i.e., the exponents
+         *             <i>n-i</i> for which \f$\beta^i\f$ is a root of
+         *             \f$\Lambda(X)\f$ (where <i>i=1,...,n</i>).
+         *
+         * @warning
+         *             If the requirement on the input <code>Lambda</code>
+         *             is violated, a call of this function runs into
+         *             undocumented behaviour.
+         *
+         * @warning
+         *             If not enough memory could be provided, an error
+         *             message is printed to <code>stderr</code> and the
+         *             program exits with status 'EXIT_FAILURE'.
+         */
+        std::vector<int> chienSearch
+        ( const std::vector<uint32_t> & Lambda ) const;
+
+
+        /**
+         * @brief
+         *             Rounds up to 64 received words simultaneously by
+         *             processing them in bit-sliced form.
+         *
+         * @details
+         *             The function requires that
+         *             <i>\link hasSmallField\endlink</i> is
+         *             <code>true</code>. The <i>l</i>th received word is
+         *             assigned to the <i>l</i>th bit of 64-bit integers;
+         *             an element of the field <i>\link gf\endlink</i>
+         *             for all words is then represented by
+         *             <i>m</i>=\link getModulus()\endlink.deg() integers
+         *             of which the <i>b</i>th holds the <i>b</i>th
+         *             coefficients. Syndromes, an inversionless variant
+         *             of the Berlekamp-Massey algorithm and the Chien
+         *             search are then run in lockstep for all words.
+         *
+         * @param c
+         *             Array of <i>num</i> received words; on output,
+         *             successfully rounded words are replaced by their
+         *             nearest codeword.
+         *
+         * @param success
+         *             On output, <code>success[l]</code> indicates
+         *             whether <code>c[l]</code> was successfully
+         *             rounded.
+         *
+         * @param num
+         *             Number of words; must be between 1 and 64.
+         *
+         * @param numErrors
+         *             If not <code>NULL</code>, on output
+         *             <code>numErrors[l]</code> contains the number of
+         *             bits that have been corrected in
+         *             <code>c[l]</code>.
+         *
+         * @return
+         *             The number of words that were successfully
+         *             rounded.
+         *
+         * @warning
+         *             If not enough memory could be provided, an error
+         *             message is printed to <code>stderr</code> and the
+         *             program exits with status 'EXIT_FAILURE'.
+         */
+        int roundBatch64
+        ( BinaryPolynomial *c , bool *success , int num ,
+          int *numErrors ) const;
+
     public:
 
         /**
@@ -309,6 +570,67 @@ namespace thimble {
          */
         bool round( BinaryPolynomial & c ) const;
 
+        /**
+         * @brief
+         *            Attempts to round many input bit sequences to their
+         *            nearest codewords.
+         *
+         * @details
+         *            Does the same as calling \link round()\endlink for
+         *            each of the <i>num</i> polynomials in <i>c</i>.
+         *            If the field defined by \link getModulus()\endlink
+         *            is small, the words are processed in groups of 64
+         *            which are transposed into bit-sliced form such that
+         *            syndrome computation, the Berlekamp-Massey
+         *            algorithm and the Chien search are run in
+         *            lockstep on 64-bit words. This is considerably
+         *            faster than rounding the words one after the other,
+         *            e.g., when decoding the same code against all
+         *            entries of a gallery.
+         *
+         * @param c
+         *            Array of <i>num</i> polynomials each of degree
+         *            smaller than \link getBlockLength()\endlink. On
+         *            output, the polynomials that could be rounded are
+         *            replaced by their nearest codeword; the others are
+         *            left unchanged.
+         *
+         * @param success
+         *            Array that can hold at least <i>num</i> flags; on
+         *            output, <code>success[l]</code> is
+         *            <code>true</code> if <code>c[l]</code> was
+         *            successfully rounded and <code>false</code>
+         *            otherwise.
+         *
+         * @param num
+         *            The number of polynomials in <i>c</i>.
+         *
+         * @param numErrors
+         *            If not <code>NULL</code>, an array that can hold
+         *            at least <i>num</i> integers; on output,
+         *            <code>numErrors[l]</code> contains the number of
+         *            bits that have been corrected in <code>c[l]</code>
+         *            (or -1 if rounding failed).
+         *
+         * @return
+         *            The number of polynomials that were successfully
+         *            rounded.
+         *
+         * @warning
+         *            If any of the <i>c[l]</i> is of degree larger than
+         *            or equals \link getBlockLength()\endlink an error
+         *            message is printed to <code>stderr</code> and the
+         *            program exits with status 'EXIT_FAILURE'.
+         *
+         * @warning
+         *            If not enough memory could be provided, an error
+         *            message is printed to <code>stderr</code> and the
+         *            program exits with status 'EXIT_FAILURE'.
+         */
+        int roundBatch
+        ( BinaryPolynomial *c , bool *success , int num ,
+          int *numErrors = NULL ) const;
+
         /**
          * @brief
          *            Attaches checkbits to a message polynomial such
@@ -342,6 +664,42 @@ namespace thimble {
          */
         void encode( BinaryPolynomial & c ) const;
 
+        /**
+         * @brief
+         *            Systematically encodes a message given as raw
+         *            32-bit words.
+         *
+         * @details
+         *            The <i>i</i>th bit of the message is the
+         *            <i>(i%32)</i>th bit of <code>m[i/32]</code> and the
+         *            same layout is used for the codeword which is the
+         *            same as for \link BinaryPolynomial\endlink and
+         *            \link BinaryVector\endlink. The message is copied to
+         *            the upper <i>k=</i>\link getDimension()\endlink
+         *            bits of <i>c</i> and the lower
+         *            <i>n-k</i> check bits are the remainder of the
+         *            message polynomial times \f$X^{n-k}\f$ modulo the
+         *            generator polynomial which is computed by a
+         *            table-driven linear feedback shift register consuming
+         *            8 message bits per step.
+         *
+         *            The result is the same as for
+         *            \link encode(BinaryPolynomial&)const\endlink.
+         *
+         * @param c
+         *            On output, contains the
+         *            <i>n=</i>\link getBlockLength()\endlink bits of
+         *            the codeword; must be able to hold at least
+         *            <i>(n+31)/32</i> words. The bits in the last word
+         *            above the <i>n</i>th bit are set to zero.
+         *
+         * @param m
+         *            Contains the <i>k</i> bits of the message in
+         *            <i>(k+31)/32</i> words; bits above the <i>k</i>th
+         *            are ignored. Must not overlap with <i>c</i>.
+         */
+        void encode( uint32_t *c , const uint32_t *m ) const;
+
         /**
          * @brief
          *            Rounds the input polynomial to its nearest codeword
@@ -378,6 +736,49 @@ namespace thimble {
          */
         bool decode( BinaryPolynomial & m ) const;
 
+        /**
+         * @brief
+         *            Decodes many received polynomials at once.
+         *
+         * @details
+         *            Does the same as calling \link decode()\endlink for
+         *            each of the <i>num</i> polynomials in <i>m</i> but
+         *            rounds them via \link roundBatch()\endlink.
+         *
+         * @param m
+         *            Array of <i>num</i> polynomials each of degree
+         *            smaller than
+         *            <i>n=</i>\link getBlockLength()\endlink. On output,
+         *            the successfully decoded polynomials are replaced
+         *            by their message polynomials; the others are left
+         *            unchanged.
+         *
+         * @param success
+         *            Array that can hold at least <i>num</i> flags; on
+         *            output, <code>success[l]</code> indicates whether
+         *            <code>m[l]</code> was successfully decoded.
+         *
+         * @param num
+         *            The number of polynomials in <i>m</i>.
+         *
+         * @return
+         *            The number of polynomials that were successfully
+         *            decoded.
+         *
+         * @warning
+         *            If any of the <i>m[l]</i> is of degree larger than
+         *            or equals <i>n=</i>\link getBlockLength()\endlink,
+         *            an error message is printed to <code>stderr</code>
+         *            and the program exits with status 'EXIT_FAILURE'.
+         *
+         * @warning
+         *            If not enough memory could be provided, an error
+         *            message is printed to <code>stderr</code> and the
+         *            program exits with status 'EXIT_FAILURE'.
+         */
+        int decodeBatch
+        ( BinaryPolynomial *m , bool *success , int num ) const;
+
         /**
          * @brief
          *           Creates a random code polynomial.
@@ -546,6 +947,39 @@ namespace thimble {
         static std::vector<BinaryPolynomial> berlekampMassey
         ( const std::vector<BinaryPolynomial> & S ,
           const BinaryPolynomial & f );
+
+        /**
+         * @brief
+         *            Implementation of the Berlekamp-Massey algorithm
+         *            for finding the minimal polynomial of a linearly
+         *            recurrent sequence in a small binary finite field.
+         *
+         * @details
+         *            Does the same as
+         *            \link berlekampMassey(const std::vector<BinaryPolynomial>&,const BinaryPolynomial&)\endlink
+         *            but works with the word representation of the
+         *            elements in <i>gf</i> which avoids the polynomial
+         *            multiplications and reductions.
+         *
+         * @param S
+         *            Linearly recurrent sequence of elements in
+         *            <i>gf</i>.
+         *
+         * @param gf
+         *            The finite field in which the sequence lives.
+         *
+         * @return
+         *            A vector of length at most <i>t+1</i> where
+         *            <code>Lambda[j]</code> is the <i>j</i>th coefficient
+         *            of the minimal polynomial of the sequence.
+         *
+         * @warning
+         *            If not enough memory could be provided, an error
+         *            message is printed to <code>stderr</code> and the
+         *            program exits with status 'EXIT_FAILURE'.
+         */
+        static std::vector<uint32_t> berlekampMassey
+        ( const std::vector<uint32_t> & S , const SmallBinaryField & gf );
     };
 }
 
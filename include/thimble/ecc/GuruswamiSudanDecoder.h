@@ -46,6 +46,8 @@
 template struct THIMBLE_DLL std::pair<double,double>;
 template class THIMBLE_DLL std::allocator< thimble::SmallBinaryFieldPolynomial >;
 template class THIMBLE_DLL std::vector< thimble::SmallBinaryFieldPolynomial , std::allocator< thimble::SmallBinaryFieldPolynomial > >;
+template class THIMBLE_DLL std::allocator< thimble::SmallBinaryFieldBivariatePolynomial >;
+template class THIMBLE_DLL std::vector< thimble::SmallBinaryFieldBivariatePolynomial , std::allocator< thimble::SmallBinaryFieldBivariatePolynomial > >;
 #endif
 
 /**
@@ -179,6 +181,30 @@ namespace thimble {
 	 *             SmallBinaryFieldPolynomial f = list.front();
 	 *            </pre>
 	 *            will be the correct polynomial with very high probability.
+	 *
+	 *            <h2>Incremental Multiplicity</h2>
+	 *            If the smallest multiplicity that suffices for decoding is
+	 *            not known in advance, the decoder can be run with
+	 *            increasing multiplicities without recomputing the
+	 *            interpolation from scratch:
+	 *            <pre>
+	 *             gsDecoder.prepare(x,y,n,k,gf);
+	 *             for ( int m0 = 1 ; m0 <= m ; m0++ ) {
+	 *                 if ( gsDecoder.increaseMultiplicity() ) {
+	 *                     // inspect 'gsDecoder.getDecodedList()'
+	 *                 }
+	 *             }
+	 *            </pre>
+	 *            Each call to <code>increaseMultiplicity()</code> multiplies
+	 *            the interpolation basis of the previous multiplicity by
+	 *            the basis of multiplicity 1. Moreover, the code locator
+	 *            polynomial and the interpolating polynomial computed by
+	 *            <code>prepare()</code> can be passed to
+	 *            \link
+	 * ReedSolomonCode::decode(SmallBinaryFieldPolynomial&,const SmallBinaryFieldPolynomial&,const SmallBinaryFieldPolynomial&,int,int)
+	 *            \endlink
+	 *            such that a classical decoding attempt can precede the
+	 *            list decoding attempts without computing them twice.
 	 */
 	class THIMBLE_DLL GuruswamiSudanDecoder {
 
@@ -269,6 +295,132 @@ namespace thimble {
 		( const uint32_t *x , const uint32_t *y ,
 		  int n , int k , int m , const SmallBinaryField & gf );
 
+		/**
+		 * @brief
+		 *            Prepares the decoder for attempts to solve a
+		 *            Reed-Solomon list decoding problem with increasing
+		 *            multiplicities.
+		 *
+		 * @details
+		 *            The pairs <i>(x[i],y[i])</i> are copied and the code
+		 *            locator polynomial
+		 *            \f$\prod_{i=0}^{n-1}(X-x[i])\f$ as well as the
+		 *            polynomial of degree \f$<n\f$ interpolating all pairs
+		 *            are computed; they can be accessed via
+		 *            <code>getLocator()</code> and
+		 *            <code>getInterpolant()</code>, respectively. The
+		 *            multiplicity of the decoder is reset to 0; decoding
+		 *            attempts are performed by successive calls of
+		 *            <code>increaseMultiplicity()</code>.
+		 *
+		 * @param x
+		 *            Reed-Solomon code locators.
+		 *
+		 * @param y
+		 *            (Erroneous) evaluations of the message polynomials on
+		 *            the code locators.
+		 *
+		 * @param n
+		 *            Number of code pairs <i>(x[i],y[i])</i>.
+		 *
+		 * @param k
+		 *            Bound of the length of polynomials that the decoder
+		 *            outputs.
+		 *
+		 * @param gf
+		 *            Specifies the finite field over which the decoder
+		 *            operates.
+		 *
+		 * @warning
+		 *            If <i>n</i> or <i>k</i> are smaller than or equals zero
+		 *            or if <i>k</i> is greater than <i>n</i> then the
+		 *            function prints an error message to
+		 *            <code>stderr</code> and exits with status 'EXIT_FAILURE'.
+		 *
+		 * @warning
+		 *            If <i>x</i> or <i>y</i> do not contain at least <i>n</i>
+		 *            valid elements in the field specified by <code>gf</code>
+		 *            the function runs into undefined behavior.
+		 */
+		void prepare
+		( const uint32_t *x , const uint32_t *y ,
+		  int n , int k , const SmallBinaryField & gf );
+
+		/**
+		 * @brief
+		 *            Attempts to solve the Reed-Solomon list decoding
+		 *            problem given to <code>prepare()</code> with the
+		 *            multiplicity increased by one.
+		 *
+		 * @details
+		 *            If the multiplicity has been 0, the basis of the module
+		 *            of bivariate polynomials passing through the pairs
+		 *            <i>(x[i],y[i])</i> is computed from the polynomials
+		 *            computed by <code>prepare()</code>. Otherwise, the
+		 *            basis for the new multiplicity <i>m+1</i> is obtained
+		 *            by multiplying the basis for the multiplicity <i>m</i>
+		 *            with the basis for multiplicity 1 following Trifonov's
+		 *            merge step; hence, the work for the previous
+		 *            multiplicities is not repeated. Afterwards, the root
+		 *            step is performed as in <code>decode()</code> and the
+		 *            decoded polynomials can be accessed via
+		 *            <code>getDecodedList()</code>.
+		 *
+		 * @return
+		 *            <code>true</code> if at least one polynomial could be
+		 *            reconstructed; otherwise <code>false</code>.
+		 *
+		 * @warning
+		 *            If <code>prepare()</code> has not been called before,
+		 *            the function prints an error message to
+		 *            <code>stderr</code> and exits with status 'EXIT_FAILURE'.
+		 */
+		bool increaseMultiplicity();
+
+		/**
+		 * @brief
+		 *            Access the multiplicity of the latest decoding attempt
+		 *            performed by <code>increaseMultiplicity()</code>.
+		 *
+		 * @return
+		 *            The current multiplicity or 0 if no attempt has been
+		 *            performed since the last call of <code>prepare()</code>.
+		 */
+		inline int getMultiplicity() const {
+			return this->multiplicity;
+		}
+
+		/**
+		 * @brief
+		 *            Access the code locator polynomial computed by
+		 *            <code>prepare()</code>.
+		 *
+		 * @return
+		 *            The polynomial \f$\prod_{i=0}^{n-1}(X-x[i])\f$.
+		 *
+		 * @warning
+		 *            If <code>prepare()</code> has not been called before,
+		 *            the function prints an error message to
+		 *            <code>stderr</code> and exits with status 'EXIT_FAILURE'.
+		 */
+		const SmallBinaryFieldPolynomial & getLocator() const;
+
+		/**
+		 * @brief
+		 *            Access the interpolating polynomial computed by
+		 *            <code>prepare()</code>.
+		 *
+		 * @return
+		 *            The polynomial of degree \f$<n\f$ interpolating all
+		 *            pairs <i>(x[i],y[i])</i>.
+		 *
+		 * @warning
+		 *            If <code>prepare()</code> has not been called before,
+		 *            the function prints an error message to
+		 *            <code>stderr</code> and exits with status 'EXIT_FAILURE'.
+		 */
+		const SmallBinaryFieldPolynomial & getInterpolant() const;
+
 		/**
 		 * @brief
 		 *            Constructor.
@@ -550,6 +702,102 @@ namespace thimble {
 		 * @see getDecodedList()
 		 */
 		std::vector<SmallBinaryFieldPolynomial> decodedList;
+
+		/**
+		 * @brief
+		 *           Copy of the code locators given to
+		 *           <code>prepare()</code>.
+		 */
+		std::vector<uint32_t> xs;
+
+		/**
+		 * @brief
+		 *           Copy of the code evaluations given to
+		 *           <code>prepare()</code>.
+		 */
+		std::vector<uint32_t> ys;
+
+		/**
+		 * @brief
+		 *           Bound of the length of the decoded polynomials given
+		 *           to <code>prepare()</code>.
+		 */
+		int k;
+
+		/**
+		 * @brief
+		 *           Multiplicity of the latest attempt performed by
+		 *           <code>increaseMultiplicity()</code>.
+		 *
+		 * @see getMultiplicity()
+		 */
+		int multiplicity;
+
+		/**
+		 * @brief
+		 *           Pointer to the code locator polynomial computed by
+		 *           <code>prepare()</code> or <code>NULL</code> if the
+		 *           decoder has not been prepared.
+		 *
+		 * @see getLocator()
+		 */
+		SmallBinaryFieldPolynomial *locatorPtr;
+
+		/**
+		 * @brief
+		 *           Pointer to the interpolating polynomial computed by
+		 *           <code>prepare()</code> or <code>NULL</code> if the
+		 *           decoder has not been prepared.
+		 *
+		 * @see getInterpolant()
+		 */
+		SmallBinaryFieldPolynomial *interpolantPtr;
+
+		/**
+		 * @brief
+		 *           Basis of the bivariate polynomials passing through the
+		 *           prepared pairs with multiplicity 1.
+		 *
+		 * @details
+		 *           Computed on the first call of
+		 *           <code>increaseMultiplicity()</code> after
+		 *           <code>prepare()</code>.
+		 */
+		std::vector<SmallBinaryFieldBivariatePolynomial> basis;
+
+		/**
+		 * @brief
+		 *           Basis of the bivariate polynomials passing through the
+		 *           prepared pairs with multiplicity
+		 *           <code>getMultiplicity()</code>.
+		 */
+		std::vector<SmallBinaryFieldBivariatePolynomial> multiplicityBasis;
+
+		/**
+		 * @brief
+		 *           Keeps the polynomials found in the root step that
+		 *           interpolate at least <i>k+1</i> pairs and sorts them
+		 *           w.r.t. the number of pairs they interpolate.
+		 *
+		 * @param ps
+		 *           The polynomials found in the root step.
+		 *
+		 * @param x
+		 *           Reed-Solomon code locators.
+		 *
+		 * @param y
+		 *           (Erroneous) evaluations of the message polynomials on
+		 *           the code locators.
+		 *
+		 * @param n
+		 *           Number of code pairs <i>(x[i],y[i])</i>.
+		 *
+		 * @param k
+		 *           Bound of the length of the decoded polynomials.
+		 */
+		void setDecodedList
+		( const std::vector<SmallBinaryFieldPolynomial> & ps ,
+		  const uint32_t *x , const uint32_t *y , int n , int k );
 	};
 }
 
@@ -226,6 +226,97 @@ namespace thimble {
 		  const uint32_t *x , const uint32_t *y , int n , int k ) {
 			return gaodecode(f,x,y,n,k);
 		}
+
+		/**
+		 * @brief
+		 *            Attempts to decode a (possibly) perturbed
+		 *            Reed-Solomon code <i>in original view</i> given by
+		 *            its code locator and interpolating polynomial using
+		 *            an algorithm by <b>Gao (2002)</b>.
+		 *
+		 * @details
+		 *            Does the same as
+		 *            <code>gaodecode(f,x,y,n,k)</code> where
+		 *            <code>locator</code> is the polynomial
+		 *            \f$\prod_{i=0}^{n-1}(X-x[i])\f$ and
+		 *            <code>interpolant</code> is the polynomial of degree
+		 *            \f$<n\f$ with <i>interpolant(x[i])=y[i]</i>. This is
+		 *            useful if the polynomials are needed elsewhere, e.g.,
+		 *            by a subsequent list decoding attempt (see
+		 *            <code>GuruswamiSudanDecoder::prepare()</code>), such
+		 *            that they are computed only once.
+		 *
+		 * @param f
+		 *            On success, <i>f</i> will contain the decoded message
+		 *            polynomial.
+		 *
+		 * @param locator
+		 *            The code locator polynomial.
+		 *
+		 * @param interpolant
+		 *            The polynomial interpolating the received vector.
+		 *
+		 * @param n
+		 *            Length of the Reed-Solomon code.
+		 *
+		 * @param k
+		 *            Size of the Reed-Solomon code.
+		 *
+		 * @return
+		 *            <code>true</code> if decoding the received vector
+		 *            was successful and <code>false</code> otherwise.
+		 *
+		 * @warning
+		 *            If <i>n<=0</i>, <i>k<=0</i>, or <i>k>n</i>, the
+		 *            function prints an error message to <code>stderr</code>
+		 *            and exits with status 'EXIT_FAILURE'.
+		 */
+		static bool gaodecode
+		( SmallBinaryFieldPolynomial & f ,
+		  const SmallBinaryFieldPolynomial & locator ,
+		  const SmallBinaryFieldPolynomial & interpolant , int n , int k );
+
+		/**
+		 * @brief
+		 *            Attempts to decode a (possibly perturbed)
+		 *            Reed-Solomon code <i>in original view</i> given by
+		 *            its code locator and interpolating polynomial.
+		 *
+		 * @details
+		 *            Currently, the function just passes the arguments to
+		 *            <code>gaodecode()</code> and returns its result.
+		 *
+		 * @param f
+		 *            On success, <i>f</i> will contain the decoded message
+		 *            polynomial.
+		 *
+		 * @param locator
+		 *            The code locator polynomial.
+		 *
+		 * @param interpolant
+		 *            The polynomial interpolating the received vector.
+		 *
+		 * @param n
+		 *            Length of the Reed-Solomon code.
+		 *
+		 * @param k
+		 *            Size of the Reed-Solomon code.
+		 *
+		 * @return
+		 *            <code>true</code> if decoding the received vector
+		 *            was successful and <code>false</code> otherwise.
+		 *
+		 * @warning
+		 *            If <i>n<=0</i>, <i>k<=0</i>, or <i>k>n</i>, the
+		 *            function prints an error message to <code>stderr</code>
+		 *            and exits with status 'EXIT_FAILURE'.
+		 */
+		inline static bool decode
+		( SmallBinaryFieldPolynomial & f ,
+		  const SmallBinaryFieldPolynomial & locator ,
+		  const SmallBinaryFieldPolynomial & interpolant , int n , int k ) {
+			return gaodecode(f,locator,interpolant,n,k);
+		}
 	};
 }
 
@@ -314,6 +314,70 @@ namespace thimble {
 		 * FingerTools::dist(const MinutiaeView&,const MinutiaeView&,int,double)
 		 *            \endlink.
 		 *            <br><br>
+		 *            The candidate alignments are selected by a generalized
+		 *            Hough transform: Each of the <i>k*l</i> minutiae
+		 *            correspondences between <i>v</i> and <i>w</i>, where
+		 *            <i>k=v.getMinutiaeCount()</i> and
+		 *            <i>l=w.getMinutiaeCount()</i>, votes for the movement
+		 *            that maps the <i>j</i>th minutia <i>b</i> of <i>w</i>
+		 *            to the <i>i</i>th minutia <i>a</i> of <i>v</i>, i.e.
+		 *            for
+		 *            <pre>
+		 *           AffineTransform f = FingerTools::align(a,b)
+		 *            </pre>
+		 *            in an accumulator over quantized rotation angles and
+		 *            translations. Only the correspondences that voted for
+		 *            the top-scoring bins or their neighboring bins are
+		 *            evaluated as candidates. Consequently, the result can
+		 *            differ from the one of
+		 *            \link
+		 *  alignExhaustively(const MinutiaeView&,const MinutiaeView&,int,double)
+		 *            \endlink
+		 *            if the best candidate does not lay in one of these bins.
+		 *
+		 * @param v
+		 *            First minutiae template.
+		 *
+		 * @param w
+		 *            Second minutiae template.
+		 *
+		 * @param n
+		 *            Controls the number of minutiae correspondences that
+		 *            are taken into account.
+		 *
+		 * @param angleWeight
+		 *            Controls how significant the minutiae angles are taken
+		 *            into account.
+		 *
+		 * @return
+		 *            Spatial movement that aligns the minutiae template
+		 *            <i>w</i> to <i>v</i>.
+		 *
+		 * @warning
+		 *            If not sufficient memory could be allocated the function
+		 *            prints an error message to <code>stderr</code> and exits
+		 *            with status 'EXIT_FAILURE'.
+		 */
+		static AffineTransform align
+		( const MinutiaeView & v , const MinutiaeView & w ,
+		  int n = 5 , double angleWeight = 11.459 );
+
+		/**
+		 * @brief
+		 *            Determines a spatial movement as an affine transform
+		 *            that aligns the minutiae in <code>w</code> to the
+		 *            minutiae in <code>v</code> by examining all minutiae
+		 *            correspondences.
+		 *
+		 * @details
+		 *            Among multiple candidates for spatial movements <i>f</i>,
+		 *            the function determines the one that minimizes the
+		 *            dissimilarity between <i>v</i> and <i>f(w)</i>. Thereby
+		 *            the dissimilarity between <i>v</i> and <i>f(w)</i> is
+		 *            given by \link
+		 * FingerTools::dist(const MinutiaeView&,const MinutiaeView&,int,double)
+		 *            \endlink.
+		 *            <br><br>
 		 *            The candidate alignments are achieved from all minutiae
 		 *            correspondences between <i>v</i> and <i>w</i> which
 		 *            is of number <i>k*l</i> in total, where
@@ -324,8 +388,13 @@ namespace thimble {
 		 *            candidate alignment is given by the movement that maps
 		 *            <i>b</i> to <i>a</i>, i.e. by
 		 *            <pre>
-		 *           AffineTransform f = FingerTools::align(a,b,n,angleWeight)
+		 *           AffineTransform f = FingerTools::align(a,b)
 		 *            </pre>
+		 *            Since each candidate is evaluated, the running time is
+		 *            quadratic in <i>k*l</i>; for a faster alternative see
+		 *            \link
+		 *  align(const MinutiaeView&,const MinutiaeView&,int,double)
+		 *            \endlink.
 		 *
 		 * @param v
 		 *            First minutiae template.
@@ -350,7 +419,7 @@ namespace thimble {
 		 *            prints an error message to <code>stderr</code> and exits
 		 *            with status 'EXIT_FAILURE'.
 		 */
-		static AffineTransform align
+		static AffineTransform alignExhaustively
 		( const MinutiaeView & v , const MinutiaeView & w ,
 		  int n = 5 , double angleWeight = 11.459 );
 
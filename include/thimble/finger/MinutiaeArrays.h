@@ -0,0 +1,464 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file MinutiaeArrays.h
+ *
+ * @brief
+ *            Provides a class storing the minutiae of a template in
+ *            separate arrays for their coordinates, angles, types, and
+ *            qualities.
+ *
+ * @author agent
+ */
+
+#ifndef THIMBLE_MINUTIAEARRAYS_H_
+#define THIMBLE_MINUTIAEARRAYS_H_
+
+#include <vector>
+
+#include <thimble/dllcompat.h>
+#include <thimble/math/AffineTransform.h>
+#include <thimble/image/Orientation.h>
+#include <thimble/finger/MinutiaeRecord.h>
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/**
+	 * @brief
+	 *            Minutiae template stored as a structure of arrays.
+	 *
+	 * @details
+	 *            A \link MinutiaeView\endlink stores its minutiae as an
+	 *            array of \link Minutia\endlink objects. Functions that
+	 *            process all minutiae of a template in bulk, such as
+	 *            moving them by a spatial movement or computing distances
+	 *            between templates, benefit from having the positions and
+	 *            angles in contiguous arrays instead: no minutiae need to be
+	 *            constructed and the loops can be vectorized by the
+	 *            compiler.
+	 *            <br><br>
+	 *            An instance can be created from a view via
+	 *            <pre>
+	 *             MinutiaeArrays a(view);
+	 *            </pre>
+	 *            then be processed in place, e.g., by
+	 *            <pre>
+	 *             a.transform(f);
+	 *            </pre>
+	 *            and be converted back via
+	 *            <pre>
+	 *             MinutiaeView u = a.toView();
+	 *            </pre>
+	 *            The results coincide with those of the corresponding
+	 *            functions in \link FingerTools\endlink, which use this
+	 *            class internally.
+	 */
+	class THIMBLE_DLL MinutiaeArrays {
+
+		friend class MinutiaeRecordView;
+
+	private:
+
+		/**
+		 * @brief
+		 *            The finger position adopted from the view.
+		 */
+		FINGER_POSITION_T fingerPosition;
+
+		/**
+		 * @brief
+		 *            The view number adopted from the view.
+		 */
+		int viewNumber;
+
+		/**
+		 * @brief
+		 *            The impression type adopted from the view.
+		 */
+		FINGER_IMPRESSION_TYPE_T impressionType;
+
+		/**
+		 * @brief
+		 *            The finger quality adopted from the view.
+		 */
+		int fingerQuality;
+
+		/**
+		 * @brief
+		 *            Abscissas of the minutiae.
+		 */
+		std::vector<double> x;
+
+		/**
+		 * @brief
+		 *            Ordinates of the minutiae.
+		 */
+		std::vector<double> y;
+
+		/**
+		 * @brief
+		 *            Angles of the minutiae, each in the range between 0
+		 *            (inclusive) and <i>2*PI</i> (exclusive).
+		 */
+		std::vector<double> angles;
+
+		/**
+		 * @brief
+		 *            Types of the minutiae.
+		 */
+		std::vector<MINUTIA_TYPE_T> types;
+
+		/**
+		 * @brief
+		 *            Qualities of the minutiae.
+		 */
+		std::vector<int> qualities;
+
+	public:
+
+		/**
+		 * @brief
+		 *            Creates an empty template with the same default
+		 *            attributes as an empty \link MinutiaeView\endlink.
+		 */
+		MinutiaeArrays();
+
+		/**
+		 * @brief
+		 *            Creates the arrays of the minutiae of a view.
+		 *
+		 * @param view
+		 *            The view whose minutiae and attributes are adopted.
+		 */
+		MinutiaeArrays( const MinutiaeView & view );
+
+		/**
+		 * @brief
+		 *            Replaces the content of this instance by the
+		 *            minutiae and attributes of a view.
+		 *
+		 * @param view
+		 *            The view whose minutiae and attributes are adopted.
+		 */
+		void assign( const MinutiaeView & view );
+
+		/**
+		 * @brief
+		 *            Replaces the content of this instance by the minutiae
+		 *            of another instance moved by a spatial movement.
+		 *
+		 * @details
+		 *            The positions are mapped by <code>f</code> and the
+		 *            rotation angle of <code>f</code> is added to the angles
+		 *            which are then normalized to the range between 0 and
+		 *            <i>2*PI</i> in the same way as by \link Minutia\endlink.
+		 *            Thus, the result coincides with the minutiae of
+		 *            <code>FingerTools::eval(f,a.toView())</code>. If
+		 *            this instance has enough capacity, no memory is
+		 *            allocated; <code>a</code> may be this instance.
+		 *
+		 * @param a
+		 *            The moved minutiae.
+		 *
+		 * @param f
+		 *            The spatial movement.
+		 */
+		void assign( const MinutiaeArrays & a , const AffineTransform & f );
+
+		/**
+		 * @brief
+		 *            Converts the instance to a minutiae view.
+		 *
+		 * @return
+		 *            A view containing the minutiae of this instance with
+		 *            its attributes.
+		 */
+		MinutiaeView toView() const;
+
+		/**
+		 * @brief
+		 *            Accesses the number of minutiae.
+		 *
+		 * @return
+		 *            The number of minutiae.
+		 */
+		inline int getMinutiaeCount() const {
+			return (int)this->x.size();
+		}
+
+		/**
+		 * @brief
+		 *            Constructs the <i>i</i>th minutia.
+		 *
+		 * @param i
+		 *            Index of the minutia.
+		 *
+		 * @return
+		 *            The <i>i</i>th minutia.
+		 *
+		 * @warning
+		 *            If <code>i</code> is negative or not smaller than
+		 *            <code>getMinutiaeCount()</code>, an error message is
+		 *            printed to <code>stderr</code> and the program exits
+		 *            with status 'EXIT_FAILURE'.
+		 */
+		Minutia getMinutia( int i ) const;
+
+		/**
+		 * @brief
+		 *            Appends a minutia.
+		 *
+		 * @param minutia
+		 *            The appended minutia.
+		 */
+		void addMinutia( const Minutia & minutia );
+
+		/**
+		 * @brief
+		 *            Removes all minutiae.
+		 */
+		void removeAllMinutiae();
+
+		/**
+		 * @brief
+		 *            Reserves the specified capacity of minutiae.
+		 *
+		 * @param capacity
+		 *            The capacity in terms of number of minutiae.
+		 */
+		void ensureCapacity( int capacity );
+
+		/**
+		 * @brief
+		 *            Accesses the array of abscissas.
+		 *
+		 * @return
+		 *            Array of <code>getMinutiaeCount()</code> abscissas.
+		 */
+		inline const double *getX() const {
+			return this->x.empty() ? NULL : &(this->x[0]);
+		}
+
+		/**
+		 * @brief
+		 *            Accesses the array of ordinates.
+		 *
+		 * @return
+		 *            Array of <code>getMinutiaeCount()</code> ordinates.
+		 */
+		inline const double *getY() const {
+			return this->y.empty() ? NULL : &(this->y[0]);
+		}
+
+		/**
+		 * @brief
+		 *            Accesses the array of angles.
+		 *
+		 * @return
+		 *            Array of <code>getMinutiaeCount()</code> angles.
+		 */
+		inline const double *getAngles() const {
+			return this->angles.empty() ? NULL : &(this->angles[0]);
+		}
+
+		/**
+		 * @brief
+		 *            Moves all minutiae by a spatial movement.
+		 *
+		 * @details
+		 *            Equivalent to <code>assign(*this,f)</code>.
+		 *
+		 * @param f
+		 *            The spatial movement.
+		 */
+		void transform( const AffineTransform & f );
+
+		/**
+		 * @brief
+		 *            Represents all minutiae w.r.t. a directed reference
+		 *            point.
+		 *
+		 * @details
+		 *            The result coincides with the minutiae of
+		 *            <code>FingerTools::prealign(v,x,y,direction)</code>.
+		 *
+		 * @param x
+		 *            The x-coordinate of the directed reference point.
+		 *
+		 * @param y
+		 *            The y-coordinate of the directed reference point.
+		 *
+		 * @param direction
+		 *            The direction of the directed reference point.
+		 */
+		void prealign( double x , double y , double direction );
+
+		/**
+		 * @brief
+		 *            Represents all minutiae w.r.t. a directed reference
+		 *            point.
+		 *
+		 * @param p
+		 *            The directed reference point.
+		 */
+		void prealign( const DirectedPoint & p );
+
+		/**
+		 * @brief
+		 *            Quantizes the positions and angles of all minutiae.
+		 *
+		 * @details
+		 *            The positions are rounded to integers and the angles
+		 *            to multiples of <i>2*PI/angleQuanta</i>. With the
+		 *            default of 256 quanta, the minutiae are quantized in
+		 *            the same way as when they are written in
+		 *            ISO 19794-2:2005 format.
+		 *
+		 * @param angleQuanta
+		 *            Number of quanta of the angles.
+		 *
+		 * @warning
+		 *            If <code>angleQuanta</code> is not positive, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		void quantize( int angleQuanta = 256 );
+
+		/**
+		 * @brief
+		 *            Returns a measure of dissimilarity between the
+		 *            <i>i</i>th minutia of <i>v</i> and the <i>j</i>th
+		 *            minutia of <i>w</i>.
+		 *
+		 * @details
+		 *            The result is the same as of
+		 *            <code>FingerTools::dist(v.getMinutia(i),
+		 *            w.getMinutia(j),angleWeight)</code>.
+		 *
+		 * @param v
+		 *            First template.
+		 *
+		 * @param i
+		 *            Index of the minutia in <i>v</i>.
+		 *
+		 * @param w
+		 *            Second template.
+		 *
+		 * @param j
+		 *            Index of the minutia in <i>w</i>.
+		 *
+		 * @param angleWeight
+		 *            Controls how significant the minutiae angles are taken
+		 *            into account.
+		 *
+		 * @return
+		 *            Dissimilarity between the minutiae.
+		 */
+		static double dist
+		( const MinutiaeArrays & v , int i ,
+		  const MinutiaeArrays & w , int j , double angleWeight );
+
+		/**
+		 * @brief
+		 *            Computes a similarity measure between two minutiae
+		 *            templates.
+		 *
+		 * @details
+		 *            The result is the same as of
+		 * FingerTools::dist(const MinutiaeView&,const MinutiaeView&,int,double)
+		 *            applied to the views of <i>v</i> and <i>w</i>.
+		 *
+		 * @param v
+		 *            First template.
+		 *
+		 * @param w
+		 *            Second template.
+		 *
+		 * @param n
+		 *            Controls the number of minutiae correspondences that
+		 *            are taken into account.
+		 *
+		 * @param angleWeight
+		 *            Controls how significant the minutiae angles are taken
+		 *            into account.
+		 *
+		 * @return
+		 *            Dissimilarity between <i>v</i> and <i>w</i>.
+		 *
+		 * @warning
+		 *            If not sufficient memory could be allocated the function
+		 *            prints an error message to <code>stderr</code> and exits
+		 *            with status 'EXIT_FAILURE'.
+		 */
+		static double dist
+		( const MinutiaeArrays & v , const MinutiaeArrays & w ,
+		  int n = 5 , double angleWeight = 11.459 );
+
+		/**
+		 * @brief
+		 *            Computes a similarity measure between two minutiae
+		 *            templates using a pre-allocated array.
+		 *
+		 * @details
+		 *            Does the same as
+		 *  dist(const MinutiaeArrays&,const MinutiaeArrays&,int,double)
+		 *            but, to avoid frequent allocations when many
+		 *            dissimilarities are computed, with a pre-allocated
+		 *            array <code>distances</code> and the number <i>m</i> of
+		 *            summands specified explicitly.
+		 *
+		 * @param v
+		 *            First template.
+		 *
+		 * @param w
+		 *            Second template.
+		 *
+		 * @param m
+		 *            Number of minutiae correspondences between <i>v</i> and
+		 *            <i>w</i> that are taken into account; must be positive
+		 *            and not larger than the number of minutiae of either
+		 *            template.
+		 *
+		 * @param angleWeight
+		 *            Controls how significant the minutiae angles are taken
+		 *            into account.
+		 *
+		 * @param distances
+		 *            Pre-allocated array that can hold <i>m</i>
+		 *            <code>double</code> values for internal use.
+		 *
+		 * @return
+		 *            Dissimilarity between <i>v</i> and <i>w</i>.
+		 *
+		 * @warning
+		 *            If the prerequisites on <i>m</i> are not satisfied,
+		 *            the behavior of the function is undocumented.
+		 */
+		static double dist
+		( const MinutiaeArrays & v , const MinutiaeArrays & w ,
+		  int m , double angleWeight , double *distances );
+	};
+}
+
+#endif /* THIMBLE_MINUTIAEARRAYS_H_ */
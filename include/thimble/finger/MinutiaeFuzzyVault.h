@@ -387,6 +387,180 @@ namespace thimble {
 		 */
 		uint32_t hash[5];
 
+		/**
+		 * @brief
+		 *           Side length of the square cells of the grid by which
+		 *           the vault minutiae are indexed w.r.t. their position.
+		 *
+		 * @see buildGrid()
+		 */
+		double gridCellSize;
+
+		/**
+		 * @brief
+		 *           Number of columns of the grid indexing the vault
+		 *           minutiae.
+		 *
+		 * @see buildGrid()
+		 */
+		int gridCols;
+
+		/**
+		 * @brief
+		 *           Number of rows of the grid indexing the vault
+		 *           minutiae.
+		 *
+		 * @see buildGrid()
+		 */
+		int gridRows;
+
+		/**
+		 * @brief
+		 *           Index of the first vault minutia in each of the grid's
+		 *           cells or -1 if the cell is empty.
+		 *
+		 * @details
+		 *           The vault minutiae located in the cell of column
+		 *           <i>cx</i> and row <i>cy</i> form a list starting at
+		 *           <code>gridHead[c]</code> where <i>c=cy*gridCols+cx</i>
+		 *           and linked via \link gridNext\endlink.
+		 *
+		 * @see buildGrid()
+		 */
+		std::vector<int> gridHead;
+
+		/**
+		 * @brief
+		 *           Index of the vault minutia following the <i>i</i>th
+		 *           vault minutia in the list of its grid cell or -1 if
+		 *           it is the last one.
+		 *
+		 * @see gridHead
+		 */
+		std::vector<int> gridNext;
+
+		/**
+		 * @brief
+		 *           Determines the grid cell of a minutia.
+		 *
+		 * @details
+		 *           Minutiae outside the region of the vault are assigned
+		 *           to the closest cell at the border.
+		 *
+		 * @param minutia
+		 *           The minutia.
+		 *
+		 * @return
+		 *           The index <i>c=cy*gridCols+cx</i> of the cell of
+		 *           column <i>cx</i> and row <i>cy</i> containing the
+		 *           minutia's position.
+		 */
+		int gridCell( const Minutia & minutia ) const;
+
+		/**
+		 * @brief
+		 *           Indexes the vault minutiae in a grid w.r.t. their
+		 *           position.
+		 *
+		 * @details
+		 *           The cells are chosen such that, on average, each cell
+		 *           contains about one vault minutia of a full vault of
+		 *           size <code>getVaultSize()</code>. The method is called
+		 *           on enrollment before the chaff minutiae are generated
+		 *           and again after the vault minutiae have been sorted.
+		 */
+		void buildGrid();
+
+		/**
+		 * @brief
+		 *           Adds the last vault minutia to the grid.
+		 *
+		 * @details
+		 *           Must be called each time a minutia is appended to the
+		 *           vault minutiae after \link buildGrid()\endlink has
+		 *           been called.
+		 */
+		void addToGrid();
+
+		/**
+		 * @brief
+		 *           Determines the vault minutia nearest to the given
+		 *           minutia within a maximal distance.
+		 *
+		 * @details
+		 *           Among all vault minutiae <i>v</i> with
+		 *           <code>dist(minutia,v)<=maxDistance</code> the one of
+		 *           minimal distance is returned, where ties are resolved
+		 *           in favour of the smaller index. Since the distance is at
+		 *           least the Euclidean distance of the minutiae positions,
+		 *           only the vault minutiae in the grid cells within a
+		 *           radius of <code>maxDistance</code> are visited.
+		 *
+		 * @param minutia
+		 *           The minutia for which the nearest vault minutia is
+		 *           sought.
+		 *
+		 * @param maxDistance
+		 *           The maximal distance.
+		 *
+		 * @return
+		 *           The index of the nearest vault minutia or -1 if no
+		 *           vault minutia is within distance
+		 *           <code>maxDistance</code>.
+		 */
+		int findNearestVaultMinutia
+		( const Minutia & minutia , double maxDistance ) const;
+
+		/**
+		 * @brief
+		 *           Checks whether a chaff candidate keeps the minimal
+		 *           inter-vault distance to all vault minutiae.
+		 *
+		 * @details
+		 *           The candidate is accepted if
+		 *           <code>dist(v,chaff)</code> is larger than
+		 *           <code>getMinimalInterVaultDistance()</code> for all
+		 *           vault minutiae <i>v</i>; only the vault minutiae in
+		 *           nearby grid cells are visited.
+		 *
+		 * @param chaff
+		 *           The chaff candidate.
+		 *
+		 * @return
+		 *           <code>true</code> if the candidate keeps the distance;
+		 *           otherwise <code>false</code>.
+		 */
+		bool keepsMinimalInterVaultDistance( const Minutia & chaff ) const;
+
+		/**
+		 * @brief
+		 *           Determines for the first <i>t</i> minutiae of a query
+		 *           template the vault minutiae they match with.
+		 *
+		 * @details
+		 *           For each query minutia, the vault minutia of minimal
+		 *           distance is determined, where ties are resolved in
+		 *           favour of the smaller index; if the distance is larger
+		 *           than <code>getMaximalMatchDistance()</code> the query
+		 *           minutia does not match.
+		 *
+		 * @see findNearestVaultMinutia()
+		 *
+		 * @param indices
+		 *           Will contain <i>t</i> integers where
+		 *           <code>indices[i]</code> is the index of the vault
+		 *           minutia matching the <i>i</i>th query minutia or -1
+		 *           if there is none.
+		 *
+		 * @param view
+		 *           The query template.
+		 *
+		 * @param t
+		 *           The number of query minutiae.
+		 */
+		void matchVaultMinutiae
+		( int *indices , const MinutiaeView & view , int t ) const;
+
 	public:
 
 		/**
@@ -452,7 +626,12 @@ namespace thimble {
 		 *           random chaff minutiae that lay within the specified region
 		 *           are generated such that they keep mutual distance
 		 *           of \f$\delta_1\f$ to each other as well as to selected
-		 *           minutiae.
+		 *           minutiae. The candidates for chaff minutiae are drawn
+		 *           uniformly from the region (see
+		 *           <code>generateChaffMinutia()</code>) such that their
+		 *           positions do not depend on the selected minutiae; the
+		 *           distance of a candidate to the vault minutiae is
+		 *           checked only against those in nearby cells of a grid.
 		 *           <br><br>
 		 *           5. The selected genuine minutiae and chaff minutiae are
 		 *           put in a list which is sorted w.r.t. lexicographical.
@@ -529,11 +708,14 @@ namespace thimble {
 		 *           <code>enroll()</code>).
 		 *           <br><br>
 		 *           2. For each selected query minutiae its nearest vault
-		 *           minutia is determined.
+		 *           minutia is determined; only vault minutiae close to the
+		 *           query minutia are examined via a grid built on
+		 *           enrollment.
 		 *           <br><br>
 		 *           3. If the distance is at most \f$\delta_2\f$=
 		 *           <code>getMaximalMatchDistance()</code> the corresponding
-		 *           vault point is included in the unlocking set.
+		 *           vault point is included in the unlocking set unless it
+		 *           already has been included.
 		 *           <br><br>
 		 *           4. Then the function attempts to decoded the secret
 		 *           polynomial from the unlocking set. Therefore, the
@@ -253,6 +253,7 @@ namespace thimble {
 
 		friend class MinutiaeView;
 		friend class MinutiaeRecord;
+		friend class MinutiaeRecordView;
 
 	private:
 
@@ -611,6 +612,8 @@ namespace thimble {
 	class THIMBLE_DLL MinutiaeView {
 
 		friend class MinutiaeRecord;
+		friend class MinutiaeArrays;
+		friend class MinutiaeRecordView;
 
 	private:
 
@@ -693,6 +696,26 @@ namespace thimble {
 		 */
 		bool write( FILE *out ) const;
 
+		/**
+		 * @brief
+		 *            Writes the minutiae view to the specified memory.
+		 *
+		 * @param data
+		 *            Receives the \link getSizeInBytes()\endlink bytes of
+		 *            the view.
+		 *
+		 * @return
+		 *            The number of bytes written or -1 if any of the
+		 *            minutiae coordinates is negative or can not be
+		 *            recorded in 14 bits.
+		 *
+		 * @warning
+		 *            If <code>data</code> can not hold
+		 *            \link getSizeInBytes()\endlink bytes, the behavior
+		 *            of the function is undocumented.
+		 */
+		int write( void *data ) const;
+
 		/**
 		 * @brief Reads a minutiae view's data from the specified
 		 *        <code>FILE</code> and stores the result in this view.
@@ -1070,6 +1093,8 @@ namespace thimble {
 	 */
 	class THIMBLE_DLL MinutiaeRecord {
 
+		friend class MinutiaeRecordView;
+
 	private:
 
 		/**
@@ -1402,6 +1427,34 @@ namespace thimble {
 		 */
 		int getSizeInBytes() const;
 
+		/**
+		 * @brief
+		 *            Writes the minutiae record to the specified memory.
+		 *
+		 * @details
+		 *            The record is serialized directly into the caller's
+		 *            buffer in the same format as written by
+		 *            \link write(FILE*) const\endlink and can be accessed
+		 *            without copying via a
+		 *            \link MinutiaeRecordView\endlink.
+		 *
+		 * @param data
+		 *            The buffer receiving the record.
+		 *
+		 * @param capacity
+		 *            The number of bytes that can be written to
+		 *            <code>data</code>.
+		 *
+		 * @return
+		 *            The number of bytes written, i.e.,
+		 *            \link getSizeInBytes()\endlink, or -1 if
+		 *            <code>capacity</code> is too small, if a view
+		 *            contains more than 255 minutiae, or if any of the
+		 *            minutiae coordinates is negative or can not be
+		 *            recorded in 14 bits.
+		 */
+		int toBytes( void *data , int capacity ) const;
+
 		/**
 		 * @brief
 		 *            Writes the minutiae record to the specified binary
@@ -1479,6 +1532,12 @@ namespace thimble {
 		 * @brief    Reads a minutiae record from the specified
 		 *           data array.
 		 *
+		 * @details
+		 *           To access records in memory without building
+		 *           \link MinutiaeView\endlink objects or to guard
+		 *           against truncated data, a
+		 *           \link MinutiaeRecordView\endlink can be used.
+		 *
 		 * @param data
 		 *           Contains the data of the specified minutiae record
 		 *
@@ -0,0 +1,684 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file MinutiaeRecordArchive.h
+ *
+ * @brief
+ *            Provides classes for packing large collections of minutiae
+ *            records in ISO 19794-2:2005 format into a single indexed
+ *            archive file and for accessing them.
+ *
+ * @author agent
+ */
+
+#ifndef THIMBLE_MINUTIAERECORDARCHIVE_H_
+#define THIMBLE_MINUTIAERECORDARCHIVE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <thimble/dllcompat.h>
+#include <thimble/finger/MinutiaeRecord.h>
+#include <thimble/finger/MinutiaeRecordView.h>
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/**
+	 * @brief
+	 *            Gives read access to an archive of minutiae records
+	 *            as written by a
+	 *            \link MinutiaeRecordArchiveWriter\endlink.
+	 *
+	 * @details
+	 *            An archive concatenates the unmodified ISO 19794-2:2005
+	 *            encodings of its records and appends an index listing
+	 *            for each record its offset, its size, its name as well
+	 *            as the finger position and finger quality of its first
+	 *            finger view. All multi-byte fields are big-endian:
+	 *            <pre>
+	 *             header (24 bytes):
+	 *                "FMRA" | version (2) | reserved (2) |
+	 *                record count (4) | index offset (8) |
+	 *                size of the name table (4)
+	 *             record data:
+	 *                the records' bytes concatenated in order
+	 *             index (24 bytes per record):
+	 *                offset (8) | size (4) | name offset (4) |
+	 *                name length (2) | finger position (1) |
+	 *                finger quality (1) | reserved (4)
+	 *             name table:
+	 *                the records' names concatenated
+	 *            </pre>
+	 *            Opening an archive only validates its index; a
+	 *            record is parsed not before it is accessed, e.g., via
+	 *            <pre>
+	 *             MinutiaeRecordArchive archive;
+	 *             MinutiaeRecordView view;
+	 *             if ( archive.read("gallery.fmra") ) {
+	 *                for ( int i = 0 ; i < archive.getRecordCount() ; i++ ) {
+	 *                   if ( archive.getRecord(view,i) ) {
+	 *                      ...
+	 *                   }
+	 *                }
+	 *             }
+	 *            </pre>
+	 *            Because the records are stored contiguously in the
+	 *            order of the index, the archive can be split into
+	 *            parts of roughly equal size to be processed by
+	 *            different threads, see
+	 *            \link getPartition()\endlink; all reading methods are
+	 *            <code>const</code> and can be called concurrently.
+	 */
+	class THIMBLE_DLL MinutiaeRecordArchive {
+
+	private:
+
+		/**
+		 * @brief
+		 *            Buffer owned by the archive if it has been read
+		 *            from a file; otherwise <code>NULL</code>.
+		 */
+		uint8_t *buffer;
+
+		/**
+		 * @brief
+		 *            The archive's data.
+		 */
+		const uint8_t *data;
+
+		/**
+		 * @brief
+		 *            The size of the archive's data in bytes.
+		 */
+		size_t size;
+
+		/**
+		 * @brief
+		 *            The number of records in the archive.
+		 */
+		int count;
+
+		/**
+		 * @brief
+		 *            Points to the first entry of the archive's index.
+		 */
+		const uint8_t *index;
+
+		/**
+		 * @brief
+		 *            Points to the archive's name table.
+		 */
+		const uint8_t *names;
+
+		/**
+		 * @brief
+		 *            Aborts the program with an error message if the
+		 *            specified record index is out of range.
+		 *
+		 * @param i
+		 *            The index of a record.
+		 */
+		void checkIndex( int i ) const;
+
+		/**
+		 * @brief
+		 *            Copy constructor which is not supported.
+		 */
+		MinutiaeRecordArchive( const MinutiaeRecordArchive & );
+
+		/**
+		 * @brief
+		 *            Assignment operator which is not supported.
+		 */
+		MinutiaeRecordArchive &operator=( const MinutiaeRecordArchive & );
+
+	public:
+
+		/**
+		 * @brief
+		 *            Creates an empty archive.
+		 */
+		MinutiaeRecordArchive();
+
+		/**
+		 * @brief
+		 *            Destructor.
+		 */
+		~MinutiaeRecordArchive();
+
+		/**
+		 * @brief
+		 *            Accesses an archive held in memory without copying
+		 *            it.
+		 *
+		 * @details
+		 *            The archive's header and index are validated; the
+		 *            records themselves are validated not before they
+		 *            are accessed. The data must remain valid and
+		 *            unmodified as long as it is accessed through this
+		 *            object; it can, for example, be a memory mapped
+		 *            archive file.
+		 *
+		 * @param data
+		 *            The data of the archive.
+		 *
+		 * @param size
+		 *            The size of the data in bytes.
+		 *
+		 * @return
+		 *            <code>true</code> if the data is a well-formed
+		 *            archive; otherwise, if <code>false</code>, the
+		 *            object is left empty.
+		 */
+		bool assign( const void *data , size_t size );
+
+		/**
+		 * @brief
+		 *            Reads an archive file into memory.
+		 *
+		 * @details
+		 *            The file is read by a single call of
+		 *            <code>fread()</code> into a buffer owned by this
+		 *            object and then validated as by
+		 *            \link assign()\endlink.
+		 *
+		 * @param path
+		 *            Path to the archive file.
+		 *
+		 * @return
+		 *            <code>true</code> if the file could be read and
+		 *            is a well-formed archive; otherwise
+		 *            <code>false</code>.
+		 */
+		bool read( const std::string & path );
+
+		/**
+		 * @brief
+		 *            Resets the archive to be empty and releases the
+		 *            memory held by it.
+		 */
+		void clear();
+
+		/**
+		 * @brief
+		 *            Returns the number of records in the archive.
+		 *
+		 * @return
+		 *            The number of records in the archive.
+		 */
+		inline int getRecordCount() const {
+			return this->count;
+		}
+
+		/**
+		 * @brief
+		 *            Returns the data of the <i>i</i>th record.
+		 *
+		 * @param i
+		 *            The index of the record.
+		 *
+		 * @return
+		 *            Pointer to the ISO 19794-2:2005 encoding of the
+		 *            record which is valid as long as the archive's
+		 *            data is.
+		 *
+		 * @warning
+		 *            If <i>i</i> is out of range, an error message is
+		 *            printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		const uint8_t *getRecordData( int i ) const;
+
+		/**
+		 * @brief
+		 *            Returns the size of the <i>i</i>th record in
+		 *            bytes.
+		 *
+		 * @param i
+		 *            The index of the record.
+		 *
+		 * @return
+		 *            The size of the record's encoding in bytes.
+		 *
+		 * @warning
+		 *            If <i>i</i> is out of range, an error message is
+		 *            printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		int getRecordSize( int i ) const;
+
+		/**
+		 * @brief
+		 *            Returns the name of the <i>i</i>th record.
+		 *
+		 * @param i
+		 *            The index of the record.
+		 *
+		 * @return
+		 *            The name under which the record has been added
+		 *            to the archive; may be empty.
+		 *
+		 * @warning
+		 *            If <i>i</i> is out of range, an error message is
+		 *            printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		std::string getName( int i ) const;
+
+		/**
+		 * @brief
+		 *            Returns the finger position of the first finger
+		 *            view of the <i>i</i>th record as stored in the
+		 *            index.
+		 *
+		 * @param i
+		 *            The index of the record.
+		 *
+		 * @return
+		 *            The finger position of the record's first view
+		 *            or \link UNKNOWN_FINGER\endlink if the record
+		 *            contains no view.
+		 *
+		 * @warning
+		 *            If <i>i</i> is out of range, an error message is
+		 *            printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		FINGER_POSITION_T getFingerPosition( int i ) const;
+
+		/**
+		 * @brief
+		 *            Returns the finger quality of the first finger
+		 *            view of the <i>i</i>th record as stored in the
+		 *            index.
+		 *
+		 * @param i
+		 *            The index of the record.
+		 *
+		 * @return
+		 *            The finger quality of the record's first view
+		 *            or 0 if the record contains no view.
+		 *
+		 * @warning
+		 *            If <i>i</i> is out of range, an error message is
+		 *            printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		int getFingerQuality( int i ) const;
+
+		/**
+		 * @brief
+		 *            Accesses the <i>i</i>th record without copying
+		 *            it.
+		 *
+		 * @param view
+		 *            Output view which is assigned the record.
+		 *
+		 * @param i
+		 *            The index of the record.
+		 *
+		 * @return
+		 *            <code>true</code> if the record is well-formed;
+		 *            otherwise <code>false</code>.
+		 *
+		 * @warning
+		 *            If <i>i</i> is out of range, an error message is
+		 *            printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		bool getRecord( MinutiaeRecordView & view , int i ) const;
+
+		/**
+		 * @brief
+		 *            Decodes the <i>i</i>th record.
+		 *
+		 * @param record
+		 *            Output record which is assigned the decoded
+		 *            record.
+		 *
+		 * @param i
+		 *            The index of the record.
+		 *
+		 * @return
+		 *            <code>true</code> if the record is well-formed;
+		 *            otherwise <code>false</code> and
+		 *            <code>record</code> is left unchanged.
+		 *
+		 * @warning
+		 *            If <i>i</i> is out of range, an error message is
+		 *            printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		bool getRecord( MinutiaeRecord & record , int i ) const;
+
+		/**
+		 * @brief
+		 *            Determines a contiguous range of records to be
+		 *            processed by one of several workers.
+		 *
+		 * @details
+		 *            The records are split into <code>numParts</code>
+		 *            consecutive ranges such that each range covers
+		 *            roughly the same number of bytes; every record
+		 *            belongs to exactly one range. If the archive does
+		 *            not contain any records, e.g., because it has been
+		 *            cleared, all ranges are empty.
+		 *
+		 * @param first
+		 *            Output index of the first record of the range.
+		 *
+		 * @param last
+		 *            Output index of the record following the last
+		 *            record of the range; the range is empty if
+		 *            <code>first==last</code>.
+		 *
+		 * @param part
+		 *            The index of the range.
+		 *
+		 * @param numParts
+		 *            The number of ranges.
+		 *
+		 * @warning
+		 *            If <code>numParts</code> is not positive or if
+		 *            <code>part</code> is not in the range
+		 *            <code>0,...,numParts-1</code>, an error message is
+		 *            printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		void getPartition( int & first , int & last , int part , int numParts ) const;
+
+		/**
+		 * @brief
+		 *            Packs the minutiae record files of a directory
+		 *            into an archive.
+		 *
+		 * @details
+		 *            Every regular file in the directory (not its
+		 *            subdirectories) that is a well-formed minutiae
+		 *            record is added unmodified to the archive under its
+		 *            file name; the files are added in lexicographic
+		 *            order of their names. Files that are not
+		 *            well-formed minutiae records are skipped.
+		 *
+		 * @param archivePath
+		 *            Path of the archive file to be written.
+		 *
+		 * @param directory
+		 *            The directory containing the record files.
+		 *
+		 * @return
+		 *            The number of records packed or -1 if the
+		 *            directory could not be listed or an I/O error
+		 *            occurred; in the latter case, no archive file is
+		 *            left behind.
+		 */
+		static int pack( const std::string & archivePath , const std::string & directory );
+
+		/**
+		 * @brief
+		 *            Writes each record of an archive to an individual
+		 *            file in a directory.
+		 *
+		 * @details
+		 *            Each record is written unmodified to a file named
+		 *            after the record; only the last component of the
+		 *            name is used such that no file outside the
+		 *            directory is written. Records without a name are
+		 *            written to a file named after their index, e.g.,
+		 *            '00000042.fmr'. The same applies to records whose
+		 *            name coincides with the name of a file that has
+		 *            already been written, e.g., records named
+		 *            'a/x.fmr' and 'b/x.fmr', such that no record
+		 *            overwrites another. The directory is created if it
+		 *            does not exist.
+		 *
+		 * @param directory
+		 *            The directory to which the record files are
+		 *            written.
+		 *
+		 * @param archivePath
+		 *            Path of the archive file.
+		 *
+		 * @return
+		 *            The number of records written or -1 if the archive
+		 *            could not be read, an I/O error occurred, or if
+		 *            the name of a record and the name derived from its
+		 *            index both coincide with files that have already
+		 *            been written.
+		 */
+		static int unpack( const std::string & directory , const std::string & archivePath );
+	};
+
+	/**
+	 * @brief
+	 *            Writes an archive of minutiae records to be read by a
+	 *            \link MinutiaeRecordArchive\endlink.
+	 *
+	 * @details
+	 *            The records are streamed to the file as they are added
+	 *            while the index is collected in memory and written on
+	 *            \link close()\endlink; for example,
+	 *            <pre>
+	 *             MinutiaeRecordArchiveWriter writer;
+	 *             if ( writer.open("gallery.fmra") ) {
+	 *                for ( ... ) {
+	 *                   writer.add(record,name);
+	 *                }
+	 *                writer.close();
+	 *             }
+	 *            </pre>
+	 *            An archive that has not been closed is incomplete and
+	 *            cannot be read. If writing fails midway,
+	 *            \link abort()\endlink removes the incomplete file
+	 *            instead of completing it.
+	 */
+	class THIMBLE_DLL MinutiaeRecordArchiveWriter {
+
+	private:
+
+		/**
+		 * @brief
+		 *            The file to which the archive is written or
+		 *            <code>NULL</code> if no archive is open.
+		 */
+		FILE *out;
+
+		/**
+		 * @brief
+		 *            Path of the archive file that is open.
+		 */
+		std::string path;
+
+		/**
+		 * @brief
+		 *            Offset at which the next record will be written.
+		 */
+		uint64_t offset;
+
+		/**
+		 * @brief
+		 *            The index entries of the records added so far.
+		 */
+		std::vector<uint8_t> index;
+
+		/**
+		 * @brief
+		 *            The names of the records added so far.
+		 */
+		std::vector<uint8_t> names;
+
+		/**
+		 * @brief
+		 *            The number of records added so far.
+		 */
+		int count;
+
+		/**
+		 * @brief
+		 *            Buffer to which records are encoded before being
+		 *            written.
+		 */
+		std::vector<uint8_t> recordBuffer;
+
+		/**
+		 * @brief
+		 *            Copy constructor which is not supported.
+		 */
+		MinutiaeRecordArchiveWriter( const MinutiaeRecordArchiveWriter & );
+
+		/**
+		 * @brief
+		 *            Assignment operator which is not supported.
+		 */
+		MinutiaeRecordArchiveWriter &operator=( const MinutiaeRecordArchiveWriter & );
+
+	public:
+
+		/**
+		 * @brief
+		 *            Creates a writer with no archive open.
+		 */
+		MinutiaeRecordArchiveWriter();
+
+		/**
+		 * @brief
+		 *            Destructor; closes the archive if it is still
+		 *            open.
+		 */
+		~MinutiaeRecordArchiveWriter();
+
+		/**
+		 * @brief
+		 *            Creates an archive file and writes a preliminary
+		 *            header.
+		 *
+		 * @details
+		 *            If an archive is already open, it is closed first.
+		 *
+		 * @param path
+		 *            Path of the archive file.
+		 *
+		 * @return
+		 *            <code>true</code> if the file could be created;
+		 *            otherwise <code>false</code>.
+		 */
+		bool open( const std::string & path );
+
+		/**
+		 * @brief
+		 *            Appends a record to the archive.
+		 *
+		 * @details
+		 *            If the record cannot be written completely, the
+		 *            archive is discarded as by \link abort()\endlink,
+		 *            such that a subsequent call of
+		 *            \link close()\endlink fails instead of completing
+		 *            a corrupt archive.
+		 *
+		 * @param record
+		 *            The record to be appended.
+		 *
+		 * @param name
+		 *            The name under which the record is stored, e.g.,
+		 *            the name of its original file; must not be longer
+		 *            than 65535 bytes.
+		 *
+		 * @return
+		 *            <code>true</code> if the record has been written;
+		 *            otherwise, if no archive is open, the name is too
+		 *            long or an I/O error occurred, <code>false</code>.
+		 */
+		bool add( const MinutiaeRecord & record , const std::string & name = "" );
+
+		/**
+		 * @brief
+		 *            Appends an encoded record to the archive.
+		 *
+		 * @details
+		 *            The data is written unmodified. If it cannot be
+		 *            written completely, the archive is discarded as by
+		 *            \link abort()\endlink, such that a subsequent call
+		 *            of \link close()\endlink fails instead of
+		 *            completing a corrupt archive.
+		 *
+		 * @param data
+		 *            The ISO 19794-2:2005 encoding of the record.
+		 *
+		 * @param size
+		 *            The size of the encoding in bytes.
+		 *
+		 * @param name
+		 *            The name under which the record is stored; must
+		 *            not be longer than 65535 bytes.
+		 *
+		 * @return
+		 *            <code>true</code> if the record has been written;
+		 *            otherwise, if no archive is open, the data is not a
+		 *            well-formed minutiae record, the name is too long
+		 *            or an I/O error occurred, <code>false</code>.
+		 */
+		bool add( const void *data , int size , const std::string & name = "" );
+
+		/**
+		 * @brief
+		 *            Returns the number of records added to the
+		 *            currently open archive.
+		 *
+		 * @return
+		 *            The number of records added so far.
+		 */
+		inline int getRecordCount() const {
+			return this->count;
+		}
+
+		/**
+		 * @brief
+		 *            Writes the index, completes the header and closes
+		 *            the archive file.
+		 *
+		 * @return
+		 *            <code>true</code> if the archive has been written
+		 *            successfully; otherwise, if no archive is open or
+		 *            an I/O error occurred, <code>false</code>.
+		 */
+		bool close();
+
+		/**
+		 * @brief
+		 *            Closes the archive file without completing it and
+		 *            removes the file.
+		 *
+		 * @details
+		 *            Used to discard a partially written archive, e.g.,
+		 *            after \link add()\endlink failed; does nothing if
+		 *            no archive is open.
+		 */
+		void abort();
+	};
+}
+
+#endif /* THIMBLE_MINUTIAERECORDARCHIVE_H_ */
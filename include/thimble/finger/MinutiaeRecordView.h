@@ -0,0 +1,573 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file MinutiaeRecordView.h
+ *
+ * @brief
+ *            Provides a class for accessing minutiae records in
+ *            ISO 19794-2:2005 format directly in memory without copying
+ *            their data.
+ *
+ * @author agent
+ */
+
+#ifndef THIMBLE_MINUTIAERECORDVIEW_H_
+#define THIMBLE_MINUTIAERECORDVIEW_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <thimble/dllcompat.h>
+#include <thimble/finger/MinutiaeRecord.h>
+#include <thimble/finger/MinutiaeArrays.h>
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/**
+	 * @brief
+	 *            Iterates over the raw minutia fields of a finger view of
+	 *            a \link MinutiaeRecordView\endlink.
+	 *
+	 * @details
+	 *            The iterator decodes the fields of the current minutia
+	 *            directly from the record's data on access; for
+	 *            example,
+	 *            <pre>
+	 *             RawMinutiaIterator it = record.getMinutiae(v);
+	 *             while ( it.next() ) {
+	 *                cout << it.getX() << " " << it.getY() << endl;
+	 *             }
+	 *            </pre>
+	 *            The iterator is valid as long as the record's data is.
+	 */
+	class THIMBLE_DLL RawMinutiaIterator {
+
+		friend class MinutiaeRecordView;
+
+	private:
+
+		/**
+		 * @brief
+		 *            The data of the first minutia of the finger view.
+		 */
+		const uint8_t *data;
+
+		/**
+		 * @brief
+		 *            The number of minutiae of the finger view.
+		 */
+		int count;
+
+		/**
+		 * @brief
+		 *            Index of the current minutia, or -1 if
+		 *            \link next()\endlink has not been called yet.
+		 */
+		int index;
+
+		/**
+		 * @brief
+		 *            The data of the current minutia.
+		 */
+		const uint8_t *current;
+
+	public:
+
+		/**
+		 * @brief
+		 *            Creates an iterator over no minutiae.
+		 */
+		inline RawMinutiaIterator() {
+			this->data = NULL;
+			this->count = 0;
+			this->index = -1;
+			this->current = NULL;
+		}
+
+		/**
+		 * @brief
+		 *            Advances to the next minutia.
+		 *
+		 * @return
+		 *            <code>true</code> if there is a next minutia;
+		 *            otherwise, if all minutiae have been visited,
+		 *            <code>false</code>.
+		 */
+		inline bool next() {
+			if ( this->index + 1 >= this->count ) {
+				this->index = this->count;
+				return false;
+			}
+			++this->index;
+			this->current = this->data + 6 * this->index;
+			return true;
+		}
+
+		/**
+		 * @brief
+		 *            Access the index of the current minutia in the
+		 *            finger view.
+		 *
+		 * @return
+		 *            The index of the current minutia.
+		 */
+		inline int getIndex() const {
+			return this->index;
+		}
+
+		/**
+		 * @brief
+		 *            Access the number of minutiae of the finger view.
+		 *
+		 * @return
+		 *            The number of minutiae.
+		 */
+		inline int getCount() const {
+			return this->count;
+		}
+
+		/**
+		 * @brief
+		 *            Access the raw six bytes of the current minutia.
+		 *
+		 * @return
+		 *            Pointer to the current minutia's data.
+		 */
+		inline const uint8_t *getData() const {
+			return this->current;
+		}
+
+		/**
+		 * @brief
+		 *            Access the horizontal coordinate of the current
+		 *            minutia.
+		 *
+		 * @return
+		 *            The 14 bit horizontal coordinate.
+		 */
+		inline int getX() const {
+			return 0x100 * (this->current[0] & 63) + this->current[1];
+		}
+
+		/**
+		 * @brief
+		 *            Access the vertical coordinate of the current
+		 *            minutia.
+		 *
+		 * @return
+		 *            The 14 bit vertical coordinate.
+		 */
+		inline int getY() const {
+			return 0x100 * (this->current[2] & 63) + this->current[3];
+		}
+
+		/**
+		 * @brief
+		 *            Access the encoded angle of the current minutia.
+		 *
+		 * @return
+		 *            The angle in units of <i>2&pi;/256</i>.
+		 */
+		inline int getAngleCode() const {
+			return this->current[4];
+		}
+
+		/**
+		 * @brief
+		 *            Access the angle of the current minutia.
+		 *
+		 * @return
+		 *            The angle in radians.
+		 */
+		double getAngle() const;
+
+		/**
+		 * @brief
+		 *            Access the type of the current minutia.
+		 *
+		 * @return
+		 *            The type of the current minutia.
+		 */
+		inline MINUTIA_TYPE_T getType() const {
+			switch ( (this->current[0] >> 6) & 0x3 ) {
+			case 1:
+				return ENDING_MINUTIA_TYPE;
+			case 2:
+				return BIFURCATION_MINUTIA_TYPE;
+			default:
+				return UNKNOWN_MINUTIA_TYPE;
+			}
+		}
+
+		/**
+		 * @brief
+		 *            Access the quality of the current minutia.
+		 *
+		 * @return
+		 *            The quality of the current minutia.
+		 */
+		inline int getQuality() const {
+			return this->current[5];
+		}
+	};
+
+	/**
+	 * @brief
+	 *            Provides read access to a minutiae record in
+	 *            ISO 19794-2:2005 format that is held in memory, e.g., in
+	 *            a buffer or a memory-mapped file.
+	 *
+	 * @details
+	 *            In contrast to \link MinutiaeRecord::fromBytes()\endlink,
+	 *            which builds \link MinutiaeView\endlink and
+	 *            \link Minutia\endlink objects, a
+	 *            \link MinutiaeRecordView\endlink only validates the
+	 *            record and remembers where its finger views start;
+	 *            it neither copies the data nor allocates memory. The
+	 *            minutiae of a finger view can be visited via a
+	 *            \link RawMinutiaIterator\endlink or be decoded at once
+	 *            into a \link MinutiaeArrays\endlink, a
+	 *            \link MinutiaeView\endlink, or a whole
+	 *            \link MinutiaeRecord\endlink.
+	 *
+	 *            The record's data must remain valid and unchanged as long
+	 *            as the view is used.
+	 *
+	 *            Records are written into a caller's buffer via
+	 *            \link MinutiaeRecord::toBytes()\endlink.
+	 */
+	class THIMBLE_DLL MinutiaeRecordView {
+
+	private:
+
+		/**
+		 * @brief
+		 *            The data of the record or <code>NULL</code>
+		 *            if the view is empty.
+		 */
+		const uint8_t *data;
+
+		/**
+		 * @brief
+		 *            The number of bytes of the record.
+		 */
+		int size;
+
+		/**
+		 * @brief
+		 *            The number of finger views of the record.
+		 */
+		int viewCount;
+
+		/**
+		 * @brief
+		 *            The offsets of the finger views in the record's
+		 *            data.
+		 */
+		int viewOffsets[256];
+
+		/**
+		 * @brief
+		 *            Checks whether a finger view index is valid.
+		 *
+		 * @param v
+		 *            The finger view index.
+		 *
+		 * @warning
+		 *            If <code>v</code> is not a valid finger view index,
+		 *            an error message is printed to <code>stderr</code>
+		 *            and the program exits with status 'EXIT_FAILURE'.
+		 */
+		void checkView( int v ) const;
+
+	public:
+
+		/**
+		 * @brief
+		 *            Creates an empty view.
+		 */
+		MinutiaeRecordView();
+
+		/**
+		 * @brief
+		 *            Parses the header of a minutiae record held in
+		 *            memory.
+		 *
+		 * @details
+		 *            The function validates the same fields as
+		 *            \link MinutiaeRecord::read()\endlink and checks that
+		 *            all finger views lie within the first
+		 *            <code>size</code> bytes of <code>data</code>. Only the
+		 *            bytes of the record are accessed; thus,
+		 *            <code>data</code> may hold subsequent data.
+		 *
+		 * @param data
+		 *            The data of the record.
+		 *
+		 * @param size
+		 *            The number of bytes available at <code>data</code>.
+		 *
+		 * @return
+		 *            <code>true</code> if <code>data</code> contains a
+		 *            valid minutiae record; otherwise, the function returns
+		 *            <code>false</code> and the view is empty.
+		 */
+		bool assign( const void *data , int size );
+
+		/**
+		 * @brief
+		 *            Resets the view to be empty.
+		 */
+		void clear();
+
+		/**
+		 * @brief
+		 *            Determines whether the view refers to a record.
+		 *
+		 * @return
+		 *            <code>false</code> if the view refers to a record;
+		 *            otherwise <code>true</code>.
+		 */
+		inline bool isEmpty() const {
+			return this->data == NULL;
+		}
+
+		/**
+		 * @brief
+		 *            Access the number of bytes of the record.
+		 *
+		 * @return
+		 *            The size of the record in bytes.
+		 */
+		inline int getSizeInBytes() const {
+			return this->size;
+		}
+
+		/**
+		 * @brief
+		 *            Access the width of the fingerprint images the
+		 *            record corresponds to.
+		 *
+		 * @return
+		 *            The width.
+		 */
+		int getWidth() const;
+
+		/**
+		 * @brief
+		 *            Access the height of the fingerprint images the
+		 *            record corresponds to.
+		 *
+		 * @return
+		 *            The height.
+		 */
+		int getHeight() const;
+
+		/**
+		 * @brief
+		 *            Access the horizontal resolution in pixels per
+		 *            centimeter.
+		 *
+		 * @return
+		 *            The horizontal resolution.
+		 */
+		int getHorizontalResolution() const;
+
+		/**
+		 * @brief
+		 *            Access the vertical resolution in pixels per
+		 *            centimeter.
+		 *
+		 * @return
+		 *            The vertical resolution.
+		 */
+		int getVerticalResolution() const;
+
+		/**
+		 * @brief
+		 *            Access the number of finger views of the record.
+		 *
+		 * @return
+		 *            The number of finger views.
+		 */
+		inline int getViewCount() const {
+			return this->viewCount;
+		}
+
+		/**
+		 * @brief
+		 *            Access the finger position of a finger view.
+		 *
+		 * @param v
+		 *            The index of the finger view.
+		 *
+		 * @return
+		 *            The finger position.
+		 *
+		 * @warning
+		 *            If <code>v</code> is not a valid finger view index,
+		 *            an error message is printed to <code>stderr</code>
+		 *            and the program exits with status 'EXIT_FAILURE'.
+		 */
+		FINGER_POSITION_T getFingerPosition( int v ) const;
+
+		/**
+		 * @brief
+		 *            Access the view number of a finger view.
+		 *
+		 * @param v
+		 *            The index of the finger view.
+		 *
+		 * @return
+		 *            The view number.
+		 *
+		 * @warning
+		 *            If <code>v</code> is not a valid finger view index,
+		 *            an error message is printed to <code>stderr</code>
+		 *            and the program exits with status 'EXIT_FAILURE'.
+		 */
+		int getViewNumber( int v ) const;
+
+		/**
+		 * @brief
+		 *            Access the impression type of a finger view.
+		 *
+		 * @param v
+		 *            The index of the finger view.
+		 *
+		 * @return
+		 *            The impression type.
+		 *
+		 * @warning
+		 *            If <code>v</code> is not a valid finger view index,
+		 *            an error message is printed to <code>stderr</code>
+		 *            and the program exits with status 'EXIT_FAILURE'.
+		 */
+		FINGER_IMPRESSION_TYPE_T getImpressionType( int v ) const;
+
+		/**
+		 * @brief
+		 *            Access the finger quality of a finger view.
+		 *
+		 * @param v
+		 *            The index of the finger view.
+		 *
+		 * @return
+		 *            The finger quality.
+		 *
+		 * @warning
+		 *            If <code>v</code> is not a valid finger view index,
+		 *            an error message is printed to <code>stderr</code>
+		 *            and the program exits with status 'EXIT_FAILURE'.
+		 */
+		int getFingerQuality( int v ) const;
+
+		/**
+		 * @brief
+		 *            Access the number of minutiae of a finger view.
+		 *
+		 * @param v
+		 *            The index of the finger view.
+		 *
+		 * @return
+		 *            The number of minutiae.
+		 *
+		 * @warning
+		 *            If <code>v</code> is not a valid finger view index,
+		 *            an error message is printed to <code>stderr</code>
+		 *            and the program exits with status 'EXIT_FAILURE'.
+		 */
+		int getMinutiaeCount( int v ) const;
+
+		/**
+		 * @brief
+		 *            Creates an iterator over the minutiae of a finger
+		 *            view.
+		 *
+		 * @param v
+		 *            The index of the finger view.
+		 *
+		 * @return
+		 *            An iterator positioned before the first minutia.
+		 *
+		 * @warning
+		 *            If <code>v</code> is not a valid finger view index,
+		 *            an error message is printed to <code>stderr</code>
+		 *            and the program exits with status 'EXIT_FAILURE'.
+		 */
+		RawMinutiaIterator getMinutiae( int v ) const;
+
+		/**
+		 * @brief
+		 *            Decodes a finger view into separate arrays.
+		 *
+		 * @param arrays
+		 *            Will contain the finger view's attributes and
+		 *            minutiae.
+		 *
+		 * @param v
+		 *            The index of the finger view.
+		 *
+		 * @warning
+		 *            If <code>v</code> is not a valid finger view index,
+		 *            an error message is printed to <code>stderr</code>
+		 *            and the program exits with status 'EXIT_FAILURE'.
+		 */
+		void decode( MinutiaeArrays & arrays , int v ) const;
+
+		/**
+		 * @brief
+		 *            Decodes a finger view.
+		 *
+		 * @param view
+		 *            Will contain the finger view's attributes and
+		 *            minutiae.
+		 *
+		 * @param v
+		 *            The index of the finger view.
+		 *
+		 * @warning
+		 *            If <code>v</code> is not a valid finger view index,
+		 *            an error message is printed to <code>stderr</code>
+		 *            and the program exits with status 'EXIT_FAILURE'.
+		 */
+		void decode( MinutiaeView & view , int v ) const;
+
+		/**
+		 * @brief
+		 *            Decodes the whole record.
+		 *
+		 * @param record
+		 *            Will contain the record's data.
+		 *
+		 * @warning
+		 *            If the view is empty, an error message is printed to
+		 *            <code>stderr</code> and the program exits with
+		 *            status 'EXIT_FAILURE'.
+		 */
+		void decode( MinutiaeRecord & record ) const;
+	};
+}
+
+#endif /* THIMBLE_MINUTIAERECORDVIEW_H_ */
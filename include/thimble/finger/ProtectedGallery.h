@@ -0,0 +1,510 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ProtectedGallery.h
+ *
+ * @brief
+ *            Provides a mechanism for identifying a query minutiae
+ *            template against a gallery of protected minutiae
+ *            templates.
+ *
+ * @author agent
+ */
+
+#ifndef THIMBLE_PROTECTEDGALLERY_H_
+#define THIMBLE_PROTECTEDGALLERY_H_
+
+#include <vector>
+
+#include <thimble/dllcompat.h>
+#include <thimble/finger/MinutiaeRecord.h>
+#include <thimble/finger/ProtectedMinutiaeTemplate.h>
+#include <thimble/math/numbertheory/SmallBinaryFieldPolynomial.h>
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/**
+	 * @brief
+	 *            A protected minutiae template of a
+	 *            \link ProtectedGallery\endlink that has been opened by a
+	 *            query.
+	 */
+	struct THIMBLE_DLL ProtectedGalleryCandidate {
+
+		/**
+		 * @brief
+		 *            Index of the template in the gallery.
+		 */
+		int index;
+
+		/**
+		 * @brief
+		 *            The number of unlocking pairs of the query that lie
+		 *            on the secret polynomial, i.e., an estimate for the
+		 *            number of the query's quantized minutiae that agree
+		 *            with the protected ones.
+		 */
+		int score;
+
+		/**
+		 * @brief
+		 *            The secret polynomial protected by the template.
+		 *
+		 * @details
+		 *            The polynomial is defined over the field of the
+		 *            template in the gallery; it must not be used after
+		 *            the gallery has been modified or destroyed.
+		 */
+		SmallBinaryFieldPolynomial secret;
+	};
+}
+
+#ifdef THIMBLE_BUILD_DLL
+template class THIMBLE_DLL std::allocator<thimble::ProtectedMinutiaeTemplate>;
+template class THIMBLE_DLL std::vector<thimble::ProtectedMinutiaeTemplate,std::allocator<thimble::ProtectedMinutiaeTemplate> >;
+template class THIMBLE_DLL std::allocator<thimble::ProtectedGalleryCandidate>;
+template class THIMBLE_DLL std::vector<thimble::ProtectedGalleryCandidate,std::allocator<thimble::ProtectedGalleryCandidate> >;
+#endif
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/**
+	 * @brief
+	 *            Identifies query minutiae templates against a gallery
+	 *            of \link ProtectedMinutiaeTemplate\endlink objects
+	 *            using multiple threads.
+	 *
+	 * @details
+	 *            Identifying a query by calling
+	 *            \link ProtectedMinutiaeTemplate::open()\endlink for
+	 *            each template of a gallery quantizes the query once per
+	 *            template. Templates that have been created with the same
+	 *            quantization parameters (the image dimension, the grid
+	 *            distance, the number of angle quanta, and the maximal
+	 *            number of genuine features), however, yield the same
+	 *            feature set. The gallery groups its templates by these
+	 *            parameters such that the query is quantized only once
+	 *            per group.
+	 *
+	 *            For each template, the unlocking set is built by
+	 *            evaluating the vault polynomial at all the (reordered)
+	 *            features in a single multipoint evaluation, where the
+	 *            vault polynomials of several slow-down values are
+	 *            unpacked at once (see
+	 *  \link ProtectedMinutiaeTemplate::unpackVaultPolynomials()\endlink).
+	 *            Each unlocking set is first passed to the cheap
+	 *            classical Reed-Solomon decoder, which already opens the
+	 *            templates with which the query has sufficiently many
+	 *            features in common, and then to the more expensive
+	 *            \link ProtectedMinutiaeTemplate::decode()\endlink.
+	 *            The templates are handed out to the threads on demand.
+	 *            \link identify()\endlink decodes all templates anyway
+	 *            and runs both decoders on each unlocking set in a single
+	 *            pass; \link identifyFirst()\endlink runs the classical
+	 *            decoder on all templates in a first pass before the
+	 *            templates that have not been opened are passed to
+	 *            \link ProtectedMinutiaeTemplate::decode()\endlink in a
+	 *            second pass, which reuses the unlocking sets of the
+	 *            first pass (up to a fixed memory budget). As every
+	 *            decoded secret is verified against the hash value
+	 *            stored with the template, the classical decoder does
+	 *            not introduce false matches; it may, however, open
+	 *            templates for which the randomized decoder used by
+	 *            \link ProtectedMinutiaeTemplate::open()\endlink
+	 *            would have failed.
+	 *
+	 *            <h2>Overlap Index</h2>
+	 *            Optionally, a template can be added together with the
+	 *            minutiae template from which it has been enrolled (see
+	 *   \link add(const ProtectedMinutiaeTemplate&,const MinutiaeView&)\endlink).
+	 *            Then the gallery keeps an inverted index from each
+	 *            quantized feature to the indexed templates containing it.
+	 *            On identification, the overlap of the quantized query
+	 *            with all the indexed templates is accumulated in
+	 *            <i>O(t+hits)</i> operations where <i>hits</i> is the
+	 *            number of index entries of the query's features. As the
+	 *            number of correct unlocking pairs of a template is its
+	 *            overlap with the query, indexed templates of an overlap
+	 *            smaller than their secret size cannot be opened and are
+	 *            skipped; the others are decoded in descending order of
+	 *            their overlap, optionally limited to the
+	 *            \link getMaxDecodingAttempts()\endlink most promising
+	 *            ones. Templates added without a minutiae template are
+	 *            decoded after the indexed ones.
+	 *
+	 *            For example, a gallery may be used as follows
+	 *            <pre>
+	 *             ProtectedGallery gallery;
+	 *             for ( int i = 0 ; i < n ; i++ ) {
+	 *                gallery.add(vaults[i]);
+	 *             }
+	 *
+	 *             vector<ProtectedGalleryCandidate> candidates;
+	 *             gallery.identify(candidates,query,10);
+	 *             for ( size_t l = 0 ; l < candidates.size() ; l++ ) {
+	 *                cout << candidates[l].index << " "
+	 *                     << candidates[l].score << endl;
+	 *             }
+	 *            </pre>
+	 */
+	class THIMBLE_DLL ProtectedGallery {
+
+	public:
+
+		/**
+		 * @brief
+		 *            Creates an empty gallery.
+		 *
+		 * @param numThreads
+		 *            The number of threads used for identification; if
+		 *            0, the number of hardware threads is used.
+		 *
+		 * @warning
+		 *            If <code>numThreads</code> is negative, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		ProtectedGallery( int numThreads = 0 );
+
+		/**
+		 * @brief
+		 *            Access the number of threads used for
+		 *            identification.
+		 *
+		 * @return
+		 *            The number of threads.
+		 */
+		inline int getNumThreads() const {
+			return this->numThreads;
+		}
+
+		/**
+		 * @brief
+		 *            Adds a copy of a protected minutiae template to the
+		 *            gallery.
+		 *
+		 * @param vault
+		 *            The protected minutiae template.
+		 *
+		 * @return
+		 *            The index of the template in the gallery.
+		 *
+		 * @warning
+		 *            If <code>vault</code> does not represent a
+		 *            successfully enrolled and decrypted protected
+		 *            minutiae template, i.e., if
+		 *     \link ProtectedMinutiaeTemplate::isDecrypted()\endlink
+		 *            returns <code>false</code>, an error message is
+		 *            printed to <code>stderr</code> and the program exits
+		 *            with status 'EXIT_FAILURE'.
+		 */
+		int add( const ProtectedMinutiaeTemplate & vault );
+
+		/**
+		 * @brief
+		 *            Adds a copy of a protected minutiae template to the
+		 *            gallery and indexes the quantization of the minutiae
+		 *            template from which it has been enrolled.
+		 *
+		 * @details
+		 *            The index allows to skip templates that cannot be
+		 *            opened by a query and to decode the others in the
+		 *            order of their overlap with the query (see the
+		 *            class description).
+		 *
+		 * @param vault
+		 *            The protected minutiae template.
+		 *
+		 * @param view
+		 *            The minutiae template from which <code>vault</code>
+		 *            has been enrolled.
+		 *
+		 * @return
+		 *            The index of the template in the gallery.
+		 *
+		 * @attention
+		 *            The index holds the template's genuine features in
+		 *            the clear. Whoever has access to the index can open
+		 *            the indexed templates without a genuine query; the
+		 *            index thus must be kept at least as secret as the
+		 *            unprotected minutiae templates, e.g., it may be
+		 *            used for the evaluation of identification
+		 *            performance.
+		 *
+		 * @warning
+		 *            If <code>vault</code> does not represent a
+		 *            successfully enrolled and decrypted protected
+		 *            minutiae template, i.e., if
+		 *     \link ProtectedMinutiaeTemplate::isDecrypted()\endlink
+		 *            returns <code>false</code>, an error message is
+		 *            printed to <code>stderr</code> and the program exits
+		 *            with status 'EXIT_FAILURE'.
+		 */
+		int add
+		( const ProtectedMinutiaeTemplate & vault ,
+		  const MinutiaeView & view );
+
+		/**
+		 * @brief
+		 *            Access the number of templates in the gallery.
+		 *
+		 * @return
+		 *            The number of templates.
+		 */
+		inline int getSize() const {
+			return (int)this->vaults.size();
+		}
+
+		/**
+		 * @brief
+		 *            Access the number of distinct quantization
+		 *            parameter sets among the gallery's templates.
+		 *
+		 * @return
+		 *            The number of groups, i.e., the number of times a
+		 *            query is quantized on identification.
+		 */
+		inline int getNumGroups() const {
+			return (int)this->groupRepresentatives.size();
+		}
+
+		/**
+		 * @brief
+		 *            Access the maximal number of indexed templates that
+		 *            are decoded on identification.
+		 *
+		 * @return
+		 *            The maximal number of decoded indexed templates; if
+		 *            0, all indexed templates that can possibly be opened
+		 *            are decoded.
+		 */
+		inline int getMaxDecodingAttempts() const {
+			return this->maxDecodingAttempts;
+		}
+
+		/**
+		 * @brief
+		 *            Specifies the maximal number of indexed templates
+		 *            that are decoded on identification.
+		 *
+		 * @details
+		 *            Only the indexed templates of the largest overlap
+		 *            with a query are decoded. Templates added without
+		 *            a minutiae template are not affected.
+		 *
+		 * @param maxDecodingAttempts
+		 *            The maximal number of decoded indexed templates; if
+		 *            0, all indexed templates that can possibly be opened
+		 *            are decoded.
+		 *
+		 * @warning
+		 *            If <code>maxDecodingAttempts</code> is negative, an
+		 *            error message is printed to <code>stderr</code> and
+		 *            the program exits with status 'EXIT_FAILURE'.
+		 */
+		void setMaxDecodingAttempts( int maxDecodingAttempts );
+
+		/**
+		 * @brief
+		 *            Access a template of the gallery.
+		 *
+		 * @param index
+		 *            The index of the template.
+		 *
+		 * @return
+		 *            The template at the specified index.
+		 *
+		 * @warning
+		 *            If <code>index</code> is not a valid index of the
+		 *            gallery, an error message is printed to
+		 *            <code>stderr</code> and the program exits with
+		 *            status 'EXIT_FAILURE'.
+		 */
+		const ProtectedMinutiaeTemplate & getTemplate( int index ) const;
+
+		/**
+		 * @brief
+		 *            Removes all templates from the gallery.
+		 */
+		void clear();
+
+		/**
+		 * @brief
+		 *            Determines the templates of the gallery that can be
+		 *            opened by a query.
+		 *
+		 * @details
+		 *            The candidates are sorted in descending order of their
+		 *            scores; candidates of equal score are sorted in
+		 *            ascending order of their indices.
+		 *
+		 * @param candidates
+		 *            Will contain the candidates.
+		 *
+		 * @param view
+		 *            The (absolutely pre-aligned) query minutiae
+		 *            template.
+		 *
+		 * @param maxCandidates
+		 *            If positive, only the <code>maxCandidates</code>
+		 *            best candidates are output; otherwise, all
+		 *            candidates are output.
+		 *
+		 * @return
+		 *            The number of candidates output.
+		 *
+		 * @warning
+		 *            If not enough memory could be provided, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		int identify
+		( std::vector<ProtectedGalleryCandidate> & candidates ,
+		  const MinutiaeView & view , int maxCandidates = 0 ) const;
+
+		/**
+		 * @brief
+		 *            Attempts to find a template of the gallery that can
+		 *            be opened by a query.
+		 *
+		 * @details
+		 *            The identification is stopped as soon as a template
+		 *            has been opened. Which template is found if the
+		 *            query opens several ones is not specified.
+		 *
+		 * @param candidate
+		 *            Will contain the candidate on success; otherwise, the
+		 *            content is left unchanged.
+		 *
+		 * @param view
+		 *            The (absolutely pre-aligned) query minutiae
+		 *            template.
+		 *
+		 * @return
+		 *            <code>true</code> if a template has been opened;
+		 *            otherwise <code>false</code>.
+		 *
+		 * @warning
+		 *            If not enough memory could be provided, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		bool identifyFirst
+		( ProtectedGalleryCandidate & candidate ,
+		  const MinutiaeView & view ) const;
+
+	private:
+
+		/**
+		 * @brief
+		 *            The number of threads.
+		 */
+		int numThreads;
+
+		/**
+		 * @brief
+		 *            The templates of the gallery.
+		 */
+		std::vector<ProtectedMinutiaeTemplate> vaults;
+
+		/**
+		 * @brief
+		 *            The group of quantization parameters of each
+		 *            template.
+		 */
+		std::vector<int> groups;
+
+		/**
+		 * @brief
+		 *            For each group, the index of the first template of
+		 *            the gallery that belongs to the group.
+		 */
+		std::vector<int> groupRepresentatives;
+
+		/**
+		 * @brief
+		 *            For each template, whether it has been indexed.
+		 */
+		std::vector<char> indexed;
+
+		/**
+		 * @brief
+		 *            For each group, the offset of its quantized features
+		 *            in \link postings\endlink.
+		 */
+		std::vector<int> groupOffsets;
+
+		/**
+		 * @brief
+		 *            The inverted index; the list at
+		 *            <code>groupOffsets[g]+q</code> contains the indexed
+		 *            templates of group <i>g</i> whose enrolled feature set
+		 *            contains the quantized feature <i>q</i>.
+		 */
+		std::vector< std::vector<int> > postings;
+
+		/**
+		 * @brief
+		 *            The maximal number of decoded indexed templates or
+		 *            0 if unlimited.
+		 */
+		int maxDecodingAttempts;
+
+		/**
+		 * @brief
+		 *            Adds a copy of a protected minutiae template to the
+		 *            gallery without indexing it.
+		 *
+		 * @param vault
+		 *            The protected minutiae template.
+		 *
+		 * @return
+		 *            The index of the template in the gallery.
+		 */
+		int addTemplate( const ProtectedMinutiaeTemplate & vault );
+
+		/**
+		 * @brief
+		 *            Runs the identification.
+		 *
+		 * @param candidates
+		 *            Will contain the (unsorted) candidates.
+		 *
+		 * @param view
+		 *            The query minutiae template.
+		 *
+		 * @param firstHit
+		 *            If <code>true</code>, the identification is stopped
+		 *            as soon as a template has been opened.
+		 */
+		void run
+		( std::vector<ProtectedGalleryCandidate> & candidates ,
+		  const MinutiaeView & view , bool firstHit ) const;
+	};
+}
+
+#endif /* THIMBLE_PROTECTEDGALLERY_H_ */
@@ -134,7 +134,7 @@
 #include <vector>
 
 #include <thimble/dllcompat.h>
-#include <thimble/security/SHA.h>
+#include <thimble/security/Hash.h>
 #include <thimble/math/Permutation.h>
 #include <thimble/math/numbertheory/BigInteger.h>
 #include <thimble/math/numbertheory/SmallBinaryField.h>
@@ -664,11 +664,11 @@ namespace thimble {
 		 *             than <i>k</i>.
 		 *
 		 * @param hash
-		 *             160-bit hash value of the correct secret polynomial
+		 *             Hash value of the correct secret polynomial
 		 *             <i>f</i>, that has been originally computed via an
 		 *             equivalent to
 		 *             <code>
-		 *              SHA().hash(hash,f.getData(),f.deg()+1)
+		 *              Hash(getHashAlgorithm()).hash(hash,f.getData(),f.deg()+1)
 		 *             </code>
 		 *
 		 * @param m
@@ -696,7 +696,7 @@ namespace thimble {
 		bool decode
 		( SmallBinaryFieldPolynomial & f ,
 		  const uint32_t *x , const uint32_t *y ,
-		  int t , int k , const uint8_t hash[20] , int m ) const;
+		  int t , int k , const uint8_t *hash , int m ) const;
 
 		/**
 		 * @brief
@@ -1088,6 +1088,35 @@ namespace thimble {
 		 */
 		void setSlowDownFactor( const BigInteger & slowDownFactor );
 
+		/**
+		 * @brief
+		 *            Specifies the hash function by which the secret key
+		 *            is verified and from which the keys of the slow-down
+		 *            mechanism are derived.
+		 *
+		 * @details
+		 *            By default, SHA-1 is used and the record is
+		 *            serialized in the original format. Otherwise, the
+		 *            hash function is recorded in the serialized
+		 *            record; faster hash functions, such as BLAKE2s,
+		 *            reduce the time for checking candidate polynomials.
+		 *
+		 * @param algorithm
+		 *            The hash function.
+		 *
+		 * @see getHashAlgorithm()
+		 *
+		 * @warning
+		 *            If this protected minutiae record object already
+		 *            contains protected data, i.e.,
+		 *            if \link isEnrolled()\endlink returns <code>true</code>,
+		 *            or if <code>algorithm</code> is not a valid hash
+		 *            function, an error message will be printed to
+		 *            <code>stderr</code> and the program exits with status
+		 *            'EXIT_FAILURE'.
+		 */
+		void setHashAlgorithm( HASH_ALGORITHM_T algorithm );
+
 		/**
 		 * @brief
 		 *             Access the distance of the hexagonal grid used
@@ -1198,6 +1227,23 @@ namespace thimble {
 		 */
 		const BigInteger & getSlowDownFactor() const;
 
+		/**
+		 * @brief
+		 *            Access the hash function by which the secret key is
+		 *            verified.
+		 *
+		 * @details
+		 *            Unless manually specified via
+		 *            \link setHashAlgorithm()\endlink, the result of this
+		 *            function is <code>HASH_SHA1</code>.
+		 *
+		 * @return
+		 *            The hash function of this protected minutiae record.
+		 *
+		 * @see setHashAlgorithm()
+		 */
+		HASH_ALGORITHM_T getHashAlgorithm() const;
+
 		/**
 		 * @brief
 		 *             Access the vector of hexagonal grid points centered in
@@ -1381,13 +1427,58 @@ namespace thimble {
 
 		/**
 		 * @brief
-		 *             Access the SHA-1 hash value of the secret key
+		 *            Unpacks the vault polynomial for a slow-down value
+		 *            given as an unsigned 64-bit integer.
+		 *
+		 * @details
+		 *            Works as
+		 *            \link unpackVaultPolynomial(const BigInteger&)const\endlink
+		 *            but without any big integer arithmetic. For the same
+		 *            slow-down value, both functions derive the same key
+		 *            and thus return the same candidate. The function is
+		 *            used by \link open()\endlink if the slow-down factor
+		 *            fits into 64 bits.
+		 *
+		 * @param slowDownVal
+		 *            A guess for the slow-down value.
+		 *
+		 * @return
+		 *            A candidate for the correct vault polynomial (which is
+		 *            correct if the guess for the slow-down value is correct).
+		 *
+		 * @warning
+		 *            If this object does not contain (a candidate) for decrypted
+		 *            vault polynomial data, i.e.,
+		 *            if \link isDecrypted()\endlink returns <code>false</code>,
+		 *            then an error message will be printed to
+		 *            <code>stderr</code> and the program exits with status
+		 *            'EXIT_FAILURE'.
+		 *
+		 * @warning
+		 *            If <code>slowDownVal</code> is greater than or equals
+		 *            \link getSlowDownFactor()\endlink, then an
+		 *            error message will be printed to <code>stderr</code> and
+		 *            the program exits with status 'EXIT_FAILURE'.
+		 *
+		 * @warning
+		 *            If not enough memory could be allocated, an error message
+		 *            will be printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		SmallBinaryFieldPolynomial unpackVaultPolynomial
+		( uint64_t slowDownVal ) const;
+
+		/**
+		 * @brief
+		 *             Access the hash value of the secret key
 		 *             generated on enrollment used to obfuscate the
 		 *             correct minutiae record's quantization.
 		 *
 		 * @return
-		 *             The SHA-1 hash value of the secret key used to
-		 *             obfuscate the correct minutiae template's quantization.
+		 *             The hash value of the secret key used to obfuscate
+		 *             the correct minutiae template's quantization; its
+		 *             size is <code>Hash::getDigestSize(getHashAlgorithm())</code>
+		 *             bytes, i.e., 20 bytes for the default SHA-1.
 		 *
 		 * @warning
 		 *             If \link isEnrolled()\endlink returns
@@ -1574,6 +1665,14 @@ namespace thimble {
 		 *             Stores data defining this protected minutiae template to
 		 *             the specified byte array.
 		 *
+		 * @details
+		 *             If \link getHashAlgorithm()\endlink is SHA-1, the
+		 *             data starts with the header <code>"PMR140822"</code>
+		 *             and is byte-for-byte the same as in previous versions
+		 *             of the library. Otherwise, the data starts with the
+		 *             header <code>"PMR261017"</code> followed by a byte
+		 *             encoding the hash function.
+		 *
 		 * @param data
 		 *             The byte array to which the data for this protected
 		 *             minutiae record is written.
@@ -1951,7 +2050,17 @@ namespace thimble {
 
 		/**
 		 * @brief
-		 *            SHA-1 hash value of the secret polynomial protecting
+		 *            The hash function by which \link hash\endlink is
+		 *            computed.
+		 *
+		 * @see getHashAlgorithm()
+		 * @see setHashAlgorithm()
+		 */
+		HASH_ALGORITHM_T hashAlgorithm;
+
+		/**
+		 * @brief
+		 *            Hash value of the secret polynomial protecting
 		 *            the enrolled minutiae record's quantization.
 		 *
 		 * @details
@@ -1959,12 +2068,14 @@ namespace thimble {
 		 *            a \link MinutiaeRecord minutiae record\endlink is bound
 		 *            to a \link SmallBinaryFieldPolynomial
 		 *            secret polynomial\endlink of which any data is dismissed
-		 *            except of its SHA-1 hash value which is stored in this
-		 *            field.
+		 *            except of its hash value which is stored in this
+		 *            field. Only the first
+		 *            <code>Hash::getDigestSize(hashAlgorithm)</code>
+		 *            bytes are used.
 		 *
 		 * @see getHash()
 		 */
-		uint8_t hash[20];
+		uint8_t hash[Hash::MAX_DIGEST_SIZE];
 
 		/**
 		 * @brief
@@ -2185,15 +2296,19 @@ namespace thimble {
 		 * @details
 		 *            The bytes of the specified integer are extracted
 		 *            via the \link BigInteger::toBytes() x.toBytes()\endlink
-		 *            method and then its \link SHA SHA hash value\endlink
-		 *            is computed; the first 16 bytes of the value
-		 *            are used to define the \link AES128 AES key\endlink
-		 *            returned by this function.
+		 *            method and then its hash value is computed; the
+		 *            first 16 bytes of the value are used to define the
+		 *            \link AES128 AES key\endlink returned by this
+		 *            function.
 		 *
 		 * @param x
 		 *            The integer of which an AES key is computed with
 		 *            this function.
 		 *
+		 * @param algorithm
+		 *            The hash function of which the first 16 bytes of the
+		 *            hash value of <code>x</code> form the key.
+		 *
 		 * @return
 		 *            The AES key derived from <code>x</code>.
 		 *
@@ -2202,7 +2317,81 @@ namespace thimble {
 		 *             is printed <code>stderr</code> and the program exits
 		 *             with status 'EXIT_FAILURE'
 		 */
-		static AES128 deriveKey( const BigInteger & x );
+		static AES128 deriveKey
+		( const BigInteger & x , HASH_ALGORITHM_T algorithm = HASH_SHA1 );
+
+		/**
+		 * @brief
+		 *            Derives an AES key from the specified unsigned
+		 *            64-bit integer.
+		 *
+		 * @details
+		 *            The key agrees with the key returned
+		 *            by \link deriveKey(const BigInteger&,HASH_ALGORITHM_T)\endlink
+		 *            for the same integer, i.e., the hashed bytes are
+		 *            the same as written by
+		 *            \link BigInteger::toBytes()\endlink; but these are
+		 *            written to a stack buffer without creating a
+		 *            \link BigInteger\endlink.
+		 *
+		 * @param x
+		 *            The integer of which an AES key is computed with
+		 *            this function.
+		 *
+		 * @param algorithm
+		 *            The hash function of which the first 16 bytes of the
+		 *            hash value of <code>x</code> form the key.
+		 *
+		 * @return
+		 *            The AES key derived from <code>x</code>.
+		 */
+		static AES128 deriveKey
+		( uint64_t x , HASH_ALGORITHM_T algorithm = HASH_SHA1 );
+
+		/**
+		 * @brief
+		 *            Decrypts and unpacks the vault polynomial using the
+		 *            specified AES key.
+		 *
+		 * @details
+		 *            Helper for both variants
+		 *            of \link unpackVaultPolynomial()\endlink after the key
+		 *            has been derived from the slow-down value.
+		 *
+		 * @param aes
+		 *            The key derived from a guess of the slow-down value.
+		 *
+		 * @return
+		 *            A candidate for the vault polynomial.
+		 *
+		 * @warning
+		 *            If not enough memory could be allocated, an error message
+		 *            will be printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		SmallBinaryFieldPolynomial decryptVaultPolynomial
+		( AES128 & aes ) const;
+
+		/**
+		 * @brief
+		 *            Unpacks the vault polynomial from decrypted vault
+		 *            data.
+		 *
+		 * @param data
+		 *            Array of \link vaultDataSize()\endlink bytes
+		 *            decrypted with a key derived from a guess of the
+		 *            slow-down value.
+		 *
+		 * @return
+		 *            A candidate for the vault polynomial.
+		 *
+		 * @warning
+		 *            If not enough memory could be allocated, an error
+		 *            message will be printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		SmallBinaryFieldPolynomial toVaultPolynomial
+		( const uint8_t *data ) const;
 
 		/**
 		 * @brief
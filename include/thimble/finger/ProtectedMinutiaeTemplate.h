@@ -389,6 +389,7 @@
 
 #include <thimble/dllcompat.h>
 #include <thimble/security/AES.h>
+#include <thimble/security/Hash.h>
 #include <thimble/finger/MinutiaeRecord.h>
 #include <thimble/math/Permutation.h>
 #include <thimble/math/numbertheory/SmallBinaryField.h>
@@ -412,6 +413,25 @@ namespace thimble {
 	 *            protected from unprotected minutiae templates with
 	 *            the <em>improved fuzzy vault scheme</em>.
 	 *
+	 * @details
+	 *            <h2>Hash Functions</h2>
+	 *            The hash function by which the secret polynomial is
+	 *            verified and from which the AES keys of the slow-down
+	 *            mechanism are derived can be selected via
+	 *            \link setHashAlgorithm()\endlink; see
+	 *            \link HASH_ALGORITHM_T\endlink for the available
+	 *            functions. Templates protected with the default
+	 *            SHA-1 are serialized in the original format; otherwise,
+	 *            a newer format version is written that records the
+	 *            hash function (likewise for \link FuzzyVault\endlink
+	 *            and \link ProtectedMinutiaeRecord\endlink).
+	 *
+	 *            No memory-hard key derivation function is provided.
+	 *            The slow-down mechanism relies on each slow-down value
+	 *            being cheap to test for the genuine user, while the
+	 *            costs for an attacker grow with the number of
+	 *            slow-down values; a memory-hard function would
+	 *            increase the costs of both by the same factor.
 	 *
 	 * @see <b>B. Tams, P. Mihailescu, A. Munk (2014).</b>
 	 *      <i>Security-Improved Minutiae-Based Fuzzy Vault</i>.
@@ -1017,11 +1037,11 @@ namespace thimble {
 		 *             than <i>k</i>.
 		 *
 		 * @param hash
-		 *             160-bit hash value of the correct secret polynomial
+		 *             Hash value of the correct secret polynomial
 		 *             <i>f</i>, that has been originally computed via an
 		 *             equivalent to
 		 *             <code>
-		 *              SHA().hash(hash,f.getData(),f.deg()+1)
+		 *              Hash(getHashAlgorithm()).hash(hash,f.getData(),f.deg()+1)
 		 *             </code>
 		 *
 		 * @param D
@@ -1033,7 +1053,7 @@ namespace thimble {
 		 */
 		virtual bool decode
 		( SmallBinaryFieldPolynomial & f , const uint32_t *x , const uint32_t *y ,
-		  int t , int k , const uint8_t hash[20] , int D ) const;
+		  int t , int k , const uint8_t *hash , int D ) const;
 
 		/**
 		 * @brief
@@ -1515,6 +1535,98 @@ namespace thimble {
 		SmallBinaryFieldPolynomial unpackVaultPolynomial
 		( const BigInteger & slowDownVal = BigInteger(0) ) const;
 
+		/**
+		 * @brief
+		 *            Unpacks the vault polynomial for a slow-down value
+		 *            given as an unsigned 64-bit integer.
+		 *
+		 * @details
+		 *            Works as
+		 *            \link unpackVaultPolynomial(const BigInteger&)const\endlink
+		 *            but without any big integer arithmetic. For the same
+		 *            slow-down value, both functions derive the same key
+		 *            and thus return the same candidate. The function is
+		 *            used by \link open()\endlink if the slow-down factor
+		 *            fits into 64 bits.
+		 *
+		 * @param slowDownVal
+		 *            A guess for the slow-down value.
+		 *
+		 * @return
+		 *            A candidate for the correct vault polynomial (which is
+		 *            correct if the guess for the slow-down value is correct).
+		 *
+		 * @warning
+		 *            If this object does not contain (a candidate) for decrypted
+		 *            vault polynomial data, i.e.,
+		 *            if \link isDecrypted()\endlink returns <code>false</code>,
+		 *            then an error message will be printed to
+		 *            <code>stderr</code> and the program exits with status
+		 *            'EXIT_FAILURE'.
+		 *
+		 * @warning
+		 *            If <code>slowDownVal</code> is greater than or equals
+		 *            \link getSlowDownFactor()\endlink, then an
+		 *            error message will be printed to <code>stderr</code> and
+		 *            the program exits with status 'EXIT_FAILURE'.
+		 *
+		 * @warning
+		 *            If not enough memory could be allocated, an error message
+		 *            will be printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		SmallBinaryFieldPolynomial unpackVaultPolynomial
+		( uint64_t slowDownVal ) const;
+
+		/**
+		 * @brief
+		 *            Unpacks the vault polynomials for consecutive
+		 *            slow-down values.
+		 *
+		 * @details
+		 *            The result equals the successive calls
+		 *            <pre>
+		 *             V[l] = unpackVaultPolynomial(slowDownVal+l)
+		 *            </pre>
+		 *            for <code>l=0,...,num-1</code>, but the vault data
+		 *            is decrypted under the keys of several slow-down
+		 *            values at once (see
+		 *            \link AES128::decryptBatch()\endlink) as done by
+		 *            \link open()\endlink.
+		 *
+		 * @param V
+		 *            Array of <code>num</code> polynomials to which the
+		 *            candidates for the vault polynomial are assigned.
+		 *
+		 * @param slowDownVal
+		 *            The first guess for the slow-down value.
+		 *
+		 * @param num
+		 *            The number of slow-down values.
+		 *
+		 * @warning
+		 *            If this object does not contain (a candidate) for decrypted
+		 *            vault polynomial data, i.e.,
+		 *            if \link isDecrypted()\endlink returns <code>false</code>,
+		 *            then an error message will be printed to
+		 *            <code>stderr</code> and the program exits with status
+		 *            'EXIT_FAILURE'.
+		 *
+		 * @warning
+		 *            If <code>num</code> is negative or if
+		 *            <code>slowDownVal+num</code> is greater than
+		 *            \link getSlowDownFactor()\endlink, then an
+		 *            error message will be printed to <code>stderr</code> and
+		 *            the program exits with status 'EXIT_FAILURE'.
+		 *
+		 * @warning
+		 *            If not enough memory could be allocated, an error message
+		 *            will be printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		void unpackVaultPolynomials
+		( SmallBinaryFieldPolynomial *V , uint64_t slowDownVal , int num ) const;
+
 		/**
 		 * @brief
 		 *            Returns the slow-down factor used to artifically
@@ -1544,13 +1656,15 @@ namespace thimble {
 
 		/**
 		 * @brief
-		 *             Access the SHA-1 hash value of the secret key
+		 *             Access the hash value of the secret key
 		 *             generated on enrollment used to obfuscate the
 		 *             correct minutiae template's quantization.
 		 *
 		 * @return
-		 *             The SHA-1 hash value of the secret key used to
-		 *             obfuscate the correct minutiae template's quantization.
+		 *             The hash value of the secret key used to obfuscate
+		 *             the correct minutiae template's quantization; its
+		 *             size is <code>Hash::getDigestSize(getHashAlgorithm())</code>
+		 *             bytes, i.e., 20 bytes for the default SHA-1.
 		 *
 		 * @warning
 		 *             If \link isEnrolled()\endlink returns
@@ -1560,6 +1674,18 @@ namespace thimble {
 		 */
 		const uint8_t *getHash() const;
 
+		/**
+		 * @brief
+		 *             Access the hash function by which the secret key is
+		 *             verified.
+		 *
+		 * @return
+		 *             The hash function of this protected minutiae template.
+		 *
+		 * @see setHashAlgorithm()
+		 */
+		HASH_ALGORITHM_T getHashAlgorithm() const;
+
 		/**
 		 * @brief
 		 *             Change the dimension of the fingerprint images
@@ -1796,6 +1922,33 @@ namespace thimble {
 		 */
 		void setSlowDownFactor( const BigInteger & slowDownFactor );
 
+		/**
+		 * @brief
+		 *            Specifies the hash function by which the secret key
+		 *            is verified and from which the keys of the slow-down
+		 *            mechanism are derived.
+		 *
+		 * @details
+		 *            By default, SHA-1 is used and the template is
+		 *            serialized in the original format. Otherwise, the
+		 *            hash function is recorded in the serialized
+		 *            template; faster hash functions, such as BLAKE2s,
+		 *            reduce the time for checking candidate polynomials.
+		 *
+		 * @param algorithm
+		 *            The hash function.
+		 *
+		 * @see getHashAlgorithm()
+		 *
+		 * @warning
+		 *            If this protected minutiae template object already
+		 *            contains protected data, i.e.,
+		 *            if \link isEnrolled()\endlink returns <code>true</code>,
+		 *            an error message will be printed to <code>stderr</code>
+		 *            and the program exits with status 'EXIT_FAILURE'.
+		 */
+		void setHashAlgorithm( HASH_ALGORITHM_T algorithm );
+
 		/**
 		 * @brief
 		 *             Clears all data that is related with a minutiae
@@ -2018,6 +2171,10 @@ namespace thimble {
 		 *            \f$A=\{array1[0],...,array1[t1-1]\}\f$
 		 *            and \f$B=\{array2[0],...,array2[t2-1]\}\f$ the result
 		 *            will be \f$|A\cap B|\f$.
+		 *            <br><br>
+		 *            The implementation sorts copies of both arrays and
+		 *            merges them which requires
+		 *            \f$O(t1\cdot\log t1+t2\cdot\log t2)\f$ operations.
 		 *
 		 * @param array1
 		 *            First array.
@@ -2041,6 +2198,11 @@ namespace thimble {
 		 *            contain at least <code>t1</code> and <code>t2</code>
 		 *            valid <code>uint32_t</code>, respectively, the
 		 *            function runs into undocumented behavior.
+		 *
+		 * @warning
+		 *            If not enough memory could be provided, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
 		 */
 		static int overlap
 		( const uint32_t *array1 , int t1 , const uint32_t *array2 , int t2 );
@@ -2321,7 +2483,17 @@ namespace thimble {
 
 		/**
 		 * @brief
-		 *            SHA-1 hash value of the secret polynomial protecting
+		 *            The hash function by which \link hash\endlink is
+		 *            computed.
+		 *
+		 * @see getHashAlgorithm()
+		 * @see setHashAlgorithm()
+		 */
+		HASH_ALGORITHM_T hashAlgorithm;
+
+		/**
+		 * @brief
+		 *            Hash value of the secret polynomial protecting
 		 *            the enrolled minutiae template's quantization.
 		 *
 		 * @details
@@ -2329,15 +2501,17 @@ namespace thimble {
 		 *            a \link MinutiaeView minutiae template\endlink is bound
 		 *            to a \link SmallBinaryFieldPolynomial
 		 *            secret polynomial\endlink of which any data is dismissed
-		 *            except of its SHA-1 hash value which is stored in this
-		 *            field.
+		 *            except of its hash value which is stored in this
+		 *            field. Only the first
+		 *            <code>Hash::getDigestSize(hashAlgorithm)</code>
+		 *            bytes are used.
 		 *
 		 *            The getter for this field is the
 		 *            \link getHash()\endlink function.
 		 *
 		 * @see getHash()
 		 */
-		uint8_t hash[20];
+		uint8_t hash[Hash::MAX_DIGEST_SIZE];
 
 		/**
 		 * @brief
@@ -2647,6 +2821,10 @@ namespace thimble {
 		 *            The integer of which an AES key is computed with
 		 *            this function.
 		 *
+		 * @param algorithm
+		 *            The hash function of which the first 16 bytes of the
+		 *            hash value of <code>x</code> form the key.
+		 *
 		 * @return
 		 *            The AES key derived from <code>x</code>.
 		 *
@@ -2655,7 +2833,81 @@ namespace thimble {
 		 *             is printed <code>stderr</code> and the program exits
 		 *             with status 'EXIT_FAILURE'
 		 */
-		static AES128 deriveKey( const BigInteger & x );
+		static AES128 deriveKey
+		( const BigInteger & x , HASH_ALGORITHM_T algorithm = HASH_SHA1 );
+
+		/**
+		 * @brief
+		 *            Derives an AES key from the specified unsigned
+		 *            64-bit integer.
+		 *
+		 * @details
+		 *            The key agrees with the key returned
+		 *            by \link deriveKey(const BigInteger&,HASH_ALGORITHM_T)\endlink
+		 *            for the same integer, i.e., the hashed bytes are
+		 *            the same as written by
+		 *            \link BigInteger::toBytes()\endlink; but these are
+		 *            written to a stack buffer without creating a
+		 *            \link BigInteger\endlink.
+		 *
+		 * @param x
+		 *            The integer of which an AES key is computed with
+		 *            this function.
+		 *
+		 * @param algorithm
+		 *            The hash function of which the first 16 bytes of the
+		 *            hash value of <code>x</code> form the key.
+		 *
+		 * @return
+		 *            The AES key derived from <code>x</code>.
+		 */
+		static AES128 deriveKey
+		( uint64_t x , HASH_ALGORITHM_T algorithm = HASH_SHA1 );
+
+		/**
+		 * @brief
+		 *            Decrypts and unpacks the vault polynomial using the
+		 *            specified AES key.
+		 *
+		 * @details
+		 *            Helper for both variants
+		 *            of \link unpackVaultPolynomial()\endlink after the key
+		 *            has been derived from the slow-down value.
+		 *
+		 * @param aes
+		 *            The key derived from a guess of the slow-down value.
+		 *
+		 * @return
+		 *            A candidate for the vault polynomial.
+		 *
+		 * @warning
+		 *            If not enough memory could be allocated, an error message
+		 *            will be printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
+		 */
+		SmallBinaryFieldPolynomial decryptVaultPolynomial
+		( AES128 & aes ) const;
+
+		/**
+		 * @brief
+		 *            Unpacks the vault polynomial from decrypted vault
+		 *            data.
+		 *
+		 * @param data
+		 *            Array of \link vaultDataSize()\endlink bytes
+		 *            decrypted with a key derived from a guess of the
+		 *            slow-down value.
+		 *
+		 * @return
+		 *            A candidate for the vault polynomial.
+		 *
+		 * @warning
+		 *            If not enough memory could be allocated, an error
+		 *            message will be printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		SmallBinaryFieldPolynomial toVaultPolynomial
+		( const uint8_t *data ) const;
 
 		/**
 		 * @brief
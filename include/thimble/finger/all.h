@@ -32,8 +32,11 @@
 #define THIMBLE_FINGER_ALL_H_
 
 #include <thimble/finger/FingerTools.h>
+#include <thimble/finger/MinutiaeArrays.h>
 #include <thimble/finger/MinutiaeFuzzyVault.h>
 #include <thimble/finger/MinutiaeRecord.h>
+#include <thimble/finger/MinutiaeRecordView.h>
+#include <thimble/finger/MinutiaeRecordArchive.h>
 #include <thimble/finger/FuzzyVaultBake.h>
 // #include <thimble/finger/ProtectedMinutiaeTemplate.h>
 #include <thimble/finger/ProtectedMinutiaeRecord.h>
@@ -0,0 +1,322 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file IndexSampler.h
+ *
+ * @brief
+ *            Provides a class for repeatedly choosing subsets of
+ *            pairwise distinct indices at random.
+ *
+ * @author agent
+ */
+
+#ifndef THIMBLE_INDEXSAMPLER_H_
+#define THIMBLE_INDEXSAMPLER_H_
+
+#include <stdint.h>
+
+#include <thimble/dllcompat.h>
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/**
+	 * @brief
+	 *            Objects of this class choose <i>k</i> pairwise distinct
+	 *            indices from the range <i>0,...,n-1</i> at random.
+	 *
+	 * @details
+	 *            The sampler performs a partial Fisher-Yates shuffle on a
+	 *            persistent array of the <i>n</i> indices. Since the array
+	 *            remains a permutation of <i>0,...,n-1</i> after each
+	 *            draw, it does not need to be reset and a draw of <i>k</i>
+	 *            indices costs <i>O(k)</i> operations; no memory is
+	 *            allocated after \link setRange()\endlink.
+	 *
+	 *            The random numbers are generated by a xoshiro256**
+	 *            generator owned by the sampler. Thus, the sampler does
+	 *            not depend on the standard <code>rand()</code> function
+	 *            and is not limited to ranges up to <code>RAND_MAX</code>.
+	 *            A sampler is not synchronized: each thread should use a
+	 *            sampler object of its own.
+	 *
+	 * @warning
+	 *            The xoshiro256** generator is fast but not
+	 *            cryptographically secure; samplers are intended for
+	 *            attacks and simulations, not for generating secrets.
+	 */
+	class THIMBLE_DLL IndexSampler {
+
+	public:
+
+		/**
+		 * @brief
+		 *            Creates a sampler choosing indices from the range
+		 *            <i>0,...,n-1</i>.
+		 *
+		 * @details
+		 *            The generator of the sampler is seeded by
+		 *            <code>MathTools::rand64(tryRandom)</code>.
+		 *
+		 * @param n
+		 *            The size of the range.
+		 *
+		 * @param tryRandom
+		 *            If <code>true</code> the seed is generated from a
+		 *            random source with more entropy; otherwise, it is
+		 *            generated using the standard <code>rand()</code>
+		 *            function.
+		 *
+		 * @warning
+		 *            If not enough memory could be provided, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		IndexSampler( uint32_t n = 0 , bool tryRandom = false );
+
+		/**
+		 * @brief
+		 *            Copy constructor.
+		 *
+		 * @details
+		 *            The copy continues the same sequence of random
+		 *            numbers as <i>sampler</i>.
+		 *
+		 * @param sampler
+		 *            The sampler of which a copy is created.
+		 *
+		 * @warning
+		 *            If not enough memory could be provided, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		IndexSampler( const IndexSampler & sampler );
+
+		/**
+		 * @brief
+		 *            Destructor.
+		 */
+		~IndexSampler();
+
+		/**
+		 * @brief
+		 *            Assignment operator.
+		 *
+		 * @param sampler
+		 *            The sampler of which this instance is assigned a
+		 *            copy of.
+		 *
+		 * @return
+		 *            A reference to this instance (after assignment).
+		 *
+		 * @warning
+		 *            If not enough memory could be provided, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		IndexSampler &operator=( const IndexSampler & sampler );
+
+		/**
+		 * @brief
+		 *            Changes the range from which indices are chosen
+		 *            to <i>0,...,n-1</i>.
+		 *
+		 * @param n
+		 *            The size of the range.
+		 *
+		 * @warning
+		 *            If not enough memory could be provided, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		void setRange( uint32_t n );
+
+		/**
+		 * @brief
+		 *            Access the size of the range from which indices are
+		 *            chosen.
+		 *
+		 * @return
+		 *            The size <i>n</i> of the range <i>0,...,n-1</i>.
+		 */
+		inline uint32_t getRange() const {
+			return this->n;
+		}
+
+		/**
+		 * @brief
+		 *            Re-seeds the generator of this sampler.
+		 *
+		 * @details
+		 *            The 256-bit state of the generator is derived from
+		 *            <i>seed</i> via SplitMix64. Two samplers of equal
+		 *            range seeded with the same value produce the same
+		 *            sequence of subsets.
+		 *
+		 * @param seed
+		 *            The seed.
+		 */
+		void seed( uint64_t seed );
+
+		/**
+		 * @brief
+		 *            Generates the next pseudo-random 64-bit number.
+		 *
+		 * @return
+		 *            A pseudo-random unsigned 64-bit integer.
+		 */
+		inline uint64_t next() {
+
+			uint64_t *s = this->state;
+			uint64_t result = rotl(s[1] * 5, 7) * 9;
+			uint64_t t = s[1] << 17;
+
+			s[2] ^= s[0];
+			s[3] ^= s[1];
+			s[1] ^= s[2];
+			s[0] ^= s[3];
+			s[2] ^= t;
+			s[3] = rotl(s[3], 45);
+
+			return result;
+		}
+
+		/**
+		 * @brief
+		 *            Generates a pseudo-random integer uniformly
+		 *            distributed in the range <i>0,...,bound-1</i>.
+		 *
+		 * @details
+		 *            The method uses Lemire's multiply-and-shift
+		 *            reduction which rejects only the few values that
+		 *            would bias the result.
+		 *
+		 * @param bound
+		 *            The (exclusive) upper bound; must be greater than 0.
+		 *
+		 * @return
+		 *            An integer in the range <i>0,...,bound-1</i>.
+		 */
+		inline uint32_t uniform( uint32_t bound ) {
+
+			uint64_t m = (uint64_t)(uint32_t)(next() >> 32) * bound;
+			uint32_t l = (uint32_t)m;
+
+			if ( l < bound ) {
+				uint32_t threshold = (uint32_t)(-bound) % bound;
+				while ( l < threshold ) {
+					m = (uint64_t)(uint32_t)(next() >> 32) * bound;
+					l = (uint32_t)m;
+				}
+			}
+
+			return (uint32_t)(m >> 32);
+		}
+
+		/**
+		 * @brief
+		 *            Chooses <i>k</i> pairwise distinct indices from the
+		 *            range <i>0,...,n-1</i> at random.
+		 *
+		 * @param indices
+		 *            Will contain <i>k</i> pairwise distinct integers
+		 *            in the range <i>0,...,n-1</i>.
+		 *
+		 * @param k
+		 *            The number of indices to be chosen.
+		 *
+		 * @warning
+		 *            If <i>k</i> is greater than the size <i>n</i> of the
+		 *            range, an error message is printed to
+		 *            <code>stderr</code> and the program exits with
+		 *            status 'EXIT_FAILURE'.
+		 *
+		 * @warning
+		 *            If <code>indices</code> cannot store at least
+		 *            <i>k</i> integers, the method runs into undocumented
+		 *            behavior.
+		 */
+		void choose( uint32_t *indices , uint32_t k );
+
+		/**
+		 * @brief
+		 *            Chooses <i>k</i> pairwise distinct indices from the
+		 *            range <i>0,...,n-1</i> at random.
+		 *
+		 * @details
+		 *            Same as \link choose(uint32_t*,uint32_t)\endlink but
+		 *            for ranges whose size does not exceed
+		 *            <code>INT_MAX</code>.
+		 *
+		 * @param indices
+		 *            Will contain <i>k</i> pairwise distinct integers
+		 *            in the range <i>0,...,n-1</i>.
+		 *
+		 * @param k
+		 *            The number of indices to be chosen.
+		 *
+		 * @warning
+		 *            If <i>k</i> is negative or greater than the size
+		 *            <i>n</i> of the range, an error message is printed
+		 *            to <code>stderr</code> and the program exits with
+		 *            status 'EXIT_FAILURE'.
+		 *
+		 * @warning
+		 *            If <code>indices</code> cannot store at least
+		 *            <i>k</i> integers, the method runs into undocumented
+		 *            behavior.
+		 */
+		void choose( int *indices , int k );
+
+	private:
+
+		/**
+		 * @brief
+		 *            Rotates a 64-bit word to the left.
+		 */
+		static inline uint64_t rotl( uint64_t x , int r ) {
+			return (x << r) | (x >> (64 - r));
+		}
+
+		/**
+		 * @brief
+		 *            The size of the range from which indices are chosen.
+		 */
+		uint32_t n;
+
+		/**
+		 * @brief
+		 *            A permutation of the indices <i>0,...,n-1</i> which
+		 *            is shuffled partially on each draw.
+		 */
+		uint32_t *range;
+
+		/**
+		 * @brief
+		 *            The state of the xoshiro256** generator.
+		 */
+		uint64_t state[4];
+	};
+}
+
+#endif /* THIMBLE_INDEXSAMPLER_H_ */
@@ -138,6 +138,38 @@ namespace thimble {
          */
         static int hammingWeight( register uint64_t n );
 
+        /**
+         * @brief
+         *            Determines the position of the least significant
+         *            non-zero bit of an integer.
+         *
+         * @details
+         *            Returns the largest <i>j</i> such that \f$2^j\f$
+         *            divides <i>n</i>, i.e., the number of trailing zero
+         *            bits of <i>n</i>.
+         *
+         * @param n
+         *            The integer of which the trailing zeros are counted.
+         *
+         * @return
+         *            The number of trailing zero bits of <i>n</i>.
+         *
+         * @warning
+         *            If <i>n</i> is zero, the result is undocumented.
+         */
+        inline static int trailingZeros( uint64_t n ) {
+#if defined(__GNUC__)
+            return __builtin_ctzll(n);
+#else
+            int j = 0;
+            while ( !(n & 0x1) ) {
+                n >>= 1;
+                ++j;
+            }
+            return j;
+#endif
+        }
+
 
         /**
          * @brief
@@ -312,6 +344,14 @@ namespace thimble {
          *             An array of <code>n</code> valid 64 bit integers that
          *             encodes <code>64*n</code> bits.
          *
+         * @details
+         *             Depending on the processor, the bits are counted
+         *             with the 'AVX-512 VPOPCNTDQ', the 'AVX2' or the
+         *             'POPCNT' instructions
+         *             (see \link hasAvx512Vpopcntdq()\endlink,
+         *             \link hasAvx2()\endlink and
+         *             \link hasPopcnt()\endlink).
+         *
          * @param n
          *             The number of valid 64 bit integers contained in
          *             <code>v</code>.
@@ -405,6 +445,40 @@ namespace thimble {
         ( register const uint64_t *v , register const uint64_t *w ,
           register int n );
 
+        /**
+         * @brief
+         *             Determines the Hamming distances between a bit-vector
+         *             and each bit-vector of a contiguous gallery.
+         *
+         * @details
+         *             The gallery <code>W</code> consists of
+         *             <code>num</code> bit-vectors of <code>n</code>
+         *             64-bit integers each, stored one after another. The
+         *             kernel used by \link hd64()\endlink is selected
+         *             only once for the whole gallery.
+         *
+         * @param d
+         *             On output, <code>d[l]</code> is the Hamming
+         *             distance between <code>(v,n)</code> and
+         *             <code>(W+l*n,n)</code>; must be able to hold
+         *             <code>num</code> integers.
+         *
+         * @param v
+         *             An array of <code>n</code> valid 64 bit integers.
+         *
+         * @param W
+         *             An array of <code>num*n</code> valid 64 bit
+         *             integers.
+         *
+         * @param n
+         *             The number of 64 bit integers per bit-vector.
+         *
+         * @param num
+         *             The number of bit-vectors in <code>W</code>.
+         */
+        static void hd64Batch
+        ( int *d , const uint64_t *v , const uint64_t *W , int n , int num );
+
         /**
          * @brief
          *             Determines the Hamming distance between two bit-vectors
@@ -494,6 +568,187 @@ namespace thimble {
 		 */
 		static uint64_t clmul( uint32_t a , uint32_t b );
 
+        /**
+         * @brief
+         *            Computes the carry-less product of two 64-bit
+         *            integers.
+         *
+         * @details
+         *            The generic implementation processes the second
+         *            factor in windows of 4 bits using a table of the
+         *            16 carry-less multiples of the first factor.
+         *
+         * @param a
+         *            first factor
+         *
+         * @param b
+         *            second factor
+         *
+         * @param hi
+         *            On output, the upper 64 bits of the 128-bit
+         *            carry-less product of <code>a</code> and
+         *            <code>b</code>.
+         *
+         * @return    the lower 64 bits of the carry-less product of
+         *            <code>a</code> and <code>b</code>
+         */
+        static uint64_t clmul64( uint64_t a , uint64_t b , uint64_t & hi );
+
+        /**
+         * @brief
+         *            Tests whether the processor on which the program
+         *            runs supports the 'PCLMULQDQ' instruction.
+         *
+         * @details
+         *            The processor is queried via 'cpuid' only once
+         *            and the result is remembered for subsequent
+         *            calls. If the library has not been compiled with
+         *            GCC for x86-64, the function always returns
+         *            <code>false</code>.
+         *
+         * @return
+         *            <code>true</code> if carry-less multiplication is
+         *            supported by the processor; otherwise
+         *            <code>false</code>.
+         */
+        static bool hasPclmulqdq();
+
+        /**
+         * @brief
+         *            Tests whether the processor on which the program
+         *            runs supports the 'AVX2' instruction set.
+         *
+         * @details
+         *            The processor is queried via 'cpuid' only once
+         *            and the result is remembered for subsequent
+         *            calls. If the library has not been compiled with
+         *            GCC for x86-64, the function always returns
+         *            <code>false</code>.
+         *
+         * @return
+         *            <code>true</code> if 256-bit integer vector
+         *            instructions are supported by the processor;
+         *            otherwise <code>false</code>.
+         */
+        static bool hasAvx2();
+
+        /**
+         * @brief
+         *            Tests whether the processor on which the program
+         *            runs supports the 'POPCNT' instruction.
+         *
+         * @details
+         *            The processor is queried via 'cpuid' only once
+         *            and the result is remembered for subsequent
+         *            calls. If the library has not been compiled with
+         *            GCC for x86-64, the function always returns
+         *            <code>false</code>.
+         *
+         * @return
+         *            <code>true</code> if the population count
+         *            instruction is supported by the processor;
+         *            otherwise <code>false</code>.
+         */
+        static bool hasPopcnt();
+
+        /**
+         * @brief
+         *            Tests whether the processor on which the program
+         *            runs supports the 'AVX-512 VPOPCNTDQ' instructions.
+         *
+         * @details
+         *            The processor is queried via 'cpuid' only once
+         *            and the result is remembered for subsequent
+         *            calls. If the library has not been compiled with
+         *            GCC for x86-64, the function always returns
+         *            <code>false</code>.
+         *
+         * @return
+         *            <code>true</code> if the 512-bit vector population
+         *            count instructions are supported by the processor;
+         *            otherwise <code>false</code>.
+         */
+        static bool hasAvx512Vpopcntdq();
+
+        /**
+         * @brief
+         *            Tests whether the processor on which the program
+         *            runs supports the 'AES-NI' instructions.
+         *
+         * @details
+         *            The processor is queried via 'cpuid' only once
+         *            and the result is remembered for subsequent
+         *            calls. If the library has not been compiled with
+         *            GCC for x86-64, the function always returns
+         *            <code>false</code>.
+         *
+         * @return
+         *            <code>true</code> if the AES round instructions
+         *            are supported by the processor; otherwise
+         *            <code>false</code>.
+         */
+        static bool hasAesni();
+
+        /**
+         * @brief
+         *            Tests whether the processor on which the program
+         *            runs supports the 'SHA' extensions.
+         *
+         * @details
+         *            The processor is queried via 'cpuid' only once
+         *            and the result is remembered for subsequent
+         *            calls. If the library has not been compiled with
+         *            GCC for x86-64, the function always returns
+         *            <code>false</code>.
+         *
+         * @return
+         *            <code>true</code> if the SHA-1 and SHA-256 round
+         *            instructions are supported by the processor;
+         *            otherwise <code>false</code>.
+         */
+        static bool hasSha();
+
+        /**
+         * @brief
+         *            Tests whether the processor on which the program
+         *            runs supports the 'SSSE3' instructions.
+         *
+         * @details
+         *            The processor is queried via 'cpuid' only once
+         *            and the result is remembered for subsequent
+         *            calls. If the library has not been compiled with
+         *            GCC for x86-64, the function always returns
+         *            <code>false</code>.
+         *
+         * @return
+         *            <code>true</code> if the byte shuffle instructions
+         *            are supported by the processor; otherwise
+         *            <code>false</code>.
+         */
+        static bool hasSsse3();
+
+        /**
+         * @brief
+         *            Transposes a 64x64 bit matrix in place.
+         *
+         * @details
+         *            The matrix is given by 64 rows of which the
+         *            <i>i</i>th is stored in <code>A[i]</code> such that
+         *            the entry in the <i>j</i>th column is the
+         *            <i>j</i>th bit of <code>A[i]</code>. On output, the
+         *            <i>j</i>th bit of <code>A[i]</code> equals the
+         *            <i>i</i>th bit of the input <code>A[j]</code>.
+         *
+         *            The implementation swaps blocks of 32x32, 16x16,...,
+         *            1x1 bits following the recursive approach described
+         *            in <b>Warren (2012)</b>. <i>Hacker's Delight</i>,
+         *            2nd edition, Section 7-3.
+         *
+         * @param A
+         *            Array of 64 integers of 64-bit width.
+         */
+        static void transpose64( uint64_t *A );
+
         /**
          * @brief
          *            Performs exclusive or operations on arrays of 64-bit
@@ -523,6 +778,9 @@ namespace thimble {
          *            <code>in2</code> are allowed to be equals but not
          *            to overlap at a position different from 0.
          *
+         *            If \link hasAvx2()\endlink returns <code>true</code>,
+         *            256 bits are processed per instruction.
+         *
          * @warning
          *            If the requirements above are not fulfilled, the method
          *            runs into undocumented behaviour.
@@ -0,0 +1,383 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file RevolvingDoorIterator.h
+ *
+ * @brief
+ *            Provides a mechanism for iterating through all choices of
+ *            <i>k</i> elements from a vector of size <i>n</i> such that
+ *            successive choices differ in exactly one element.
+ *
+ * @author agent
+ *
+ * @see thimble::RevolvingDoorIterator
+ */
+
+#ifndef THIMBLE_REVOLVINGDOORITERATOR_H_
+#define THIMBLE_REVOLVINGDOORITERATOR_H_
+
+#include <stdint.h>
+#include <cstdlib>
+
+#include <thimble/dllcompat.h>
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/**
+	 * @brief
+	 *            Iterates through all choices of <i>k</i> from <i>n</i>
+	 *            indices in revolving-door order.
+	 *
+	 * @details
+	 *            In contrast to the \link BinomialIterator\endlink which
+	 *            enumerates the choices in lexicographic order, each
+	 *            call of \link next()\endlink replaces exactly one index
+	 *            of the current choice by an index not contained in the
+	 *            current choice, which can be accessed via
+	 *            \link getRemoved()\endlink and \link getAdded()\endlink.
+	 *            Algorithms that maintain data depending on the current
+	 *            choice, e.g., an interpolation polynomial, can thereby
+	 *            be updated instead of being recomputed.
+	 *
+	 *            Each choice has a rank in the range
+	 *            <i>0,...,</i>\link getCount()\endlink<i>-1</i> and
+	 *            \link unrank()\endlink directly jumps to the choice of
+	 *            a given rank. Thus, the enumeration can be split into
+	 *            disjoint rank ranges processed by different threads,
+	 *            each thread holding an iterator of its own.
+	 *
+	 *            The implementation follows the revolving-door algorithms
+	 *            of Kreher and Stinson, <i>Combinatorial Algorithms:
+	 *            Generation, Enumeration, and Search</i>, Section 2.3.3.
+	 *
+	 * @see BinomialIterator
+	 */
+	class THIMBLE_DLL RevolvingDoorIterator {
+
+	public:
+
+		/**
+		 * @brief
+		 *            Creates an iterator through all choices of <i>k</i>
+		 *            from <i>n</i> indices which is initialized with the
+		 *            choice <i>0,...,k-1</i> of rank 0.
+		 *
+		 * @param n
+		 *            Size of the arrays from where <i>k</i> elements are
+		 *            chosen in each iteration.
+		 *
+		 * @param k
+		 *            Specifies the number of elements that are chosen from
+		 *            an array of size <i>n</i> in each iteration.
+		 *
+		 * @warning
+		 *            If <i>n</i> or <i>k</i> is smaller than zero or if
+		 *            <i>n</i> is smaller than <i>k</i>, an error message
+		 *            will be written to <code>stderr</code> and an exit
+		 *            with status 'EXIT_FAILURE' will be caused.
+		 *
+		 * @warning
+		 *            If not sufficient memory could be provided, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		RevolvingDoorIterator( int n , int k );
+
+		/**
+		 * @brief
+		 *            Copy constructor.
+		 *
+		 * @param it
+		 *            The iterator of which a copy is created.
+		 *
+		 * @warning
+		 *            If not sufficient memory could be provided, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		RevolvingDoorIterator( const RevolvingDoorIterator & it );
+
+		/**
+		 * @brief
+		 *            Destructor.
+		 */
+		~RevolvingDoorIterator();
+
+		/**
+		 * @brief
+		 *            Assignment operator.
+		 *
+		 * @param it
+		 *            The iterator of which this instance is assigned a
+		 *            copy of.
+		 *
+		 * @return
+		 *            A reference to this instance (after assignment).
+		 *
+		 * @warning
+		 *            If not sufficient memory could be provided, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		RevolvingDoorIterator &operator=( const RevolvingDoorIterator & it );
+
+		/**
+		 * @brief
+		 *            Changes the iterator's state to the choice of the
+		 *            next rank.
+		 *
+		 * @details
+		 *            The new choice differs from the previous choice in
+		 *            exactly one index; the index that has been replaced
+		 *            and the index that replaced it can be accessed via
+		 *            \link getRemoved()\endlink and
+		 *            \link getAdded()\endlink, respectively. The run-time
+		 *            is <i>O(k)</i> in the worst case and constant on
+		 *            average.
+		 *
+		 * @return
+		 *            <code>true</code> if the iterator's state changed
+		 *            successfully; otherwise, if the iterator has reached
+		 *            the choice of rank \link getCount()\endlink<i>-1</i>,
+		 *            the result will be <code>false</code> and the state
+		 *            remains unchanged.
+		 */
+		bool next();
+
+		/**
+		 * @brief
+		 *            Sets the iterator's state to the choice of the
+		 *            specified rank.
+		 *
+		 * @details
+		 *            If the number of choices cannot be represented by
+		 *            64 bits, the choices of some ranks cannot be
+		 *            determined with 64-bit arithmetic; then the
+		 *            iterator's state remains unchanged and the
+		 *            function returns <code>false</code>. The choice of
+		 *            rank 0 can always be determined.
+		 *
+		 * @param rank
+		 *            The rank of the choice.
+		 *
+		 * @return
+		 *            <code>true</code> if the iterator's state has been
+		 *            set to the choice of the specified rank; otherwise,
+		 *            <code>false</code>.
+		 *
+		 * @warning
+		 *            If <code>rank</code> is not smaller than
+		 *            \link getCount()\endlink, an error message will be
+		 *            written to <code>stderr</code> and an exit with status
+		 *            'EXIT_FAILURE' will be caused.
+		 */
+		bool unrank( uint64_t rank );
+
+		/**
+		 * @brief
+		 *            Access the rank of the current choice.
+		 *
+		 * @return
+		 *            The rank of the current choice.
+		 */
+		inline uint64_t getRank() const {
+			return this->rank;
+		}
+
+		/**
+		 * @brief
+		 *            Access the number of all choices of <i>k</i> from
+		 *            <i>n</i> indices.
+		 *
+		 * @return
+		 *            The binomial coefficient &quot;<i>n</i> over
+		 *            <i>k</i>&quot; or <code>UINT64_MAX</code> if it
+		 *            cannot be represented by 64 bits; in the latter
+		 *            case, \link next()\endlink stops at the choice of
+		 *            rank <code>UINT64_MAX-1</code>.
+		 */
+		inline uint64_t getCount() const {
+			return this->count;
+		}
+
+		/**
+		 * @brief
+		 *            Access the size of the array from where <i>k</i>
+		 *            entries of different positions are selected.
+		 *
+		 * @return
+		 *            The size of the array from where <i>k</i> entries
+		 *            of different positions are selected.
+		 */
+		inline int get_n() const { return this->n; }
+
+		/**
+		 * @brief
+		 *            Access the number of entries of different positions
+		 *            that are selected.
+		 *
+		 * @return
+		 *            The number of entries of different positions that are
+		 *            selected.
+		 */
+		inline int get_k() const { return this->k; }
+
+		/**
+		 * @brief
+		 *            Access the indices of the current choice.
+		 *
+		 * @return
+		 *            An array of <i>k</i> indices in the range
+		 *            <i>0,...,n-1</i> sorted in ascending order.
+		 */
+		inline const int *getIndices() const {
+			return this->indices + 1;
+		}
+
+		/**
+		 * @brief
+		 *            Access the index that has been removed from the
+		 *            choice by the last call of \link next()\endlink.
+		 *
+		 * @return
+		 *            The removed index or -1 if the state of the iterator
+		 *            has not been changed by \link next()\endlink since
+		 *            its construction or the last call of
+		 *            \link unrank()\endlink.
+		 */
+		inline int getRemoved() const {
+			return this->removed;
+		}
+
+		/**
+		 * @brief
+		 *            Access the index that has been added to the choice
+		 *            by the last call of \link next()\endlink.
+		 *
+		 * @return
+		 *            The added index or -1 if the state of the iterator
+		 *            has not been changed by \link next()\endlink since
+		 *            its construction or the last call of
+		 *            \link unrank()\endlink.
+		 */
+		inline int getAdded() const {
+			return this->added;
+		}
+
+		/**
+		 * @brief
+		 *            Selects <i>k</i> elements of different position from
+		 *            <code>array</code> corresponding to the iterator's
+		 *            state and stores them successively in
+		 *            <code>selection</code>.
+		 *
+		 * @param selection
+		 *            Will contain <i>k=</i>\link get_k()\endlink choices
+		 *            of different positions from the first
+		 *            <i>n</i>=\link get_n()\endlink entries of
+		 *            <code>array</code>.
+		 *
+		 * @param array
+		 *            Array from where to choose <i>k</i> entries.
+		 *
+		 * @warning
+		 *            If <code>array</code> does not contain at least <i>n</i>
+		 *            valid entries of type <code>T</code> or if
+		 *            <code>selection</code> cannot hold at least <i>k</i>
+		 *            entries the behavior of the method is undocumented.
+		 */
+		template <class T>
+		inline void select( T *selection , const T *array ) const {
+			for ( int i = 0 ; i < this->k ; i++ ) {
+				selection[i] = array[this->indices[i+1]];
+			}
+		}
+
+	private:
+
+		/**
+		 * @brief
+		 *            The size of the arrays from where <i>k</i> entries of
+		 *            different positions are chosen.
+		 */
+		int n;
+
+		/**
+		 * @brief
+		 *            The number of entries of different positions that are
+		 *            chosen.
+		 */
+		int k;
+
+		/**
+		 * @brief
+		 *            The current choice as an array of <i>k+2</i> integers.
+		 *
+		 * @details
+		 *            The entries <code>indices[1],...,indices[k]</code>
+		 *            hold the chosen indices in ascending order. The
+		 *            entries <code>indices[0]</code> and
+		 *            <code>indices[k+1]</code> are auxiliary.
+		 */
+		int *indices;
+
+		/**
+		 * @brief
+		 *            Table of the binomial coefficients
+		 *            <code>binomials[x*(k+1)+i]</code>=&quot;<i>x</i> over
+		 *            <i>i</i>&quot; for <i>x=0,...,n</i> and
+		 *            <i>i=0,...,k</i>; coefficients that cannot be
+		 *            represented by 64 bits are <code>UINT64_MAX</code>.
+		 */
+		uint64_t *binomials;
+
+		/**
+		 * @brief
+		 *            The rank of the current choice.
+		 */
+		uint64_t rank;
+
+		/**
+		 * @brief
+		 *            The number of all choices.
+		 */
+		uint64_t count;
+
+		/**
+		 * @brief
+		 *            The index removed by the last call of
+		 *            \link next()\endlink or -1.
+		 */
+		int removed;
+
+		/**
+		 * @brief
+		 *            The index added by the last call of
+		 *            \link next()\endlink or -1.
+		 */
+		int added;
+	};
+}
+
+#endif /* THIMBLE_REVOLVINGDOORITERATOR_H_ */
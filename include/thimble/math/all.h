@@ -34,9 +34,11 @@
 #include <thimble/math/BinomialIterator.h>
 #include <thimble/math/GrahamScan.h>
 #include <thimble/math/HexagonalGrid.h>
+#include <thimble/math/IndexSampler.h>
 #include <thimble/math/MathTools.h>
 #include <thimble/math/Permutation.h>
 #include <thimble/math/RandomGenerator.h>
+#include <thimble/math/RevolvingDoorIterator.h>
 #include <thimble/math/RigidTransform.h>
 
 #include <thimble/math/linalg/all.h>
@@ -449,11 +449,62 @@ namespace thimble {
          *            Makes the matrix an upper triangular matrix using
          *            elementary row and column operations.
          *
+         * @details
+         *            The elimination is performed
+         *            by \link rowEchelon()\endlink after which the pivot
+         *            columns are moved to the front.
+         *
          * @return
          *            The rank of the matrix.
+         *
+         * @warning
+         *            If not enough memory could be provided, an error
+         *            message is printed to <code>stderr</code> and the
+         *            program exits with status 'EXIT_FAILURE'.
          */
         int gauss();
 
+        /**
+         * @brief
+         *            Brings the matrix into row echelon form using
+         *            elementary row operations only.
+         *
+         * @details
+         *            The elimination works on rows packed into 64-bit
+         *            words. Pivots are searched in blocks of up to eight
+         *            columns; for each block, a table of all combinations of
+         *            its pivot rows is built such that every other row is
+         *            reduced by a single table lookup and row addition
+         *            (method of the Four Russians).
+         *
+         *            On output, the first <i>r</i> rows are non-zero where
+         *            <i>r</i> is the rank of the matrix and the remaining
+         *            rows are zero. The leading entry of the <i>k</i>th
+         *            row is found at column <code>pivots[k]</code> where
+         *            <code>pivots[0]<pivots[1]<...<pivots[r-1]</code>.
+         *            If <code>reduced</code> is <code>true</code>, the
+         *            pivot columns are zero except at their pivot
+         *            row, i.e., the result is the reduced row echelon form.
+         *
+         * @param pivots
+         *            If not <code>NULL</code>, an array that can hold at
+         *            least min(\link numRows()\endlink,\link numCols()\endlink)
+         *            integers that will contain the pivot columns.
+         *
+         * @param reduced
+         *            Specifies whether the reduced row echelon form is
+         *            computed.
+         *
+         * @return
+         *            The rank of the matrix.
+         *
+         * @warning
+         *            If not enough memory could be provided, an error
+         *            message is printed to <code>stderr</code> and the
+         *            program exits with status 'EXIT_FAILURE'.
+         */
+        int rowEchelon( int *pivots = NULL , bool reduced = true );
+
         /**
          * @brief
          *            Returns the rank of the matrix.
@@ -682,6 +733,10 @@ namespace thimble {
          *           \f[
          *            c = a \cdot b.
          *           \f]
+         *           The product is computed with the method of the Four
+         *           Russians (M4RM) on rows packed into 64-bit words;
+         *           for large matrices, the Strassen-Winograd recursion
+         *           is applied on top of M4RM.
          *
          * @param c
          *           One output, the product of the input <i>a</i> times
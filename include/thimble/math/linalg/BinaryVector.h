@@ -33,6 +33,7 @@
 
 #include <stdint.h>
 #include <fstream>
+#include <vector>
 
 #include <thimble/dllcompat.h>
 
@@ -54,9 +55,9 @@ namespace thimble {
          * @brief
          *            Encodes the binary entries of the vector.
          *
-         * @see getData()
+         * @see getData64()
          */
-        uint32_t *data;
+        uint64_t *data;
 
         /**
          * @brief
@@ -67,18 +68,44 @@ namespace thimble {
 
         /**
          * @brief
-         *            The number of 32-bit words that the array
+         *            The number of 64-bit words that the array
          *            \link data\endlink can hold.
          *
          * @details
          *            The representation of the binary vector is encoded
-         *            by 32 bit blocks. To represent a vector of dimension
-         *            <i>n</i> at least \f$\lceil n/32\rceil\f$ integers
-         *            of width 32 bits are needed. Thus, the field
-         *            should be at least \f$\lceil n/32\rceil\f$.
+         *            by 64 bit blocks. To represent a vector of dimension
+         *            <i>n</i> at least \f$\lceil n/64\rceil\f$ integers
+         *            of width 64 bits are needed. Thus, the field
+         *            should be at least \f$\lceil n/64\rceil\f$. The
+         *            bits of the first \f$\lceil n/64\rceil\f$ words
+         *            at positions \f$\geq n\f$ are kept zero.
          */
         int numWords;
 
+        /**
+         * @brief
+         *            Copy of the binary entries of the vector in the
+         *            32-bit layout of \link getData32()\endlink as
+         *            returned by the deprecated \link getData()\endlink.
+         *
+         * @details
+         *            The copy is only updated by
+         *            \link getData()\endlink and only if
+         *            \link data32Valid\endlink is <code>false</code>.
+         */
+        mutable std::vector<uint32_t> data32;
+
+        /**
+         * @brief
+         *            Whether \link data32\endlink equals the current
+         *            entries of the vector.
+         *
+         * @details
+         *            Every function that changes the entries of the
+         *            vector sets this flag to <code>false</code>.
+         */
+        mutable bool data32Valid;
+
 
     public:
 
@@ -618,6 +645,48 @@ namespace thimble {
         static int hammingDistance
         ( const BinaryVector & a , const BinaryVector & b );
 
+        /**
+         * @brief
+         *            Determines the Hamming distances between a query
+         *            vector and each vector of a contiguous gallery.
+         *
+         * @details
+         *            The gallery consists of <code>num</code> vectors
+         *            of the same length <i>n</i> as <code>query</code>
+         *            where each is encoded as in
+         *            \link getData64()\endlink by
+         *            \f$\lceil n/64\rceil\f$ words (including the
+         *            zero padding) and the vectors are stored one after
+         *            another. A gallery may thus be built by copying
+         *            \link getData64()\endlink of each enrolled vector
+         *            into a single buffer.
+         *
+         *            Depending on the processor, the distances are
+         *            computed with the 'AVX-512 VPOPCNTDQ', the 'AVX2'
+         *            or the 'POPCNT' instructions
+         *            (see \link MathTools::hd64Batch()\endlink).
+         *
+         * @param d
+         *            On output, <code>d[l]</code> is the Hamming
+         *            distance between <code>query</code> and the
+         *            <i>l</i>th vector of the gallery; must be able to
+         *            hold <code>num</code> integers.
+         *
+         * @param query
+         *            The query vector.
+         *
+         * @param gallery
+         *            Contiguous buffer of
+         *            \f$num\cdot\lceil n/64\rceil\f$ valid 64-bit
+         *            words.
+         *
+         * @param num
+         *            The number of vectors in the gallery.
+         */
+        static void hammingDistanceBatch
+        ( int *d , const BinaryVector & query ,
+          const uint64_t *gallery , int num );
+
         /**
          * @brief
          *            Overloaded '+'-operator to perform an addition
@@ -768,54 +837,123 @@ namespace thimble {
 
         /**
          * @brief
-         *            Access the data array encodes the binary entries of the
-         *            vector.
+         *            Access the array of 64-bit words encoding the binary
+         *            entries of the vector.
          *
          * @details
          *            If the vector represented by this instance is written as
          *            \f[
          *             (b_0,...,b_{n-1})
          *            \f]
-         *            where \f$b_j\in\{0,1\}\f$, then the <i>i</i>th 32 bit
+         *            where \f$b_j\in\{0,1\}\f$, then the <i>i</i>th 64 bit
          *            integer, where
-         *            \f$i<\lceil n/32\rceil\f$, equals
+         *            \f$i<\lceil n/64\rceil\f$, equals
          *            \f[
-         *             \sum_{k=0,...,61,~i\cdot 32+k<n}b_{i\cdot 32+k};
+         *             \sum_{k=0,...,63,~i\cdot 64+k<n}b_{i\cdot 64+k}\cdot 2^k.
          *            \f]
-         *            and \link getLength()\endlink equals
-         *            \f$n\geq 0\f$.
+         *            The bits at positions \f$\geq n\f$ are zero.
          *
          * @return
-         *            The data array encoding the binary entries of the
-         *            vector.
+         *            The array of \f$\lceil n/64\rceil\f$ words encoding
+         *            the binary entries of the vector.
          */
-        inline const uint32_t *getData() const {
+        inline const uint64_t *getData64() const {
 
             return this->data;
         }
 
         /**
          * @brief
-         *           Returns the array encoding the coefficients of this
-         *           vector.
+         *            Copies the binary entries of the vector into an
+         *            array of 32-bit integers.
+         *
+         * @details
+         *            If the vector represented by this instance is written as
+         *            \f[
+         *             (b_0,...,b_{n-1})
+         *            \f]
+         *            where \f$b_j\in\{0,1\}\f$, then the <i>i</i>th 32 bit
+         *            integer written to <code>words</code>, where
+         *            \f$i<\lceil n/32\rceil\f$, equals
+         *            \f[
+         *             \sum_{k=0,...,31,~i\cdot 32+k<n}b_{i\cdot 32+k}\cdot 2^k;
+         *            \f]
+         *            this is the layout used by
+         *            \link BinaryPolynomial\endlink and
+         *            \link BinaryMatrix\endlink.
+         *
+         * @param words
+         *            On output, contains the \f$\lceil n/32\rceil\f$
+         *            words encoding the binary entries of the vector.
+         *
+         * @see getData64()
+         * @see setData32()
+         */
+        void getData32( uint32_t *words ) const;
+
+        /**
+         * @brief
+         *            Replaces the binary entries of the vector by the
+         *            entries encoded in an array of 32-bit integers.
          *
          * @details
-         *           The result of this function is the same as the result of
-         *           \link getData()\endlink except that the content of the
-         *           vector can be changed by changing the content of the
-         *           result.
+         *            The layout of the words is the same as for
+         *            \link getData32()\endlink. The length of the vector
+         *            remains unchanged; bits of <code>words</code> at
+         *            positions greater than or equal to
+         *            \link getLength()\endlink are ignored and entries not
+         *            covered by <code>numWords</code> words are set to 0.
+         *
+         * @param words
+         *            Array of <code>numWords</code> 32-bit integers.
+         *
+         * @param numWords
+         *            The number of words in <code>words</code>.
+         *
+         * @see getData32()
+         */
+        void setData32( const uint32_t *words , int numWords );
+
+        /**
+         * @brief
+         *            Access the data array encoding the binary entries of
+         *            the vector as 32-bit integers.
+         *
+         * @details
+         *            The entries are stored in 64-bit words (see
+         *            \link getData64()\endlink). The result points to a
+         *            copy of the entries in the 32-bit layout of
+         *            \link getData32()\endlink which is updated only if
+         *            the vector has changed since the last call; hence,
+         *            repeated calls such as <code>v.getData()[i]</code>
+         *            in a loop cost constant time.
+         *
+         * @deprecated
+         *            Use \link getData32()\endlink or
+         *            \link getData64()\endlink instead.
          *
          * @warning
-         *           Use the result with caution and perform only changes if
-         *           you really know what your are doing; otherwise, you might
-         *           experience undocumented behaviour.
+         *            The result is valid until the vector is changed or
+         *            destroyed. As the copy is updated by this function,
+         *            it must not be called concurrently on the same
+         *            vector.
          *
          * @return
-         *           Array encoding the coefficients of this polynomial.
+         *            The \f$\lceil n/32\rceil\f$ words encoding the
+         *            binary entries of the vector where <i>n</i> is
+         *            \link getLength()\endlink.
          */
-        inline uint32_t *getData_nonconst() {
+        [[deprecated("use getData32() or getData64()")]]
+        inline const uint32_t *getData() const {
 
-            return this->data;
+            if ( !this->data32Valid ) {
+                this->data32.resize
+                        (this->length/32+(this->length%32?1:0)+1);
+                getData32(&(this->data32[0]));
+                this->data32Valid = true;
+            }
+
+            return &(this->data32[0]);
         }
     };
 
@@ -422,6 +422,32 @@ namespace thimble {
 			}
 		}
 
+		/**
+		 * @brief
+		 *            Converts the absolute value of this integer to an
+		 *            unsigned 64-bit integer.
+		 *
+		 * @details
+		 *            If the integer is denoted by <i>a</i> the result will
+		 *            be
+		 *            \f[
+		 *             |a|~mod~2^{64}.
+		 *            \f]
+		 *            Hence, the result agrees with <i>|a|</i> only
+		 *            if \link numBits()\endlink is not greater than 64.
+		 *
+		 * @return
+		 *            The absolute value of this integer modulo
+		 *            \f$2^{64}\f$.
+		 */
+		inline uint64_t toUInt64() const {
+			uint64_t v = this->data[0];
+			if ( getNumWords() > 1 ) {
+				v |= (uint64_t)this->data[1] << 32;
+			}
+			return v;
+		}
+
 		/**
 		 * @brief
 		 *            Converts this integer to a long double value.
@@ -889,6 +915,12 @@ namespace thimble {
 		 *            \f[
 		 *             c = a\cdot b
 		 *            \f]
+		 *            Small operands are multiplied with the schoolbook
+		 *            method on 64-bit limbs; larger operands are
+		 *            multiplied with Karatsuba's method and very large,
+		 *            balanced operands with Toom-Cook 3-way
+		 *            multiplication. The object <i>c</i> may be the same
+		 *            reference as <i>a</i> or <i>b</i>.
 		 *
 		 * @param c
 		 *            Will contain the product of <i>a</i> and <i>b</i>.
@@ -918,6 +950,11 @@ namespace thimble {
 		 *            \f[
 		 *             c = \left\lfloor\frac{a}{b}\right\rfloor.
 		 *            \f]
+		 *            If both <i>a</i> and <i>b</i> are large, the quotient
+		 *            is obtained from a reciprocal of <i>b</i> computed by
+		 *            Newton iteration, such that division costs a constant
+		 *            number of multiplications; otherwise, Knuth's long
+		 *            division is used.
 		 *
 		 * @param c
 		 *            Will contain the quotient of <i>a</i> and <i>b</i>.
@@ -1074,7 +1111,10 @@ namespace thimble {
 		 *            \f[
 		 *             n!=\prod_{i=0}^ni.
 		 *            \f]
-		 *            If <i>n=0</i> the result will be 1.
+		 *            If <i>n=0</i> the result will be 1. The product is
+		 *            evaluated as a balanced product tree such that the
+		 *            expensive multiplications are between factors of
+		 *            similar size.
 		 *
 		 * @param n
 		 *            The integer of which the factorial is computed.
@@ -1104,6 +1144,8 @@ namespace thimble {
 		 *             \left({n\atop k}\right)=\frac{n!}{k!\cdot(n-k)!}
 		 *             =\prod_{i=1}^k\frac{n+1-j}{j}.
 		 *            \f]
+		 *            Numerator and denominator are evaluated as balanced
+		 *            product trees and divided once.
 		 *
 		 * @param n
 		 *            Integer as <code>int</code>.
@@ -781,6 +781,30 @@ namespace thimble {
           const BinaryPolynomial & g ,
           const BinaryPolynomial & h );
 
+        /**
+         * @brief
+         *           Computes the square of a binary polynomial.
+         *
+         * @details
+         *           Since squaring is linear over the binary field, the
+         *           square of \f$\sum_jc_jX^j\f$ is \f$\sum_jc_jX^{2j}\f$
+         *           which is computed by spreading the bits of each byte
+         *           of coefficients using a look-up table.
+         *
+         * @param f
+         *           Square of <i>g</i>.
+         *
+         * @param g
+         *           Polynomial that is squared.
+         *
+         * @warning
+         *           If not enough memory could be provided, an error
+         *           message is printed to <code>stderr</code> and the
+         *           program exits with status 'EXIT_FAILURE'.
+         */
+        static void sqr
+        ( BinaryPolynomial & f , const BinaryPolynomial & g );
+
         /**
          * @brief
          *           Computes a Euclidean division with remainder.
@@ -1940,6 +1964,32 @@ namespace thimble {
         BinaryPolynomial::mul(f,g,h);
     }
 
+    /**
+     * @brief
+     *           Computes the square of a binary polynomial.
+     *
+     * @details
+     *           Since squaring is linear over the binary field, the
+     *           square of \f$\sum_jc_jX^j\f$ is \f$\sum_jc_jX^{2j}\f$
+     *           which is computed by spreading the bits of each byte
+     *           of coefficients using a look-up table.
+     *
+     * @param f
+     *           Square of <i>g</i>.
+     *
+     * @param g
+     *           Polynomial that is squared.
+     *
+     * @warning
+     *           If not enough memory could be provided, an error
+     *           message is printed to <code>stderr</code> and the
+     *           program exits with status 'EXIT_FAILURE'.
+     */
+    inline void sqr( BinaryPolynomial & f , const BinaryPolynomial & g ) {
+
+        BinaryPolynomial::sqr(f,g);
+    }
+
     /**
      * @brief
      *           Computes a Euclidean division with remainder.
@@ -0,0 +1,352 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file BinaryPolynomialModulus.h
+ *
+ * @brief
+ *            Provides a class for fast and repeated reduction of
+ *            binary polynomials modulo a fixed polynomial.
+ *
+ * @author agent
+ */
+
+#ifndef THIMBLE_BINARYPOLYNOMIALMODULUS_H
+#define THIMBLE_BINARYPOLYNOMIALMODULUS_H
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <thimble/dllcompat.h>
+#include <thimble/math/numbertheory/BinaryPolynomial.h>
+
+#ifdef THIMBLE_BUILD_DLL
+template class THIMBLE_DLL std::allocator<int>;
+template class THIMBLE_DLL std::vector<int,std::allocator<int> >;
+#endif
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+    /**
+     * @brief
+     *           Instances of this class represent a fixed binary
+     *           polynomial modulus together with precomputed data
+     *           that enables fast reduction modulo the polynomial.
+     *
+     * @details
+     *           Many algorithms, e.g., irreducibility tests,
+     *           factoring or the setup of BCH codes, reduce modulo
+     *           the same polynomial \f$f(X)\f$ of degree \f$n\f$ over
+     *           and over again. For such applications, it is much
+     *           more efficient to create a
+     *           \link BinaryPolynomialModulus\endlink once, e.g.,
+     *           <pre>
+     *            BinaryPolynomialModulus F(f);
+     *           </pre>
+     *           and to use its member functions, e.g.,
+     *           <pre>
+     *            F.mulMod(c,a,b);
+     *           </pre>
+     *           instead of
+     *           <pre>
+     *            mul(c,a,b);
+     *            rem(c,c,f);
+     *           </pre>
+     *
+     *           If the modulus is sparse, i.e., a trinomial or a
+     *           pentanomial (or any other polynomial with at most
+     *           five non-zero coefficients), reduction is performed
+     *           by shifting and adding the lower terms of the modulus
+     *           word by word. Otherwise, Barrett reduction is used
+     *           with the precomputed quotient
+     *           \f$\mu=\lfloor X^{2n}/f\rfloor\f$ such that a
+     *           polynomial of degree smaller than \f$2n\f$ is reduced
+     *           with two polynomial multiplications.
+     */
+    class THIMBLE_DLL BinaryPolynomialModulus {
+
+    private:
+
+        /**
+         * @brief
+         *           The modulus polynomial.
+         */
+        BinaryPolynomial f;
+
+        /**
+         * @brief
+         *           The quotient of \f$X^{2n}\f$ divided by the modulus
+         *           where \f$n\f$ is the degree of the modulus; only
+         *           used if the modulus is not sparse.
+         */
+        BinaryPolynomial mu;
+
+        /**
+         * @brief
+         *           If the modulus is sparse, the exponents of its
+         *           non-zero coefficients smaller than its degree;
+         *           otherwise empty.
+         */
+        std::vector<int> taps;
+
+        /**
+         * @brief
+         *           Reduces a polynomial of degree smaller than
+         *           <i>2n</i> via Barrett reduction.
+         *
+         * @param r
+         *           On output, the remainder of <i>a</i> modulo the
+         *           modulus.
+         *
+         * @param a
+         *           Polynomial of degree smaller than <i>2n</i>.
+         *
+         * @param tmp1
+         *           Temporary polynomial.
+         *
+         * @param tmp2
+         *           Temporary polynomial.
+         *
+         * @warning
+         *           If not enough memory could be provided, an error
+         *           message is printed to <code>stderr</code> and the
+         *           program exits with status 'EXIT_FAILURE'.
+         */
+        void barrett
+        ( BinaryPolynomial & r , const BinaryPolynomial & a ,
+          BinaryPolynomial & tmp1 , BinaryPolynomial & tmp2 ) const;
+
+    public:
+
+        /**
+         * @brief
+         *           Creates a modulus and precomputes the data needed
+         *           for fast reduction.
+         *
+         * @param f
+         *           The modulus polynomial.
+         *
+         * @warning
+         *           If <i>f</i> is zero, an error message is printed
+         *           to <code>stderr</code> and the program exits with
+         *           status 'EXIT_FAILURE'.
+         *
+         * @warning
+         *           If not enough memory could be provided, an error
+         *           message is printed to <code>stderr</code> and the
+         *           program exits with status 'EXIT_FAILURE'.
+         */
+        BinaryPolynomialModulus( const BinaryPolynomial & f );
+
+        /**
+         * @brief
+         *           Access the modulus polynomial.
+         *
+         * @return
+         *           The modulus polynomial.
+         */
+        inline const BinaryPolynomial & getModulus() const {
+            return this->f;
+        }
+
+        /**
+         * @brief
+         *           Access the degree of the modulus.
+         *
+         * @return
+         *           The degree of the modulus polynomial.
+         */
+        inline int deg() const {
+            return this->f.deg();
+        }
+
+        /**
+         * @brief
+         *           Checks whether reduction is performed via shifts
+         *           and additions of the modulus' terms.
+         *
+         * @return
+         *           <code>true</code> if the modulus has at most five
+         *           non-zero coefficients; otherwise
+         *           <code>false</code> in which case Barrett reduction
+         *           is used.
+         */
+        inline bool isSparse() const {
+            return !this->taps.empty();
+        }
+
+        /**
+         * @brief
+         *           Reduces a polynomial modulo the modulus.
+         *
+         * @param r
+         *           On output, the remainder of <i>a</i> divided by
+         *           the modulus.
+         *
+         * @param a
+         *           Polynomial of arbitrary degree.
+         *
+         * @warning
+         *           If not enough memory could be provided, an error
+         *           message is printed to <code>stderr</code> and the
+         *           program exits with status 'EXIT_FAILURE'.
+         */
+        void rem( BinaryPolynomial & r , const BinaryPolynomial & a ) const;
+
+        /**
+         * @brief
+         *           Computes the product of two polynomials modulo
+         *           the modulus.
+         *
+         * @param c
+         *           On output, the remainder of \f$a\cdot b\f$ divided
+         *           by the modulus.
+         *
+         * @param a
+         *           First factor.
+         *
+         * @param b
+         *           Second factor.
+         *
+         * @warning
+         *           If not enough memory could be provided, an error
+         *           message is printed to <code>stderr</code> and the
+         *           program exits with status 'EXIT_FAILURE'.
+         */
+        void mulMod
+        ( BinaryPolynomial & c ,
+          const BinaryPolynomial & a , const BinaryPolynomial & b ) const;
+
+        /**
+         * @brief
+         *           Computes the square of a polynomial modulo the
+         *           modulus.
+         *
+         * @param c
+         *           On output, the remainder of \f$a^2\f$ divided
+         *           by the modulus.
+         *
+         * @param a
+         *           Polynomial that is squared.
+         *
+         * @warning
+         *           If not enough memory could be provided, an error
+         *           message is printed to <code>stderr</code> and the
+         *           program exits with status 'EXIT_FAILURE'.
+         */
+        void sqrMod( BinaryPolynomial & c , const BinaryPolynomial & a ) const;
+
+        /**
+         * @brief
+         *           Computes a power of a polynomial modulo the modulus.
+         *
+         * @details
+         *           The power is computed via left-to-right square
+         *           and multiply.
+         *
+         * @param c
+         *           On output, the remainder of \f$a^e\f$ divided
+         *           by the modulus.
+         *
+         * @param a
+         *           The base.
+         *
+         * @param e
+         *           The exponent.
+         *
+         * @warning
+         *           If not enough memory could be provided, an error
+         *           message is printed to <code>stderr</code> and the
+         *           program exits with status 'EXIT_FAILURE'.
+         */
+        void powMod
+        ( BinaryPolynomial & c , const BinaryPolynomial & a , uint64_t e ) const;
+
+        /**
+         * @brief
+         *           Computes the <i>k</i>-fold iterated square of a
+         *           polynomial modulo the modulus.
+         *
+         * @details
+         *           The result equals \f$a^{2^k}\f$ modulo the modulus
+         *           which is the image of <i>a</i> under the
+         *           <i>k</i>th power of the Frobenius map.
+         *
+         * @param c
+         *           On output, the remainder of \f$a^{2^k}\f$ divided
+         *           by the modulus.
+         *
+         * @param a
+         *           Polynomial that is squared.
+         *
+         * @param k
+         *           Number of squarings.
+         *
+         * @warning
+         *           If <i>k</i> is negative, an error message is
+         *           printed to <code>stderr</code> and the program
+         *           exits with status 'EXIT_FAILURE'.
+         *
+         * @warning
+         *           If not enough memory could be provided, an error
+         *           message is printed to <code>stderr</code> and the
+         *           program exits with status 'EXIT_FAILURE'.
+         */
+        void frobenius
+        ( BinaryPolynomial & c , const BinaryPolynomial & a , int k ) const;
+
+        /**
+         * @brief
+         *           Computes the minimal polynomial of a polynomial
+         *           modulo the modulus.
+         *
+         * @details
+         *           Same as
+         *           \link BinaryPolynomial::minPolyMod()\endlink
+         *           but uses the precomputed data of this modulus for
+         *           the reductions.
+         *
+         * @param h
+         *           On output, the minimal polynomial of <i>g</i>
+         *           modulo the modulus.
+         *
+         * @param g
+         *           Polynomial of degree smaller than the modulus'
+         *           degree.
+         *
+         * @warning
+         *           If the degree of the modulus is smaller than 1,
+         *           an error message is printed to <code>stderr</code>
+         *           and the program exits with status 'EXIT_FAILURE'.
+         *
+         * @warning
+         *           If not enough memory could be provided, an error
+         *           message is printed to <code>stderr</code> and the
+         *           program exits with status 'EXIT_FAILURE'.
+         */
+        void minPoly( BinaryPolynomial & h , const BinaryPolynomial & g ) const;
+    };
+}
+
+#endif /* THIMBLE_BINARYPOLYNOMIALMODULUS_H */
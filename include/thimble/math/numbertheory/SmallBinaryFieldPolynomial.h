@@ -757,6 +757,40 @@ namespace thimble {
 		 */
 		uint32_t eval( uint32_t x ) const;
 
+		/**
+		 * @brief
+		 *            Evaluates the polynomial at multiple field elements.
+		 *
+		 * @details
+		 *            The function computes <i>y[j]</i> as the evaluation
+		 *            of the polynomial at <i>x[j]</i> for
+		 *            <i>j=0,...,n-1</i>. The result is the same as
+		 *            calling \link eval(uint32_t)const\endlink for each
+		 *            element, but the Horner steps of all points are
+		 *            interleaved such that each coefficient is loaded
+		 *            only once and the points' steps, which are
+		 *            independent of each other, can overlap.
+		 *
+		 * @param y
+		 *            Will contain the <i>n</i> evaluations.
+		 *
+		 * @param x
+		 *            The <i>n</i> elements of the polynomial's
+		 *            underlying finite field.
+		 *
+		 * @param n
+		 *            The number of elements at which the polynomial is
+		 *            evaluated.
+		 *
+		 * @warning
+		 *            If <code>x</code> or <code>y</code> do not hold
+		 *            <i>n</i> elements or if <code>x</code> contains
+		 *            elements that are not valid elements of the
+		 *            polynomial's underlying finite field, calling this
+		 *            function may run into unexpected behavior.
+		 */
+		void eval( uint32_t *y , const uint32_t *x , int n ) const;
+
 		/**
 		 * @brief
 		 *            Replaces the polynomial by the polynomial that
@@ -32,6 +32,7 @@
 
 #include <thimble/math/numbertheory/BigInteger.h>
 #include <thimble/math/numbertheory/BinaryPolynomial.h>
+#include <thimble/math/numbertheory/BinaryPolynomialModulus.h>
 #include <thimble/math/numbertheory/SmallBinaryField.h>
 #include <thimble/math/numbertheory/SmallBinaryFieldBivariatePolynomial.h>
 #include <thimble/math/numbertheory/SmallBinaryFieldPolynomial.h>
@@ -142,6 +142,21 @@ namespace thimble {
 	 *            causes the state to contain the same byte sequence
 	 *            as the original message <code>msg</code>.
 	 *
+	 *            <h2>Implementation</h2>
+	 *            If the processor supports the 'AES-NI' instructions,
+	 *            the key expansion, encryption and decryption are
+	 *            performed by these instructions. Otherwise, up to four
+	 *            blocks are processed at once in bitsliced
+	 *            representation where the S-box is evaluated as a
+	 *            logic circuit such that no table is indexed by secret
+	 *            data. Blocks that have to be processed one at a time,
+	 *            e.g., on encryption in cipher-block chaining mode,
+	 *            cost as much as four blocks on decryption or by
+	 *            \link decryptBatch()\endlink. If the library is
+	 *            compiled with 'THIMBLE_AES_LOOKUP_TABLES' defined,
+	 *            such blocks are transformed with lookup tables
+	 *            instead, which is faster but not in constant time.
+	 *
 	 * @see <b>National Institute of Standards and Technology (2001).</b>
      *      <i>
      *       FIPS PUB 197: Announcing the Advanced Encryption Standard
@@ -296,6 +311,49 @@ namespace thimble {
 		 */
 		void decrypt( uint8_t *out , const uint8_t *in , int n );
 
+		/**
+		 * @brief
+		 *           Decrypt the same data under several AES keys.
+		 *
+		 * @details
+		 *           The result equals the successive calls
+		 *           <pre>
+		 *            keys[l].decrypt(out+l*n,in,n)
+		 *           </pre>
+		 *           for <code>l=0,...,numKeys-1</code>. If the processor
+		 *           supports the 'AES-NI' instructions, the decryptions
+		 *           under up to eight keys are interleaved which is
+		 *           useful to test many derived keys such as the keys
+		 *           derived from slow-down values.
+		 *
+		 * @param out
+		 *           Array that can hold <code>numKeys*n</code> bytes to
+		 *           which the decrypted data is written; must not
+		 *           overlap with <code>in</code>.
+		 *
+		 * @param keys
+		 *           Array of <code>numKeys</code> AES keys.
+		 *
+		 * @param numKeys
+		 *           Number of keys in <code>keys</code>.
+		 *
+		 * @param in
+		 *           Array of <i>n</i> well-defined bytes containing the
+		 *           encrypted data.
+		 *
+		 * @param n
+		 *           A non-negative integer being a multiple of 16 defining
+		 *           the size of the encrypted data.
+		 *
+		 * @warning
+		 *           If <i>n</i> is not a multiple of 16, an error message
+		 *           is printed to <code>stderr</code> and the program
+		 *           exits with status 'EXIT_FAILURE'.
+		 */
+		static void decryptBatch
+		( uint8_t *out , const AES128 *keys , int numKeys ,
+		  const uint8_t *in , int n );
+
 		/**
 		 * @brief
 		 *           Access the 16 bytes of this AES's state.
@@ -536,6 +594,20 @@ namespace thimble {
 		 */
 		uint32_t w[4*(10+1)];
 
+		/**
+		 * @brief
+		 *            Holds the AES key expanded for the equivalent
+		 *            inverse cipher.
+		 *
+		 * @details
+		 *            The array contains the round keys of
+		 *            \link w\endlink in reverse order where the
+		 *            <em>InvMixColumns()</em> transformation has been
+		 *            applied to the round keys of the rounds 1,...,9
+		 *            (see Section 5.3.5 of the standard).
+		 */
+		uint32_t dw[4*(10+1)];
+
 		/**
 		 * @brief
 		 *            The internal state on which the AES algorithms operate.
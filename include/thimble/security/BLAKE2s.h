@@ -0,0 +1,221 @@
+/*
+ *  THIMBLE --- A Library for Research, Development, and Analysis of
+ *  Fingerprint Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file BLAKE2s.h
+ *
+ * @brief
+ *            Provides a mechanism for computing the BLAKE2s hash value of
+ *            data.
+ *
+ * @author agent
+ */
+#ifndef THIMBLE_BLAKE2S_H_
+#define THIMBLE_BLAKE2S_H_
+
+#include <stdint.h>
+#include <cstdlib>
+
+#include <thimble/dllcompat.h>
+
+/**
+ * @brief The library's namespace
+ */
+namespace thimble {
+
+    /**
+     * @brief
+     *            Instances of this class represent an environment in
+     *            which the unkeyed 256-bit BLAKE2s hash value (RFC 7693)
+     *            of data can be computed.
+     *
+     * @details
+     *            The interface is the same as of the \link SHA\endlink
+     *            class. BLAKE2s operates on 32-bit words and is faster
+     *            than SHA-256 in software; if the processor supports the
+     *            'SSSE3' instructions, the rows of the state are
+     *            processed as vectors. Moreover, \link hashBatch()\endlink
+     *            computes the hash values of eight messages at once using
+     *            the 'AVX2' instructions.
+     */
+    class THIMBLE_DLL BLAKE2s {
+
+    private:
+
+        /**
+         * @brief
+         *            The intermediate hash value.
+         */
+        uint32_t H[8];
+
+        /**
+         * @brief
+         *            Buffers the trailing bytes of the message. Unlike for
+         *            SHA-1, a complete block remains buffered until
+         *            further bytes follow since the last block must be
+         *            compressed with the finalization flag.
+         */
+        uint8_t block[64];
+
+        /**
+         * @brief
+         *            The total number of message bytes that have been
+         *            passed to this %BLAKE2s object since the last call of
+         *            \link init()\endlink.
+         */
+        uint64_t L;
+
+    public:
+
+        /**
+         * @brief
+         *            Standard constructor.
+         */
+        BLAKE2s();
+
+        /**
+         * @brief
+         *            Destructor.
+         */
+        ~BLAKE2s();
+
+        /**
+         * @brief
+         *            Resets this %BLAKE2s object such that a new message
+         *            can be hashed incrementally.
+         */
+        void init();
+
+        /**
+         * @brief
+         *            Appends bytes to the message being hashed.
+         *
+         * @param message
+         *            Contains at least <code>n</code> valid bytes that
+         *            are appended to the message.
+         *
+         * @param n
+         *            Number of valid bytes contained in <code>message</code>
+         */
+        void update( const uint8_t *message , uint64_t n );
+
+        /**
+         * @brief
+         *            Appends 32-bit integers to the message being hashed.
+         *
+         * @details
+         *            Each integer contributes its four bytes in big-endian
+         *            order, i.e., in the same way as for
+         *            \link SHA::update(const uint32_t*,uint64_t)\endlink.
+         *
+         * @param message
+         *            Contains at least <code>n</code> valid integers of
+         *            type <code>uint32_t</code> that are appended to the
+         *            message.
+         *
+         * @param n
+         *            Number of valid 32-bit integers contained in
+         *            <code>message</code>
+         */
+        void update( const uint32_t *message , uint64_t n );
+
+        /**
+         * @brief
+         *            Finalizes the message passed since the last call of
+         *            \link init()\endlink and outputs its BLAKE2s hash
+         *            value.
+         *
+         * @details
+         *            Afterwards, this %BLAKE2s object is initialized again.
+         *
+         * @param h
+         *            Will contain the BLAKE2s hash value of the message.
+         */
+        void final( uint8_t h[32] );
+
+        /**
+         * @brief
+         *            Computes the BLAKE2s hash value of a message.
+         *
+         * @param h
+         *            Will contain the BLAKE2s hash value of the first
+         *            <code>n</code> bytes in <code>message</code>.
+         *
+         * @param message
+         *            Contains at least <code>n</code> valid bytes of which
+         *            the hash value is computed.
+         *
+         * @param n
+         *            Number of valid bytes contained in <code>message</code>
+         */
+        void hash( uint8_t h[32] , const uint8_t *message , uint64_t n );
+
+        /**
+         * @brief
+         *            Computes the BLAKE2s hash value of a message of
+         *            32-bit integers.
+         *
+         * @param h
+         *            Will contain the BLAKE2s hash value of the first
+         *            <code>n</code> 32-bit integers in
+         *            <code>message</code>.
+         *
+         * @param message
+         *            Contains at least <code>n</code> valid integers of
+         *            type <code>uint32_t</code> of which the hash value
+         *            is computed.
+         *
+         * @param n
+         *            Number of valid 32-bit integers contained in
+         *            <code>message</code>
+         */
+        void hash( uint8_t h[32] , const uint32_t *message , uint64_t n );
+
+        /**
+         * @brief
+         *            Computes the BLAKE2s hash values of several
+         *            independent messages of 32-bit integers at once.
+         *
+         * @details
+         *            For each <code>l=0,...,num-1</code>, the hash value of
+         *            the first <code>n[l]</code> integers contained in
+         *            <code>messages[l]</code> is stored in <code>h[l]</code>.
+         *            The messages may be of different lengths.
+         *
+         * @param h
+         *            Will contain the <code>num</code> hash values.
+         *
+         * @param messages
+         *            Contains <code>num</code> messages.
+         *
+         * @param n
+         *            Contains the number of valid 32-bit integers in each
+         *            of the <code>num</code> messages.
+         *
+         * @param num
+         *            The number of messages.
+         */
+        static void hashBatch
+        ( uint8_t h[][32] , const uint32_t *const *messages ,
+          const uint64_t *n , int num );
+    };
+}
+
+#endif /* THIMBLE_BLAKE2S_H_ */
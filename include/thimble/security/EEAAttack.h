@@ -404,6 +404,20 @@ namespace thimble {
 		 * @see getFeatures2()
 		 */
 		uint32_t *features2;
+
+		/**
+		 * @brief
+		 *            Polynomials used as workspace by
+		 *            \link perform()\endlink.
+		 *
+		 * @details
+		 *            The workspace is kept between successive calls such
+		 *            that an object applied to many pairs of vaults, e.g.,
+		 *            by an \link EEACrossMatcher\endlink, does not
+		 *            reallocate the remainders and cofactors of the
+		 *            extended Euclidean algorithm for each pair.
+		 */
+		std::vector<SmallBinaryFieldPolynomial> workspace;
 	};
 }
 
@@ -0,0 +1,233 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file EEACrossMatcher.h
+ *
+ * @brief
+ *            Provides a mechanism for cross-matching all pairs of a
+ *            gallery of instances of the <em>improved fuzzy vault
+ *            scheme</em> via the \link thimble::EEAAttack EEAAttack\endlink.
+ *
+ * @author agent
+ */
+
+#ifndef THIMBLE_EEACROSSMATCHER_H_
+#define THIMBLE_EEACROSSMATCHER_H_
+
+#include <stdint.h>
+
+#include <thimble/dllcompat.h>
+#include <thimble/math/numbertheory/SmallBinaryFieldPolynomial.h>
+#include <thimble/security/EEAAttack.h>
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/**
+	 * @brief
+	 *            Receives the pairs of vaults that an
+	 *            \link EEACrossMatcher\endlink labels as related.
+	 *
+	 * @details
+	 *            Implementations override \link report()\endlink which
+	 *            is called as soon as a related pair has been found such
+	 *            that results can be processed while the cross-matching
+	 *            is still running, e.g., written to a file.
+	 */
+	class THIMBLE_DLL EEACrossMatchSink {
+
+	public:
+
+		/**
+		 * @brief
+		 *            Destructor.
+		 */
+		virtual ~EEACrossMatchSink();
+
+		/**
+		 * @brief
+		 *            Reports a pair of vaults labeled as related.
+		 *
+		 * @details
+		 *            The function is called from the worker threads of the
+		 *            \link EEACrossMatcher\endlink but never concurrently;
+		 *            thus, implementations do not need to synchronize.
+		 *            The order in which pairs are reported is not
+		 *            specified.
+		 *
+		 * @param i
+		 *            Index of the first vault in the gallery.
+		 *
+		 * @param j
+		 *            Index of the second vault in the gallery where
+		 *            <i>i&lt;j</i>.
+		 *
+		 * @param attack
+		 *            The attack that has been successfully performed
+		 *            against the <i>i</i>th and <i>j</i>th vault, giving
+		 *            access to the candidates for the overlap and the
+		 *            feature sets' differences; it is valid only during
+		 *            the call.
+		 */
+		virtual void report( int i , int j , const EEAAttack & attack ) = 0;
+	};
+
+	/**
+	 * @brief
+	 *            Runs the \link EEAAttack\endlink against all pairs of a
+	 *            gallery of improved fuzzy vault instances using multiple
+	 *            threads.
+	 *
+	 * @details
+	 *            The <i>n(n-1)/2</i> pairs are grouped into tiles of
+	 *            \link getBlockSize()\endlink times
+	 *            \link getBlockSize()\endlink pairs which are handed out
+	 *            to the threads on demand. While a thread processes a
+	 *            tile, it only accesses the vaults of two blocks which
+	 *            thus remain in its cache. Each thread owns an
+	 *            \link EEAAttack\endlink object whose workspace is reused
+	 *            for all of its pairs.
+	 *
+	 *            For example, a privacy audit of a database of vaults
+	 *            may run
+	 *            <pre>
+	 *             class Printer : public EEACrossMatchSink {
+	 *             public:
+	 *                void report( int i , int j , const EEAAttack & attack ) {
+	 *                   cout << i << " " << j << " "
+	 *                        << attack.getNumOverlap() << endl;
+	 *                }
+	 *             };
+	 *
+	 *             Printer printer;
+	 *             EEACrossMatcher matcher;
+	 *             matcher.crossMatch(vaults,n,k,printer);
+	 *            </pre>
+	 */
+	class THIMBLE_DLL EEACrossMatcher {
+
+	public:
+
+		/**
+		 * @brief
+		 *            Creates a cross-matcher.
+		 *
+		 * @param numThreads
+		 *            The number of threads; if 0, the number of hardware
+		 *            threads is used.
+		 *
+		 * @param blockSize
+		 *            The number of vaults per block of the tiled
+		 *            schedule.
+		 *
+		 * @warning
+		 *            If <code>numThreads</code> is negative or if
+		 *            <code>blockSize</code> is not positive, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		EEACrossMatcher( int numThreads = 0 , int blockSize = 32 );
+
+		/**
+		 * @brief
+		 *            Access the number of threads used for
+		 *            cross-matching.
+		 *
+		 * @return
+		 *            The number of threads.
+		 */
+		inline int getNumThreads() const {
+			return this->numThreads;
+		}
+
+		/**
+		 * @brief
+		 *            Access the number of vaults per block of the tiled
+		 *            schedule.
+		 *
+		 * @return
+		 *            The block size.
+		 */
+		inline int getBlockSize() const {
+			return this->blockSize;
+		}
+
+		/**
+		 * @brief
+		 *            Cross-matches all pairs of vaults of a gallery.
+		 *
+		 * @details
+		 *            For each pair <i>i&lt;j</i> for which
+		 *            <code>EEAAttack::perform(vaults[i],vaults[j],k)</code>
+		 *            returns <code>true</code>, the pair is reported to
+		 *            <code>sink</code>.
+		 *
+		 * @param vaults
+		 *            The gallery of <i>n</i> vault polynomials which must
+		 *            be defined over the same finite field.
+		 *
+		 * @param n
+		 *            The number of vaults in the gallery.
+		 *
+		 * @param k
+		 *            The (maximal) size of the secret polynomials
+		 *            protected by the vaults.
+		 *
+		 * @param sink
+		 *            Receives the related pairs.
+		 *
+		 * @return
+		 *            The number of pairs labeled as related.
+		 *
+		 * @warning
+		 *            If <i>n</i> is negative, an error message is printed
+		 *            to <code>stderr</code> and the program exits with
+		 *            status 'EXIT_FAILURE'.
+		 *
+		 * @warning
+		 *            If not enough memory could be provided, an error
+		 *            message is printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		uint64_t crossMatch
+		( const SmallBinaryFieldPolynomial *vaults , int n , int k ,
+		  EEACrossMatchSink & sink ) const;
+
+	private:
+
+		/**
+		 * @brief
+		 *            The number of threads.
+		 */
+		int numThreads;
+
+		/**
+		 * @brief
+		 *            The number of vaults per block of the tiled
+		 *            schedule.
+		 */
+		int blockSize;
+	};
+}
+
+#endif /* THIMBLE_EEACROSSMATCHER_H_ */
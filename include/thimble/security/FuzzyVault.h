@@ -39,6 +39,7 @@
 #include <thimble/math/numbertheory/SmallBinaryField.h>
 #include <thimble/math/numbertheory/SmallBinaryFieldPolynomial.h>
 #include <thimble/security/AES.h>
+#include <thimble/security/Hash.h>
 
 /**
  * @brief
@@ -254,6 +255,30 @@ namespace thimble {
 		void setSlowDownFactor
 			( const BigInteger & slowDownFactor );
 
+		/**
+		 * @brief Specifies the hash function by which the secret
+		 * polynomial is verified and from which the keys of the slow-down
+		 * mechanism are derived.
+		 *
+		 * @details By default, SHA-1 is used and the vault is exported
+		 * in the original format via \link toBytes()\endlink. Otherwise,
+		 * the hash function is recorded in the exported data; faster hash
+		 * functions, such as BLAKE2s, reduce the time for checking
+		 * candidate polynomials.
+		 *
+		 * @param algorithm The hash function.
+		 *
+		 * @warning If the method is called while the fuzzy vault object
+		 * protects a feature set (i.e., if \link isEnrolled()\endlink returns
+		 * <code>true</code>) or if <code>algorithm</code> is not a valid
+		 * hash function, then an error message will be printed to
+		 * <code>stderr</code> and the program exits with status
+		 * 'EXIT_FAILURE'.
+		 *
+		 * @see getHashAlgorithm()
+		 */
+		void setHashAlgorithm( HASH_ALGORITHM_T algorithm );
+
 		/**
 		 * @brief Returns the size of the feature universe that has been
 		 * specified for this fuzzy vault object.
@@ -315,6 +340,19 @@ namespace thimble {
 		 */
 		const BigInteger & getSlowDownFactor() const;
 
+		/**
+		 * @brief Returns the hash function by which the secret
+		 * polynomial is verified.
+		 *
+		 * @details Unless specified manually
+		 * via \link setHashAlgorithm()\endlink, SHA-1 is used.
+		 *
+		 * @return The hash function of this fuzzy vault object.
+		 *
+		 * @see setHashAlgorithm()
+		 */
+		HASH_ALGORITHM_T getHashAlgorithm() const;
+
 		/**
 		 * @brief Generates protected data from the specified feature set
 		 * and stores the result in this fuzzy vault object.
@@ -534,17 +572,19 @@ namespace thimble {
 		const SmallBinaryField & getField() const;
 
 		/**
-		 * @brief Returns the 160-bit (20-byte) hash value of the secret
-		 * key bound to the feature set protected by this fuzzy vault object.
+		 * @brief Returns the hash value of the secret key bound to the
+		 * feature set protected by this fuzzy vault object.
 		 *
 		 * @details After successful enrollment via \link enroll()\endlink a
 		 * secret polynomial will be bounded to the feature set passed
 		 * through \link enroll()\endlink. In order to allow safe
-		 * verification, the \link SHA SHA1\endlink hash value of the secret
-		 * polynomial is stored of which result can be accessed by this
-		 * function.
+		 * verification, the hash value of the secret polynomial
+		 * computed with \link getHashAlgorithm()\endlink is stored of
+		 * which result can be accessed by this function.
 		 *
-		 * @return An array containing 20 bytes.
+		 * @return An array containing
+		 * <code>Hash::getDigestSize(getHashAlgorithm())</code> bytes,
+		 * i.e., 20 bytes for the default SHA-1.
 		 */
 		const uint8_t * getHash() const;
 
@@ -645,6 +685,43 @@ namespace thimble {
 		SmallBinaryFieldPolynomial unpackVaultPolynomial
 			( const BigInteger & slowDownValue = BigInteger(0) ) const;
 
+		/**
+		 * @brief Unpacks the vault polynomial for a slow-down value that
+		 * is given as an unsigned 64-bit integer.
+		 *
+		 * @details Works as
+		 * \link unpackVaultPolynomial(const BigInteger&)const\endlink
+		 * but without any big integer arithmetic. For the same
+		 * slow-down value, both functions derive the same key and thus
+		 * return the same candidate. The function is used
+		 * by \link open()\endlink if the slow-down factor fits into 64
+		 * bits.
+		 *
+		 * @param slowDownValue A guess for the slow-down value.
+		 *
+		 * @return A candidate for the correct vault polynomial
+		 * (which is correct if the guess for the slow-down value
+		 * is correct).
+		 *
+		 * @warning If this object does not contain (a candidate) for
+		 * decrypted vault polynomial data, i.e.,
+		 * if \link isDecrypted()\endlink returns <code>false</code>,
+		 * then an error message will be printed to
+		 * <code>stderr</code> and the program exits with status
+		 * 'EXIT_FAILURE'.
+		 *
+		 * @warning If <code>slowDownValue</code> not smaller
+		 * than \link getSlowDownFactor()\endlink, then an
+		 * error message will be printed to <code>stderr</code> and
+		 * the program exits with status 'EXIT_FAILURE'.
+		 *
+		 * @warning If not enough memory could be allocated, an error
+		 * message will be printed to <code>stderr</code> and the program
+		 * exits with status 'EXIT_FAILURE'.
+		 */
+		SmallBinaryFieldPolynomial unpackVaultPolynomial
+			( uint64_t slowDownValue ) const;
+
 		/**
 		 * @brief Evaluates the reordering of a quantized feature element
 		 * through which they are passed to avoid a certain record
@@ -763,11 +840,11 @@ namespace thimble {
 		 *             strictly smaller than <i>k</i>.
 		 *
 		 * @param hash
-		 *             160-bit hash value of the correct secret polynomial
+		 *             Hash value of the correct secret polynomial
 		 *             <i>f</i>, that has been originally computed via an
 		 *             equivalent to
 		 *             <code>
-		 *              SHA().hash(hash,f.getData(),f.deg()+1)
+		 *              Hash(getHashAlgorithm()).hash(hash,f.getData(),f.deg()+1)
 		 *             </code>
 		 *
 		 * @return <code>true</code> if the decoding attempt was successful
@@ -776,7 +853,7 @@ namespace thimble {
 		virtual bool decode
 		( SmallBinaryFieldPolynomial & f ,
 		  const uint32_t *x , const uint32_t *y , int u , int k ,
-		  const uint8_t hash[20] ) const;
+		  const uint8_t *hash ) const;
 
 		/**
 		 * @brief Returns the number of bytes needed to export this fuzzy vault
@@ -799,6 +876,14 @@ namespace thimble {
 		 * @brief Exports the successfully enrolled fuzzy vault object to
 		 * a data array.
 		 *
+		 * @details If \link getHashAlgorithm()\endlink is SHA-1, the
+		 * data starts with the header <code>"FVR"</code> and is
+		 * byte-for-byte the same as in previous versions of the library.
+		 * Otherwise, the data starts with the header <code>"FV2"</code>
+		 * and the size of the data is followed by a byte encoding the
+		 * hash function. Both formats are read
+		 * by \link fromBytes()\endlink.
+		 *
 		 * @param data An array that can store at
 		 * least \link getSizeInBytes()\endlink bytes.
 		 *
@@ -1237,18 +1322,28 @@ namespace thimble {
 		uint8_t *encryptedVaultPolynomialData;
 
 		/**
-		 * @brief SHA-1 hash value of the secret polynomial protecting
+		 * @brief The hash function by which \link hash\endlink is
+		 * computed.
+		 *
+		 * @see getHashAlgorithm()
+		 * @see setHashAlgorithm()
+		 */
+		HASH_ALGORITHM_T hashAlgorithm;
+
+		/**
+		 * @brief Hash value of the secret polynomial protecting
 		 * the feature set both being bound and obfuscating each other by
 		 * this fuzzy vault object.
 		 *
 		 * @details On \link enroll() enrollment\endlink, a feature set is
 		 * bound to a \link SmallBinaryFieldPolynomial secret polynomial\endlink
-		 * of which any data is dismissed except its SHA-1 hash value. This
-		 * value which is stored in this field.
+		 * of which any data is dismissed except its hash value. This
+		 * value which is stored in this field. Only the first
+		 * <code>Hash::getDigestSize(hashAlgorithm)</code> bytes are used.
 		 *
 		 * @see getHash()
 		 */
-		uint8_t hash[20];
+		uint8_t hash[Hash::MAX_DIGEST_SIZE];
 
 		/**
 		 * @brief A record-specific public permutation process used to shuffle
@@ -1268,7 +1363,7 @@ namespace thimble {
 		 * accessed via the \link reorder()\endlink function.
 		 *
 		 * Note that the permutation is generated pseudo-randomly
-		 * using the 160 bits of \link hash\endlink as the random generator's
+		 * using the first 160 bits of \link hash\endlink as the random generator's
 		 * seed. In this way, no additional storage bits are required when
 		 * storing a successfully enrolled fuzzy vault object.
 		 *
@@ -1464,15 +1559,19 @@ namespace thimble {
 		 * @details
 		 *            The bytes of the specified integer are extracted
 		 *            via the \link BigInteger::toBytes() x.toBytes()\endlink
-		 *            method and then its \link SHA SHA hash value\endlink
-		 *            is computed; the first 16 bytes of the value
-		 *            are used to define the \link AES128 AES key\endlink
-		 *            returned by this function.
+		 *            method and then its hash value is computed; the
+		 *            first 16 bytes of the value are used to define the
+		 *            \link AES128 AES key\endlink returned by this
+		 *            function.
 		 *
 		 * @param x
 		 *            The integer of which an AES key is computed with
 		 *            this function.
 		 *
+		 * @param algorithm
+		 *            The hash function of which the first 16 bytes of the
+		 *            hash value of <code>x</code> form the key.
+		 *
 		 * @return
 		 *            The AES key derived from <code>x</code>.
 		 *
@@ -1481,7 +1580,87 @@ namespace thimble {
 		 *             is printed <code>stderr</code> and the program exits
 		 *             with status 'EXIT_FAILURE'
 		 */
-		static AES128 deriveKey( const BigInteger & x );
+		static AES128 deriveKey
+		( const BigInteger & x , HASH_ALGORITHM_T algorithm = HASH_SHA1 );
+
+		/**
+		 * @brief
+		 *            Derives an AES key from the specified unsigned
+		 *            64-bit integer.
+		 *
+		 * @details
+		 *            The key agrees with the key returned
+		 *            by \link deriveKey(const BigInteger&,HASH_ALGORITHM_T)\endlink
+		 *            for the same integer, i.e., the hashed bytes are
+		 *            the same as written by
+		 *            \link BigInteger::toBytes()\endlink; but these are
+		 *            written to a stack buffer without creating a
+		 *            \link BigInteger\endlink.
+		 *
+		 * @param x
+		 *            The integer of which an AES key is computed with
+		 *            this function.
+		 *
+		 * @param algorithm
+		 *            The hash function of which the first 16 bytes of the
+		 *            hash value of <code>x</code> form the key.
+		 *
+		 * @return
+		 *            The AES key derived from <code>x</code>.
+		 */
+		static AES128 deriveKey
+		( uint64_t x , HASH_ALGORITHM_T algorithm = HASH_SHA1 );
+
+		/**
+		 * @brief
+		 *            Decrypts and unpacks the vault polynomial using the
+		 *            specified AES key.
+		 *
+		 * @details
+		 *            Helper for both variants
+		 *            of \link unpackVaultPolynomial()\endlink after the key
+		 *            has been derived from the slow-down value.
+		 *
+		 * @param aes
+		 *            The key derived from a guess of the slow-down value.
+		 *
+		 * @return
+		 *            A candidate for the correct vault polynomial.
+		 *
+		 * @warning
+		 *            If not enough memory could be allocated, an error
+		 *            message will be printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		SmallBinaryFieldPolynomial decryptVaultPolynomial
+			( AES128 & aes ) const;
+
+		/**
+		 * @brief
+		 *            Unpacks the vault polynomial from decrypted vault
+		 *            data.
+		 *
+		 * @details
+		 *            The coefficients of the vault polynomial are
+		 *            split from <code>data</code> as packed by
+		 *            \link packVaultPolynomial()\endlink before
+		 *            encryption.
+		 *
+		 * @param data
+		 *            Array of \link vaultDataSize()\endlink bytes
+		 *            decrypted with a key derived from a guess of the
+		 *            slow-down value.
+		 *
+		 * @return
+		 *            A candidate for the correct vault polynomial.
+		 *
+		 * @warning
+		 *            If not enough memory could be allocated, an error
+		 *            message will be printed to <code>stderr</code> and the
+		 *            program exits with status 'EXIT_FAILURE'.
+		 */
+		SmallBinaryFieldPolynomial toVaultPolynomial
+			( const uint8_t *data ) const;
 
 		/**
 		 * @brief
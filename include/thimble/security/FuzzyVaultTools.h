@@ -50,6 +50,7 @@
 
 #include <thimble/dllcompat.h>
 #include <thimble/math/numbertheory/SmallBinaryFieldPolynomial.h>
+#include <thimble/security/Hash.h>
 
 /**
  * @brief The library's namespace.
@@ -261,8 +262,7 @@ namespace thimble
 		 *            -1.
 		 *            <ul>
 		 *             <li>
-		 *              <code>n</code> is smaller than or equal 0
-		 *              or if <code>n</code> is larger than RAND_MAX.
+		 *              <code>n</code> is smaller than or equal 0.
 		 *             </li>
 		 *             <li>
 		 *              <code>k</code> is smaller than or equal 0
@@ -347,8 +347,7 @@ namespace thimble
 		 *            -1.
 		 *            <ul>
 		 *             <li>
-		 *              <code>n</code> is smaller than or equal 0
-		 *              or if <code>n</code> is larger than RAND_MAX.
+		 *              <code>n</code> is smaller than or equal 0.
 		 *             </li>
 		 *             <li>
 		 *              <code>k</code> is smaller than or equal 0
@@ -376,6 +375,61 @@ namespace thimble
 							 int n, int k, const uint8_t hash[20],
 							 uint64_t maxIts);
 
+		/**
+		 * @brief
+		 *            Attempts to break an instance of the fuzzy vault scheme
+		 *            of which secret polynomial is verified by a
+		 *            selectable hash function.
+		 *
+		 * @details
+		 *            The attack is the same as
+		 *            \link bfattack(SmallBinaryFieldPolynomial&,const uint32_t*,const uint32_t*,int,int,const uint8_t[20],uint64_t)
+		 *            \endlink except that the candidate polynomials are
+		 *            hashed with the hash function <code>algorithm</code>
+		 *            via \link Hash::hashBatch()\endlink.
+		 *
+		 * @param f
+		 *            Will contain the secret vault polynomial if the function
+		 *            returns <code>true</code>.
+		 *
+		 * @param x
+		 *            Contains the <code>n</code> successive vault point's
+		 *            abscissas.
+		 *
+		 * @param y
+		 *            Contains the <code>n</code> successive vault point's
+		 *            ordinate values.
+		 *
+		 * @param n
+		 *            The vault's size.
+		 *
+		 * @param k
+		 *            The size of the secret polynomial (i.e. the polynomial
+		 *            is assumed to be of degree smaller than <code>k</code>)
+		 *
+		 * @param hash
+		 *            The hash value of the secret polynomial consisting
+		 *            of <code>Hash::getDigestSize(algorithm)</code> bytes.
+		 *
+		 * @param algorithm
+		 *            The hash function by which <code>hash</code> has
+		 *            been computed.
+		 *
+		 * @param maxIts
+		 *            The maximal number of iterations that are performed
+		 *            before the attack stops.
+		 *
+		 * @warning
+		 *            In the same cases as for the other variants, the
+		 *            function prints an error message to
+		 *            <code>stderr</code> and exits with status
+		 *            'EXIT_FAILURE'.
+		 */
+		static bool bfattack(SmallBinaryFieldPolynomial &f,
+							 const uint32_t *x, const uint32_t *y,
+							 int n, int k, const uint8_t *hash,
+							 HASH_ALGORITHM_T algorithm, uint64_t maxIts);
+
 		/**
 		 * @brief
 		 *           Attempts to decode a polynomial given unlocking points.
@@ -395,6 +449,15 @@ namespace thimble
 		 *           found, <i>f</i> will be left unchanged and the function
 		 *           returns <code>false</code>.
 		 *
+		 *           The subsets are enumerated in revolving-door order via
+		 *           a \link RevolvingDoorIterator\endlink such that each
+		 *           candidate polynomial is obtained from its predecessor
+		 *           by replacing one interpolation point which costs
+		 *           <i>O(k)</i> field operations. If the number of
+		 *           subsets cannot be represented by 64 bits, only the
+		 *           first <code>UINT64_MAX</code> subsets are tested,
+		 *           which is no restriction in practice.
+		 *
 		 * @param f
 		 *           If decoding was successful, the polynomial will be equals
 		 *           the decoded polynomial.
@@ -443,6 +506,89 @@ namespace thimble
 							 const uint32_t *x, const uint32_t *y,
 							 int n, int k, const uint32_t hash[5]);
 
+		/**
+		 * @brief
+		 *           Attempts to decode a polynomial of degree smaller than
+		 *           <i>k</i> that interpolates <i>k</i> given points and
+		 *           that is of specified hash value where only the subsets
+		 *           of a range of ranks are tested.
+		 *
+		 * @details
+		 *           Performs the same as
+		 *           \link bfdecode(SmallBinaryFieldPolynomial&,const uint32_t*,const uint32_t*,int,int,const uint32_t[5])\endlink
+		 *           but only tests the subsets of the ranks
+		 *           <code>firstRank,...,firstRank+numRanks-1</code> in
+		 *           the revolving-door order of a
+		 *           \link RevolvingDoorIterator\endlink of <i>k</i> out
+		 *           of <i>n</i>. In such a way, the exhaustive search can
+		 *           be split into disjoint rank ranges, e.g., to be
+		 *           processed by different threads; the number of all
+		 *           ranks is <code>RevolvingDoorIterator(n,k).getCount()</code>.
+		 *           If the number of subsets cannot be represented by
+		 *           64 bits and the subset of rank <code>firstRank</code>
+		 *           cannot be determined by
+		 *           \link RevolvingDoorIterator::unrank()\endlink, the
+		 *           function returns <code>false</code> without testing
+		 *           any subset.
+		 *
+		 * @param f
+		 *           If decoding was successful, the polynomial will be equals
+		 *           the decoded polynomial.
+		 *
+		 * @param x
+		 *           Successive abscissas of the unlocking set.
+		 *
+		 * @param y
+		 *           Successive ordinates of the unlocking set.
+		 *
+		 * @param n
+		 *           Size of the unlocking set.
+		 *
+		 * @param k
+		 *           Size of the secret polynomial.
+		 *
+		 * @param hash
+		 *           The SHA-1 hash value of the secret polynomial.
+		 *
+		 * @param firstRank
+		 *           The rank of the first subset to be tested.
+		 *
+		 * @param numRanks
+		 *           The number of subsets to be tested; the range is
+		 *           truncated at the last rank.
+		 *
+		 * @return
+		 *           <code>true</code> if decoding was successful and
+		 *           <code>false</code> otherwise.
+		 *
+		 * @warning
+		 *           If the first <i>t</i> entries of <i>x</i>
+		 *           are not pairwise distinct, an error message will be
+		 *           printed to <code>stderr</code> and causes an exit
+		 *           with status 'EXIT_FAILURE'.
+		 *
+		 * @warning
+		 *           If <i>x</i> or if <i>y</i> do not contain at least
+		 *           <i>t</i> valid elements in the finite field over which
+		 *           <i>f</i> is defined, the function runs into unexpected
+		 *           behavior.
+		 *
+		 * @warning
+		 *           If <i>n</i> or <i>k</i> are smaller than zero or if the
+		 *           number of subsets cannot be represented by a 64-bit
+		 *           integer, the function prints an error message to
+		 *           <code>stderr</code> and exits with status 'EXIT_FAILURE'.
+		 *
+		 * @warning
+		 *           If not sufficient memory can be allocated to run the
+		 *           function the function prints an error message to
+		 *           <code>stderr</code> and exits with status 'EXIT_FAILURE'.
+		 */
+		static bool bfdecode(SmallBinaryFieldPolynomial &f,
+							 const uint32_t *x, const uint32_t *y,
+							 int n, int k, const uint32_t hash[5],
+							 uint64_t firstRank, uint64_t numRanks);
+
 		/**
 		 * @brief
 		 *           For a random fuzzy vault of specified parameters,
@@ -490,8 +636,9 @@ namespace thimble
 		 *           Specifies the number of integers to be selected.
 		 *
 		 * @warning
-		 *            If <code>k</code> is greater than or equals <code>n</code>
-		 *            the method may never terminate.
+		 *            If <code>k</code> is greater than <code>n</code>, an error
+		 *            message is printed to <code>stderr</code> and the program
+		 *            exits with status 'EXIT_FAILURE'.
 		 *
 		 * @warning
 		 *            If <code>indices</code> cannot store at least <code>k</code>
@@ -502,6 +649,8 @@ namespace thimble
 		 *            If not sufficient memory could be provided, the method
 		 *            prints an error message to <code>stderr</code> and exits
 		 *            with status 'EXIT_FAILURE'.
+		 *
+		 * @see IndexSampler
 		 */
 		static void fastChooseIndicesAtRandom(register int *indices, register int n, register int k);
 	};
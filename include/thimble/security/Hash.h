@@ -0,0 +1,311 @@
+/*
+ *  THIMBLE --- A Library for Research, Development, and Analysis of
+ *  Fingerprint Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file Hash.h
+ *
+ * @brief
+ *            Provides a common interface to the hash functions of the
+ *            library such that the hash function used by a protected
+ *            template can be selected and recorded.
+ *
+ * @author agent
+ */
+#ifndef THIMBLE_HASH_H_
+#define THIMBLE_HASH_H_
+
+#include <stdint.h>
+#include <cstdlib>
+
+#include <thimble/dllcompat.h>
+#include <thimble/security/SHA.h>
+#include <thimble/security/SHA256.h>
+#include <thimble/security/BLAKE2s.h>
+
+/**
+ * @brief The library's namespace
+ */
+namespace thimble {
+
+    /**
+     * @brief Enumerates the hash functions provided by the library.
+     *
+     * @details
+     *            The codes are stored in serialized templates and must
+     *            therefore not be changed.
+     */
+    typedef enum {
+
+        /**
+         * @brief Code for SHA-1 with 20-byte hash values
+         */
+        HASH_SHA1    = 0 ,
+
+        /**
+         * @brief Code for SHA-256 with 32-byte hash values
+         */
+        HASH_SHA256  = 1 ,
+
+        /**
+         * @brief Code for BLAKE2s with 32-byte hash values
+         */
+        HASH_BLAKE2S = 2
+
+    } HASH_ALGORITHM_T;
+
+    /**
+     * @brief
+     *            Instances of this class compute hash values with a
+     *            hash function selected at run time.
+     *
+     * @details
+     *            Messages of 32-bit integers are hashed via the
+     *            big-endian encoding of the integers for all hash
+     *            functions. In such, hashing a message with
+     *            <code>HASH_SHA1</code> yields the same bytes as
+     *            \link SHA::hash(uint8_t[20],const uint32_t*,uint64_t)
+     *            \endlink.
+     *
+     *            The hash function can be selected for
+     *            \link ProtectedMinutiaeTemplate\endlink,
+     *            \link ProtectedMinutiaeRecord\endlink and
+     *            \link FuzzyVault\endlink; BLAKE3 is not
+     *            provided since BLAKE2s offers the same security level
+     *            at comparable speed for the short messages hashed by
+     *            the vaults.
+     */
+    class THIMBLE_DLL Hash {
+
+    private:
+
+        /**
+         * @brief
+         *            The hash function that is used.
+         */
+        HASH_ALGORITHM_T algorithm;
+
+        /**
+         * @brief
+         *            Context if \link algorithm\endlink is
+         *            <code>HASH_SHA1</code>.
+         */
+        SHA sha;
+
+        /**
+         * @brief
+         *            Context if \link algorithm\endlink is
+         *            <code>HASH_SHA256</code>.
+         */
+        SHA256 sha256;
+
+        /**
+         * @brief
+         *            Context if \link algorithm\endlink is
+         *            <code>HASH_BLAKE2S</code>.
+         */
+        BLAKE2s blake2s;
+
+    public:
+
+        /**
+         * @brief
+         *            The maximal size in bytes of a hash value computed by
+         *            any of the hash functions.
+         */
+        static const int MAX_DIGEST_SIZE = 32;
+
+        /**
+         * @brief
+         *            Constructs an environment computing hash values with
+         *            the specified hash function.
+         *
+         * @param algorithm
+         *            The hash function.
+         *
+         * @warning
+         *            If <code>algorithm</code> is not a valid hash function
+         *            code, an error message is printed to
+         *            <code>stderr</code> and the program exits with status
+         *            'EXIT_FAILURE'.
+         */
+        Hash( HASH_ALGORITHM_T algorithm = HASH_SHA1 );
+
+        /**
+         * @brief
+         *            Returns the hash function of this object.
+         *
+         * @return
+         *            The hash function of this object.
+         */
+        HASH_ALGORITHM_T getAlgorithm() const;
+
+        /**
+         * @brief
+         *            Returns the size in bytes of the hash values computed
+         *            by this object.
+         *
+         * @return
+         *            20 for SHA-1 and 32 otherwise.
+         */
+        int getDigestSize() const;
+
+        /**
+         * @brief
+         *            Returns the size in bytes of the hash values computed
+         *            by the specified hash function.
+         *
+         * @param algorithm
+         *            The hash function.
+         *
+         * @return
+         *            20 for SHA-1 and 32 otherwise.
+         */
+        static int getDigestSize( HASH_ALGORITHM_T algorithm );
+
+        /**
+         * @brief
+         *            Tests whether an integer, e.g., read from a serialized
+         *            template, encodes a hash function.
+         *
+         * @param code
+         *            The integer.
+         *
+         * @return
+         *            <code>true</code> if <code>code</code> is the code of
+         *            a hash function enumerated by
+         *            \link HASH_ALGORITHM_T\endlink; otherwise
+         *            <code>false</code>.
+         */
+        static bool isValid( int code );
+
+        /**
+         * @brief
+         *            Resets this object such that a new message can
+         *            be hashed incrementally.
+         */
+        void init();
+
+        /**
+         * @brief
+         *            Appends bytes to the message being hashed.
+         *
+         * @param message
+         *            Contains at least <code>n</code> valid bytes.
+         *
+         * @param n
+         *            Number of valid bytes contained in <code>message</code>
+         */
+        void update( const uint8_t *message , uint64_t n );
+
+        /**
+         * @brief
+         *            Appends 32-bit integers to the message being hashed.
+         *
+         * @param message
+         *            Contains at least <code>n</code> valid integers.
+         *
+         * @param n
+         *            Number of valid 32-bit integers contained in
+         *            <code>message</code>
+         */
+        void update( const uint32_t *message , uint64_t n );
+
+        /**
+         * @brief
+         *            Outputs the hash value of the message passed since the
+         *            last call of \link init()\endlink.
+         *
+         * @param digest
+         *            Will contain the \link getDigestSize()\endlink bytes
+         *            of the hash value.
+         */
+        void final( uint8_t *digest );
+
+        /**
+         * @brief
+         *            Computes the hash value of a message of bytes.
+         *
+         * @param digest
+         *            Will contain the \link getDigestSize()\endlink bytes
+         *            of the hash value.
+         *
+         * @param message
+         *            Contains at least <code>n</code> valid bytes.
+         *
+         * @param n
+         *            Number of valid bytes contained in <code>message</code>
+         */
+        void hash( uint8_t *digest , const uint8_t *message , uint64_t n );
+
+        /**
+         * @brief
+         *            Computes the hash value of a message of 32-bit
+         *            integers.
+         *
+         * @param digest
+         *            Will contain the \link getDigestSize()\endlink bytes
+         *            of the hash value.
+         *
+         * @param message
+         *            Contains at least <code>n</code> valid integers.
+         *
+         * @param n
+         *            Number of valid 32-bit integers contained in
+         *            <code>message</code>
+         */
+        void hash( uint8_t *digest , const uint32_t *message , uint64_t n );
+
+        /**
+         * @brief
+         *            Computes the hash values of several independent
+         *            messages of 32-bit integers at once.
+         *
+         * @details
+         *            The hash value of the <code>l</code>th message is
+         *            stored at
+         *            <code>digests+l*getDigestSize(algorithm)</code>.
+         *            SHA-1 and BLAKE2s hash eight messages simultaneously
+         *            on processors supporting 'AVX2'; SHA-256 hashes the
+         *            messages one after another, which is fastest with the
+         *            'SHA' extensions.
+         *
+         * @param algorithm
+         *            The hash function.
+         *
+         * @param digests
+         *            Will contain the <code>num</code> hash values.
+         *
+         * @param messages
+         *            Contains <code>num</code> messages.
+         *
+         * @param n
+         *            Contains the number of valid 32-bit integers in each
+         *            of the <code>num</code> messages.
+         *
+         * @param num
+         *            The number of messages.
+         */
+        static void hashBatch
+        ( HASH_ALGORITHM_T algorithm , uint8_t *digests ,
+          const uint32_t *const *messages , const uint64_t *n , int num );
+    };
+}
+
+#endif /* THIMBLE_HASH_H_ */
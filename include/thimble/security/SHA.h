@@ -49,162 +49,125 @@ namespace thimble {
     private:
 
         /**
-          * @brief
-          *            Contains the padded message and may be reallocated to
-          *            ensure it is of sufficient size to perform this. 'size'
-          *            always denotes the number of bytes that 'buffer' can
-          *            store.
-          */
-        uint32_t *buffer;
+         * @brief
+         *            The intermediate hash value of all complete 512-bit
+         *            blocks that have been passed to this %SHA object
+         *            since the last call of \link init()\endlink.
+         */
+        uint32_t H[5];
 
         /**
          * @brief
-         *             The number of bytes stored in the array
-         *             \link buffer\endlink that forms the message of which
-         *             hash value is computed.
+         *            Buffers the trailing bytes of the message that do
+         *            not yet form a complete 512-bit block.
          */
-        uint64_t L;
+        uint8_t block[64];
 
         /**
          * @brief
-         *             The size in bytes of the array \link buffer\endlink.
+         *            The total number of message bytes that have been
+         *            passed to this %SHA object since the last call of
+         *            \link init()\endlink.
          */
-        size_t size;
+        uint64_t L;
+
+    public:
 
         /**
          * @brief
-         *            Will be used as the words of the message schedule.
+         *            Standard constructor.
          */
-        uint32_t W[80];
+        SHA();
 
+        /**
+         * @brief
+         *            Destructor.
+         */
+        ~SHA();
 
         /**
          * @brief
-         *            Ensures that this %SHA object can buffer a message of
-         *            specified bit length.
+         *            Resets this %SHA object such that a new message can
+         *            be hashed incrementally.
          *
          * @details
-         *            The value \link L\endlink will be updated indicating
-         *            the number of bytes that the
-         *            array \link buffer\endlink must be able to store in
-         *            order to hash a message of the specified bit length.
-         *            If needed, the array \link buffer\endlink will be
-         *            reallocated in which case the
-         *            integer \link size\endlink is increased.
-         *
-         * @param l
-         *            The number of bits of a message that this %SHA object
-         *            must be able to hash.
-         *
-         * @warning
-         *            If not enough memory could be provided, an error
-         *            message is printed to <code>stderr</code> and the
-         *            program exits with status 'EXIT_FAILURE'.
+         *            After initialization, the message is passed in
+         *            arbitrary pieces to \link update()\endlink and the
+         *            hash value is obtained by \link final()\endlink.
+         *            No heap memory is used in this process.
          */
-        void prepareMessageBits( uint64_t l );
+        void init();
 
         /**
          * @brief
-         *            Copies message of bytes to \link buffer\endlink, appends
-         *            the bit 1 to the buffer and pads the bit sequence by
-         *            0 bits until the bit-length of the buffered message
-         *            becomes a multiple of 512.
-         *
-         * @details
-         *            The value \link L\endlink will hold the number of
-         *            padded bytes stored in \link buffer\endlink.
+         *            Appends bytes to the message being hashed.
          *
          * @param message
-         *            An array containing <code>n</code> 8-bit integers,
-         *            i.e., bytes, of type <code>uint8_t</code>.
+         *            Contains at least <code>n</code> valid bytes that
+         *            are appended to the message.
          *
          * @param n
-         *            Number of bytes stored in <code>message</code>.
-         *
-         * @warning
-         *            If not enough memory could be provided, an error
-         *            message is printed to <code>stderr</code> and the
-         *            program exits with status 'EXIT_FAILURE'.
+         *            Number of valid bytes contained in <code>message</code>
          *
          * @warning
-         *            If <code>message</code> does not hold at least
-         *            <code>n</code> valid integers of type
-         *            <code>uint8_t</code>, the behavior of this
-         *            method is undocumented.
+         *            If <code>message</code> contains no <code>n</code> valid
+         *            bytes the method runs into undocumented behavior.
          */
-        void padMessage( const uint8_t *message , uint64_t n );
+        void update( const uint8_t *message , uint64_t n );
 
         /**
          * @brief
-         *            Copies a message of 32-bit integers
-         *            to \link buffer\endlink, appends the bit 1 to the buffer
-         *            and pads the bit sequence by 0 bits until the bit-length
-         *            of the buffered message becomes a multiple of 512.
+         *            Appends 32-bit integers to the message being hashed.
          *
          * @details
-         *            The value \link L\endlink will hold the number of
-         *            padded bytes stored in \link buffer\endlink.
+         *            Each integer contributes its four bytes in big-endian
+         *            order such that hashing the integers in one piece
+         *            yields the same value as
+         *            \link hash(uint32_t[5],const uint32_t*,uint64_t)
+         *            \endlink.
          *
          * @param message
-         *            An array containing <code>n</code> 32-bit integers,
-         *            i.e., bytes, of type <code>uint8_t</code>.
+         *            Contains at least <code>n</code> valid integers of
+         *            type <code>uint32_t</code> that are appended to the
+         *            message.
          *
          * @param n
-         *            Number of 32-bit integers stored in
-         *            <code>message</code>.
-         *
-         * @warning
-         *            If not enough memory could be provided, an error
-         *            message is printed to <code>stderr</code> and the
-         *            program exits with status 'EXIT_FAILURE'.
+         *            Number of valid 32-bit integers contained in
+         *            <code>message</code>
          *
          * @warning
-         *            If <code>message</code> does not hold at least
-         *            <code>n</code> valid integers of type
-         *            <code>uint32_t</code>, the behavior of this
-         *            method is undocumented.
+         *            If <code>message</code> contains no <code>n</code> valid
+         *            integers the method runs into undocumented behavior.
          */
-        void padMessage( const uint32_t *message , uint64_t n );
+        void update( const uint32_t *message , uint64_t n );
 
         /**
          * @brief
-         *            Computes the hash of the padded message stored by this
-         *            %SHA object and stores the result in the specified
-         *            output array.
+         *            Pads the message passed since the last call of
+         *            \link init()\endlink and outputs its SHA-1 hash
+         *            value.
+         *
+         * @details
+         *            Afterwards, this %SHA object is initialized again.
          *
          * @param h
-         *            An array that is capable to hold 5 integers of type
-         *            <code>uint32_t</code> to which the hash value
-         *            of the buffered message is stored.
+         *            Will contain the SHA-1 hash value of the message.
          */
-        void hash( uint32_t h[5] );
+        void final( uint32_t h[5] );
 
         /**
          * @brief
-         *            Computes the hash of the padded message stored by this
-         *            %SHA object and stores the result in the specified
-         *            output array.
+         *            Pads the message passed since the last call of
+         *            \link init()\endlink and outputs its SHA-1 hash
+         *            value.
+         *
+         * @details
+         *            Afterwards, this %SHA object is initialized again.
          *
          * @param h
-         *            An array that is capable to hold 20 integers of type
-         *            <code>uint8_t</code> to which the hash value
-         *            of the buffered message is stored.
-         */
-        void hash( uint8_t h[20] );
-
-    public:
-
-        /**
-         * @brief
-         *            Standard constructor.
-         */
-        SHA();
-
-        /**
-         * @brief
-         *            Destructor.
+         *            Will contain the SHA-1 hash value of the message.
          */
-        ~SHA();
+        void final( uint8_t h[20] );
 
         /**
          * @brief
@@ -227,12 +190,6 @@ namespace thimble {
          *            Number of valid bytes contained in <code>message</code>
          *
          * @warning
-         *            If not sufficient memory could be provided to compute
-         *            the result an error message is printed to
-         *            <code>stderr</code> and the program exits with status
-         *            -1.
-         *
-         * @warning
          *            If <code>message</code> contains no <code>n</code> valid
          *            bytes the method runs into undocumented behavior.
          */
@@ -262,12 +219,6 @@ namespace thimble {
          *            <code>message</code>
          *
          * @warning
-         *            If not sufficient memory could be provided to compute
-         *            the result an error message is printed to
-         *            <code>stderr</code> and the program exits with status
-         *            -1.
-         *
-         * @warning
          *            If <code>message</code> contains no <code>n</code> valid
          *            bytes the method runs into undocumented behavior.
          */
@@ -294,12 +245,6 @@ namespace thimble {
          *            Number of valid bytes contained in <code>message</code>
          *
          * @warning
-         *            If not sufficient memory could be provided to compute
-         *            the result an error message is printed to
-         *            <code>stderr</code> and the program exits with status
-         *            -1.
-         *
-         * @warning
          *            If <code>message</code> contains no <code>n</code> valid
          *            bytes the method runs into undocumented behavior.
          */
@@ -329,16 +274,83 @@ namespace thimble {
          *            <code>message</code>
          *
          * @warning
-         *            If not sufficient memory could be provided to compute
-         *            the result an error message is printed to
-         *            <code>stderr</code> and the program exits with status
-         *            -1.
-         *
-         * @warning
          *            If <code>message</code> contains no <code>n</code> valid
          *            bytes the method runs into undocumented behavior.
          */
         void hash( uint8_t h[20] , const uint32_t *message , uint64_t n );
+
+        /**
+         * @brief
+         *            Computes the SHA-1 hash values of several independent
+         *            messages at once.
+         *
+         * @details
+         *            For each <code>l=0,...,num-1</code>, the hash value of
+         *            the first <code>n[l]</code> integers of type
+         *            <code>uint32_t</code> contained in
+         *            <code>messages[l]</code> is stored in <code>h[l]</code>.
+         *            The messages may be of different lengths. On processors
+         *            supporting the 'AVX2' instructions, eight messages are
+         *            compressed simultaneously, which pays off for the many
+         *            short candidates verified by brute-force attacks (see
+         *            \link FuzzyVaultTools::bfattack()\endlink).
+         *
+         * @param h
+         *            Will contain the <code>num</code> hash values.
+         *
+         * @param messages
+         *            Contains <code>num</code> messages.
+         *
+         * @param n
+         *            Contains the number of valid 32-bit integers in each
+         *            of the <code>num</code> messages.
+         *
+         * @param num
+         *            The number of messages.
+         *
+         * @warning
+         *            If one of the arrays does not contain <code>num</code>
+         *            valid entries or if <code>messages[l]</code> contains
+         *            no <code>n[l]</code> valid integers, the method runs
+         *            into undocumented behavior.
+         */
+        static void hashBatch
+        ( uint32_t h[][5] , const uint32_t *const *messages ,
+          const uint64_t *n , int num );
+
+        /**
+         * @brief
+         *            Computes the SHA-1 hash values of several independent
+         *            messages at once.
+         *
+         * @details
+         *            For each <code>l=0,...,num-1</code>, the hash value of
+         *            the first <code>n[l]</code> bytes contained in
+         *            <code>messages[l]</code> is stored in <code>h[l]</code>.
+         *            The messages may be of different lengths.
+         *
+         * @param h
+         *            Will contain the <code>num</code> hash values.
+         *
+         * @param messages
+         *            Contains <code>num</code> messages.
+         *
+         * @param n
+         *            Contains the number of valid bytes in each of the
+         *            <code>num</code> messages.
+         *
+         * @param num
+         *            The number of messages.
+         *
+         * @warning
+         *            If one of the arrays does not contain <code>num</code>
+         *            valid entries or if <code>messages[l]</code> contains
+         *            no <code>n[l]</code> valid bytes, the method runs
+         *            into undocumented behavior.
+         */
+        static void hashBatch
+        ( uint8_t h[][20] , const uint8_t *const *messages ,
+          const uint64_t *n , int num );
     };
 }
 
@@ -0,0 +1,190 @@
+/*
+ *  THIMBLE --- A Library for Research, Development, and Analysis of
+ *  Fingerprint Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SHA256.h
+ *
+ * @brief
+ *            Provides a mechanism for computing the SHA-256 hash value of
+ *            data.
+ *
+ * @author agent
+ */
+#ifndef THIMBLE_SHA256_H_
+#define THIMBLE_SHA256_H_
+
+#include <stdint.h>
+#include <cstdlib>
+
+#include <thimble/dllcompat.h>
+
+/**
+ * @brief The library's namespace
+ */
+namespace thimble {
+
+    /**
+     * @brief
+     *            Instances of this class represent an environment in
+     *            which SHA-256 hash value of data can be computed.
+     *
+     * @details
+     *            The interface is the same as of the \link SHA\endlink
+     *            class: a message can be passed incrementally via
+     *            \link init()\endlink, \link update()\endlink and
+     *            \link final()\endlink or at once via
+     *            \link hash()\endlink. If the processor supports the
+     *            'SHA' extensions, they are used for compression.
+     */
+    class THIMBLE_DLL SHA256 {
+
+    private:
+
+        /**
+         * @brief
+         *            The intermediate hash value of all complete 512-bit
+         *            blocks that have been passed to this %SHA256 object
+         *            since the last call of \link init()\endlink.
+         */
+        uint32_t H[8];
+
+        /**
+         * @brief
+         *            Buffers the trailing bytes of the message that do
+         *            not yet form a complete 512-bit block.
+         */
+        uint8_t block[64];
+
+        /**
+         * @brief
+         *            The total number of message bytes that have been
+         *            passed to this %SHA256 object since the last call of
+         *            \link init()\endlink.
+         */
+        uint64_t L;
+
+    public:
+
+        /**
+         * @brief
+         *            Standard constructor.
+         */
+        SHA256();
+
+        /**
+         * @brief
+         *            Destructor.
+         */
+        ~SHA256();
+
+        /**
+         * @brief
+         *            Resets this %SHA256 object such that a new message
+         *            can be hashed incrementally.
+         */
+        void init();
+
+        /**
+         * @brief
+         *            Appends bytes to the message being hashed.
+         *
+         * @param message
+         *            Contains at least <code>n</code> valid bytes that
+         *            are appended to the message.
+         *
+         * @param n
+         *            Number of valid bytes contained in <code>message</code>
+         */
+        void update( const uint8_t *message , uint64_t n );
+
+        /**
+         * @brief
+         *            Appends 32-bit integers to the message being hashed.
+         *
+         * @details
+         *            Each integer contributes its four bytes in big-endian
+         *            order.
+         *
+         * @param message
+         *            Contains at least <code>n</code> valid integers of
+         *            type <code>uint32_t</code> that are appended to the
+         *            message.
+         *
+         * @param n
+         *            Number of valid 32-bit integers contained in
+         *            <code>message</code>
+         */
+        void update( const uint32_t *message , uint64_t n );
+
+        /**
+         * @brief
+         *            Pads the message passed since the last call of
+         *            \link init()\endlink and outputs its SHA-256 hash
+         *            value.
+         *
+         * @details
+         *            Afterwards, this %SHA256 object is initialized again.
+         *
+         * @param h
+         *            Will contain the SHA-256 hash value of the message.
+         */
+        void final( uint8_t h[32] );
+
+        /**
+         * @brief
+         *            Computes the SHA-256 hash value of a message.
+         *
+         * @param h
+         *            Will contain the SHA-256 hash value of the first
+         *            <code>n</code> bytes in <code>message</code>.
+         *
+         * @param message
+         *            Contains at least <code>n</code> valid bytes of which
+         *            the hash value is computed.
+         *
+         * @param n
+         *            Number of valid bytes contained in <code>message</code>
+         */
+        void hash( uint8_t h[32] , const uint8_t *message , uint64_t n );
+
+        /**
+         * @brief
+         *            Computes the SHA-256 hash value of a message of
+         *            32-bit integers.
+         *
+         * @param h
+         *            Will contain the SHA-256 hash value of the first
+         *            <code>n</code> 32-bit integers in
+         *            <code>message</code>.
+         *
+         * @param message
+         *            Contains at least <code>n</code> valid integers of
+         *            type <code>uint32_t</code> of which the hash value
+         *            is computed.
+         *
+         * @param n
+         *            Number of valid 32-bit integers contained in
+         *            <code>message</code>
+         */
+        void hash( uint8_t h[32] , const uint32_t *message , uint64_t n );
+    };
+}
+
+#endif /* THIMBLE_SHA256_H_ */
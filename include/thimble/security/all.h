@@ -35,6 +35,10 @@
 #include <thimble/security/FuzzyVault.h>
 #include <thimble/security/FuzzyVaultTools.h>
 #include <thimble/security/EEAAttack.h>
+#include <thimble/security/EEACrossMatcher.h>
 #include <thimble/security/SHA.h>
+#include <thimble/security/SHA256.h>
+#include <thimble/security/BLAKE2s.h>
+#include <thimble/security/Hash.h>
 
 #endif /* THIMBLE_SECURITY_ALL_H_ */
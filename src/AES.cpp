@@ -28,12 +28,15 @@
  *
  * @author Benjamin Tams
  */
+#include "config.h"
 #include <stdint.h>
 #include <cstring>
 #include <iostream>
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+#include <immintrin.h>
+#endif
 
-#include <thimble/math/numbertheory/SmallBinaryPolynomial.h>
-#include <thimble/math/numbertheory/SmallBinaryField.h>
+#include <thimble/math/MathTools.h>
 #include <thimble/security/SHA.h>
 #include <thimble/security/AES.h>
 
@@ -45,27 +48,7 @@ using namespace std;
  */
 namespace thimble {
 
-	/**
-	 * @brief
-	 *           Finite field in which internal AES computations are performed.
-	 *
-	 * @details
-	 *           The standard works with bytes each representing an element
-	 *           in the finite field defined by the polynomial
-	 *           \f$x^8+x^4+x^3+x+1\f$ which is represented by the integer
-	 *           \f$2^8+2^4+2^3+2+1=283\f$.
-	 *
-	 * @see Section 4.2, Equation (4.1), page 10 in
-	 *      <b>National Institute of Standards and Technology (2001).</b>
-	 *      <i>
-	 *       FIPS PUB 197: Announcing the Advanced Encryption Standard
-	 *       (AES).
-	 *      </i>
-	 *      <a href="http://csrc.nist.gov/publications/fips/fips197/fips-197.pdf" target="_blank">
-	 *      available online</a>.
-	 */
-	static SmallBinaryField _GF(SmallBinaryPolynomial(283));
-
+#ifdef THIMBLE_AES_LOOKUP_TABLES
 	/**
 	 * @brief
 	 *           Substitution values for the byte <code>xy</code> in
@@ -130,150 +113,1387 @@ namespace thimble {
 	0xA0, 0xE0, 0x3B, 0x4D, 0xAE, 0x2A, 0xF5, 0xB0, 0xC8, 0xEB, 0xBB, 0x3C, 0x83, 0x53, 0x99, 0x61,
 	0x17, 0x2B, 0x04, 0x7E, 0xBA, 0x77, 0xD6, 0x26, 0xE1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0C, 0x7D};
 
-	/**
-	 * @brief
-	 *            The round constant word array,
-	 */
-	static const uint32_t _RCON[] = {
-	0x1000000 ,0x2000000 ,0x4000000 ,0x8000000 ,
-	0x10000000,0x20000000,0x40000000,0x80000000,
-	0x1b000000,0x36000000
-	};
+#endif
+
+	/**
+	 * @brief
+	 *            The round constant word array,
+	 */
+	static const uint32_t _RCON[] = {
+	0x1000000 ,0x2000000 ,0x4000000 ,0x8000000 ,
+	0x10000000,0x20000000,0x40000000,0x80000000,
+	0x1b000000,0x36000000
+	};
+
+	/**
+	 * @brief
+	 *            Concatenates four bytes to an unsigned 32 bit word
+	 *            (Big-endian).
+	 *
+	 * @param b0
+	 *            unsigned byte
+	 *
+	 * @param b1
+	 *            unsigned byte
+	 *
+	 * @param b2
+	 *            unsigned byte
+	 *
+	 * @param b3
+	 *            unsigned byte
+	 *
+	 * @return \f$b3+b2\cdot 256+b1\cdot 256^2+b0\cdot 256^3\f$
+	 */
+	static uint32_t toWord( uint8_t b0 , uint8_t b1 , uint8_t b2 , uint8_t b3 ) {
+
+		uint32_t w;
+
+		w  = (uint32_t)b0; w <<= 8;
+		w += (uint32_t)b1; w <<= 8;
+		w += (uint32_t)b2; w <<= 8;
+		w += (uint32_t)b3;
+
+		return w;
+	}
+
+	/**
+	 * @brief
+	 *           Splits an unsigned 32-bit word into four bytes.
+	 *
+	 * @param w
+	 *           Input unsigned 32-bit word.
+	 *
+	 * @param b  Output byte array such that
+	 *           \f$w=b[3]+b[2]\cdot 256+b[1]\cdot 256^2+b[0]\cdot 256^3\f$
+	 */
+	static void toBytes( uint8_t b[4] , uint32_t w ) {
+		b[3] = (uint8_t)(w & 0xFF); w >>= 8;
+		b[2] = (uint8_t)(w & 0xFF); w >>= 8;
+		b[1] = (uint8_t)(w & 0xFF); w >>= 8;
+		b[0] = (uint8_t)w;
+	}
+
+#ifdef THIMBLE_AES_LOOKUP_TABLES
+	/**
+	 * @brief
+	 *           Multiplies a byte by \f$x\f$ in the finite field
+	 *           defined by \f$x^8+x^4+x^3+x+1\f$.
+	 */
+	inline static uint8_t xtime( uint8_t b ) {
+		return (uint8_t)((b<<1)^((b&0x80)?0x1b:0x00));
+	}
+
+	/**
+	 * @brief
+	 *           Multiplies two bytes in the finite field defined by
+	 *           \f$x^8+x^4+x^3+x+1\f$.
+	 *
+	 * @details
+	 *           The function does not depend on static
+	 *           initialization which allows the
+	 *           \link AESTables lookup tables\endlink to be built
+	 *           at any time.
+	 */
+	static uint8_t gmul( uint8_t a , uint8_t b ) {
+
+		uint8_t c = 0;
+
+		while ( b ) {
+			if ( b & 0x1 ) {
+				c ^= a;
+			}
+			a = xtime(a);
+			b >>= 1;
+		}
+
+		return c;
+	}
+
+	/**
+	 * @brief
+	 *           Lookup tables that combine the <em>SubBytes()</em>,
+	 *           <em>ShiftRows()</em> and <em>MixColumns()</em>
+	 *           transformations (and their inverses, respectively)
+	 *           of a round on columns encoded as 32 bit words.
+	 *
+	 * @details
+	 *           The <i>j</i>th table is the first table rotated by
+	 *           <i>j</i> bytes to the right such that a round of the
+	 *           cipher costs 16 table lookups.
+	 *
+	 * @see <b>J. Daemen and V. Rijmen (2002).</b>
+	 *      <i>The Design of Rijndael</i>, Section 4.2.
+	 *      Springer.
+	 */
+	struct AESTables {
+
+		/**
+		 * @brief
+		 *           Tables for the cipher.
+		 */
+		uint32_t Te[4][256];
+
+		/**
+		 * @brief
+		 *           Tables for the equivalent inverse cipher.
+		 */
+		uint32_t Td[4][256];
+
+		/**
+		 * @brief
+		 *           Computes the tables from the S-boxes.
+		 */
+		AESTables() {
+
+			for ( int x = 0 ; x < 256 ; x++ ) {
+
+				uint8_t s = _SBOX[x] , i = _ISBOX[x];
+
+				uint32_t e = toWord
+						(gmul(s,0x02),s,s,gmul(s,0x03));
+				uint32_t d = toWord
+						(gmul(i,0x0e),gmul(i,0x09),gmul(i,0x0d),gmul(i,0x0b));
+
+				for ( int j = 0 ; j < 4 ; j++ ) {
+					this->Te[j][x] = e;
+					this->Td[j][x] = d;
+					e = (e>>8)|(e<<24);
+					d = (d>>8)|(d<<24);
+				}
+			}
+		}
+	};
+
+	/**
+	 * @brief
+	 *           Returns the lookup tables which are computed on the
+	 *           first call.
+	 */
+	static const AESTables & tables() {
+
+		static const AESTables T;
+
+		return T;
+	}
+
+	/**
+	 * @brief
+	 *           Encrypts a single 16 byte block with the
+	 *           \link AESTables lookup tables\endlink.
+	 *
+	 * @param out
+	 *           Output block; may be equal to <code>in</code>.
+	 *
+	 * @param in
+	 *           Input block.
+	 *
+	 * @param rk
+	 *           The 44 words of the expanded key.
+	 */
+	static void encryptBlockTable
+	( uint8_t out[16] , const uint8_t in[16] , const uint32_t *rk ) {
+
+		const AESTables & T = tables();
+
+		uint32_t s0 , s1 , s2 , s3 , t0 , t1 , t2 , t3;
+
+		s0 = toWord(in[ 0],in[ 1],in[ 2],in[ 3]) ^ rk[0];
+		s1 = toWord(in[ 4],in[ 5],in[ 6],in[ 7]) ^ rk[1];
+		s2 = toWord(in[ 8],in[ 9],in[10],in[11]) ^ rk[2];
+		s3 = toWord(in[12],in[13],in[14],in[15]) ^ rk[3];
+
+		for ( int round = 1 ; round < 10 ; round++ ) {
+
+			rk += 4;
+
+			t0 = T.Te[0][s0>>24] ^ T.Te[1][(s1>>16)&0xFF] ^
+				 T.Te[2][(s2>>8)&0xFF] ^ T.Te[3][s3&0xFF] ^ rk[0];
+			t1 = T.Te[0][s1>>24] ^ T.Te[1][(s2>>16)&0xFF] ^
+				 T.Te[2][(s3>>8)&0xFF] ^ T.Te[3][s0&0xFF] ^ rk[1];
+			t2 = T.Te[0][s2>>24] ^ T.Te[1][(s3>>16)&0xFF] ^
+				 T.Te[2][(s0>>8)&0xFF] ^ T.Te[3][s1&0xFF] ^ rk[2];
+			t3 = T.Te[0][s3>>24] ^ T.Te[1][(s0>>16)&0xFF] ^
+				 T.Te[2][(s1>>8)&0xFF] ^ T.Te[3][s2&0xFF] ^ rk[3];
+
+			s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+		}
+
+		rk += 4;
+
+		// Last round without 'MixColumns()'
+		toBytes(out   ,toWord(_SBOX[s0>>24],_SBOX[(s1>>16)&0xFF],
+				_SBOX[(s2>>8)&0xFF],_SBOX[s3&0xFF]) ^ rk[0]);
+		toBytes(out+ 4,toWord(_SBOX[s1>>24],_SBOX[(s2>>16)&0xFF],
+				_SBOX[(s3>>8)&0xFF],_SBOX[s0&0xFF]) ^ rk[1]);
+		toBytes(out+ 8,toWord(_SBOX[s2>>24],_SBOX[(s3>>16)&0xFF],
+				_SBOX[(s0>>8)&0xFF],_SBOX[s1&0xFF]) ^ rk[2]);
+		toBytes(out+12,toWord(_SBOX[s3>>24],_SBOX[(s0>>16)&0xFF],
+				_SBOX[(s1>>8)&0xFF],_SBOX[s2&0xFF]) ^ rk[3]);
+	}
+
+	/**
+	 * @brief
+	 *           Decrypts a single 16 byte block with the
+	 *           \link AESTables lookup tables\endlink.
+	 *
+	 * @param out
+	 *           Output block; may be equal to <code>in</code>.
+	 *
+	 * @param in
+	 *           Input block.
+	 *
+	 * @param dk
+	 *           The 44 words of the expanded key for the equivalent
+	 *           inverse cipher.
+	 */
+	static void decryptBlockTable
+	( uint8_t out[16] , const uint8_t in[16] , const uint32_t *dk ) {
+
+		const AESTables & T = tables();
+
+		uint32_t s0 , s1 , s2 , s3 , t0 , t1 , t2 , t3;
+
+		s0 = toWord(in[ 0],in[ 1],in[ 2],in[ 3]) ^ dk[0];
+		s1 = toWord(in[ 4],in[ 5],in[ 6],in[ 7]) ^ dk[1];
+		s2 = toWord(in[ 8],in[ 9],in[10],in[11]) ^ dk[2];
+		s3 = toWord(in[12],in[13],in[14],in[15]) ^ dk[3];
+
+		for ( int round = 1 ; round < 10 ; round++ ) {
+
+			dk += 4;
+
+			t0 = T.Td[0][s0>>24] ^ T.Td[1][(s3>>16)&0xFF] ^
+				 T.Td[2][(s2>>8)&0xFF] ^ T.Td[3][s1&0xFF] ^ dk[0];
+			t1 = T.Td[0][s1>>24] ^ T.Td[1][(s0>>16)&0xFF] ^
+				 T.Td[2][(s3>>8)&0xFF] ^ T.Td[3][s2&0xFF] ^ dk[1];
+			t2 = T.Td[0][s2>>24] ^ T.Td[1][(s1>>16)&0xFF] ^
+				 T.Td[2][(s0>>8)&0xFF] ^ T.Td[3][s3&0xFF] ^ dk[2];
+			t3 = T.Td[0][s3>>24] ^ T.Td[1][(s2>>16)&0xFF] ^
+				 T.Td[2][(s1>>8)&0xFF] ^ T.Td[3][s0&0xFF] ^ dk[3];
+
+			s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+		}
+
+		dk += 4;
+
+		// Last round without 'InvMixColumns()'
+		toBytes(out   ,toWord(_ISBOX[s0>>24],_ISBOX[(s3>>16)&0xFF],
+				_ISBOX[(s2>>8)&0xFF],_ISBOX[s1&0xFF]) ^ dk[0]);
+		toBytes(out+ 4,toWord(_ISBOX[s1>>24],_ISBOX[(s0>>16)&0xFF],
+				_ISBOX[(s3>>8)&0xFF],_ISBOX[s2&0xFF]) ^ dk[1]);
+		toBytes(out+ 8,toWord(_ISBOX[s2>>24],_ISBOX[(s1>>16)&0xFF],
+				_ISBOX[(s0>>8)&0xFF],_ISBOX[s3&0xFF]) ^ dk[2]);
+		toBytes(out+12,toWord(_ISBOX[s3>>24],_ISBOX[(s2>>16)&0xFF],
+				_ISBOX[(s1>>8)&0xFF],_ISBOX[s0&0xFF]) ^ dk[3]);
+	}
+
+#endif
+
+	/**
+	 * @brief
+	 *           Transposes the 8x8 bit matrix whose rows are the bytes
+	 *           of a 64 bit word.
+	 *
+	 * @details
+	 *           Bit <i>k</i> of byte <i>j</i> of the input becomes bit
+	 *           <i>j</i> of byte <i>k</i> of the output.
+	 */
+	inline static uint64_t transpose8x8( uint64_t x ) {
+
+		uint64_t t;
+
+		t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+		x ^= t ^ (t << 7);
+		t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+		x ^= t ^ (t << 14);
+		t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+		x ^= t ^ (t << 28);
+
+		return x;
+	}
+
+	/**
+	 * @brief
+	 *           Substitutes up to 64 bytes using the S-box in bitsliced
+	 *           representation.
+	 *
+	 * @details
+	 *           Bit <i>l</i> of the <i>i</i>th plane holds the
+	 *           <i>i</i>th bit of the <i>l</i>th byte. The S-box is
+	 *           evaluated with the circuit of 115 logical gates (32 of
+	 *           them AND gates) due to Boyar and Peralta such that the running time does not
+	 *           depend on the bytes.
+	 *
+	 * @param q
+	 *           The eight bit planes that are substituted in place.
+	 *
+	 * @see <b>J. Boyar and R. Peralta (2012).</b>
+	 *      A depth-16 circuit for the AES S-box.
+	 *      <i>Information Security and Privacy Research</i>,
+	 *      pp. 287--298. Springer.
+	 */
+	static void bitslicedSbox( uint64_t q[8] ) {
+
+		uint64_t x0 = q[7] , x1 = q[6] , x2 = q[5] , x3 = q[4] ,
+				 x4 = q[3] , x5 = q[2] , x6 = q[1] , x7 = q[0];
+
+		// Top linear transformation
+		uint64_t y14 = x3 ^ x5;
+		uint64_t y13 = x0 ^ x6;
+		uint64_t y9 = x0 ^ x3;
+		uint64_t y8 = x0 ^ x5;
+		uint64_t t0 = x1 ^ x2;
+		uint64_t y1 = t0 ^ x7;
+		uint64_t y4 = y1 ^ x3;
+		uint64_t y12 = y13 ^ y14;
+		uint64_t y2 = y1 ^ x0;
+		uint64_t y5 = y1 ^ x6;
+		uint64_t y3 = y5 ^ y8;
+		uint64_t t1 = x4 ^ y12;
+		uint64_t y15 = t1 ^ x5;
+		uint64_t y20 = t1 ^ x1;
+		uint64_t y6 = y15 ^ x7;
+		uint64_t y10 = y15 ^ t0;
+		uint64_t y11 = y20 ^ y9;
+		uint64_t y7 = x7 ^ y11;
+		uint64_t y17 = y10 ^ y11;
+		uint64_t y19 = y10 ^ y8;
+		uint64_t y16 = t0 ^ y11;
+		uint64_t y21 = y13 ^ y16;
+		uint64_t y18 = x0 ^ y16;
+
+		// Non-linear section
+		uint64_t t2 = y12 & y15;
+		uint64_t t3 = y3 & y6;
+		uint64_t t4 = t3 ^ t2;
+		uint64_t t5 = y4 & x7;
+		uint64_t t6 = t5 ^ t2;
+		uint64_t t7 = y13 & y16;
+		uint64_t t8 = y5 & y1;
+		uint64_t t9 = t8 ^ t7;
+		uint64_t t10 = y2 & y7;
+		uint64_t t11 = t10 ^ t7;
+		uint64_t t12 = y9 & y11;
+		uint64_t t13 = y14 & y17;
+		uint64_t t14 = t13 ^ t12;
+		uint64_t t15 = y8 & y10;
+		uint64_t t16 = t15 ^ t12;
+		uint64_t t17 = t4 ^ t14;
+		uint64_t t18 = t6 ^ t16;
+		uint64_t t19 = t9 ^ t14;
+		uint64_t t20 = t11 ^ t16;
+		uint64_t t21 = t17 ^ y20;
+		uint64_t t22 = t18 ^ y19;
+		uint64_t t23 = t19 ^ y21;
+		uint64_t t24 = t20 ^ y18;
+		uint64_t t25 = t21 ^ t22;
+		uint64_t t26 = t21 & t23;
+		uint64_t t27 = t24 ^ t26;
+		uint64_t t28 = t25 & t27;
+		uint64_t t29 = t28 ^ t22;
+		uint64_t t30 = t23 ^ t24;
+		uint64_t t31 = t22 ^ t26;
+		uint64_t t32 = t31 & t30;
+		uint64_t t33 = t32 ^ t24;
+		uint64_t t34 = t23 ^ t33;
+		uint64_t t35 = t27 ^ t33;
+		uint64_t t36 = t24 & t35;
+		uint64_t t37 = t36 ^ t34;
+		uint64_t t38 = t27 ^ t36;
+		uint64_t t39 = t29 & t38;
+		uint64_t t40 = t25 ^ t39;
+		uint64_t t41 = t40 ^ t37;
+		uint64_t t42 = t29 ^ t33;
+		uint64_t t43 = t29 ^ t40;
+		uint64_t t44 = t33 ^ t37;
+		uint64_t t45 = t42 ^ t41;
+		uint64_t z0 = t44 & y15;
+		uint64_t z1 = t37 & y6;
+		uint64_t z2 = t33 & x7;
+		uint64_t z3 = t43 & y16;
+		uint64_t z4 = t40 & y1;
+		uint64_t z5 = t29 & y7;
+		uint64_t z6 = t42 & y11;
+		uint64_t z7 = t45 & y17;
+		uint64_t z8 = t41 & y10;
+		uint64_t z9 = t44 & y12;
+		uint64_t z10 = t37 & y3;
+		uint64_t z11 = t33 & y4;
+		uint64_t z12 = t43 & y13;
+		uint64_t z13 = t40 & y5;
+		uint64_t z14 = t29 & y2;
+		uint64_t z15 = t42 & y9;
+		uint64_t z16 = t45 & y14;
+		uint64_t z17 = t41 & y8;
+
+		// Bottom linear transformation
+		uint64_t t46 = z15 ^ z16;
+		uint64_t t47 = z10 ^ z11;
+		uint64_t t48 = z5 ^ z13;
+		uint64_t t49 = z9 ^ z10;
+		uint64_t t50 = z2 ^ z12;
+		uint64_t t51 = z2 ^ z5;
+		uint64_t t52 = z7 ^ z8;
+		uint64_t t53 = z0 ^ z3;
+		uint64_t t54 = z6 ^ z7;
+		uint64_t t55 = z16 ^ z17;
+		uint64_t t56 = z12 ^ t48;
+		uint64_t t57 = t50 ^ t53;
+		uint64_t t58 = z4 ^ t46;
+		uint64_t t59 = z3 ^ t54;
+		uint64_t t60 = t46 ^ t57;
+		uint64_t t61 = z14 ^ t57;
+		uint64_t t62 = t52 ^ t58;
+		uint64_t t63 = t49 ^ t58;
+		uint64_t t64 = z4 ^ t59;
+		uint64_t t65 = t61 ^ t62;
+		uint64_t t66 = z1 ^ t63;
+		uint64_t s0 = t59 ^ t63;
+		uint64_t s6 = t56 ^ ~t62;
+		uint64_t s7 = t48 ^ ~t60;
+		uint64_t t67 = t64 ^ t65;
+		uint64_t s3 = t53 ^ t66;
+		uint64_t s4 = t51 ^ t66;
+		uint64_t s5 = t47 ^ t65;
+		uint64_t s1 = t64 ^ ~s3;
+		uint64_t s2 = t55 ^ ~t67;
+
+		q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+		q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
+	}
+
+	/**
+	 * @brief
+	 *           Applies the inverse of the affine transformation of the
+	 *           S-box including its constant to bit planes.
+	 *
+	 * @details
+	 *           Since the S-box is the inversion in the finite field
+	 *           followed by the affine transformation, the inverse
+	 *           S-box equals this function applied before and after
+	 *           the S-box.
+	 */
+	static void bitslicedInvAffine( uint64_t q[8] ) {
+
+		uint64_t y[8];
+
+		for ( int i = 0 ; i < 8 ; i++ ) {
+			y[i] = q[(i+2)%8] ^ q[(i+5)%8] ^ q[(i+7)%8];
+		}
+
+		// Constant 0x05
+		y[0] = ~y[0];
+		y[2] = ~y[2];
+
+		memcpy(q,y,sizeof(y));
+	}
+
+	/**
+	 * @brief
+	 *           Transposes up to 64 bytes into eight bit planes.
+	 *
+	 * @details
+	 *           On output, bit <i>l</i> of <code>q[i]</code> equals the
+	 *           <i>i</i>th bit of <code>s[l]</code>; the bits of lanes
+	 *           not smaller than <i>n</i> are zero.
+	 *
+	 * @param q
+	 *           On output, the eight bit planes.
+	 *
+	 * @param s
+	 *           Array of <i>n</i> bytes.
+	 *
+	 * @param n
+	 *           Number of bytes; at most 64.
+	 */
+	static void toBitPlanes( uint64_t q[8] , const uint8_t *s , int n ) {
+
+		memset(q,0,8*sizeof(uint64_t));
+
+		// Eight bytes at a time
+		for ( int g = 0 ; 8*g < n ; g++ ) {
+
+			uint64_t v = 0;
+			for ( int j = 0 ; j < 8 && 8*g+j < n ; j++ ) {
+				v |= ((uint64_t)s[8*g+j]) << (8*j);
+			}
+
+			v = transpose8x8(v);
+
+			for ( int i = 0 ; i < 8 ; i++ ) {
+				q[i] |= ((v >> (8*i)) & 0xFF) << (8*g);
+			}
+		}
+	}
+
+	/**
+	 * @brief
+	 *           Inverse of \link toBitPlanes()\endlink.
+	 *
+	 * @param s
+	 *           On output, the first <i>n</i> bytes encoded by the bit
+	 *           planes.
+	 *
+	 * @param q
+	 *           The eight bit planes.
+	 *
+	 * @param n
+	 *           Number of bytes; at most 64.
+	 */
+	static void fromBitPlanes( uint8_t *s , const uint64_t q[8] , int n ) {
+
+		for ( int g = 0 ; 8*g < n ; g++ ) {
+
+			uint64_t v = 0;
+			for ( int i = 0 ; i < 8 ; i++ ) {
+				v |= ((q[i] >> (8*g)) & 0xFF) << (8*i);
+			}
+
+			v = transpose8x8(v);
+
+			for ( int j = 0 ; j < 8 && 8*g+j < n ; j++ ) {
+				s[8*g+j] = (uint8_t)(v >> (8*j));
+			}
+		}
+	}
+
+	/**
+	 * @brief
+	 *           Substitutes up to 64 bytes using the S-box or the
+	 *           inverse S-box in constant time.
+	 *
+	 * @details
+	 *           Rather than looking up the bytes in a table, which would
+	 *           leak the bytes through the cache, the bytes are
+	 *           transposed into bit planes on which the S-box is
+	 *           evaluated as a logic circuit by
+	 *           \link bitslicedSbox()\endlink.
+	 *
+	 * @param s
+	 *           Array of <i>n</i> bytes that are substituted in place.
+	 *
+	 * @param n
+	 *           Number of bytes; at most 64.
+	 *
+	 * @param inverse
+	 *           If <code>true</code>, the inverse S-box is applied;
+	 *           otherwise, the S-box.
+	 */
+	static void subBytesBitsliced( uint8_t *s , int n , bool inverse ) {
+
+		uint64_t q[8];
+
+		toBitPlanes(q,s,n);
+
+		if ( inverse ) {
+			bitslicedInvAffine(q);
+			bitslicedSbox(q);
+			bitslicedInvAffine(q);
+		} else {
+			bitslicedSbox(q);
+		}
+
+		fromBitPlanes(s,q,n);
+	}
+
+	/**
+	 * @brief
+	 *           Returns an unsigned 32-bit word whose four bytes
+	 *           are the substituted bytes of the input word.
+	 *
+	 * @param w
+	 *           Input word.
+	 *
+	 * @return
+	 *           \f$b_3'+b_2'\cdot 256+b_1'\cdot 256^2+b_0'\cdot 256^3\f$
+	 *           where \f$b_j'\f$ is the substitution of \f$b_j\f$ and
+	 *           \$fw=b_3+b_2\cdot 256+b_1\cdot 256^2+b_0\cdot 256^3\f$.
+	 */
+	static uint32_t SubWord( uint32_t w ) {
+
+		uint8_t b[4];
+
+		toBytes(b,w);
+
+		subBytesBitsliced(b,4,false);
+
+		return toWord(b[0],b[1],b[2],b[3]);
+	}
+
+	/**
+	 * @brief
+	 *            Function used in the key expansion routine that takes a
+	 *            four-byte word and performs a cyclic permutation.
+	 *
+	 * @param w
+	 *            Input four-byte word
+	 *            \f$b_3+b_2\cdot 256+b_1\cdot b_1\cdot 256^2+b_0\cdot 256^3\f$.
+	 *
+	 * @return
+	 *            Cylic permutation of <i>w</i>, i.e.,
+	 *            \f$b_0+b_3\cdot 256+b_2\cdot 256^2+b_1\cdot 256^3\f$.
+	 */
+	static uint32_t RotWord( uint32_t w ) {
+
+		uint8_t b[4];
+
+		toBytes(b,w);
+
+		return toWord(b[1],b[2],b[3],b[0]);
+	}
+
+	/**
+	 * @brief
+	 *           Multiplies each of the four bytes of a word by \f$x\f$
+	 *           in the finite field defined by \f$x^8+x^4+x^3+x+1\f$
+	 *           without branching on the bytes.
+	 */
+	inline static uint32_t xtime4( uint32_t x ) {
+		return ((x & 0x7F7F7F7F) << 1) ^ (((x >> 7) & 0x01010101) * 0x1B);
+	}
+
+	/**
+	 * @brief
+	 *           Rotates a 32 bit word by <i>k</i> bits to the right
+	 *           where \f$0<k<32\f$.
+	 */
+	inline static uint32_t rotr32( uint32_t x , int k ) {
+		return (x >> k) | (x << (32-k));
+	}
+
+	/**
+	 * @brief
+	 *           Applies the <em>MixColumns()</em> transformation to a
+	 *           column whose <i>r</i>th byte is the least significant
+	 *           byte of <code>x>>(8*r)</code>.
+	 */
+	static uint32_t MixColumn( uint32_t x ) {
+
+		// s_r' = 2*(s_r+s_{r+1})+s_{r+1}+s_{r+2}+s_{r+3}
+		uint32_t x1 = rotr32(x,8);
+
+		return xtime4(x ^ x1) ^ x1 ^ rotr32(x,16) ^ rotr32(x,24);
+	}
+
+	/**
+	 * @brief
+	 *           Applies the <em>InvMixColumns()</em> transformation to a
+	 *           column encoded as for \link MixColumn()\endlink.
+	 */
+	static uint32_t InvMixColumn( uint32_t x ) {
+
+		// The inverse matrix factors into the matrix of 'MixColumns()'
+		// and the matrix with rows (5,0,4,0) rotated
+		return MixColumn(x ^ xtime4(xtime4(x ^ rotr32(x,16))));
+	}
+
+	/**
+	 * @brief
+	 *           Applies the <em>InvMixColumns()</em> transformation to a
+	 *           column encoded as a big-endian 32 bit word as used for
+	 *           the key schedule.
+	 */
+	static uint32_t InvMixColumnWord( uint32_t w ) {
+
+		uint8_t b[4];
+
+		toBytes(b,w);
+
+		uint32_t x = InvMixColumn(toWord(b[3],b[2],b[1],b[0]));
+
+		toBytes(b,x);
+
+		return toWord(b[3],b[2],b[1],b[0]);
+	}
+
+	/**
+	 * @brief
+	 *           Applies <em>MixColumns()</em> or
+	 *           <em>InvMixColumns()</em> to a state of 16 bytes.
+	 */
+	static void mixColumnsState( uint8_t s[16] , bool inverse ) {
+
+		for ( int c = 0 ; c < 4 ; c++ , s += 4 ) {
+
+			uint32_t x = toWord(s[3],s[2],s[1],s[0]);
+
+			x = inverse ? InvMixColumn(x) : MixColumn(x);
+
+			for ( int r = 0 ; r < 4 ; r++ ) {
+				s[r] = (uint8_t)(x >> (8*r));
+			}
+		}
+	}
+
+	/**
+	 * @brief
+	 *           Transposes the round keys of up to four expanded keys
+	 *           into bit planes.
+	 *
+	 * @details
+	 *           The lanes of the planes correspond to the bytes of up
+	 *           to four states as for \link toBitPlanes()\endlink such
+	 *           that <code>kq[round]</code> can be added to the planes
+	 *           of four states whose <i>l</i>th state is encrypted or
+	 *           decrypted under the <i>l</i>th key.
+	 *
+	 * @param kq
+	 *           On output, the bit planes of the 11 round keys.
+	 *
+	 * @param w
+	 *           Array of <i>num</i> expanded keys of 44 words each.
+	 *
+	 * @param num
+	 *           The number of keys; at most 4.
+	 */
+	static void roundKeyPlanes
+	( uint64_t kq[11][8] , const uint32_t *const *w , int num ) {
+
+		uint8_t k[64];
+
+		for ( int round = 0 ; round <= 10 ; round++ ) {
+
+			for ( int l = 0 ; l < num ; l++ ) {
+				for ( int c = 0 ; c < 4 ; c++ ) {
+					toBytes(k+16*l+4*c,w[l][4*round+c]);
+				}
+			}
+
+			toBitPlanes(kq[round],k,16*num);
+		}
+
+		memset(k,0,sizeof(k));
+	}
+
+	/**
+	 * @brief
+	 *           Rotates each 16 bit chunk of a 64 bit word by
+	 *           <i>k</i> bits to the right where \f$0<k<16\f$.
+	 */
+	inline static uint64_t rotr16x4( uint64_t y , int k ) {
+
+		uint64_t m = 0x0001000100010001ULL * ((((uint64_t)1) << (16-k)) - 1);
+
+		return ((y >> k) & m) | ((y << (16-k)) & ~m);
+	}
+
+	/**
+	 * @brief
+	 *           Applies <em>ShiftRows()</em> or <em>InvShiftRows()</em>
+	 *           to the bit planes of up to four states.
+	 *
+	 * @details
+	 *           The byte in row <i>r</i> and column <i>c</i> of a state
+	 *           is lane <i>4c+r</i> of its 16 bit chunk such that
+	 *           shifting row <i>r</i> by <i>r</i> positions is a
+	 *           rotation of its lanes by <i>4r</i> bits.
+	 */
+	static void shiftRowsPlanes( uint64_t q[8] , bool inverse ) {
+
+		for ( int i = 0 ; i < 8 ; i++ ) {
+
+			uint64_t x = q[i];
+
+			if ( inverse ) {
+				q[i] = (x & 0x1111111111111111ULL) |
+					   rotr16x4(x & 0x2222222222222222ULL,12) |
+					   rotr16x4(x & 0x4444444444444444ULL,8) |
+					   rotr16x4(x & 0x8888888888888888ULL,4);
+			} else {
+				q[i] = (x & 0x1111111111111111ULL) |
+					   rotr16x4(x & 0x2222222222222222ULL,4) |
+					   rotr16x4(x & 0x4444444444444444ULL,8) |
+					   rotr16x4(x & 0x8888888888888888ULL,12);
+			}
+		}
+	}
+
+	/**
+	 * @brief
+	 *           Rotates the four rows of each column of the bit
+	 *           planes by one position upwards.
+	 */
+	inline static uint64_t rotRows1( uint64_t x ) {
+		return ((x >> 1) & 0x7777777777777777ULL) |
+			   ((x << 3) & 0x8888888888888888ULL);
+	}
+
+	/**
+	 * @brief
+	 *           Rotates the four rows of each column of the bit
+	 *           planes by two positions.
+	 */
+	inline static uint64_t rotRows2( uint64_t x ) {
+		return ((x >> 2) & 0x3333333333333333ULL) |
+			   ((x << 2) & 0xCCCCCCCCCCCCCCCCULL);
+	}
+
+	/**
+	 * @brief
+	 *           Multiplies each lane of the bit planes by \f$x\f$ in the
+	 *           finite field defined by \f$x^8+x^4+x^3+x+1\f$.
+	 */
+	static void xtimePlanes( uint64_t y[8] , const uint64_t t[8] ) {
+
+		y[7] = t[6];
+		y[6] = t[5];
+		y[5] = t[4];
+		y[4] = t[3] ^ t[7];
+		y[3] = t[2] ^ t[7];
+		y[2] = t[1];
+		y[1] = t[0] ^ t[7];
+		y[0] = t[7];
+	}
+
+	/**
+	 * @brief
+	 *           Applies <em>MixColumns()</em> to the bit planes of up to
+	 *           four states.
+	 */
+	static void mixColumnsPlanes( uint64_t q[8] ) {
+
+		uint64_t a1[8] , t[8] , y[8];
+
+		// s_r' = 2*(s_r+s_{r+1})+s_{r+1}+s_{r+2}+s_{r+3}
+		for ( int i = 0 ; i < 8 ; i++ ) {
+			a1[i] = rotRows1(q[i]);
+			t[i] = q[i] ^ a1[i];
+		}
+
+		xtimePlanes(y,t);
+
+		for ( int i = 0 ; i < 8 ; i++ ) {
+			q[i] = y[i] ^ a1[i] ^ rotRows2(t[i]);
+		}
+	}
+
+	/**
+	 * @brief
+	 *           Applies <em>InvMixColumns()</em> to the bit planes of up
+	 *           to four states.
+	 */
+	static void invMixColumnsPlanes( uint64_t q[8] ) {
+
+		uint64_t t[8] , y[8];
+
+		// Same factorization as for 'InvMixColumn()'
+		for ( int i = 0 ; i < 8 ; i++ ) {
+			t[i] = q[i] ^ rotRows2(q[i]);
+		}
+
+		xtimePlanes(y,t);
+		xtimePlanes(t,y);
+
+		for ( int i = 0 ; i < 8 ; i++ ) {
+			q[i] ^= t[i];
+		}
+
+		mixColumnsPlanes(q);
+	}
+
+	/**
+	 * @brief
+	 *           Adds round key planes to the bit planes of the states.
+	 */
+	inline static void addRoundKeyPlanes( uint64_t q[8] , const uint64_t k[8] ) {
+		for ( int i = 0 ; i < 8 ; i++ ) {
+			q[i] ^= k[i];
+		}
+	}
+
+#ifndef THIMBLE_AES_LOOKUP_TABLES
+	/**
+	 * @brief
+	 *           Encrypts up to four blocks in constant time, each under
+	 *           its own key.
+	 *
+	 * @details
+	 *           The blocks are kept in bitsliced representation during
+	 *           all rounds such that the costs of a round are shared by
+	 *           the blocks and no table is indexed by secret data. If
+	 *           less than four blocks are given, the lanes of the
+	 *           missing blocks are zero and pass through the circuit
+	 *           like the others such that the running time does not
+	 *           depend on <i>num</i> either.
+	 *
+	 * @param s
+	 *           Array of <i>num</i> blocks of 16 bytes each that are
+	 *           encrypted in place.
+	 *
+	 * @param num
+	 *           The number of blocks; at most 4.
+	 *
+	 * @param kq
+	 *           The round key planes as computed by
+	 *           \link roundKeyPlanes()\endlink.
+	 */
+	static void encryptBlocksBitsliced
+	( uint8_t *s , int num , const uint64_t kq[11][8] ) {
+
+		uint64_t q[8];
+
+		toBitPlanes(q,s,16*num);
+
+		addRoundKeyPlanes(q,kq[0]);
+
+		for ( int round = 1 ; round < 10 ; round++ ) {
+			bitslicedSbox(q);
+			shiftRowsPlanes(q,false);
+			mixColumnsPlanes(q);
+			addRoundKeyPlanes(q,kq[round]);
+		}
+
+		bitslicedSbox(q);
+		shiftRowsPlanes(q,false);
+		addRoundKeyPlanes(q,kq[10]);
+
+		fromBitPlanes(s,q,16*num);
+
+		memset(q,0,sizeof(q));
+	}
+#endif
+
+	/**
+	 * @brief
+	 *           Decrypts up to four blocks in constant time, each under
+	 *           its own key.
+	 *
+	 * @details
+	 *           The blocks are kept in bitsliced representation during
+	 *           all rounds such that the costs of a round are shared by
+	 *           the blocks and no table is indexed by secret data. The
+	 *           inverse cipher of Figure 12 of the standard is run with
+	 *           the round key planes of the (not inverted) expanded
+	 *           keys. As for \link encryptBlocksBitsliced()\endlink,
+	 *           the lanes of missing blocks are zero.
+	 *
+	 * @param s
+	 *           Array of <i>num</i> blocks of 16 bytes each that are
+	 *           decrypted in place.
+	 *
+	 * @param num
+	 *           The number of blocks; at most 4.
+	 *
+	 * @param kq
+	 *           The round key planes as computed by
+	 *           \link roundKeyPlanes()\endlink.
+	 */
+	static void decryptBlocksBitsliced
+	( uint8_t *s , int num , const uint64_t kq[11][8] ) {
+
+		uint64_t q[8];
+
+		toBitPlanes(q,s,16*num);
+
+		addRoundKeyPlanes(q,kq[10]);
+
+		for ( int round = 9 ; round >= 1 ; round-- ) {
+			shiftRowsPlanes(q,true);
+			bitslicedInvAffine(q);
+			bitslicedSbox(q);
+			bitslicedInvAffine(q);
+			addRoundKeyPlanes(q,kq[round]);
+			invMixColumnsPlanes(q);
+		}
+
+		shiftRowsPlanes(q,true);
+		bitslicedInvAffine(q);
+		bitslicedSbox(q);
+		bitslicedInvAffine(q);
+		addRoundKeyPlanes(q,kq[0]);
+
+		fromBitPlanes(s,q,16*num);
+
+		memset(q,0,sizeof(q));
+	}
 
 	/**
 	 * @brief
-	 *            Concatenates four bytes to an unsigned 32 bit word
-	 *            (Big-endian).
+	 *           Encrypts data in cipher-block chaining mode (with zero
+	 *           initialization vector) without 'AES-NI'.
 	 *
-	 * @param b0
-	 *            unsigned byte
+	 * @details
+	 *           The blocks are chained and thus have to be encrypted
+	 *           one after the other. By default, each block is run
+	 *           through \link encryptBlocksBitsliced()\endlink with
+	 *           the remaining three blocks of the pass left empty,
+	 *           which keeps the encryption in constant time. Only if
+	 *           'THIMBLE_AES_LOOKUP_TABLES' is defined, the faster
+	 *           \link AESTables lookup tables\endlink are used.
 	 *
-	 * @param b1
-	 *            unsigned byte
+	 * @param out
+	 *           Output array of <i>n</i> bytes; may be equal to
+	 *           <code>in</code>.
 	 *
-	 * @param b2
-	 *            unsigned byte
+	 * @param in
+	 *           Input array of <i>n</i> bytes.
 	 *
-	 * @param b3
-	 *            unsigned byte
+	 * @param n
+	 *           Positive multiple of 16.
 	 *
-	 * @return \f$b3+b2\cdot 256+b1\cdot 256^2+b0\cdot 256^3\f$
+	 * @param w
+	 *           The 44 words of the expanded key.
 	 */
-	static uint32_t toWord( uint8_t b0 , uint8_t b1 , uint8_t b2 , uint8_t b3 ) {
+	static void encryptCbcPortable
+	( uint8_t *out , const uint8_t *in , int n , const uint32_t *w ) {
 
-		uint32_t w;
+		uint8_t x[16];
 
-		w  = (uint32_t)b0; w <<= 8;
-		w += (uint32_t)b1; w <<= 8;
-		w += (uint32_t)b2; w <<= 8;
-		w += (uint32_t)b3;
+#ifndef THIMBLE_AES_LOOKUP_TABLES
+		uint64_t kq[11][8];
 
-		return w;
+		roundKeyPlanes(kq,&w,1);
+#endif
+
+		memset(x,0,16);
+
+		for ( int i = 0 ; i < n ; i += 16 ) {
+			for ( int j = 0 ; j < 16 ; j++ ) {
+				x[j] ^= in[i+j];
+			}
+#ifdef THIMBLE_AES_LOOKUP_TABLES
+			encryptBlockTable(x,x,w);
+#else
+			encryptBlocksBitsliced(x,1,kq);
+#endif
+			memcpy(out+i,x,16);
+		}
+
+		memset(x,0,16);
+#ifndef THIMBLE_AES_LOOKUP_TABLES
+		memset(kq,0,sizeof(kq));
+#endif
 	}
 
 	/**
 	 * @brief
-	 *           Splits an unsigned 32-bit word into four bytes.
+	 *           Decrypts data in cipher-block chaining mode (with zero
+	 *           initialization vector) without 'AES-NI'.
+	 *
+	 * @details
+	 *           Since the blocks can be decrypted independently, four
+	 *           blocks are decrypted at once in bitsliced
+	 *           representation. A final group of less than four blocks
+	 *           is decrypted in the same way with the lanes of the
+	 *           missing blocks left empty. Only if
+	 *           'THIMBLE_AES_LOOKUP_TABLES' is defined, the blocks of
+	 *           such a group are decrypted with the
+	 *           \link AESTables lookup tables\endlink instead.
+	 *
+	 * @param out
+	 *           Output array of <i>n</i> bytes; may be equal to
+	 *           <code>in</code>.
+	 *
+	 * @param in
+	 *           Input array of <i>n</i> bytes.
+	 *
+	 * @param n
+	 *           Positive multiple of 16.
 	 *
 	 * @param w
-	 *           Input unsigned 32-bit word.
+	 *           The 44 words of the expanded key.
 	 *
-	 * @param b  Output byte array such that
-	 *           \f$w=b[3]+b[2]\cdot 256+b[1]\cdot 256^2+b[0]\cdot 256^3\f$
+	 * @param dw
+	 *           The 44 words of the expanded key for the equivalent
+	 *           inverse cipher; only used with the lookup tables.
 	 */
-	static void toBytes( uint8_t b[4] , uint32_t w ) {
-		b[3] = (uint8_t)(w & 0xFF); w >>= 8;
-		b[2] = (uint8_t)(w & 0xFF); w >>= 8;
-		b[1] = (uint8_t)(w & 0xFF); w >>= 8;
-		b[0] = (uint8_t)w;
+	static void decryptCbcPortable
+	( uint8_t *out , const uint8_t *in , int n ,
+	  const uint32_t *w , const uint32_t *dw ) {
+
+		uint64_t kq[11][8];
+		uint8_t prev[16] , c[64] , x[64];
+		const uint32_t *keys[4] = {w,w,w,w};
+
+		roundKeyPlanes(kq,keys,4);
+
+		memset(prev,0,16);
+
+		for ( int i = 0 ; i < n ; i += 64 ) {
+
+			int num = (n-i)/16 < 4 ? (n-i)/16 : 4;
+
+			// Backup since 'out' and 'in' may be equal
+			memcpy(c,in+i,16*num);
+			memcpy(x,c,16*num);
+
+#ifdef THIMBLE_AES_LOOKUP_TABLES
+			if ( num < 4 ) {
+				for ( int l = 0 ; l < num ; l++ ) {
+					decryptBlockTable(x+16*l,x+16*l,dw);
+				}
+			} else {
+				decryptBlocksBitsliced(x,4,kq);
+			}
+#else
+			decryptBlocksBitsliced(x,num,kq);
+#endif
+
+			for ( int j = 0 ; j < 16 ; j++ ) {
+				out[i+j] = (uint8_t)(x[j]^prev[j]);
+			}
+			for ( int j = 16 ; j < 16*num ; j++ ) {
+				out[i+j] = (uint8_t)(x[j]^c[j-16]);
+			}
+
+			memcpy(prev,c+16*(num-1),16);
+		}
+
+		memset(x,0,sizeof(x));
+		memset(kq,0,sizeof(kq));
 	}
 
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
 	/**
 	 * @brief
-	 *           Substitutes a single byte using the
-	 *           \link _SBOX S-box\endlink.
-	 *
-	 * @param b
-	 *           Input byte.
+	 *           Converts an expanded key of 44 words into the 176
+	 *           bytes of the round keys as expected by the
+	 *           'AES-NI' instructions.
+	 */
+	static void toRoundKeyBytes( uint8_t k[176] , const uint32_t *w ) {
+		for ( int i = 0 ; i < 44 ; i++ ) {
+			toBytes(k+4*i,w[i]);
+		}
+	}
+
+	/**
+	 * @brief
+	 *           Same as \link encryptCbcPortable()\endlink but uses the
+	 *           'AES-NI' instructions.
 	 *
-	 * @return
-	 *           Substitution of <i>b</i>.
+	 * @warning
+	 *           Must only be called if
+	 *           \link MathTools::hasAesni()\endlink returns
+	 *           <code>true</code>.
 	 */
-	inline static uint8_t SubByte( uint8_t b ) {
-		return _SBOX[b];
+	__attribute__((target("aes,sse2")))
+	static void encryptCbcAesni
+	( uint8_t *out , const uint8_t *in , int n , const uint8_t rk[176] ) {
+
+		__m128i k[11];
+		for ( int r = 0 ; r <= 10 ; r++ ) {
+			k[r] = _mm_loadu_si128((const __m128i*)(rk+16*r));
+		}
+
+		__m128i x = _mm_setzero_si128();
+
+		for ( int i = 0 ; i < n ; i += 16 ) {
+			x = _mm_xor_si128(x,_mm_loadu_si128((const __m128i*)(in+i)));
+			x = _mm_xor_si128(x,k[0]);
+			for ( int r = 1 ; r < 10 ; r++ ) {
+				x = _mm_aesenc_si128(x,k[r]);
+			}
+			x = _mm_aesenclast_si128(x,k[10]);
+			_mm_storeu_si128((__m128i*)(out+i),x);
+		}
 	}
 
 	/**
 	 * @brief
-	 *           Performs the inverse substitution of a byte using the
-	 *           \link _ISBOX inverse S-box\endlink.
+	 *           Same as \link decryptCbcPortable()\endlink but uses the
+	 *           'AES-NI' instructions.
 	 *
 	 * @details
-	 *           This function is inverse to \link SubByte(uint8_t)\endlink.
-	 *           More specifically,
-	 *           <pre>
-	 *            b == InvSubByte(SubByte(b))
-	 *           </pre>
-	 *           holds <code>true</code> for each <code>uint8_t</code>.
+	 *           Since in cipher-block chaining mode the decryption of
+	 *           a block depends only on the ciphertext, eight blocks
+	 *           are decrypted in an interleaved manner to hide the
+	 *           latency of the 'AESDEC' instruction.
 	 *
-	 * @param b
-	 *           Input byte.
-	 *
-	 * @return
-	 *           Inverse substitution of <i>b</i>.
+	 * @warning
+	 *           Must only be called if
+	 *           \link MathTools::hasAesni()\endlink returns
+	 *           <code>true</code>.
 	 */
-	inline static uint8_t InvSubByte( uint8_t b ) {
-		return _ISBOX[b];
+	__attribute__((target("aes,sse2")))
+	static void decryptCbcAesni
+	( uint8_t *out , const uint8_t *in , int n , const uint8_t dk[176] ) {
+
+		__m128i k[11];
+		for ( int r = 0 ; r <= 10 ; r++ ) {
+			k[r] = _mm_loadu_si128((const __m128i*)(dk+16*r));
+		}
+
+		__m128i prev = _mm_setzero_si128();
+		int i;
+
+		for ( i = 0 ; i+128 <= n ; i += 128 ) {
+
+			__m128i c[8] , x[8];
+
+			for ( int j = 0 ; j < 8 ; j++ ) {
+				c[j] = _mm_loadu_si128((const __m128i*)(in+i+16*j));
+				x[j] = _mm_xor_si128(c[j],k[0]);
+			}
+			for ( int r = 1 ; r < 10 ; r++ ) {
+				for ( int j = 0 ; j < 8 ; j++ ) {
+					x[j] = _mm_aesdec_si128(x[j],k[r]);
+				}
+			}
+			for ( int j = 0 ; j < 8 ; j++ ) {
+				x[j] = _mm_aesdeclast_si128(x[j],k[10]);
+			}
+
+			_mm_storeu_si128((__m128i*)(out+i),_mm_xor_si128(x[0],prev));
+			for ( int j = 1 ; j < 8 ; j++ ) {
+				_mm_storeu_si128
+				((__m128i*)(out+i+16*j),_mm_xor_si128(x[j],c[j-1]));
+			}
+			prev = c[7];
+		}
+
+		for ( ; i < n ; i += 16 ) {
+
+			__m128i c = _mm_loadu_si128((const __m128i*)(in+i));
+			__m128i x = _mm_xor_si128(c,k[0]);
+			for ( int r = 1 ; r < 10 ; r++ ) {
+				x = _mm_aesdec_si128(x,k[r]);
+			}
+			x = _mm_aesdeclast_si128(x,k[10]);
+
+			_mm_storeu_si128((__m128i*)(out+i),_mm_xor_si128(x,prev));
+			prev = c;
+		}
 	}
 
 	/**
 	 * @brief
-	 *           Returns an unsigned 32-bit word whose four bytes
-	 *           are the substituted bytes of the input word.
+	 *           Decrypts the same data in cipher-block chaining mode
+	 *           under up to eight keys using the 'AES-NI'
+	 *           instructions.
 	 *
-	 * @param w
-	 *           Input word.
+	 * @details
+	 *           The decryptions under the different keys are
+	 *           interleaved to hide the latency of the 'AESDEC'
+	 *           instruction. The decryption under the <i>l</i>th key
+	 *           is written to <code>out+l*n</code>.
 	 *
-	 * @return
-	 *           \f$b_3'+b_2'\cdot 256+b_1'\cdot 256^2+b_0'\cdot 256^3\f$
-	 *           where \f$b_j'=SubByte(b_j)\f$ and
-	 *           \$fw=b_3+b_2\cdot 256+b_1\cdot 256^2+b_0\cdot 256^3\f$.
+	 * @warning
+	 *           Must only be called if
+	 *           \link MathTools::hasAesni()\endlink returns
+	 *           <code>true</code>.
 	 */
-	static uint32_t SubWord( uint32_t w ) {
+	__attribute__((target("aes,sse2")))
+	static void decryptCbcAesniMultiKey
+	( uint8_t *out , const uint8_t *in , int n ,
+	  const uint8_t dk[][176] , int numKeys ) {
+
+		// Always eight lanes such that the loops over the lanes can be
+		// unrolled; unused lanes repeat the first key.
+		__m128i k[8][11];
+		for ( int l = 0 ; l < 8 ; l++ ) {
+			for ( int r = 0 ; r <= 10 ; r++ ) {
+				k[l][r] = _mm_loadu_si128
+						((const __m128i*)(dk[l<numKeys?l:0]+16*r));
+			}
+		}
 
-		uint8_t b[4];
+		__m128i prev = _mm_setzero_si128();
 
-		toBytes(b,w);
+		for ( int i = 0 ; i < n ; i += 16 ) {
 
-		b[0] = SubByte(b[0]);
-		b[1] = SubByte(b[1]);
-		b[2] = SubByte(b[2]);
-		b[3] = SubByte(b[3]);
+			__m128i c = _mm_loadu_si128((const __m128i*)(in+i));
+			__m128i x[8];
 
-		return toWord(b[0],b[1],b[2],b[3]);
+			for ( int l = 0 ; l < 8 ; l++ ) {
+				x[l] = _mm_xor_si128(c,k[l][0]);
+			}
+			for ( int r = 1 ; r < 10 ; r++ ) {
+				for ( int l = 0 ; l < 8 ; l++ ) {
+					x[l] = _mm_aesdec_si128(x[l],k[l][r]);
+				}
+			}
+			for ( int l = 0 ; l < 8 ; l++ ) {
+				x[l] = _mm_aesdeclast_si128(x[l],k[l][10]);
+			}
+			for ( int l = 0 ; l < numKeys ; l++ ) {
+				_mm_storeu_si128
+				((__m128i*)(out+(size_t)l*n+i),_mm_xor_si128(x[l],prev));
+			}
+
+			prev = c;
+		}
 	}
 
 	/**
 	 * @brief
-	 *            Function used in the key expansion routine that takes a
-	 *            four-byte word and performs a cyclic permutation.
+	 *           Computes the next round key of the key expansion using
+	 *           the AES-NI instruction set.
 	 *
-	 * @param w
-	 *            Input four-byte word
-	 *            \f$b_3+b_2\cdot 256+b_1\cdot b_1\cdot 256^2+b_0\cdot 256^3\f$.
+	 * @param k
+	 *           The previous round key.
 	 *
-	 * @return
-	 *            Cylic permutation of <i>w</i>, i.e.,
-	 *            \f$b_0+b_3\cdot 256+b_2\cdot 256^2+b_1\cdot 256^3\f$.
+	 * @param t
+	 *           Result of <code>_mm_aeskeygenassist_si128()</code>
+	 *           applied to <code>k</code> with the round constant.
 	 */
-	static uint32_t RotWord( uint32_t w ) {
+	__attribute__((target("aes,sse2")))
+	static inline __m128i nextRoundKeyAesni( __m128i k , __m128i t ) {
 
-		uint8_t b[4];
+		t = _mm_shuffle_epi32(t,0xFF);
+		k = _mm_xor_si128(k,_mm_slli_si128(k,4));
+		k = _mm_xor_si128(k,_mm_slli_si128(k,4));
+		k = _mm_xor_si128(k,_mm_slli_si128(k,4));
 
-		toBytes(b,w);
+		return _mm_xor_si128(k,t);
+	}
 
-		return toWord(b[1],b[2],b[3],b[0]);
+	/**
+	 * @brief
+	 *           Expands a key and computes the key schedule of the
+	 *           equivalent inverse cipher using the AES-NI instruction
+	 *           set.
+	 *
+	 * @details
+	 *           Produces the same words as the portable implementation
+	 *           of \link AES128::keyExpansion()\endlink but does not
+	 *           evaluate the S-box in software.
+	 *
+	 * @warning
+	 *           Must only be called if
+	 *           \link MathTools::hasAesni()\endlink returns
+	 *           <code>true</code>.
+	 */
+	__attribute__((target("aes,sse2")))
+	static void keyExpansionAesni
+	( uint32_t w[44] , uint32_t dw[44] , const uint8_t key[16] ) {
+
+		__m128i k[11];
+		uint8_t b[16];
+
+		// The round constant must be an immediate
+		k[0]  = _mm_loadu_si128((const __m128i*)key);
+		k[1]  = nextRoundKeyAesni(k[0],_mm_aeskeygenassist_si128(k[0],0x01));
+		k[2]  = nextRoundKeyAesni(k[1],_mm_aeskeygenassist_si128(k[1],0x02));
+		k[3]  = nextRoundKeyAesni(k[2],_mm_aeskeygenassist_si128(k[2],0x04));
+		k[4]  = nextRoundKeyAesni(k[3],_mm_aeskeygenassist_si128(k[3],0x08));
+		k[5]  = nextRoundKeyAesni(k[4],_mm_aeskeygenassist_si128(k[4],0x10));
+		k[6]  = nextRoundKeyAesni(k[5],_mm_aeskeygenassist_si128(k[5],0x20));
+		k[7]  = nextRoundKeyAesni(k[6],_mm_aeskeygenassist_si128(k[6],0x40));
+		k[8]  = nextRoundKeyAesni(k[7],_mm_aeskeygenassist_si128(k[7],0x80));
+		k[9]  = nextRoundKeyAesni(k[8],_mm_aeskeygenassist_si128(k[8],0x1B));
+		k[10] = nextRoundKeyAesni(k[9],_mm_aeskeygenassist_si128(k[9],0x36));
+
+		for ( int round = 0 ; round <= 10 ; round++ ) {
+
+			_mm_storeu_si128((__m128i*)b,k[round]);
+			for ( int c = 0 ; c < 4 ; c++ ) {
+				w[4*round+c] = toWord(b[4*c],b[4*c+1],b[4*c+2],b[4*c+3]);
+			}
+
+			// Figure 15 on page 25 of the standard
+			if ( round > 0 && round < 10 ) {
+				_mm_storeu_si128((__m128i*)b,_mm_aesimc_si128(k[round]));
+			}
+			for ( int c = 0 ; c < 4 ; c++ ) {
+				dw[4*(10-round)+c] =
+						toWord(b[4*c],b[4*c+1],b[4*c+2],b[4*c+3]);
+			}
+		}
+
+		memset(b,0,16);
+		memset(k,0,sizeof(k));
 	}
+#endif
 
 	/**
 	 * @brief
@@ -342,6 +1562,7 @@ namespace thimble {
 	 */
 	AES128::AES128( const AES128 & aes ) {
 		memcpy(this->w    ,aes.w    ,44*sizeof(uint32_t));
+		memcpy(this->dw   ,aes.dw   ,44*sizeof(uint32_t));
 		memcpy(this->state,aes.state,16);
 	}
 
@@ -352,7 +1573,8 @@ namespace thimble {
 	AES128::~AES128() {
 
 		// Just overwrite any data.
-		memset(this->w    ,0,44);
+		memset(this->w    ,0,44*sizeof(uint32_t));
+		memset(this->dw   ,0,44*sizeof(uint32_t));
 		memset(this->state,0,16);
 	}
 
@@ -371,47 +1593,12 @@ namespace thimble {
 	 *           A reference to this AES key after assignment.
 	 */
 	AES128 & AES128::operator=(const AES128 & aes ) {
-		memcpy(this->w    ,aes.w    ,44);
+		memcpy(this->w    ,aes.w    ,44*sizeof(uint32_t));
+		memcpy(this->dw   ,aes.dw   ,44*sizeof(uint32_t));
 		memcpy(this->state,aes.state,16);
 		return *this;
 	}
 
-	/**
-	 * @brief
-	 *          XOR the elements of two arrays both containing
-	 *          16 bytes.
-	 *
-	 * @details
-	 *          XORs the bytes in <code>out</code> with the
-	 *          bytes in <code>in</code> and stores the results
-	 *          in <code>out</code>.
-	 *
-	 *          The method is used to realize the chaining block
-	 *          cipher mode on encryption and decryption.
-	 *
-	 * @param in
-	 *          Input array containing 16 bytes.
-	 *
-	 * @param out
-	 *          Input array containing 16 bytes; the array also serves
-	 *          as the output.
-	 */
-    static void mxor8( uint8_t out[16] , const uint8_t in[16]  ) {
-
-		// Interpret the bytes as two 64 bit word which should
-		// increase execution on 64 bit machines.
-
-		register uint64_t *_out , *_in;
-
-		_out = (uint64_t*)out;
-		_in = (uint64_t*)in;
-
-		*_out ^= *_in;
-		++_out; ++_in;
-
-		*_out ^= *_in;
-    }
-
 	/**
 	 * @brief
 	 *           Encrypt data using this AES key.
@@ -450,8 +1637,6 @@ namespace thimble {
 	 */
 	void AES128::encrypt( uint8_t *out , const uint8_t *in , int n ) {
 
-		int i;
-
 		// Ensure data consists of 128 bit blocks.
 		if ( n % 16 != 0 ) {
 			cerr << "AES128::encrypt: "
@@ -463,35 +1648,17 @@ namespace thimble {
 			return;
 		}
 
-		// Copy the first 128 bits to the state.
-		memcpy(this->state,in,16);
-
-		// Encrypt the first 128 bit and ...
-		cipher();
-
-		// ... store the encryption to the output; this is equivalent to
-		// perform the encryption of the first block with a zero
-		// initialization vector when accounting for the
-		// cipher-block chaining mode.
-		memcpy(out,this->state,16);
-
-		// Iteration over the remaining blocks
-		for ( i = 16 ; i < n ; i += 16 ) {
-
-			in  += 16;
-			out += 16;
-
-			// As the state contains the encryption of the previous blocks,
-			// we use the state for xoring with the current block, thereby
-			// realizing the cipher-block chaining mode.
-			mxor8(this->state,in);
-
-			// Cipher the current block and ...
-			cipher();
-
-			// ... store the encrpytion to the output.
-			memcpy(out,this->state,16);
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+		if ( MathTools::hasAesni() ) {
+			uint8_t rk[176];
+			toRoundKeyBytes(rk,this->w);
+			encryptCbcAesni(out,in,n,rk);
+			memset(rk,0,176);
+			return;
 		}
+#endif
+
+		encryptCbcPortable(out,in,n,this->w);
 	}
 
 	/**
@@ -535,13 +1702,6 @@ namespace thimble {
 	 */
 	void AES128::decrypt( uint8_t *out , const uint8_t *in , int n ) {
 
-		int i;
-
-		// These arrays are used to temporarily make backups of encrypted
-		// blocks such that we can account for the cipher-block chaining mode
-		// even if 'out==in' is 'true'
-		uint8_t tmp1[16] , tmp2[16];
-
 		// Ensure data consists of 128 bit blocks.
 		if ( n % 16 != 0 ) {
 			cerr << "AES128::decrypt: "
@@ -553,42 +1713,92 @@ namespace thimble {
 			return;
 		}
 
-		// Make a copy of the first 128 bit bytes to account for the
-		// cipher-block chaining mode.
-		memcpy(tmp1,in,16);
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+		if ( MathTools::hasAesni() ) {
+			uint8_t dk[176];
+			toRoundKeyBytes(dk,this->dw);
+			decryptCbcAesni(out,in,n,dk);
+			memset(dk,0,176);
+			return;
+		}
+#endif
+
+		decryptCbcPortable(out,in,n,this->w,this->dw);
+	}
+
+	/*
+	 * see 'AES.h' for the documentation.
+	 */
+	void AES128::decryptBatch
+	( uint8_t *out , const AES128 *keys , int numKeys ,
+	  const uint8_t *in , int n ) {
+
+		if ( n % 16 != 0 ) {
+			cerr << "AES128::decryptBatch: "
+				 << "Message must consist of 128 bit blocks." << endl;
+            exit(EXIT_FAILURE);
+		}
+
+		if ( n <= 0 ) { // Nothing to do
+			return;
+		}
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+		if ( MathTools::hasAesni() ) {
+
+			uint8_t dk[8][176];
+
+			for ( int l0 = 0 ; l0 < numKeys ; l0 += 8 ) {
+
+				int num = numKeys-l0 < 8 ? numKeys-l0 : 8;
+
+				for ( int l = 0 ; l < num ; l++ ) {
+					toRoundKeyBytes(dk[l],keys[l0+l].dw);
+				}
+
+				decryptCbcAesniMultiKey(out+(size_t)l0*n,in,n,dk,num);
+			}
+
+			memset(dk,0,sizeof(dk));
+			return;
+		}
+#endif
+
+		// Decrypt the same block under four keys at once; the lanes of
+		// a final group of less than four keys are left empty
+		uint64_t kq[11][8];
+		uint8_t x[64];
+		const uint32_t *w[4];
+
+		for ( int l0 = 0 ; l0 < numKeys ; l0 += 4 ) {
 
-		// Decrypt the first block and ...
-		memcpy(this->state,in,16);
-		invCipher();
-		// ... store the decryption to the output.
-		memcpy(out,this->state,16);
+			int num = numKeys-l0 < 4 ? numKeys-l0 : 4;
 
-		// Iteration over the remaining blocks
-		for ( i = 16 ; i < n ; i += 16 ) {
+			for ( int l = 0 ; l < num ; l++ ) {
+				w[l] = keys[l0+l].w;
+			}
 
-			in  += 16;
-			out += 16;
+			roundKeyPlanes(kq,w,num);
 
-			// Make a copy of the current block to account for the
-			// cipher-block chaining mode; note that 'tmp1' still
-			// contains the encryption of the previous block.
-			memcpy(tmp2,in,16);
+			for ( int i = 0 ; i < n ; i += 16 ) {
 
-			// Decrypt the current block and ...
-			memcpy(this->state,in,16);
-			invCipher();
+				for ( int l = 0 ; l < num ; l++ ) {
+					memcpy(x+16*l,in+i,16);
+				}
 
-			// ... xor with the previous encrypted block to
-			// reverse the cipher-block chaining mode.
-			memcpy(out,tmp1,16);
-			mxor8(out,this->state);
+				decryptBlocksBitsliced(x,num,kq);
 
-			// Copy the encrypted block to 'tmp1' such that on
-			// next iteration, 'tmp1' contains the encryption of the
-			// previous block to account for the cipher-block chaining
-			// mode.
-			memcpy(tmp1,tmp2,16);
+				for ( int l = 0 ; l < num ; l++ ) {
+					uint8_t *o = out+(size_t)(l0+l)*n+i;
+					for ( int j = 0 ; j < 16 ; j++ ) {
+						o[j] = (uint8_t)(x[16*l+j]^(i > 0 ? in[i-16+j] : 0));
+					}
+				}
+			}
 		}
+
+		memset(kq,0,sizeof(kq));
+		memset(x,0,sizeof(x));
 	}
 
 	/**
@@ -649,21 +1859,28 @@ namespace thimble {
 	 */
 	void AES128::cipher() {
 
-		// The following is in accordance with the representation
-		// in Figure 5 on page 15 in the standard
-
-		addRoundKey(0);
-
-		for ( int round = 1 ; round < 10 ; round++ ) {
-			subBytes();
-			shiftRows();
-			mixColumns();
-			addRoundKey(round);
-		}
-
-		subBytes();
-		shiftRows();
-		addRoundKey(10);
+		// Equivalent to the following sequence as in Figure 5 on
+		// page 15 of the standard
+		//
+		//  addRoundKey(0);
+		//  for ( int round = 1 ; round < 10 ; round++ ) {
+		//   subBytes(); shiftRows(); mixColumns(); addRoundKey(round);
+		//  }
+		//  subBytes(); shiftRows(); addRoundKey(10);
+		//
+		// which is run in bitsliced representation (or with lookup
+		// tables if 'THIMBLE_AES_LOOKUP_TABLES' is defined).
+#ifdef THIMBLE_AES_LOOKUP_TABLES
+		encryptBlockTable(this->state,this->state,this->w);
+#else
+		const uint32_t *w = this->w;
+		uint64_t kq[11][8];
+
+		roundKeyPlanes(kq,&w,1);
+		encryptBlocksBitsliced(this->state,1,kq);
+
+		memset(kq,0,sizeof(kq));
+#endif
 	}
 
 	/**
@@ -692,21 +1909,30 @@ namespace thimble {
 	 */
 	void AES128::invCipher() {
 
-		// The following is in accordance with the presentation
-		// of Figure 12 on page 21 of the standard.
-
-		addRoundKey(10);
-
-		for ( int round = 9 ; round >= 1 ; round-- ) {
-			invShiftRows();
-			invSubBytes();
-			addRoundKey(round);
-			invMixColumns();
-		}
-
-		invShiftRows();
-		invSubBytes();
-		addRoundKey(0);
+		// Equivalent to the following sequence as in Figure 12 on
+		// page 21 of the standard
+		//
+		//  addRoundKey(10);
+		//  for ( int round = 9 ; round >= 1 ; round-- ) {
+		//   invShiftRows(); invSubBytes(); addRoundKey(round);
+		//   invMixColumns();
+		//  }
+		//  invShiftRows(); invSubBytes(); addRoundKey(0);
+		//
+		// which is run in bitsliced representation (or as the equivalent
+		// inverse cipher of Figure 15 on page 25 of the standard with
+		// lookup tables if 'THIMBLE_AES_LOOKUP_TABLES' is defined).
+#ifdef THIMBLE_AES_LOOKUP_TABLES
+		decryptBlockTable(this->state,this->state,this->dw);
+#else
+		const uint32_t *w = this->w;
+		uint64_t kq[11][8];
+
+		roundKeyPlanes(kq,&w,1);
+		decryptBlocksBitsliced(this->state,1,kq);
+
+		memset(kq,0,sizeof(kq));
+#endif
 	}
 
 	/**
@@ -740,6 +1966,13 @@ namespace thimble {
 	 */
 	void AES128::keyExpansion( const uint8_t key[16] ) {
 
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+		if ( MathTools::hasAesni() ) {
+			keyExpansionAesni(this->w,this->dw,key);
+			return;
+		}
+#endif
+
 		// Essentially, the following is in accordance with the presentation
 		// of Figure 11 on page 20 of the standard.
 
@@ -763,6 +1996,19 @@ namespace thimble {
 
 			this->w[i] = this->w[i-4] ^ temp;
 		}
+
+		// Key schedule of the equivalent inverse cipher as in Figure 15
+		// on page 25 of the standard: the round keys in reverse order
+		// where 'InvMixColumns()' is applied to the inner round keys.
+		for ( int c = 0 ; c < 4 ; c++ ) {
+			this->dw[c]    = this->w[40+c];
+			this->dw[40+c] = this->w[c];
+		}
+		for ( int round = 1 ; round < 10 ; round++ ) {
+			for ( int c = 0 ; c < 4 ; c++ ) {
+				this->dw[4*round+c] = InvMixColumnWord(this->w[4*(10-round)+c]);
+			}
+		}
 	}
 
 	/**
@@ -813,10 +2059,8 @@ namespace thimble {
 	 */
 	void AES128::subBytes() {
 
-		// Substitute all bytes of state using '_SBOX'
-		for ( int i = 0 ; i < 16 ; i++ ) {
-			this->state[i] = SubByte(this->state[i]);
-		}
+		// Substitute all bytes of state in constant time
+		subBytesBitsliced(this->state,16,false);
 	}
 
 	/**
@@ -874,29 +2118,9 @@ namespace thimble {
 	void AES128::mixColumns() {
 
 		// Perform the matrix multiplication as specified by Equation (5.6)
-		// on page 18 in the standard.
-
-		uint8_t s[4];
-
-		// Iterate over the columns and ...
-		for ( int c = 0 ; c < 4 ; c++ ) {
-
-			// ... multiply column-wise with the matrix by ...
-
-			// ... copying the column to a temporary array ...
-			memcpy(s,this->state+4*c,4);
-
-			// ... and updating the column by a matrix-vector
-			// multiplication.
-			this->state[4*c+0] =
-					(uint8_t)(_GF.mul(s[0],0x02)^_GF.mul(s[1],0x03)^s[2]^s[3]);
-			this->state[4*c+1] =
-					(uint8_t)(_GF.mul(s[1],0x02)^_GF.mul(s[2],0x03)^s[0]^s[3]);
-			this->state[4*c+2] =
-					(uint8_t)(_GF.mul(s[2],0x02)^_GF.mul(s[3],0x03)^s[0]^s[1]);
-			this->state[4*c+3] =
-					(uint8_t)(_GF.mul(s[3],0x02)^_GF.mul(s[0],0x03)^s[1]^s[2]);
-		}
+		// on page 18 in the standard for each column without
+		// branching on the bytes.
+		mixColumnsState(this->state,false);
 	}
 
 	/**
@@ -915,10 +2139,8 @@ namespace thimble {
 	 */
 	void AES128::invSubBytes() {
 
-		// Substitute all bytes of state using '_ISBOX'
-		for ( int i = 0 ; i < 16 ; i++ ) {
-			this->state[i] = InvSubByte(this->state[i]);
-		}
+		// Substitute all bytes of state in constant time
+		subBytesBitsliced(this->state,16,true);
 	}
 
 	/**
@@ -975,33 +2197,9 @@ namespace thimble {
 	void AES128::invMixColumns() {
 
 		// Perform the matrix multiplication as specified by Equation (5.10)
-		// on page 23 in the standard.
-
-		uint8_t s[4];
-
-		// Iterate over the columns and ...
-		for ( int c = 0 ; c < 4 ; c++ ) {
-
-			// ... multiply column-wise with the matrix by ...
-
-			// ... copying the column to a temporary array ...
-			memcpy(s,this->state+4*c,4);
-
-			// ... and updating the column by a matrix-vector
-			// multiplication.
-			this->state[4*c+0] =
-					(uint8_t)(_GF.mul(0x0e,s[0]) ^ _GF.mul(0x0b,s[1]) ^
-					_GF.mul(0x0d,s[2]) ^ _GF.mul(0x09,s[3]));
-			this->state[4*c+1] =
-					(uint8_t)(_GF.mul(0x09,s[0]) ^ _GF.mul(0x0e,s[1]) ^
-					_GF.mul(0x0b,s[2]) ^ _GF.mul(0x0d,s[3]));
-			this->state[4*c+2] =
-					(uint8_t)(_GF.mul(0x0d,s[0]) ^ _GF.mul(0x09,s[1]) ^
-					_GF.mul(0x0e,s[2]) ^ _GF.mul(0x0b,s[3]));
-			this->state[4*c+3] =
-					(uint8_t)(_GF.mul(0x0b,s[0]) ^ _GF.mul(0x0d,s[1]) ^
-					_GF.mul(0x09,s[2]) ^ _GF.mul(0x0e,s[3]));
-		}
+		// on page 23 in the standard for each column without
+		// branching on the bytes.
+		mixColumnsState(this->state,true);
 	}
 }
 
@@ -28,9 +28,13 @@
  * @author Benjamin Tams
  */
 
+#include <stdint.h>
+#include <cstring>
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 
+#include <thimble/math/MathTools.h>
 #include <thimble/math/linalg/BinaryVector.h>
 #include <thimble/math/linalg/BinaryMatrix.h>
 #include <thimble/math/linalg/LinAlgTools.h>
@@ -77,8 +81,15 @@ namespace thimble {
         // *******************************************************************
         // *** BEGIN: build the generator matrix *****************************
         // *******************************************************************
-        this->G.setDimension(n,k);
+
+        // The 'j'th column of the generator matrix is the codeword of
+        // the message 'X^j'; thus, the codewords are written as rows
+        // of the transpose of the generator matrix.
+        BinaryMatrix Gt(k,n);
         {
+            int N = n/32+(n%32?1:0);
+            uint32_t *rows = Gt.getData_nonconst();
+
             BinaryPolynomial m , c;
             for ( int j = k-1 ; j >= 0 ; j-- ) {
 
@@ -87,15 +98,15 @@ namespace thimble {
                 c.assign(m);
                 BCHCodeBase::encode(c);
 
-                for ( int i = 0 ; i < n ; i++ ) {
-                    if ( c.getCoeff(i) ) {
-                        this->G.setAt(i,j);
-                    }
+                if ( c.deg() >= 0 ) {
+                    memcpy(rows+j*N,c.getData(),
+                           (c.deg()/32+1)*sizeof(uint32_t));
                 }
 
                 m.clearCoeff(j);
             }
         }
+        BinaryMatrix::transpose(this->G,Gt);
         // *******************************************************************
         // *** END: generator matrix has been built **************************
         // *******************************************************************
@@ -108,11 +119,20 @@ namespace thimble {
         // Since the generator matrix is systematic, i.e., of the form
         // 'G=transpose(P|I)', the check matrix equals 'H=(I|P)'.
         this->H.setDimension(n-k,n);
-        for ( int i = 0 ; i < n-k ; i++ ) {
-            this->H.setAt(i,i);
-            for ( int j = 0 ; j < k ; j++ ) {
-                if (this->G.getAt(i,j) ) {
-                    this->H.setAt(i,j+n-k);
+        {
+            int N = k/32+(k%32?1:0);
+            const uint32_t *rows = this->G.getData();
+
+            for ( int i = 0 ; i < n-k ; i++ ) {
+
+                this->H.setAt(i,i);
+
+                // Visit the non-zero entries of the 'i'th row of 'G'
+                for ( int l = 0 ; l < N ; l++ ) {
+                    for ( uint32_t v = rows[i*N+l] ; v != 0 ; v &= v-1 ) {
+                        int j = 32*l+MathTools::trailingZeros(v);
+                        this->H.setAt(i,j+n-k);
+                    }
                 }
             }
         }
@@ -313,7 +333,27 @@ namespace thimble {
      */
     void BCHCode::encode( BinaryVector & c ) const {
 
-    	mul(c,this->G,c);
+    	int n , k;
+    	n = getBlockLength();
+    	k = getDimension();
+
+    	if ( c.getLength() != k ) {
+    		cerr << "BCHCode::encode: bad argument, invalid message length"
+    			 << endl;
+    		exit(EXIT_FAILURE);
+    	}
+
+    	// Message words
+    	vector<uint32_t> m(k/32+1,0);
+    	c.getData32(&(m[0]));
+
+    	// Same as multiplying by the generator matrix but the check bits
+    	// are obtained from the table-driven shift register
+    	vector<uint32_t> cw(n/32+1,0);
+    	BCHCodeBase::encode(&(cw[0]),&(m[0]));
+
+    	c.setLength(n);
+    	c.setData32(&(cw[0]),(int)cw.size());
     }
 
     /**
@@ -374,6 +414,151 @@ namespace thimble {
     	return true;
     }
 
+    /**
+     * @brief
+     *            Rounds many vectors to their nearest codewords at
+     *            once.
+     *
+     * @details
+     *            The implementation of this function is wrapped around
+     *            the \link BCHCodeBase::roundBatch()\endlink function
+     *            which processes the vectors in bit-sliced groups of
+     *            64.
+     *
+     * @param c
+     *            Array of <i>num</i> vectors each of length
+     *            <i>n=</i>\link getBlockLength()\endlink. On output,
+     *            the vectors that could be rounded are replaced by
+     *            their nearest codeword; the others are left
+     *            unchanged.
+     *
+     * @param success
+     *            Array that can hold at least <i>num</i> flags; on
+     *            output, <code>success[l]</code> indicates whether
+     *            <code>c[l]</code> was successfully rounded.
+     *
+     * @param num
+     *            The number of vectors in <i>c</i>.
+     *
+     * @return
+     *            The number of vectors that were successfully
+     *            rounded.
+     *
+     * @warning
+     *            If any of the vectors is of length different from
+     *            <i>n=</i>\link getBlockLength()\endlink, an error
+     *            message is printed to <code>stderr</code> and the
+     *            program exits with status 'EXIT_FAILURE'.
+     *
+     * @warning
+     *            If not enough memory could be provided, an error
+     *            message is printed to <code>stderr</code> and the
+     *            program exits with status 'EXIT_FAILURE'.
+     *
+     * @see BCHCode::round()
+     * @see BCHCodeBase::roundBatch()
+     */
+    int BCHCode::roundBatch( BinaryVector *c , bool *success , int num ) const {
+
+    	int n = getBlockLength();
+
+    	vector<BinaryPolynomial> cX(num);
+    	for ( int l = 0 ; l < num ; l++ ) {
+    		if ( c[l].getLength() != n ) {
+    			cerr << "BCHCode::roundBatch: "
+    				 << "vector does not match block length." << endl;
+    			exit(EXIT_FAILURE);
+    		}
+    		conv(cX[l],c[l]);
+    	}
+
+    	if ( num <= 0 ) {
+    		return 0;
+    	}
+
+    	int numSuccess = BCHCodeBase::roundBatch(&(cX[0]),success,num);
+
+    	for ( int l = 0 ; l < num ; l++ ) {
+    		if ( success[l] ) {
+    			conv(c[l],cX[l]);
+    		}
+    	}
+
+    	return numSuccess;
+    }
+
+    /**
+     * @brief
+     *            Decodes many vectors at once.
+     *
+     * @details
+     *            Does the same as calling \link decode()\endlink for
+     *            each of the <i>num</i> vectors in <i>m</i> but
+     *            rounds them via \link roundBatch()\endlink.
+     *
+     * @param m
+     *            Array of <i>num</i> vectors each of length
+     *            <i>n=</i>\link getBlockLength()\endlink. On output,
+     *            each successfully decoded vector contains its
+     *            message in the first
+     *            <i>k=</i>\link getDimension()\endlink entries; the
+     *            other vectors are left unchanged.
+     *
+     * @param success
+     *            Array that can hold at least <i>num</i> flags; on
+     *            output, <code>success[l]</code> indicates whether
+     *            <code>m[l]</code> was successfully decoded.
+     *
+     * @param num
+     *            The number of vectors in <i>m</i>.
+     *
+     * @return
+     *            The number of vectors that were successfully
+     *            decoded.
+     *
+     * @warning
+     *            If any of the vectors is of length different from
+     *            <i>n=</i>\link getBlockLength()\endlink, an error
+     *            message is printed to <code>stderr</code> and the
+     *            program exits with status 'EXIT_FAILURE'.
+     *
+     * @warning
+     *            If not enough memory could be provided, an error
+     *            message is printed to <code>stderr</code> and the
+     *            program exits with status 'EXIT_FAILURE'.
+     *
+     * @see BCHCode::decode()
+     * @see BCHCodeBase::decodeBatch()
+     */
+    int BCHCode::decodeBatch( BinaryVector *m , bool *success , int num ) const {
+
+    	int n = getBlockLength();
+
+    	vector<BinaryPolynomial> tmp(num);
+    	for ( int l = 0 ; l < num ; l++ ) {
+    		if ( m[l].getLength() != n ) {
+    			cerr << "BCHCode::decodeBatch: bad argument, "
+    				 << "invalid block length" << endl;
+    			exit(EXIT_FAILURE);
+    		}
+    		conv(tmp[l],m[l]);
+    	}
+
+    	if ( num <= 0 ) {
+    		return 0;
+    	}
+
+    	int numSuccess = BCHCodeBase::decodeBatch(&(tmp[0]),success,num);
+
+    	for ( int l = 0 ; l < num ; l++ ) {
+    		if ( success[l] ) {
+    			conv(m[l],tmp[l]);
+    		}
+    	}
+
+    	return numSuccess;
+    }
+
     /**
      * @brief
      *            Creates a random code word.
@@ -31,8 +31,13 @@
 #include <cstdlib>
 #include <vector>
 #include <iostream>
+#include <algorithm>
 
+#include <thimble/math/MathTools.h>
 #include <thimble/math/numbertheory/BinaryPolynomial.h>
+#include <thimble/math/numbertheory/BinaryPolynomialModulus.h>
+#include <thimble/math/numbertheory/SmallBinaryPolynomial.h>
+#include <thimble/math/numbertheory/SmallBinaryField.h>
 #include <thimble/ecc/BCHCodeBase.h>
 
 using namespace std;
@@ -42,6 +47,208 @@ using namespace std;
  */
 namespace thimble {
 
+    /**
+     * @brief
+     *            Maximal degree of the modulus <i>f</i> for which
+     *            error-correction is performed with the tables of a
+     *            \link SmallBinaryField\endlink.
+     */
+    static const int _MAX_SMALL_FIELD_DEGREE = 16;
+
+    /**
+     * @brief
+     *            Maximal number of 64-bit words that are spent for the
+     *            bit-sliced Chien search tables.
+     */
+    static const size_t _MAX_CHIEN_MASKS = ((size_t)1)<<20;
+
+    /**
+     * @brief
+     *            Computes the <i>e</i>th power of an element in a small
+     *            binary finite field via square-and-multiply.
+     *
+     * @param gf
+     *            The finite field.
+     *
+     * @param a
+     *            The base.
+     *
+     * @param e
+     *            The non-negative exponent.
+     *
+     * @return
+     *            The power \f$a^e\f$.
+     */
+    static uint32_t _pow( const SmallBinaryField & gf , uint32_t a , int e ) {
+
+        uint32_t b = 1;
+
+        for ( ; e > 0 ; e >>= 1 ) {
+            if ( e & 1 ) {
+                b = gf.mul(b,a);
+            }
+            a = gf.mul(a,a);
+        }
+
+        return b;
+    }
+
+    /**
+     * @brief
+     *            Multiplies two elements given in bit-sliced
+     *            representation.
+     *
+     * @details
+     *            An element of a binary field of degree <i>m</i> is
+     *            given by <i>m</i> 64-bit integers of which the
+     *            <i>b</i>th integer holds the <i>b</i>th coefficients
+     *            of 64 independent field elements.
+     *
+     * @param c
+     *            On output, the 64 products
+     *            (may be the same as <i>a</i> or <i>b</i>).
+     *
+     * @param a
+     *            First factor.
+     *
+     * @param b
+     *            Second factor.
+     *
+     * @param m
+     *            Degree of the field.
+     *
+     * @param taps
+     *            The lower <i>m</i> coefficients of the defining
+     *            polynomial of the field, i.e., the representation of
+     *            \f$X^m\f$ modulo the defining polynomial.
+     */
+    static void _bsmul
+    ( uint64_t *c , const uint64_t *a , const uint64_t *b ,
+      int m , uint32_t taps ) {
+
+        uint64_t p[2*_MAX_SMALL_FIELD_DEGREE];
+
+        for ( int k = 0 ; k < m+m-1 ; k++ ) {
+            p[k] = 0;
+        }
+
+        // Schoolbook multiplication of the coefficient vectors
+        for ( int i = 0 ; i < m ; i++ ) {
+            if ( a[i] != 0 ) {
+                for ( int j = 0 ; j < m ; j++ ) {
+                    p[i+j] ^= a[i] & b[j];
+                }
+            }
+        }
+
+        // Reduction using 'X^k=X^(k-m)*taps'
+        for ( int k = m+m-2 ; k >= m ; k-- ) {
+            if ( p[k] != 0 ) {
+                for ( int l = 0 ; l < m ; l++ ) {
+                    if ( (taps>>l) & 1 ) {
+                        p[k-m+l] ^= p[k];
+                    }
+                }
+            }
+        }
+
+        for ( int k = 0 ; k < m ; k++ ) {
+            c[k] = p[k];
+        }
+    }
+
+    /**
+     * @brief
+     *            Multiplies elements given in bit-sliced representation
+     *            by a constant.
+     *
+     * @param c
+     *            On output, the 64 products (may be the same as
+     *            <i>a</i>).
+     *
+     * @param a
+     *            The elements in bit-sliced representation.
+     *
+     * @param cols
+     *            Array of <i>m</i> field elements where
+     *            <code>cols[i]</code> is the product of
+     *            \f$X^i\f$ with the constant.
+     *
+     * @param m
+     *            Degree of the field.
+     */
+    static void _bsmulConst
+    ( uint64_t *c , const uint64_t *a , const uint32_t *cols , int m ) {
+
+        uint64_t p[_MAX_SMALL_FIELD_DEGREE];
+
+        for ( int b = 0 ; b < m ; b++ ) {
+            p[b] = 0;
+        }
+
+        for ( int i = 0 ; i < m ; i++ ) {
+            if ( a[i] != 0 ) {
+                for ( int b = 0 ; b < m ; b++ ) {
+                    if ( (cols[i]>>b) & 1 ) {
+                        p[b] ^= a[i];
+                    }
+                }
+            }
+        }
+
+        for ( int b = 0 ; b < m ; b++ ) {
+            c[b] = p[b];
+        }
+    }
+
+    /**
+     * @brief
+     *            Multiplies elements given in bit-sliced representation
+     *            by a constant whose multiplication matrix is given as
+     *            masks.
+     *
+     * @details
+     *            Does the same as \link _bsmulConst()\endlink but
+     *            without branching on the bits of the constant, which
+     *            is faster if the same constant is used many times.
+     *
+     * @param c
+     *            On output, the 64 products (may be the same as
+     *            <i>a</i>).
+     *
+     * @param a
+     *            The elements in bit-sliced representation.
+     *
+     * @param M
+     *            Array of <i>m*m</i> masks where <code>M[i*m+b]</code>
+     *            is all-ones if the <i>b</i>th coefficient of the
+     *            product of \f$X^i\f$ with the constant is set and
+     *            zero otherwise.
+     *
+     * @param m
+     *            Degree of the field.
+     */
+    static void _bsmulMasks
+    ( uint64_t *c , const uint64_t *a , const uint64_t *M , int m ) {
+
+        uint64_t p[_MAX_SMALL_FIELD_DEGREE];
+
+        for ( int b = 0 ; b < m ; b++ ) {
+            p[b] = 0;
+        }
+
+        for ( int i = 0 ; i < m ; i++ ) {
+            uint64_t x = a[i];
+            for ( int b = 0 ; b < m ; b++ ) {
+                p[b] ^= x & M[i*m+b];
+            }
+        }
+
+        for ( int b = 0 ; b < m ; b++ ) {
+            c[b] = p[b];
+        }
+    }
+
     /**
      * @brief
      *            Creates a binary BCH code of given length that can
@@ -138,17 +345,17 @@ namespace thimble {
         // *****************************************************
 
         this->g.setOne();
+        BinaryPolynomialModulus F(this->f);
         BinaryPolynomial beta , beta_power , gj , tmp;
         beta.setX();
         beta_power.setOne();
         this->powers_of_X_mod_f.push_back(beta_power);
         for ( int j = 1 ; ; j++ ) {
 
-            mul(beta_power,beta_power,beta);
-            rem(beta_power,beta_power,this->f);
+            F.mulMod(beta_power,beta_power,beta);
             this->powers_of_X_mod_f.push_back(beta_power);
 
-            minPolyMod(gj,beta_power,this->f);
+            F.minPoly(gj,beta_power);
 
             gcd(tmp,this->g,gj);
 
@@ -174,6 +381,12 @@ namespace thimble {
         this->n = n;
         // ... and the dimension.
         this->k = n-this->g.deg();
+
+        // Prepare the tables for fast error-correction if possible ...
+        initSmallField();
+
+        // ... and for encoding
+        initEncoder();
     }
 
     /**
@@ -197,6 +410,11 @@ namespace thimble {
         this->g                 = code.g;
         this->f                 = code.f;
         this->powers_of_X_mod_f = code.powers_of_X_mod_f;
+        this->hasSmallField     = code.hasSmallField;
+        this->gf                = code.gf;
+        this->syndromeTables    = code.syndromeTables;
+        this->chienMasks        = code.chienMasks;
+        this->lfsrTable         = code.lfsrTable;
     }
 
     /**
@@ -213,6 +431,219 @@ namespace thimble {
         // to emphasize that the memory is in fact freed.
     }
 
+    /**
+     * @brief
+     *             Initializes <i>\link hasSmallField\endlink</i>,
+     *             <i>\link gf\endlink</i>,
+     *             <i>\link syndromeTables\endlink</i> and
+     *             <i>\link chienMasks\endlink</i> after the members
+     *             <i>\link n\endlink</i>, <i>\link d\endlink</i> and
+     *             <i>\link f\endlink</i> have been computed.
+     *
+     * @warning
+     *             If not enough memory could be provided, an error
+     *             message is printed to <code>stderr</code> and the
+     *             program exits with status 'EXIT_FAILURE'.
+     */
+    void BCHCodeBase::initSmallField() {
+
+        int m = this->f.deg();
+
+        this->syndromeTables.clear();
+        this->chienMasks.clear();
+
+        this->hasSmallField = m <= _MAX_SMALL_FIELD_DEGREE;
+        if ( !this->hasSmallField ) {
+            return;
+        }
+
+        this->gf.initialize(SmallBinaryPolynomial(this->f.getData()[0]));
+
+        // Representation of 'beta = X mod f' in the field
+        uint32_t beta = this->powers_of_X_mod_f[1].getData()[0];
+
+        int nu = getErrorTolerance();
+
+        // ****************************************************************
+        // * BEGIN: Tables for the odd syndromes. Each table maps a byte  *
+        // * of the received word to its evaluation at 'beta^(2l+1)'.     *
+        // ****************************************************************
+
+        this->syndromeTables.assign(257*(size_t)nu,0);
+        for ( int l = 0 ; l < nu ; l++ ) {
+
+            uint32_t *T = &(this->syndromeTables[257*(size_t)l]);
+            uint32_t b = _pow(this->gf,beta,2*l+1);
+
+            // 'bi' runs over 'b^i' where 'i=0,...,7'
+            uint32_t bi = 1;
+            for ( int i = 0 ; i < 8 ; i++ ) {
+                for ( int v = 0 ; v < (1<<i) ; v++ ) {
+                    T[v+(1<<i)] = T[v] ^ bi;
+                }
+                bi = this->gf.mul(bi,b);
+            }
+
+            // Multiplier to shift the evaluation by one byte
+            T[256] = bi;
+        }
+
+        // ****************************************************************
+        // * END: Tables for the odd syndromes                            *
+        // ****************************************************************
+
+        if ( (size_t)nu * (size_t)(m*m) > _MAX_CHIEN_MASKS ) {
+            return;
+        }
+
+        // ****************************************************************
+        // * BEGIN: Bit-sliced tables for the Chien search; the 's'th bit *
+        // * of the 'b'th word of a row contains the 'b'th coefficient of *
+        // * 'X^a*beta^(j*s)'.                                            *
+        // ****************************************************************
+
+        this->chienMasks.assign((size_t)nu*(size_t)(m*m),0);
+        for ( int j = 1 ; j <= nu ; j++ ) {
+
+            uint32_t bj = _pow(this->gf,beta,j);
+
+            for ( int a = 0 ; a < m ; a++ ) {
+
+                uint64_t *M = &(this->chienMasks[((size_t)(j-1)*m+a)*m]);
+                uint32_t v = ((uint32_t)1) << a;
+
+                for ( int s = 0 ; s < 64 ; s++ ) {
+                    for ( int b = 0 ; b < m ; b++ ) {
+                        if ( (v>>b) & 1 ) {
+                            M[b] |= ((uint64_t)1) << s;
+                        }
+                    }
+                    v = this->gf.mul(v,bj);
+                }
+            }
+        }
+
+        // ****************************************************************
+        // * END: Chien search tables                                     *
+        // ****************************************************************
+    }
+
+    /**
+     * @brief
+     *             Initializes <i>\link lfsrTable\endlink</i> after
+     *             the generator polynomial <i>\link g\endlink</i> has
+     *             been computed.
+     *
+     * @warning
+     *             If not enough memory could be provided, an error
+     *             message is printed to <code>stderr</code> and the
+     *             program exits with status 'EXIT_FAILURE'.
+     */
+    void BCHCodeBase::initEncoder() {
+
+        int r = this->g.deg();
+        int W = (r+31)/32;
+
+        this->lfsrTable.clear();
+
+        if ( r < 8 ) {
+            return;
+        }
+
+        this->lfsrTable.assign(256*(size_t)W,0);
+
+        // The entries for 'v=2^i' are 'X^(r+i) rem g'; the others follow
+        // by linearity.
+        BinaryPolynomial h , q , rem;
+        for ( int i = 0 ; i < 8 ; i++ ) {
+
+            h.setZero();
+            h.setCoeff(r+i);
+            divRem(q,rem,h,this->g);
+
+            uint32_t *T = &(this->lfsrTable[(size_t)W<<i]);
+            const uint32_t *data = rem.getData();
+            int numWords = rem.deg() < 0 ? 0 : rem.deg()/32+1;
+            for ( int w = 0 ; w < numWords ; w++ ) {
+                T[w] = data[w];
+            }
+
+            for ( int v = 1 ; v < (1<<i) ; v++ ) {
+                const uint32_t *U = &(this->lfsrTable[(size_t)W*v]);
+                uint32_t *V = &(this->lfsrTable[(size_t)W*(v+(1<<i))]);
+                for ( int w = 0 ; w < W ; w++ ) {
+                    V[w] = T[w] ^ U[w];
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief
+     *             Computes the partial syndromes of a received word
+     *             by table look-ups in
+     *             <i>\link syndromeTables\endlink</i>.
+     *
+     * @details
+     *             The function requires that
+     *             <i>\link hasSmallField\endlink</i> is
+     *             <code>true</code>. The odd syndromes are
+     *             evaluated by Horner's method processing 8 bits of
+     *             <i>c</i> per step; the even syndromes are obtained
+     *             via \f$S_{2j}=S_j^2\f$.
+     *
+     * @param S
+     *             On output, contains the syndromes
+     *             \f$S_{j+1}=c(\beta^{j+1})\f$ at the index
+     *             \f$j=0,...,2\nu-1\f$ where
+     *             \f$\nu=\f$\link getErrorTolerance()\endlink.
+     *             Must be able to hold at least \f$2\nu\f$
+     *             elements.
+     *
+     * @param c
+     *             The received word; a polynomial of degree smaller
+     *             than <i>\link n\endlink</i>.
+     *
+     * @return
+     *             <code>true</code> if all syndromes are zero, i.e.,
+     *             if <i>c</i> is a codeword; otherwise
+     *             <code>false</code>.
+     */
+    bool BCHCodeBase::syndromes
+    ( uint32_t *S , const BinaryPolynomial & c ) const {
+
+        int nu = getErrorTolerance();
+        int numBytes = c.deg() < 0 ? 0 : c.deg()/8+1;
+        const uint32_t *data = c.getData();
+
+        bool isCodeword = true;
+
+        // Odd syndromes via Horner's method with one byte per step
+        for ( int l = 0 ; l < nu ; l++ ) {
+
+            const uint32_t *T = &(this->syndromeTables[257*(size_t)l]);
+            uint32_t shift = T[256];
+            uint32_t s = 0;
+
+            for ( int i = numBytes-1 ; i >= 0 ; i-- ) {
+                uint32_t v = (data[i>>2] >> ((i&3)<<3)) & 0xFF;
+                s = this->gf.mul(s,shift) ^ T[v];
+            }
+
+            S[l+l] = s;
+            if ( s != 0 ) {
+                isCodeword = false;
+            }
+        }
+
+        // Since the code is binary, 'S_{2j}=c(beta^{2j})=c(beta^j)^2'
+        for ( int j = 2 ; j <= nu+nu ; j += 2 ) {
+            S[j-1] = this->gf.mul(S[j/2-1],S[j/2-1]);
+        }
+
+        return isCodeword;
+    }
+
     /**
      * @brief
      *            Assignment operator.
@@ -244,6 +675,11 @@ namespace thimble {
         this->g                 = code.g;
         this->f                 = code.f;
         this->powers_of_X_mod_f = code.powers_of_X_mod_f;
+        this->hasSmallField     = code.hasSmallField;
+        this->gf                = code.gf;
+        this->syndromeTables    = code.syndromeTables;
+        this->chienMasks        = code.chienMasks;
+        this->lfsrTable         = code.lfsrTable;
 
         return *this;
     }
@@ -283,49 +719,558 @@ namespace thimble {
      */
     bool BCHCodeBase::round( BinaryPolynomial & c ) const {
 
-        if ( c.deg() >= this->n ) {
-            cerr << "BCHCode::round: "
-                 << "length of input polynomial too large."
-                 << endl;
-            exit(EXIT_FAILURE);
+        if ( c.deg() >= this->n ) {
+            cerr << "BCHCode::round: "
+                 << "length of input polynomial too large."
+                 << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        if ( this->hasSmallField ) {
+
+            int nu = getErrorTolerance();
+
+            // Partial syndromes via table look-ups; if all are zero,
+            // 'c' is already a codeword
+            vector<uint32_t> S(nu+nu);
+            if ( nu == 0 || syndromes(&(S[0]),c) ) {
+                return true;
+            }
+
+            // Find the error-locator polynomial
+            vector<uint32_t> Lambda =
+                    BCHCodeBase::berlekampMassey(S,this->gf);
+
+            // More than 'nu' errors can not be corrected reliably
+            if ( (int)Lambda.size() > nu+1 ) {
+                return false;
+            }
+
+            // Find the error-locations which are given by the zeros of
+            // Lambda
+            vector<int> locs = chienSearch(Lambda);
+            if ( locs.size() + 1 != Lambda.size() ) {
+                return false;
+            }
+
+            for ( int i = 0 ; i < (int)locs.size() ; i++ ) {
+                int j = locs.at(i);
+                c.setCoeff(j,!c.getCoeff(j));
+            }
+
+            return true;
+        }
+
+        BinaryPolynomial r(this->n) , tmp(this->n);
+        divRem(tmp,r,c,this->g);
+
+        if ( r.isZero() ) {
+            // 'c' is already a codeword; nothing to do
+            return true;
+        }
+
+        int nu = getErrorTolerance();
+
+        // Compute partial syndromes.
+        // TODO: syndrome computation is currently the bottleneck in the
+        // implementation
+        vector<BinaryPolynomial> S(nu+nu);
+        for ( int j = 0 ; j < nu+nu ; j++ ) {
+            evalMod(S[j],r,this->powers_of_X_mod_f[j+1],this->f);
+        }
+
+        // Find the error-locator polynomial
+        vector<BinaryPolynomial> Lambda = BCHCodeBase::berlekampMassey(S,this->f);
+
+        // Find the error-locations which are given by the zeros of Lambda
+        vector<int> locs = chienSearch(Lambda);
+        if ( locs.size() + 1 != Lambda.size() ) {
+            return false;
+        }
+
+        // Flip the bits at the error location; as the code is binary, this
+        // causes
+        for ( int i = 0 ; i < (int)locs.size() ; i++ ) {
+            int j = locs.at(i);
+            c.setCoeff(j,!c.getCoeff(j));
+        }
+
+        // Decoding successul
+        return true;
+    }
+
+    /**
+     * @brief
+     *            Attempts to round many input bit sequences to their
+     *            nearest codewords.
+     *
+     * @details
+     *            Does the same as calling \link round()\endlink for
+     *            each of the <i>num</i> polynomials in <i>c</i>.
+     *            If the field defined by \link getModulus()\endlink
+     *            is small, the words are processed in groups of 64
+     *            which are transposed into bit-sliced form such that
+     *            syndrome computation, the Berlekamp-Massey
+     *            algorithm and the Chien search are run in
+     *            lockstep on 64-bit words. This is considerably
+     *            faster than rounding the words one after the other,
+     *            e.g., when decoding the same code against all
+     *            entries of a gallery.
+     *
+     * @param c
+     *            Array of <i>num</i> polynomials each of degree
+     *            smaller than \link getBlockLength()\endlink. On
+     *            output, the polynomials that could be rounded are
+     *            replaced by their nearest codeword; the others are
+     *            left unchanged.
+     *
+     * @param success
+     *            Array that can hold at least <i>num</i> flags; on
+     *            output, <code>success[l]</code> is
+     *            <code>true</code> if <code>c[l]</code> was
+     *            successfully rounded and <code>false</code>
+     *            otherwise.
+     *
+     * @param num
+     *            The number of polynomials in <i>c</i>.
+     *
+     * @param numErrors
+     *            If not <code>NULL</code>, an array that can hold
+     *            at least <i>num</i> integers; on output,
+     *            <code>numErrors[l]</code> contains the number of
+     *            bits that have been corrected in <code>c[l]</code>
+     *            (or -1 if rounding failed).
+     *
+     * @return
+     *            The number of polynomials that were successfully
+     *            rounded.
+     *
+     * @warning
+     *            If any of the <i>c[l]</i> is of degree larger than
+     *            or equals \link getBlockLength()\endlink an error
+     *            message is printed to <code>stderr</code> and the
+     *            program exits with status 'EXIT_FAILURE'.
+     *
+     * @warning
+     *            If not enough memory could be provided, an error
+     *            message is printed to <code>stderr</code> and the
+     *            program exits with status 'EXIT_FAILURE'.
+     */
+    int BCHCodeBase::roundBatch
+    ( BinaryPolynomial *c , bool *success , int num ,
+      int *numErrors ) const {
+
+        for ( int l = 0 ; l < num ; l++ ) {
+            if ( c[l].deg() >= this->n ) {
+                cerr << "BCHCode::roundBatch: "
+                     << "length of input polynomial too large."
+                     << endl;
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        int numSuccess = 0;
+
+        if ( !this->hasSmallField ) {
+
+            // Round the words one after the other
+            for ( int l = 0 ; l < num ; l++ ) {
+                BinaryPolynomial tmp(c[l]);
+                success[l] = round(c[l]);
+                if ( success[l] ) {
+                    numSuccess++;
+                }
+                if ( numErrors != NULL ) {
+                    numErrors[l] = success[l] ?
+                            hammingDistance(tmp,c[l]) : -1;
+                }
+            }
+
+            return numSuccess;
+        }
+
+        // Process groups of 64 words in bit-sliced form
+        for ( int l = 0 ; l < num ; l += 64 ) {
+            numSuccess += roundBatch64
+                    (c+l,success+l,num-l<64?num-l:64,
+                     numErrors!=NULL?numErrors+l:NULL);
+        }
+
+        return numSuccess;
+    }
+
+    /**
+     * @brief
+     *             Rounds up to 64 received words simultaneously by
+     *             processing them in bit-sliced form.
+     *
+     * @details
+     *             The function requires that
+     *             <i>\link hasSmallField\endlink</i> is
+     *             <code>true</code>. The <i>l</i>th received word is
+     *             assigned to the <i>l</i>th bit of 64-bit integers;
+     *             an element of the field <i>\link gf\endlink</i>
+     *             for all words is then represented by
+     *             <i>m</i>=\link getModulus()\endlink.deg() integers
+     *             of which the <i>b</i>th holds the <i>b</i>th
+     *             coefficients. Syndromes, an inversionless variant
+     *             of the Berlekamp-Massey algorithm and the Chien
+     *             search are then run in lockstep for all words.
+     *
+     * @param c
+     *             Array of <i>num</i> received words; on output,
+     *             successfully rounded words are replaced by their
+     *             nearest codeword.
+     *
+     * @param success
+     *             On output, <code>success[l]</code> indicates
+     *             whether <code>c[l]</code> was successfully
+     *             rounded.
+     *
+     * @param num
+     *             Number of words; must be between 1 and 64.
+     *
+     * @param numErrors
+     *             If not <code>NULL</code>, on output
+     *             <code>numErrors[l]</code> contains the number of
+     *             bits that have been corrected in
+     *             <code>c[l]</code>.
+     *
+     * @return
+     *             The number of words that were successfully
+     *             rounded.
+     *
+     * @warning
+     *             If not enough memory could be provided, an error
+     *             message is printed to <code>stderr</code> and the
+     *             program exits with status 'EXIT_FAILURE'.
+     */
+    int BCHCodeBase::roundBatch64
+    ( BinaryPolynomial *c , bool *success , int num ,
+      int *numErrors ) const {
+
+        int n = this->n;
+        int m = this->gf.getDegree();
+        int nu = getErrorTolerance();
+        uint32_t beta = this->powers_of_X_mod_f[1].getData()[0];
+        uint32_t taps = this->f.getData()[0] ^ (((uint32_t)1) << m);
+
+        // Lanes that correspond to an input word
+        uint64_t lanes = num >= 64 ? ~((uint64_t)0) :
+                (((uint64_t)1) << num) - 1;
+
+        for ( int l = 0 ; l < num ; l++ ) {
+            success[l] = false;
+            if ( numErrors != NULL ) {
+                numErrors[l] = -1;
+            }
+        }
+
+        // ****************************************************************
+        // * BEGIN: Transpose the received words such that 'R[i]' holds   *
+        // * the 'i'th coefficient of all words.                          *
+        // ****************************************************************
+
+        int numBlocks = (n+63)/64;
+        vector<uint64_t> R(64*(size_t)numBlocks);
+        for ( int q = 0 ; q < numBlocks ; q++ ) {
+
+            uint64_t *A = &(R[64*(size_t)q]);
+
+            for ( int l = 0 ; l < 64 ; l++ ) {
+
+                A[l] = 0;
+                if ( l >= num ) {
+                    continue;
+                }
+
+                const uint32_t *data = c[l].getData();
+                int numWords = c[l].deg() < 0 ? 0 : c[l].deg()/32+1;
+
+                if ( q+q < numWords ) {
+                    A[l] = data[q+q];
+                }
+                if ( q+q+1 < numWords ) {
+                    A[l] |= ((uint64_t)data[q+q+1]) << 32;
+                }
+            }
+
+            MathTools::transpose64(A);
+        }
+
+        // ****************************************************************
+        // * END: Transposition                                           *
+        // ****************************************************************
+
+        // Powers 'beta^i' for 'i=0,...,n-1'
+        vector<uint32_t> pw(n);
+        pw[0] = 1;
+        for ( int i = 1 ; i < n ; i++ ) {
+            pw[i] = this->gf.mul(pw[i-1],beta);
+        }
+
+        // ****************************************************************
+        // * BEGIN: Bit-sliced syndromes; the coefficients of 'S_j' are   *
+        // * stored at 'S[(j-1)*m+b]' where 'b=0,...,m-1'.                *
+        // ****************************************************************
+
+        vector<uint64_t> S(2*(size_t)nu*m,0);
+        {
+            // 'e[l]' runs over the exponents 'i*(2l+1) mod n'
+            vector<int> e(nu,0);
+
+            for ( int i = 0 ; i < n ; i++ ) {
+
+                uint64_t r = R[i];
+
+                for ( int l = 0 ; l < nu ; l++ ) {
+
+                    if ( r != 0 ) {
+                        uint32_t v = pw[e[l]];
+                        uint64_t *Sj = &(S[(size_t)(l+l)*m]);
+                        for ( int b = 0 ; b < m ; b++ ) {
+                            Sj[b] ^= r & (0-(uint64_t)((v>>b)&1));
+                        }
+                    }
+
+                    e[l] += l+l+1;
+                    if ( e[l] >= n ) {
+                        e[l] -= n;
+                    }
+                }
+            }
+
+            // Even syndromes by squaring
+            vector<uint32_t> sq(m);
+            for ( int a = 0 ; a < m ; a++ ) {
+                sq[a] = this->gf.mul(((uint32_t)1)<<a,((uint32_t)1)<<a);
+            }
+            for ( int j = 2 ; j <= nu+nu ; j += 2 ) {
+                _bsmulConst
+                (&(S[(size_t)(j-1)*m]),&(S[(size_t)(j/2-1)*m]),&(sq[0]),m);
+            }
+        }
+
+        // Lanes of words that are not codewords
+        uint64_t active = 0;
+        for ( size_t i = 0 ; i < S.size() ; i++ ) {
+            active |= S[i];
+        }
+        active &= lanes;
+
+        int numSuccess = 0;
+        for ( int l = 0 ; l < num ; l++ ) {
+            if ( ((active>>l)&1) == 0 ) {
+                success[l] = true;
+                if ( numErrors != NULL ) {
+                    numErrors[l] = 0;
+                }
+                numSuccess++;
+            }
+        }
+
+        if ( active == 0 ) {
+            return numSuccess;
+        }
+
+        // ****************************************************************
+        // * END: Syndromes                                               *
+        // ****************************************************************
+
+        // ****************************************************************
+        // * BEGIN: Inversionless Berlekamp-Massey algorithm where the    *
+        // * steps with vanishing discrepancy (which are the steps of odd *
+        // * index as the code is binary) are skipped.                    *
+        // ****************************************************************
+
+        int cap = nu+nu+2;
+        vector<uint64_t> Lambda(cap*(size_t)m,0) , B(cap*(size_t)m,0);
+        vector<uint64_t> nLambda(cap*(size_t)m) , nB(cap*(size_t)m);
+        uint64_t gamma[_MAX_SMALL_FIELD_DEGREE] ,
+                 Delta[_MAX_SMALL_FIELD_DEGREE] ,
+                 tmp[_MAX_SMALL_FIELD_DEGREE];
+        int L[64];
+        int maxL = 0;
+
+        for ( int b = 0 ; b < m ; b++ ) {
+            gamma[b] = 0;
+        }
+        gamma[0] = ~((uint64_t)0);
+        Lambda[0] = ~((uint64_t)0);
+        B[0] = ~((uint64_t)0);
+        for ( int l = 0 ; l < 64 ; l++ ) {
+            L[l] = 0;
+        }
+
+        for ( int r = 1 ; r < nu+nu ; r += 2 ) {
+
+            // Delta = S_r+Lambda_1S_{r-1}+...+Lambda_LS_{r-L}
+            for ( int b = 0 ; b < m ; b++ ) {
+                Delta[b] = 0;
+            }
+            for ( int j = 0 ; j <= maxL && j < r ; j++ ) {
+                _bsmul(tmp,&(Lambda[(size_t)j*m]),
+                       &(S[(size_t)(r-j-1)*m]),m,taps);
+                for ( int b = 0 ; b < m ; b++ ) {
+                    Delta[b] ^= tmp[b];
+                }
+            }
+
+            uint64_t nonzero = 0;
+            for ( int b = 0 ; b < m ; b++ ) {
+                nonzero |= Delta[b];
+            }
+            nonzero &= active;
+
+            // Lanes in which the length of the LFSR changes
+            uint64_t upd = 0;
+            int newMaxL = maxL;
+            for ( int l = 0 ; l < num ; l++ ) {
+                if ( ((nonzero>>l)&1) && L[l]+L[l] <= r-1 ) {
+                    upd |= ((uint64_t)1) << l;
+                    L[l] = r-L[l];
+                    if ( L[l] > newMaxL ) {
+                        newMaxL = L[l];
+                    }
+                }
+            }
+
+            // Lambda(X) <- gamma*Lambda(X)-Delta*X*B(X)
+            std::fill(nLambda.begin(),nLambda.end(),0);
+            for ( int j = 0 ; j <= newMaxL && j < cap ; j++ ) {
+
+                uint64_t *Lj = &(nLambda[(size_t)j*m]);
+
+                if ( j <= maxL ) {
+                    _bsmul(Lj,&(Lambda[(size_t)j*m]),gamma,m,taps);
+                }
+
+                if ( j > 0 && nonzero != 0 ) {
+                    _bsmul(tmp,&(B[(size_t)(j-1)*m]),Delta,m,taps);
+                    for ( int b = 0 ; b < m ; b++ ) {
+                        Lj[b] ^= tmp[b];
+                    }
+                }
+            }
+
+            // B(X) <- X*Lambda(X) in the updated lanes; otherwise,
+            // B(X) <- X^2*B(X)
+            for ( int j = 0 ; j < cap ; j++ ) {
+                for ( int b = 0 ; b < m ; b++ ) {
+                    uint64_t u = j >= 1 ? Lambda[(size_t)(j-1)*m+b] : 0;
+                    uint64_t v = j >= 2 ? B[(size_t)(j-2)*m+b] : 0;
+                    nB[(size_t)j*m+b] = (upd & u) | (~upd & v);
+                }
+            }
+
+            for ( int b = 0 ; b < m ; b++ ) {
+                gamma[b] = (upd & Delta[b]) | (~upd & gamma[b]);
+            }
+
+            swap(Lambda,nLambda);
+            swap(B,nB);
+            maxL = newMaxL < cap ? newMaxL : cap-1;
         }
 
-        BinaryPolynomial r(this->n) , tmp(this->n);
-        divRem(tmp,r,c,this->g);
+        // ****************************************************************
+        // * END: Error-locator polynomials have been computed            *
+        // ****************************************************************
 
-        if ( r.isZero() ) {
-            // 'c' is already a codeword; nothing to do
-            return true;
+        // More than 'nu' errors can not be corrected reliably
+        for ( int l = 0 ; l < num ; l++ ) {
+            if ( L[l] > nu ) {
+                active &= ~(((uint64_t)1) << l);
+            }
         }
 
-        int nu = getErrorTolerance();
+        // ****************************************************************
+        // * BEGIN: Bit-sliced Chien search; 'Y[j*m+b]' runs over the     *
+        // * 'b'th coefficients of 'lambda_j*beta^(j*(i+1))' of all words *
+        // ****************************************************************
 
-        // Compute partial syndromes.
-        // TODO: syndrome computation is currently the bottleneck in the
-        // implementation
-        vector<BinaryPolynomial> S(nu+nu);
-        for ( int j = 0 ; j < nu+nu ; j++ ) {
-            evalMod(S[j],r,this->powers_of_X_mod_f[j+1],this->f);
+        int t = 0;
+        for ( int l = 0 ; l < num ; l++ ) {
+            if ( ((active>>l)&1) && L[l] > t ) {
+                t = L[l];
+            }
         }
 
-        // Find the error-locator polynomial
-        vector<BinaryPolynomial> Lambda = BCHCodeBase::berlekampMassey(S,this->f);
+        // 'M[(j*m+a)*m+b]' is all-ones if the 'b'th coefficient of the
+        // product of 'X^a' with 'beta^j' is set and zero otherwise
+        vector<uint64_t> M((t+1)*(size_t)m*m,0);
+        vector<uint64_t> Y((t+1)*(size_t)m,0);
+        for ( int j = 1 ; j <= t ; j++ ) {
+            uint32_t bj = _pow(this->gf,beta,j);
+            for ( int a = 0 ; a < m ; a++ ) {
+                uint32_t col = this->gf.mul(((uint32_t)1)<<a,bj);
+                for ( int b = 0 ; b < m ; b++ ) {
+                    M[((size_t)j*m+a)*m+b] = 0-(uint64_t)((col>>b)&1);
+                }
+            }
+        }
 
-        // Find the error-locations which are given by the zeros of Lambda
-        vector<int> locs = chienSearch(Lambda);
-        if ( locs.size() + 1 != Lambda.size() ) {
-            return false;
+        for ( int j = 1 ; j <= t ; j++ ) {
+            _bsmulMasks
+            (&(Y[(size_t)j*m]),&(Lambda[(size_t)j*m]),&(M[(size_t)j*m*m]),m);
         }
 
-        // Flip the bits at the error location; as the code is binary, this
-        // causes
-        for ( int i = 0 ; i < (int)locs.size() ; i++ ) {
-            int j = locs.at(i);
-            c.setCoeff(j,!c.getCoeff(j));
+        vector< vector<int> > locs(num);
+
+        // Lanes whose error-locator polynomial may have further roots
+        uint64_t pending = active;
+
+        for ( int i = 0 ; i < n && pending != 0 ; i++ ) {
+
+            uint64_t nz = 0;
+            for ( int b = 0 ; b < m ; b++ ) {
+                uint64_t sum = Lambda[b];
+                for ( int j = 1 ; j <= t ; j++ ) {
+                    sum ^= Y[(size_t)j*m+b];
+                }
+                nz |= sum;
+            }
+
+            uint64_t z = ~nz & pending;
+            for ( int l = 0 ; z != 0 ; l++ , z >>= 1 ) {
+                if ( z & 1 ) {
+                    // ..., we found an error location.
+                    locs[l].push_back(n-i-1);
+                    if ( (int)locs[l].size() == L[l] ) {
+                        pending &= ~(((uint64_t)1) << l);
+                    }
+                }
+            }
+
+            for ( int j = 1 ; j <= t ; j++ ) {
+                _bsmulMasks
+                (&(Y[(size_t)j*m]),&(Y[(size_t)j*m]),&(M[(size_t)j*m*m]),m);
+            }
         }
 
-        // Decoding successul
-        return true;
+        // ****************************************************************
+        // * END: Chien search                                            *
+        // ****************************************************************
+
+        for ( int l = 0 ; l < num ; l++ ) {
+
+            if ( ((active>>l)&1) == 0 || (int)locs[l].size() != L[l] ) {
+                continue;
+            }
+
+            // Flip the bits at the error locations
+            for ( int i = 0 ; i < (int)locs[l].size() ; i++ ) {
+                int j = locs[l][i];
+                c[l].setCoeff(j,!c[l].getCoeff(j));
+            }
+
+            success[l] = true;
+            if ( numErrors != NULL ) {
+                numErrors[l] = L[l];
+            }
+            numSuccess++;
+        }
+
+        return numSuccess;
     }
 
     /**
@@ -367,17 +1312,156 @@ namespace thimble {
             exit(EXIT_FAILURE);
         }
 
-        BinaryPolynomial p(this->n);
+        // *******************************************************************
+        // * WARNING: THIS METHOD USES A 'getData_nonconst()' METHOD WHICH ***
+        // * YOU SHOULD ONLY USE ON YOURSELF IF YOU REALLY KNOW WHAT YOU ARE *
+        // * DOING ***********************************************************
+        // *******************************************************************
+
+        // Copy of the message words
+        vector<uint32_t> m((this->k+31)/32+1,0);
+        int numWords = c.deg() < 0 ? 0 : c.deg()/32+1;
+        for ( int w = 0 ; w < numWords ; w++ ) {
+            m[w] = c.getData()[w];
+        }
+
+        // Ensure that 'c' can hold 'n' coefficients
+        c.setZero();
+        c.setCoeff(this->n-1);
+
+        // Message in the upper 'k' coefficients and check bits in the
+        // lower 'n-k' coefficients
+        encode(c.getData_nonconst(),&(m[0]));
+
+        // Since upper coefficients may be zero, the degree could
+        // be smaller
+        c.degreeCouldBeSmaller();
+    }
+
+    /**
+     * @brief
+     *            Systematically encodes a message given as raw
+     *            32-bit words.
+     *
+     * @details
+     *            The <i>i</i>th bit of the message is the
+     *            <i>(i%32)</i>th bit of <code>m[i/32]</code> and the
+     *            same layout is used for the codeword which is the
+     *            same as for \link BinaryPolynomial\endlink and
+     *            \link BinaryVector\endlink. The message is copied to
+     *            the upper <i>k=</i>\link getDimension()\endlink
+     *            bits of <i>c</i> and the lower
+     *            <i>n-k</i> check bits are the remainder of the
+     *            message polynomial times \f$X^{n-k}\f$ modulo the
+     *            generator polynomial which is computed by a
+     *            table-driven linear feedback shift register consuming
+     *            8 message bits per step.
+     *
+     *            The result is the same as for
+     *            \link encode(BinaryPolynomial&)const\endlink.
+     *
+     * @param c
+     *            On output, contains the
+     *            <i>n=</i>\link getBlockLength()\endlink bits of
+     *            the codeword; must be able to hold at least
+     *            <i>(n+31)/32</i> words. The bits in the last word
+     *            above the <i>n</i>th bit are set to zero.
+     *
+     * @param m
+     *            Contains the <i>k</i> bits of the message in
+     *            <i>(k+31)/32</i> words; bits above the <i>k</i>th
+     *            are ignored. Must not overlap with <i>c</i>.
+     */
+    void BCHCodeBase::encode( uint32_t *c , const uint32_t *m ) const {
+
+        int n = this->n , k = this->k , r = n-k;
+        int W = (r+31)/32;
+        int numWords = (n+31)/32;
+
+        // The remainder register; for usual codes it fits on the stack
+        uint32_t stackR[64];
+        vector<uint32_t> heapR;
+        uint32_t *R = stackR;
+        if ( W > 64 ) {
+            heapR.resize(W);
+            R = &(heapR[0]);
+        }
+        for ( int w = 0 ; w < W ; w++ ) {
+            R[w] = 0;
+        }
+
+        // Mask of the valid bits in the highest word of the register
+        uint32_t topMask = (r%32) ? ((((uint32_t)1)<<(r%32))-1) : ~((uint32_t)0);
+
+        if ( !this->lfsrTable.empty() ) {
+
+            // Feed the message into the register, 8 bits per step
+            // starting with the highest coefficients
+            int p = r-8; // Position of the register's upper byte
+            for ( int q = (k+7)/8-1 ; q >= 0 ; q-- ) {
+
+                uint32_t v = (m[q>>2] >> ((q&3)<<3)) & 0xFF;
+                if ( k-8*q < 8 ) {
+                    v &= (((uint32_t)1)<<(k-8*q))-1;
+                }
+
+                // Upper byte of the register
+                uint32_t top = R[p>>5] >> (p&31);
+                if ( (p&31) > 24 ) {
+                    top |= R[(p>>5)+1] << (32-(p&31));
+                }
+                top = (top ^ v) & 0xFF;
+
+                // R <- (R*X^8 mod X^r)+T[top]
+                for ( int w = W-1 ; w > 0 ; w-- ) {
+                    R[w] = (R[w] << 8) | (R[w-1] >> 24);
+                }
+                R[0] <<= 8;
+                R[W-1] &= topMask;
+
+                const uint32_t *T = &(this->lfsrTable[(size_t)W*top]);
+                for ( int w = 0 ; w < W ; w++ ) {
+                    R[w] ^= T[w];
+                }
+            }
+
+        } else if ( r > 0 ) {
+
+            // Generator polynomial of small degree; bit-wise register
+            uint32_t taps = this->g.getData()[0] & topMask;
+
+            for ( int i = k-1 ; i >= 0 ; i-- ) {
+                uint32_t fb = ((R[0] >> (r-1)) ^ (m[i>>5] >> (i&31))) & 1;
+                R[0] = (R[0] << 1) & topMask;
+                if ( fb ) {
+                    R[0] ^= taps;
+                }
+            }
+        }
+
+        // ****************************************************************
+        // * Codeword: check bits in the lower 'r' and the message in the *
+        // * upper 'k' coefficients.                                      *
+        // ****************************************************************
+
+        for ( int w = 0 ; w < numWords ; w++ ) {
+            c[w] = w < W ? R[w] : 0;
+        }
 
-        // Make the upper 'k' coefficient form the input
-        // message polynomial
-        c.leftShift(this->n-this->k);
+        int ws = r/32 , bs = r%32;
+        int mWords = (k+31)/32;
+        for ( int w = 0 ; w < mWords ; w++ ) {
 
-        // Check bits
-        rem(p,c,this->g);
+            uint32_t v = m[w];
+            if ( w == mWords-1 && (k%32) != 0 ) {
+                v &= (((uint32_t)1)<<(k%32))-1;
+            }
 
-        // Add check bits
-        sub(c,c,p);
+            c[w+ws] |= v << bs;
+            if ( bs != 0 && w+ws+1 < numWords ) {
+                c[w+ws+1] |= v >> (32-bs);
+            }
+        }
     }
 
     /**
@@ -431,6 +1515,60 @@ namespace thimble {
         return true;
     }
 
+    /**
+     * @brief
+     *            Decodes many received polynomials at once.
+     *
+     * @details
+     *            Does the same as calling \link decode()\endlink for
+     *            each of the <i>num</i> polynomials in <i>m</i> but
+     *            rounds them via \link roundBatch()\endlink.
+     *
+     * @param m
+     *            Array of <i>num</i> polynomials each of degree
+     *            smaller than
+     *            <i>n=</i>\link getBlockLength()\endlink. On output,
+     *            the successfully decoded polynomials are replaced
+     *            by their message polynomials; the others are left
+     *            unchanged.
+     *
+     * @param success
+     *            Array that can hold at least <i>num</i> flags; on
+     *            output, <code>success[l]</code> indicates whether
+     *            <code>m[l]</code> was successfully decoded.
+     *
+     * @param num
+     *            The number of polynomials in <i>m</i>.
+     *
+     * @return
+     *            The number of polynomials that were successfully
+     *            decoded.
+     *
+     * @warning
+     *            If any of the <i>m[l]</i> is of degree larger than
+     *            or equals <i>n=</i>\link getBlockLength()\endlink,
+     *            an error message is printed to <code>stderr</code>
+     *            and the program exits with status 'EXIT_FAILURE'.
+     *
+     * @warning
+     *            If not enough memory could be provided, an error
+     *            message is printed to <code>stderr</code> and the
+     *            program exits with status 'EXIT_FAILURE'.
+     */
+    int BCHCodeBase::decodeBatch
+    ( BinaryPolynomial *m , bool *success , int num ) const {
+
+        int numSuccess = roundBatch(m,success,num);
+
+        for ( int l = 0 ; l < num ; l++ ) {
+            if ( success[l] ) {
+                m[l].rightShift(this->n-this->k);
+            }
+        }
+
+        return numSuccess;
+    }
+
     /**
      * @brief
      *           Creates a random code polynomial.
@@ -592,6 +1730,98 @@ namespace thimble {
         return Lambda;
     }
 
+    /**
+     * @brief
+     *            Implementation of the Berlekamp-Massey algorithm
+     *            for finding the minimal polynomial of a linearly
+     *            recurrent sequence in a small binary finite field.
+     *
+     * @details
+     *            Does the same as
+     *            \link berlekampMassey(const std::vector<BinaryPolynomial>&,const BinaryPolynomial&)\endlink
+     *            but works with the word representation of the
+     *            elements in <i>gf</i> which avoids the polynomial
+     *            multiplications and reductions.
+     *
+     * @param S
+     *            Linearly recurrent sequence of elements in
+     *            <i>gf</i>.
+     *
+     * @param gf
+     *            The finite field in which the sequence lives.
+     *
+     * @return
+     *            A vector of length at most <i>t+1</i> where
+     *            <code>Lambda[j]</code> is the <i>j</i>th coefficient
+     *            of the minimal polynomial of the sequence.
+     *
+     * @warning
+     *            If not enough memory could be provided, an error
+     *            message is printed to <code>stderr</code> and the
+     *            program exits with status 'EXIT_FAILURE'.
+     */
+    vector<uint32_t> BCHCodeBase::berlekampMassey
+    ( const std::vector<uint32_t> & S , const SmallBinaryField & gf ) {
+
+        int s = S.size();
+
+        // Lambda(X) = 1
+        vector<uint32_t> Lambda(s+1,0) , B(s+1,0) , T;
+        Lambda[0] = 1;
+        B[0] = 1;
+
+        // Degree of 'Lambda'
+        int L = 0;
+
+        // 'B(X)' is multiplied by 'X^e' and scaled by 'b^(-1)' on update
+        int e = 1;
+        uint32_t b = 1;
+
+        for ( int l = 0 ; l < s ; l++ ) {
+
+            // Discrepancy 'Delta = S_l+Lambda_1S_{l-1}+...+Lambda_LS_{l-L}'
+            uint32_t Delta = S[l];
+            for ( int i = 1 ; i <= L ; i++ ) {
+                Delta ^= gf.mul(Lambda[i],S[l-i]);
+            }
+
+            if ( Delta == 0 ) {
+                e++;
+                continue;
+            }
+
+            uint32_t coeff = gf.div(Delta,b);
+
+            if ( L+L <= l ) {
+
+                T = Lambda;
+
+                // Lambda(X) <- Lambda(X)-Delta/b*X^e*B(X)
+                for ( int i = 0 ; i+e <= s ; i++ ) {
+                    Lambda[i+e] ^= gf.mul(coeff,B[i]);
+                }
+
+                L = l+1-L;
+                swap(B,T);
+                b = Delta;
+                e = 1;
+
+            } else {
+
+                // Lambda(X) <- Lambda(X)-Delta/b*X^e*B(X)
+                for ( int i = 0 ; i+e <= s ; i++ ) {
+                    Lambda[i+e] ^= gf.mul(coeff,B[i]);
+                }
+
+                e++;
+            }
+        }
+
+        Lambda.erase(Lambda.begin()+L+1,Lambda.end());
+
+        return Lambda;
+    }
+
     /**
      * @brief
      *             Determines the non-zero roots of a polynomial
@@ -708,6 +1938,137 @@ namespace thimble {
             }
         }
 
+        return locs;
+    }
+    /**
+     * @brief
+     *             Determines the non-zero roots of a polynomial
+     *             with coefficients in the field
+     *             <i>\link gf\endlink</i>.
+     *
+     * @details
+     *             Does the same as
+     *             \link chienSearch(const std::vector<BinaryPolynomial>&)const\endlink
+     *             but requires <i>\link hasSmallField\endlink</i> to
+     *             be <code>true</code>; the polynomial is evaluated at
+     *             64 consecutive powers of \f$\beta\f$ at once using
+     *             the bit-sliced tables
+     *             <i>\link chienMasks\endlink</i>.
+     *
+     * @param Lambda
+     *             An array of length <i>t+1</i>
+     *             (where <i>t</i>\f$\leq\f$\link getErrorTolerance()\endlink)
+     *             such that the entry <code>Lambda[j]</code>
+     *             is the <i>j</i>th coefficient \f$\lambda_j\f$ of the
+     *             polynomial \f$\Lambda(X)\f$.
+     *
+     * @return
+     *             The error locations, i.e., the exponents
+     *             <i>n-i</i> for which \f$\beta^i\f$ is a root of
+     *             \f$\Lambda(X)\f$ (where <i>i=1,...,n</i>).
+     *
+     * @warning
+     *             If the requirement on the input <code>Lambda</code>
+     *             is violated, a call of this function runs into
+     *             undocumented behaviour.
+     *
+     * @warning
+     *             If not enough memory could be provided, an error
+     *             message is printed to <code>stderr</code> and the
+     *             program exits with status 'EXIT_FAILURE'.
+     */
+    vector<int> BCHCodeBase::chienSearch
+    ( const std::vector<uint32_t> & Lambda ) const {
+
+        vector<int> locs;
+
+        int t = (int)Lambda.size()-1;
+        int m = this->gf.getDegree();
+        uint32_t beta = this->powers_of_X_mod_f[1].getData()[0];
+
+        // 'y[j]' runs over 'lambda_j*beta^(j*(i+1))' and is multiplied
+        // by 'step[j]' after each block of evaluations
+        vector<uint32_t> y(t+1) , step(t+1);
+        for ( int j = 1 ; j <= t ; j++ ) {
+            y[j] = this->gf.mul(Lambda[j],_pow(this->gf,beta,j));
+        }
+
+        if ( this->chienMasks.empty() ) {
+
+            // Evaluate 'Lambda(beta^(i+1))' one after the other
+            for ( int j = 1 ; j <= t ; j++ ) {
+                step[j] = _pow(this->gf,beta,j);
+            }
+
+            for ( int i = 0 ; i < this->n ; i++ ) {
+
+                uint32_t sum = Lambda[0];
+                for ( int j = 1 ; j <= t ; j++ ) {
+                    sum ^= y[j];
+                    y[j] = this->gf.mul(y[j],step[j]);
+                }
+
+                if ( sum == 0 ) {
+                    locs.push_back(this->n-i-1);
+                    if ( (int)locs.size() == t ) {
+                        break;
+                    }
+                }
+            }
+
+            return locs;
+        }
+
+        for ( int j = 1 ; j <= t ; j++ ) {
+            step[j] = _pow(this->gf,beta,64*j);
+        }
+
+        // Bit-sliced evaluations: the 's'th bit of 'W[b]' will contain
+        // the 'b'th coefficient of 'Lambda(beta^(i+s+1))'
+        uint64_t W[_MAX_SMALL_FIELD_DEGREE];
+
+        for ( int i = 0 ; i < this->n ; i += 64 ) {
+
+            for ( int b = 0 ; b < m ; b++ ) {
+                W[b] = ((Lambda[0]>>b)&1) ? ~((uint64_t)0) : 0;
+            }
+
+            for ( int j = 1 ; j <= t ; j++ ) {
+
+                const uint64_t *M =
+                        &(this->chienMasks[(size_t)(j-1)*(size_t)(m*m)]);
+
+                for ( int a = 0 ; a < m ; a++ ) {
+                    uint64_t mask = 0-(uint64_t)((y[j]>>a)&1);
+                    for ( int b = 0 ; b < m ; b++ ) {
+                        W[b] ^= M[a*m+b] & mask;
+                    }
+                }
+
+                y[j] = this->gf.mul(y[j],step[j]);
+            }
+
+            // Bits of evaluations being zero
+            uint64_t z = 0;
+            for ( int b = 0 ; b < m ; b++ ) {
+                z |= W[b];
+            }
+            z = ~z;
+            if ( this->n - i < 64 ) {
+                z &= (((uint64_t)1) << (this->n-i)) - 1;
+            }
+
+            for ( int s = 0 ; z != 0 ; s++ , z >>= 1 ) {
+                if ( z & 1 ) {
+                    // ..., we found an error location.
+                    locs.push_back(this->n-i-s-1);
+                    if ( (int)locs.size() == t ) {
+                        return locs;
+                    }
+                }
+            }
+        }
+
         return locs;
     }
 }
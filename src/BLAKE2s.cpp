@@ -0,0 +1,586 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file BLAKE2s.cpp
+ *
+ * @brief
+ *            This file implements the functionalities provided by
+ *            'BLAKE2s.h' which provides a mechanism for computing the
+ *            BLAKE2s hash value of data.
+ *
+ * @details
+ *            see 'BLAKE2s.h'
+ *
+ * @author agent
+ */
+#include "config.h"
+#include <stdint.h>
+#include <cstring>
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+#include <immintrin.h>
+#endif
+
+#include <thimble/math/MathTools.h>
+#include <thimble/security/BLAKE2s.h>
+
+using namespace std;
+
+/**
+ * @brief The library's namespace
+ */
+namespace thimble {
+
+    /**
+     * @brief
+     *            Initialization vector (see Section 2.6 in RFC 7693).
+     */
+    static const uint32_t _BLAKE2S_IV[8] = {
+        0x6A09E667 , 0xBB67AE85 , 0x3C6EF372 , 0xA54FF53A ,
+        0x510E527F , 0x9B05688C , 0x1F83D9AB , 0x5BE0CD19 };
+
+    /**
+     * @brief
+     *            Message word permutations of the ten rounds (see
+     *            Section 2.7 in RFC 7693).
+     */
+    static const uint8_t _BLAKE2S_SIGMA[10][16] = {
+        {  0 ,  1 ,  2 ,  3 ,  4 ,  5 ,  6 ,  7 ,  8 ,  9 , 10 , 11 , 12 , 13 , 14 , 15 } ,
+        { 14 , 10 ,  4 ,  8 ,  9 , 15 , 13 ,  6 ,  1 , 12 ,  0 ,  2 , 11 ,  7 ,  5 ,  3 } ,
+        { 11 ,  8 , 12 ,  0 ,  5 ,  2 , 15 , 13 , 10 , 14 ,  3 ,  6 ,  7 ,  1 ,  9 ,  4 } ,
+        {  7 ,  9 ,  3 ,  1 , 13 , 12 , 11 , 14 ,  2 ,  6 ,  5 , 10 ,  4 ,  0 , 15 ,  8 } ,
+        {  9 ,  0 ,  5 ,  7 ,  2 ,  4 , 10 , 15 , 14 ,  1 , 11 , 12 ,  6 ,  8 ,  3 , 13 } ,
+        {  2 , 12 ,  6 , 10 ,  0 , 11 ,  8 ,  3 ,  4 , 13 ,  7 ,  5 , 15 , 14 ,  1 ,  9 } ,
+        { 12 ,  5 ,  1 , 15 , 14 , 13 ,  4 , 10 ,  0 ,  7 ,  6 ,  3 ,  9 ,  2 ,  8 , 11 } ,
+        { 13 , 11 ,  7 , 14 , 12 ,  1 ,  3 ,  9 ,  5 ,  0 , 15 ,  4 ,  8 ,  6 ,  2 , 10 } ,
+        {  6 , 15 , 14 ,  9 , 11 ,  3 ,  0 ,  8 , 12 ,  2 , 13 ,  7 ,  1 ,  4 , 10 ,  5 } ,
+        { 10 ,  2 ,  8 ,  4 ,  7 ,  6 ,  1 ,  5 , 15 , 11 ,  9 , 14 ,  3 , 12 , 13 ,  0 } };
+
+    /**
+     * @brief
+     *            Circular right shift of a 32-bit integer by
+     *            <code>n</code> bits.
+     */
+    inline static uint32_t rotr32( uint32_t x , int n ) {
+        return (x >> n) | (x << (32 - n));
+    }
+
+    /**
+     * @brief
+     *            Interprets four bytes as a little-endian 32-bit integer.
+     */
+    inline static uint32_t load32le( const uint8_t *p ) {
+        return  ((uint32_t)p[0])      | (((uint32_t)p[1])<<8) |
+               (((uint32_t)p[2])<<16) | (((uint32_t)p[3])<<24);
+    }
+
+    /**
+     * @brief
+     *            Writes a 32-bit integer as four big-endian bytes.
+     */
+    inline static void store32be( uint8_t *p , uint32_t x ) {
+        p[0] = (uint8_t)(x>>24);
+        p[1] = (uint8_t)(x>>16);
+        p[2] = (uint8_t)(x>>8);
+        p[3] = (uint8_t)x;
+    }
+
+    /**
+     * @brief
+     *            Writes a 32-bit integer as four little-endian bytes.
+     */
+    inline static void store32le( uint8_t *p , uint32_t x ) {
+        p[0] = (uint8_t)x;
+        p[1] = (uint8_t)(x>>8);
+        p[2] = (uint8_t)(x>>16);
+        p[3] = (uint8_t)(x>>24);
+    }
+
+    /**
+     * @brief
+     *            The mixing function <i>G</i> (see Section 3.1 in RFC 7693).
+     */
+    inline static void mix
+    ( uint32_t v[16] , int a , int b , int c , int d , uint32_t x , uint32_t y ) {
+
+        v[a] = v[a] + v[b] + x;
+        v[d] = rotr32(v[d] ^ v[a],16);
+        v[c] = v[c] + v[d];
+        v[b] = rotr32(v[b] ^ v[c],12);
+        v[a] = v[a] + v[b] + y;
+        v[d] = rotr32(v[d] ^ v[a],8);
+        v[c] = v[c] + v[d];
+        v[b] = rotr32(v[b] ^ v[c],7);
+    }
+
+    /**
+     * @brief
+     *            Portable implementation of \link compress()\endlink
+     *            (see Section 3.2 in RFC 7693).
+     */
+    static void compressGeneric
+    ( uint32_t H[8] , const uint8_t block[64] , uint64_t t , bool last ) {
+
+        uint32_t m[16] , v[16];
+
+        for ( int i = 0 ; i < 16 ; i++ ) {
+            m[i] = load32le(block+4*i);
+        }
+
+        for ( int i = 0 ; i < 8 ; i++ ) {
+            v[i] = H[i];
+            v[i+8] = _BLAKE2S_IV[i];
+        }
+        v[12] ^= (uint32_t)t;
+        v[13] ^= (uint32_t)(t>>32);
+        if ( last ) {
+            v[14] = ~v[14];
+        }
+
+        for ( int r = 0 ; r < 10 ; r++ ) {
+            const uint8_t *s = _BLAKE2S_SIGMA[r];
+            mix(v,0,4, 8,12,m[s[ 0]],m[s[ 1]]);
+            mix(v,1,5, 9,13,m[s[ 2]],m[s[ 3]]);
+            mix(v,2,6,10,14,m[s[ 4]],m[s[ 5]]);
+            mix(v,3,7,11,15,m[s[ 6]],m[s[ 7]]);
+            mix(v,0,5,10,15,m[s[ 8]],m[s[ 9]]);
+            mix(v,1,6,11,12,m[s[10]],m[s[11]]);
+            mix(v,2,7, 8,13,m[s[12]],m[s[13]]);
+            mix(v,3,4, 9,14,m[s[14]],m[s[15]]);
+        }
+
+        for ( int i = 0 ; i < 8 ; i++ ) {
+            H[i] ^= v[i] ^ v[i+8];
+        }
+    }
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+    /**
+     * @brief
+     *            Implementation of \link compress()\endlink processing
+     *            the four rows of the state as 128-bit vectors.
+     *
+     * @details
+     *            The columns are mixed in parallel; then the rows are
+     *            rotated such that the diagonals become columns, mixed,
+     *            and rotated back.
+     */
+    __attribute__((target("ssse3")))
+    static void compressSsse3
+    ( uint32_t H[8] , const uint8_t block[64] , uint64_t t , bool last ) {
+
+        const __m128i rot16 =
+            _mm_set_epi8(13,12,15,14,9,8,11,10,5,4,7,6,1,0,3,2);
+        const __m128i rot8 =
+            _mm_set_epi8(12,15,14,13,8,11,10,9,4,7,6,5,0,3,2,1);
+
+        uint32_t m[16];
+        memcpy(m,block,64);
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+        for ( int i = 0 ; i < 16 ; i++ ) {
+            m[i] = load32le(block+4*i);
+        }
+#endif
+
+        __m128i h0 = _mm_loadu_si128((const __m128i*)H);
+        __m128i h1 = _mm_loadu_si128((const __m128i*)(H+4));
+        __m128i a = h0;
+        __m128i b = h1;
+        __m128i c = _mm_loadu_si128((const __m128i*)_BLAKE2S_IV);
+        __m128i d = _mm_xor_si128
+            (_mm_loadu_si128((const __m128i*)(_BLAKE2S_IV+4)),
+             _mm_set_epi32(0,last?-1:0,(int)(uint32_t)(t>>32),(int)(uint32_t)t));
+
+        for ( int r = 0 ; r < 10 ; r++ ) {
+
+            const uint8_t *s = _BLAKE2S_SIGMA[r];
+
+            for ( int half = 0 ; half < 2 ; half++ , s += 8 ) {
+
+                __m128i x = _mm_set_epi32
+                    ((int)m[s[6]],(int)m[s[4]],(int)m[s[2]],(int)m[s[0]]);
+                __m128i y = _mm_set_epi32
+                    ((int)m[s[7]],(int)m[s[5]],(int)m[s[3]],(int)m[s[1]]);
+
+                a = _mm_add_epi32(_mm_add_epi32(a,b),x);
+                d = _mm_shuffle_epi8(_mm_xor_si128(d,a),rot16);
+                c = _mm_add_epi32(c,d);
+                b = _mm_xor_si128(b,c);
+                b = _mm_or_si128(_mm_srli_epi32(b,12),_mm_slli_epi32(b,20));
+                a = _mm_add_epi32(_mm_add_epi32(a,b),y);
+                d = _mm_shuffle_epi8(_mm_xor_si128(d,a),rot8);
+                c = _mm_add_epi32(c,d);
+                b = _mm_xor_si128(b,c);
+                b = _mm_or_si128(_mm_srli_epi32(b,7),_mm_slli_epi32(b,25));
+
+                if ( half == 0 ) {
+                    // Diagonalize
+                    b = _mm_shuffle_epi32(b,_MM_SHUFFLE(0,3,2,1));
+                    c = _mm_shuffle_epi32(c,_MM_SHUFFLE(1,0,3,2));
+                    d = _mm_shuffle_epi32(d,_MM_SHUFFLE(2,1,0,3));
+                } else {
+                    // Undiagonalize
+                    b = _mm_shuffle_epi32(b,_MM_SHUFFLE(2,1,0,3));
+                    c = _mm_shuffle_epi32(c,_MM_SHUFFLE(1,0,3,2));
+                    d = _mm_shuffle_epi32(d,_MM_SHUFFLE(0,3,2,1));
+                }
+            }
+        }
+
+        _mm_storeu_si128((__m128i*)H,_mm_xor_si128(h0,_mm_xor_si128(a,c)));
+        _mm_storeu_si128((__m128i*)(H+4),_mm_xor_si128(h1,_mm_xor_si128(b,d)));
+    }
+
+    /**
+     * @brief
+     *            Circular right shift of eight 32-bit integers.
+     */
+    template<int N>
+    __attribute__((target("avx2")))
+    inline static __m256i rotr32x8( __m256i x ) {
+        return _mm256_or_si256(_mm256_srli_epi32(x,N),_mm256_slli_epi32(x,32-N));
+    }
+
+    /**
+     * @brief
+     *            The mixing function <i>G</i> applied to eight
+     *            states simultaneously.
+     */
+    __attribute__((target("avx2")))
+    inline static void mixAvx2
+    ( __m256i v[16] , int a , int b , int c , int d , __m256i x , __m256i y ) {
+
+        v[a] = _mm256_add_epi32(_mm256_add_epi32(v[a],v[b]),x);
+        v[d] = rotr32x8<16>(_mm256_xor_si256(v[d],v[a]));
+        v[c] = _mm256_add_epi32(v[c],v[d]);
+        v[b] = rotr32x8<12>(_mm256_xor_si256(v[b],v[c]));
+        v[a] = _mm256_add_epi32(_mm256_add_epi32(v[a],v[b]),y);
+        v[d] = rotr32x8<8>(_mm256_xor_si256(v[d],v[a]));
+        v[c] = _mm256_add_epi32(v[c],v[d]);
+        v[b] = rotr32x8<7>(_mm256_xor_si256(v[b],v[c]));
+    }
+
+    /**
+     * @brief
+     *            Compresses one block for each of eight intermediate hash
+     *            values simultaneously using the 'AVX2' instructions.
+     *
+     * @param S
+     *            The intermediate hash values where <code>S[i][l]</code>
+     *            denotes the <code>i</code>th word of the
+     *            <code>l</code>th hash value.
+     *
+     * @param M
+     *            The message blocks where <code>M[i][l]</code>
+     *            denotes the <code>i</code>th (little-endian) word of
+     *            the <code>l</code>th block.
+     *
+     * @param t
+     *            The byte counters of the eight blocks.
+     *
+     * @param f
+     *            The finalization flags of the eight blocks, i.e.,
+     *            <code>0xFFFFFFFF</code> for the last block of a message
+     *            and <code>0</code> otherwise.
+     *
+     * @param mask
+     *            Only the hash values with <code>mask[l]</code> being
+     *            non-zero are updated.
+     */
+    __attribute__((target("avx2")))
+    static void compressAvx2
+    ( uint32_t S[8][8] , const uint32_t M[16][8] , const uint64_t t[8] ,
+      const uint32_t f[8] , const int32_t mask[8] ) {
+
+        __m256i m[16] , v[16] , h[8];
+
+        for ( int i = 0 ; i < 16 ; i++ ) {
+            m[i] = _mm256_loadu_si256((const __m256i*)M[i]);
+        }
+        for ( int i = 0 ; i < 8 ; i++ ) {
+            h[i] = _mm256_loadu_si256((const __m256i*)S[i]);
+            v[i] = h[i];
+            v[i+8] = _mm256_set1_epi32((int)_BLAKE2S_IV[i]);
+        }
+
+        uint32_t tlo[8] , thi[8];
+        for ( int l = 0 ; l < 8 ; l++ ) {
+            tlo[l] = (uint32_t)t[l];
+            thi[l] = (uint32_t)(t[l]>>32);
+        }
+        v[12] = _mm256_xor_si256(v[12],_mm256_loadu_si256((const __m256i*)tlo));
+        v[13] = _mm256_xor_si256(v[13],_mm256_loadu_si256((const __m256i*)thi));
+        v[14] = _mm256_xor_si256(v[14],_mm256_loadu_si256((const __m256i*)f));
+
+        for ( int r = 0 ; r < 10 ; r++ ) {
+            const uint8_t *s = _BLAKE2S_SIGMA[r];
+            mixAvx2(v,0,4, 8,12,m[s[ 0]],m[s[ 1]]);
+            mixAvx2(v,1,5, 9,13,m[s[ 2]],m[s[ 3]]);
+            mixAvx2(v,2,6,10,14,m[s[ 4]],m[s[ 5]]);
+            mixAvx2(v,3,7,11,15,m[s[ 6]],m[s[ 7]]);
+            mixAvx2(v,0,5,10,15,m[s[ 8]],m[s[ 9]]);
+            mixAvx2(v,1,6,11,12,m[s[10]],m[s[11]]);
+            mixAvx2(v,2,7, 8,13,m[s[12]],m[s[13]]);
+            mixAvx2(v,3,4, 9,14,m[s[14]],m[s[15]]);
+        }
+
+        const __m256i sel = _mm256_loadu_si256((const __m256i*)mask);
+        for ( int i = 0 ; i < 8 ; i++ ) {
+            __m256i x = _mm256_xor_si256(h[i],_mm256_xor_si256(v[i],v[i+8]));
+            _mm256_storeu_si256
+                ((__m256i*)S[i],_mm256_blendv_epi8(h[i],x,sel));
+        }
+    }
+#endif
+
+    /**
+     * @brief
+     *            Updates an intermediate hash value by one 64-byte
+     *            message block.
+     *
+     * @param H
+     *            The intermediate hash value that is updated.
+     *
+     * @param block
+     *            The message block.
+     *
+     * @param t
+     *            The number of message bytes processed including this
+     *            block.
+     *
+     * @param last
+     *            Whether the block is the last block of the message.
+     */
+    static void compress
+    ( uint32_t H[8] , const uint8_t block[64] , uint64_t t , bool last ) {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        if ( MathTools::hasSsse3() ) {
+            compressSsse3(H,block,t,last);
+            return;
+        }
+#endif
+        compressGeneric(H,block,t,last);
+    }
+
+    /**
+     * @brief
+     *            Returns the number of bytes buffered by a %BLAKE2s
+     *            object to which <code>L</code> bytes have been passed.
+     *
+     * @details
+     *            A non-empty message always leaves between 1 and 64
+     *            bytes in the buffer.
+     */
+    inline static int numBuffered( uint64_t L ) {
+        return ( L > 0 && L % 64 == 0 ) ? 64 : (int)(L % 64);
+    }
+
+    /*
+     * see 'BLAKE2s.h' for the documentation.
+     */
+    BLAKE2s::BLAKE2s() {
+        init();
+    }
+
+    /*
+     * see 'BLAKE2s.h' for the documentation.
+     */
+    BLAKE2s::~BLAKE2s() {
+        memset(this->block,0,64);
+    }
+
+    /*
+     * see 'BLAKE2s.h' for the documentation.
+     */
+    void BLAKE2s::init() {
+        memcpy(this->H,_BLAKE2S_IV,8*sizeof(uint32_t));
+        // Parameter block: digest length 32, no key, fanout 1, depth 1
+        this->H[0] ^= 0x01010020;
+        this->L = 0;
+    }
+
+    /*
+     * see 'BLAKE2s.h' for the documentation.
+     */
+    void BLAKE2s::update( const uint8_t *message , uint64_t n ) {
+
+        if ( n == 0 ) {
+            return;
+        }
+
+        // Fill a partially buffered block first
+        int r = numBuffered(this->L);
+        if ( r > 0 ) {
+            uint64_t c = 64 - r;
+            if ( n < c ) {
+                c = n;
+            }
+            memcpy(this->block+r,message,(size_t)c);
+            this->L += c;
+            message += c;
+            n -= c;
+            if ( n == 0 ) {
+                return;
+            }
+            // More bytes follow; thus, the buffered block is not the last
+            compress(this->H,this->block,this->L,false);
+        }
+
+        // Compress complete blocks directly from the message while
+        // retaining the last block ...
+        while ( n > 64 ) {
+            this->L += 64;
+            compress(this->H,message,this->L,false);
+            message += 64;
+            n -= 64;
+        }
+
+        // ... in the buffer.
+        memcpy(this->block,message,(size_t)n);
+        this->L += n;
+    }
+
+    /*
+     * see 'BLAKE2s.h' for the documentation.
+     */
+    void BLAKE2s::update( const uint32_t *message , uint64_t n ) {
+
+        uint8_t bytes[64];
+
+        while ( n > 0 ) {
+            int c = n < 16 ? (int)n : 16;
+            for ( int i = 0 ; i < c ; i++ ) {
+                store32be(bytes+4*i,message[i]);
+            }
+            update(bytes,4*c);
+            message += c;
+            n -= c;
+        }
+    }
+
+    /*
+     * see 'BLAKE2s.h' for the documentation.
+     */
+    void BLAKE2s::final( uint8_t h[32] ) {
+
+        // Pad the last block by zeros and compress it with the
+        // finalization flag
+        int r = numBuffered(this->L);
+        memset(this->block+r,0,64-r);
+        compress(this->H,this->block,this->L,true);
+
+        for ( int i = 0 ; i < 8 ; i++ ) {
+            store32le(h+4*i,this->H[i]);
+        }
+
+        init();
+    }
+
+    /*
+     * see 'BLAKE2s.h' for the documentation.
+     */
+    void BLAKE2s::hash( uint8_t h[32] , const uint8_t *message , uint64_t n ) {
+
+        init();
+        update(message,n);
+        final(h);
+    }
+
+    /*
+     * see 'BLAKE2s.h' for the documentation.
+     */
+    void BLAKE2s::hash( uint8_t h[32] , const uint32_t *message , uint64_t n ) {
+
+        init();
+        update(message,n);
+        final(h);
+    }
+
+    /*
+     * see 'BLAKE2s.h' for the documentation.
+     */
+    void BLAKE2s::hashBatch
+    ( uint8_t h[][32] , const uint32_t *const *messages ,
+      const uint64_t *n , int num ) {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        if ( MathTools::hasAvx2() ) {
+
+            uint32_t S[8][8] , M[16][8] , f[8];
+            int32_t mask[8];
+            uint64_t t[8] , numBlocks[8];
+
+            for ( int l0 = 0 ; l0 < num ; l0 += 8 ) {
+
+                int lanes = num - l0 < 8 ? num - l0 : 8;
+
+                // Each message of 'n' words consists of 4n bytes being
+                // compressed in at least one block
+                uint64_t maxBlocks = 0;
+                for ( int l = 0 ; l < lanes ; l++ ) {
+                    uint64_t bytes = 4*n[l0+l];
+                    numBlocks[l] = bytes == 0 ? 1 : (bytes+63)/64;
+                    if ( numBlocks[l] > maxBlocks ) {
+                        maxBlocks = numBlocks[l];
+                    }
+                }
+
+                for ( int i = 0 ; i < 8 ; i++ ) {
+                    for ( int l = 0 ; l < 8 ; l++ ) {
+                        S[i][l] = _BLAKE2S_IV[i] ^ (i == 0 ? 0x01010020 : 0);
+                    }
+                }
+
+                for ( uint64_t b = 0 ; b < maxBlocks ; b++ ) {
+                    for ( int l = 0 ; l < 8 ; l++ ) {
+                        uint64_t len = l < lanes ? n[l0+l] : 0;
+                        bool active = l < lanes && b < numBlocks[l];
+                        for ( int i = 0 ; i < 16 ; i++ ) {
+                            uint64_t pos = 16*b+i;
+                            // The big-endian encoding of a word read as
+                            // a little-endian word is its byte reversal
+                            M[i][l] = active && pos < len ?
+                                __builtin_bswap32(messages[l0+l][pos]) : 0;
+                        }
+                        uint64_t end = 64*(b+1);
+                        t[l] = end < 4*len ? end : 4*len;
+                        f[l] = active && b + 1 == numBlocks[l] ? 0xFFFFFFFF : 0;
+                        mask[l] = active ? -1 : 0;
+                    }
+                    compressAvx2(S,M,t,f,mask);
+                }
+
+                for ( int l = 0 ; l < lanes ; l++ ) {
+                    for ( int i = 0 ; i < 8 ; i++ ) {
+                        store32le(h[l0+l]+4*i,S[i][l]);
+                    }
+                }
+            }
+            return;
+        }
+#endif
+
+        BLAKE2s blake2s;
+        for ( int l = 0 ; l < num ; l++ ) {
+            blake2s.hash(h[l],messages[l],n[l]);
+        }
+    }
+}
@@ -31,6 +31,7 @@
  * @see thimble::BigInteger
  */
 #include <stdint.h>
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
@@ -444,104 +445,450 @@ namespace thimble {
 
 	/**
 	 * @brief
-	 *            Low-level function that forms the radix-\f$2^{32}\f$ product
-	 *            of two positive big integers.
+	 *            Number of 64-bit limbs from which on positive integers
+	 *            are multiplied using Karatsuba's method rather than the
+	 *            schoolbook method.
+	 */
+	static const int _KARATSUBA_THRESHOLD = 24;
+
+	/**
+	 * @brief
+	 *            Number of 32-bit words from which on two positive
+	 *            integers of similar length are multiplied using the
+	 *            Toom-Cook method (Toom-3).
+	 */
+	static const int _TOOM3_THRESHOLD = 6144;
+
+	/**
+	 * @brief
+	 *            Number of 32-bit words from which on the quotient of
+	 *            two integers is computed from an approximation of the
+	 *            reciprocal of the denominator obtained via Newton
+	 *            iteration rather than via long division.
 	 *
 	 * @details
-	 *            The method computes the product of the two factors
-	 *            \f[
-	 *             \sum_{i=0}^{m-1}a[i]\cdot 2^{i\cdot 32}
-	 *            \f]
-	 *            and
-	 *            \f[
-	 *             \sum_{i=0}^{n-1}b[i]\cdot 2^{i\cdot 32}
-	 *            \f]
-	 *            and stores the result in <i>c</i> such that
-	 *            \f[
-	 *             \sum_{i=0}^{m+n}c[i]\cdot 2^{i\cdot 32}
-	 *            \f]
-	 *            is the product.
-	 *            <br><br>
-	 *            <b>Note:</b> The array <i>c</i>, <i>a</i>, or <i>b</i>
-	 *            are <b>NOT ALLOWED</b> to be pairwise equal or to
-	 *            overlap/cross their first <i>n+m</i>, <i>m</i>,
-	 *            or <i>n</i> elements, respectively.
+	 *            Both, the denominator and the quotient, must have at
+	 *            least this number of words.
+	 */
+	static const int _NEWTON_THRESHOLD = 96;
+
+#ifdef __SIZEOF_INT128__
+	/**
+	 * @brief
+	 *            Unsigned 128-bit integer type provided by GCC-compatible
+	 *            compilers on 64-bit platforms which we use for
+	 *            accumulating products of 64-bit limbs.
+	 */
+	__extension__ typedef unsigned __int128 _uint128_t;
+#endif
+
+	/**
+	 * @brief
+	 *            Low-level function computing the 128-bit result of
+	 *            \f$a\cdot b+c+d\f$ for unsigned 64-bit integers.
+	 *
+	 * @details
+	 *            The result cannot exceed \f$2^{128}-1\f$ and thus
+	 *            always fits into two 64-bit integers.
+	 *
+	 * @param lo
+	 *            On output, the lower 64 bits of the result.
+	 *
+	 * @param a
+	 *            First factor.
+	 *
+	 * @param b
+	 *            Second factor.
 	 *
 	 * @param c
-	 *            After calling the method, the first <i>n+m+1</i> entries of
-	 *            the array contains the product as described in the details.
+	 *            First summand.
+	 *
+	 * @param d
+	 *            Second summand.
+	 *
+	 * @return
+	 *            The upper 64 bits of the result.
+	 */
+	inline static uint64_t mulAdd64
+	( uint64_t & lo , uint64_t a , uint64_t b , uint64_t c , uint64_t d ) {
+
+#ifdef __SIZEOF_INT128__
+		_uint128_t t = (_uint128_t)a * (_uint128_t)b + c + d;
+		lo = (uint64_t)t;
+		return (uint64_t)(t>>64);
+#else
+		// Split the factors into 32-bit halves and combine the four
+		// partial products.
+		uint64_t a0 , a1 , b0 , b1 , p00 , p01 , p10 , p11 , mid , hi;
+		a0 = a & 0xFFFFFFFF; a1 = a >> 32;
+		b0 = b & 0xFFFFFFFF; b1 = b >> 32;
+		p00 = a0*b0; p01 = a0*b1; p10 = a1*b0; p11 = a1*b1;
+		mid = (p00>>32) + (p01&0xFFFFFFFF) + (p10&0xFFFFFFFF);
+		hi = p11 + (p01>>32) + (p10>>32) + (mid>>32);
+		lo = (mid<<32) | (p00&0xFFFFFFFF);
+		lo += c;
+		hi += (lo < c);
+		lo += d;
+		hi += (lo < d);
+		return hi;
+#endif
+	}
+
+	/**
+	 * @brief
+	 *            Low-level function adding two positive integers of
+	 *            <i>n</i> limbs of 64 bits.
+	 *
+	 * @details
+	 *            The array <i>c</i> may be equal to <i>a</i> or
+	 *            <i>b</i>.
+	 *
+	 * @param c
+	 *            On output, the lower <i>n</i> limbs of the sum.
 	 *
 	 * @param a
-	 *            Contains <i>m</i> valid <code>uint32_t</code>s which
-	 *            specifies the first factor.
+	 *            First summand of <i>n</i> limbs.
+	 *
+	 * @param b
+	 *            Second summand of <i>n</i> limbs.
+	 *
+	 * @param n
+	 *            Number of limbs.
+	 *
+	 * @return
+	 *            The carry, i.e., the <i>n</i>th limb of the sum.
+	 */
+	static uint64_t add64
+	( uint64_t *c , const uint64_t *a , const uint64_t *b , int n ) {
+
+		uint64_t carry = 0 , s , t;
+		for ( int i = 0 ; i < n ; i++ ) {
+			s = a[i] + carry;
+			carry = (s < carry);
+			t = s + b[i];
+			carry += (t < s);
+			c[i] = t;
+		}
+		return carry;
+	}
+
+	/**
+	 * @brief
+	 *            Low-level function subtracting two positive integers
+	 *            of <i>n</i> limbs of 64 bits.
+	 *
+	 * @details
+	 *            The array <i>c</i> may be equal to <i>a</i> or
+	 *            <i>b</i>.
+	 *
+	 * @param c
+	 *            On output, the difference <i>a-b</i> modulo
+	 *            \f$2^{64\cdot n}\f$.
+	 *
+	 * @param a
+	 *            Minuend of <i>n</i> limbs.
+	 *
+	 * @param b
+	 *            Subtrahend of <i>n</i> limbs.
+	 *
+	 * @param n
+	 *            Number of limbs.
+	 *
+	 * @return
+	 *            1 if <i>a</i> is smaller than <i>b</i> and 0
+	 *            otherwise.
+	 */
+	static uint64_t sub64
+	( uint64_t *c , const uint64_t *a , const uint64_t *b , int n ) {
+
+		uint64_t borrow = 0 , s , t;
+		for ( int i = 0 ; i < n ; i++ ) {
+			s = a[i] - borrow;
+			borrow = (a[i] < borrow);
+			t = s - b[i];
+			borrow += (s < b[i]);
+			c[i] = t;
+		}
+		return borrow;
+	}
+
+	/**
+	 * @brief
+	 *            Low-level function propagating a carry through a
+	 *            positive integer of <i>n</i> limbs of 64 bits.
+	 *
+	 * @param c
+	 *            The integer to which the carry is added in place.
+	 *
+	 * @param n
+	 *            Number of limbs.
+	 *
+	 * @param carry
+	 *            The carry added to the least significant limb.
+	 *
+	 * @return
+	 *            The carry out of the most significant limb.
+	 */
+	static uint64_t addCarry64( uint64_t *c , int n , uint64_t carry ) {
+
+		for ( int i = 0 ; i < n && carry ; i++ ) {
+			c[i] += carry;
+			carry = (c[i] < carry);
+		}
+		return carry;
+	}
+
+	/**
+	 * @brief
+	 *            Low-level function propagating a borrow through a
+	 *            positive integer of <i>n</i> limbs of 64 bits.
+	 *
+	 * @param c
+	 *            The integer from which the borrow is subtracted in
+	 *            place.
+	 *
+	 * @param n
+	 *            Number of limbs.
+	 *
+	 * @param borrow
+	 *            The borrow subtracted from the least significant limb.
+	 *
+	 * @return
+	 *            The borrow out of the most significant limb.
+	 */
+	static uint64_t subBorrow64( uint64_t *c , int n , uint64_t borrow ) {
+
+		for ( int i = 0 ; i < n && borrow ; i++ ) {
+			uint64_t t = c[i];
+			c[i] = t - borrow;
+			borrow = (t < borrow);
+		}
+		return borrow;
+	}
+
+	/**
+	 * @brief
+	 *            Low-level function adding the product of a positive
+	 *            integer of <i>n</i> limbs of 64 bits and a single limb
+	 *            to an integer of <i>n</i> limbs.
+	 *
+	 * @param c
+	 *            On input, the summand of <i>n</i> limbs; on output,
+	 *            the lower <i>n</i> limbs of \f$c+a\cdot b\f$.
+	 *
+	 * @param a
+	 *            Factor of <i>n</i> limbs.
+	 *
+	 * @param n
+	 *            Number of limbs.
+	 *
+	 * @param b
+	 *            Single limb factor.
+	 *
+	 * @return
+	 *            The <i>n</i>th limb of \f$c+a\cdot b\f$.
+	 */
+	static uint64_t addMul64
+	( uint64_t *c , const uint64_t *a , int n , uint64_t b ) {
+
+		uint64_t carry = 0;
+		for ( int i = 0 ; i < n ; i++ ) {
+			carry = mulAdd64(c[i],a[i],b,c[i],carry);
+		}
+		return carry;
+	}
+
+	/**
+	 * @brief
+	 *            Low-level function computing the product of two
+	 *            positive integers of <i>m</i> and <i>n</i> limbs of
+	 *            64 bits with the schoolbook method.
+	 *
+	 * @param C
+	 *            On output, the <i>m+n</i> limbs of the product; must
+	 *            not overlap with <i>A</i> or <i>B</i>.
+	 *
+	 * @param A
+	 *            First factor of <i>m</i> limbs.
 	 *
 	 * @param m
-	 *            The number of <code>uint32_t</code>s in <i>a</i> that
-	 *            specify the first factor.
+	 *            Number of limbs of the first factor.
+	 *
+	 * @param B
+	 *            Second factor of <i>n</i> limbs.
+	 *
+	 * @param n
+	 *            Number of limbs of the second factor.
+	 */
+	static void plainMul64
+	( uint64_t *C , const uint64_t *A , int m , const uint64_t *B , int n ) {
+
+		memset(C,0,m*sizeof(uint64_t));
+		for ( int j = 0 ; j < n ; j++ ) {
+			C[m+j] = addMul64(C+j,A,m,B[j]);
+		}
+	}
+
+	/**
+	 * @brief
+	 *            Low-level function computing the absolute difference
+	 *            of two positive integers of 64-bit limbs.
+	 *
+	 * @param d
+	 *            On output, the <i>m</i> limbs of \f$|a-b|\f$.
 	 *
 	 * @param a
-	 *            Contains <i>m</i> valid <code>uint32_t</code>s which
-	 *            specifies the second factor.
+	 *            First integer of <i>m</i> limbs.
+	 *
+	 * @param m
+	 *            Number of limbs of the first integer.
+	 *
+	 * @param b
+	 *            Second integer of <i>n</i> limbs.
 	 *
 	 * @param n
-	 *            The number of <code>uint32_t</code>s in <i>b</i> that
-	 *            specify the second factor.
+	 *            Number of limbs of the second integer which must be
+	 *            smaller than or equal to <i>m</i>.
 	 *
-	 * @warning
-	 *            If not sufficient memory could be provided the method
-	 *            prints an error message to <code>stderr</code> and
-	 *            exits with status 'EXIT_FAILURE'.
+	 * @return
+	 *            <code>true</code> if <i>a</i> is smaller than
+	 *            <i>b</i>; otherwise <code>false</code>.
+	 */
+	static bool absDiff64
+	( uint64_t *d , const uint64_t *a , int m , const uint64_t *b , int n ) {
+
+		// Determine which of the two integers is the larger one.
+		int cmp = 0;
+		for ( int i = m-1 ; i >= n && cmp == 0 ; i-- ) {
+			if ( a[i] ) {
+				cmp = 1;
+			}
+		}
+		for ( int i = n-1 ; i >= 0 && cmp == 0 ; i-- ) {
+			if ( a[i] != b[i] ) {
+				cmp = a[i] > b[i] ? 1 : -1;
+			}
+		}
+
+		if ( cmp >= 0 ) {
+			uint64_t borrow = sub64(d,a,b,n);
+			memcpy(d+n,a+n,(m-n)*sizeof(uint64_t));
+			subBorrow64(d+n,m-n,borrow);
+			return false;
+		}
+
+		// Here 'a<b' which implies that the upper 'm-n' limbs of 'a'
+		// are zero.
+		sub64(d,b,a,n);
+		memset(d+n,0,(m-n)*sizeof(uint64_t));
+		return true;
+	}
+
+	/**
+	 * @brief
+	 *            Low-level function computing the product of two
+	 *            positive integers of 64-bit limbs with Karatsuba's
+	 *            method.
+	 *
+	 * @details
+	 *            If both factors have at least
+	 *            <code>_KARATSUBA_THRESHOLD</code> limbs and are of
+	 *            similar length, they are split into halves
+	 *            \f$A=A_0+2^{64h}A_1\f$ and \f$B=B_0+2^{64h}B_1\f$
+	 *            and the product is obtained from the three products
+	 *            \f$A_0B_0\f$, \f$A_1B_1\f$ and
+	 *            \f$|A_0-A_1|\cdot|B_0-B_1|\f$. Using the absolute
+	 *            differences rather than the sums keeps the middle
+	 *            product within <i>2h</i> limbs. If one factor is much
+	 *            shorter than the other, the longer one is cut into
+	 *            pieces as long as the shorter one. Products where one
+	 *            factor is shorter than <code>_KARATSUBA_THRESHOLD</code>
+	 *            limbs are computed with the schoolbook method.
+	 *
+	 * @param C
+	 *            On output, the <i>m+n</i> limbs of the product.
+	 *
+	 * @param A
+	 *            First factor of <i>m</i> limbs.
+	 *
+	 * @param m
+	 *            Number of limbs of the first factor.
+	 *
+	 * @param B
+	 *            Second factor of <i>n</i> limbs.
+	 *
+	 * @param n
+	 *            Number of limbs of the second factor.
+	 *
+	 * @param T
+	 *            Scratch space of at least <i>8(m+n)+64</i> limbs.
 	 *
 	 * @warning
-	 *            In the following cases the behavior of the function is
+	 *            If <i>C</i> or <i>T</i> overlaps with any of the
+	 *            other arrays, the behavior of the function is
 	 *            undocumented.
-	 *            <ul>
-	 *             <li>
-	 *             If <i>a</i> or <i>b</i> do not contain at least <i>m</i>
-	 *             or <i>n</i> valid <code>uint32_t</code>s.
-	 *             </li>
-	 *             <li>
-	 *              If <i>c</i> was not allocated successfully to store at
-	 *              least <i>m+n+1</i> unsigned 32-bit integers.
-	 *             </li>
-	 *             <li>
-	 *              If <i>c</i>, <i>a</i>, or <i>b</i> overlap/cross their
-	 *              first <i>n+m</i>, <i>m</i>, or <i>n</i> elements,
-	 *              respectively, in particula, if they are not pairwise
-	 *              distinct.
-	 *             </li>
-	 *            </ul>
 	 */
-	static void mul
-	( register uint32_t *c ,
-	  register uint32_t *a , register int m ,
-	  register uint32_t *b , register int n ) {
+	static void karatsubaMul64
+	( uint64_t *C ,
+	  const uint64_t *A , int m ,
+	  const uint64_t *B , int n , uint64_t *T ) {
 
-		register uint32_t *tmp;
-		register int i;
+		if ( m < n ) {
+			karatsubaMul64(C,B,n,A,m,T);
+			return;
+		}
 
-		// Allocate a temporary array that can hold 'm+1' unsigned 32-bit
-		// integers
-		if ( (tmp=(uint32_t*)malloc((m+1)*sizeof(uint32_t))) == NULL ) {
-			cerr << "BigInteger::mul: Out of memory." << endl;
-			exit(EXIT_FAILURE);
+		if ( n < _KARATSUBA_THRESHOLD ) {
+			plainMul64(C,A,m,B,n);
+			return;
 		}
 
-		// Initialize the output array 'c' by' zeros
-		memset(c,0,(m+n+1)*sizeof(uint32_t));
+		int h = (m+1)/2;
+
+		if ( n <= h ) {
 
-		// The following is an implementation of the traditional multiplication
-		// scheme we learned in school with intensively use of pointer
-		// arithmetic.
-		b += n-1;
-		c += n-1;
-		for ( i = n-1 ; i >= 0 ; i-- , b-- , c-- ) {
-			tmp[m] = mul(tmp,a,*b,m);
-			c[m+1] += add(c,c,m+1,tmp,m+1);
+			// *** BEGIN: unbalanced product ***
+			// Multiply pieces of 'A' of 'n' limbs by 'B' and accumulate.
+			memset(C,0,(m+n)*sizeof(uint64_t));
+			for ( int i = 0 ; i < m ; i += n ) {
+				int l = std::min(n,m-i);
+				karatsubaMul64(T,A+i,l,B,n,T+l+n);
+				uint64_t carry = add64(C+i,C+i,T,l+n);
+				addCarry64(C+i+l+n,m-i-l,carry);
+			}
+			return;
+			// *** END: unbalanced product ***
+		}
+
+		// Lengths of the upper halves
+		int ma , nb;
+		ma = m-h;
+		nb = n-h;
+
+		// C = A0*B0 + 2^(128h)*A1*B1
+		karatsubaMul64(C,A,h,B,h,T);
+		karatsubaMul64(C+2*h,A+h,ma,B+h,nb,T);
+
+		// T[0..2h) = |A0-A1|,|B0-B1| and T[2h..4h) = |A0-A1|*|B0-B1|
+		bool negA = absDiff64(T,A,h,A+h,ma);
+		bool negB = absDiff64(T+h,B,h,B+h,nb);
+		karatsubaMul64(T+2*h,T,h,T+h,h,T+4*h);
+
+		// M = A0*B0 + A1*B1 -/+ |A0-A1|*|B0-B1| = A0*B1 + A1*B0
+		uint64_t *M = T+4*h;
+		int l2 = ma+nb;
+		memcpy(M,C,2*h*sizeof(uint64_t));
+		M[2*h] = addCarry64(M+l2,2*h-l2,add64(M,M,C+2*h,l2));
+		if ( negA != negB ) {
+			M[2*h] += add64(M,M,T+2*h,2*h);
+		} else {
+			M[2*h] -= sub64(M,M,T+2*h,2*h);
 		}
 
-		// Free temporary memory
-		free(tmp);
+		// C += 2^(64h)*M
+		int l = std::min(2*h+1,m+n-h);
+		uint64_t carry = add64(C+h,C+h,M,l);
+		addCarry64(C+h+l,m+n-h-l,carry);
 	}
 
 	/*
@@ -1382,14 +1729,6 @@ namespace thimble {
 	void BigInteger::leftShift
 	( BigInteger & a , const BigInteger & b , int n ) {
 
-		// If output and input are of same reference, it is necessary to
-		// compute the left shift of a copy.
-		if ( &a == &b ) {
-			BigInteger tb = b;
-			leftShift(a,tb,n);
-			return;
-		}
-
 		// If the specified bit positions is negative, the left shift
 		// is interpreted as a right shift.
 		if ( n < 0 ) {
@@ -1397,37 +1736,38 @@ namespace thimble {
 			return;
 		}
 
-		// Backup of the sign.
+		// Backup of the sign and the length; note that 'a' and 'b' may
+		// be of the same reference.
 		int s = b.sign();
+		int l = b.getNumWords();
 
 		// Left shift by 'n=k*32+m' bits have to be performed.
 		int k , m;
 		k = n/32L;
 		m = n%32L;
 
-		// Temporarily, let 'a' be of as many zero words which suffice to
-		// hold the result; we will normalize later.
-		a.clear();
-		a.ensureCapacity(k+b.getNumWords()+1);
-		a.size =  k+b.getNumWords()+1;
+		// Ensure 'a' can hold the shifted words. If 'a' and 'b' are of
+		// the same reference, the words of 'b' are kept.
+		a.ensureCapacity(k+l+1);
 
-		// The first 'k' coefficients, which are 32-bit words, of 'a' will be
-		// zero because 'k' is the proportion of whole 32 shift bit positions;
-		// thus, it suffices to compute the coefficients of the output which
-		// are at index >='k'.
-		for ( int i = b.getNumWords() - 1 ; i >= 0 ; i-- ) {
+		// The words are processed from the most significant to the
+		// least significant one such that each word of 'b' is read
+		// before it can be overwritten in case 'a' and 'b' are equal.
+		a.data[k+l] = m ? (b.data[l-1]>>(32-m)) : 0;
+		for ( int i = l-1 ; i > 0 ; i-- ) {
+			a.data[k+i] = (b.data[i]<<m) | (m ? (b.data[i-1]>>(32-m)) : 0);
+		}
+		a.data[k] = b.data[0]<<m;
 
-			// The first '32-m' bits of the current coefficient will be
-			// stored in 'u'...
-			uint64_t u = (uint64_t)b.data[i];
-			u <<= m;
+		// The first 'k' coefficients, which are 32-bit words, of 'a' will be
+		// zero because 'k' is the proportion of whole 32 shift bit positions.
+		memset(a.data,0,k*sizeof(uint32_t));
 
-			// ... and be combined with the last 'm' bits.
-			a.data[k+i+1] |= (u>>32);
-			a.data[k+i] |= (u&0xFFFFFFFF);
-		}
+		// Clear the words that are not relevant.
+		memset(a.data+k+l+1,0,(a.capacity-k-l-1)*sizeof(uint32_t));
 
 		// There is no harm in normalizing the shift.
+		a.size = k+l+1;
 		a.normalize();
 
 		// Adopt the backuped sign.
@@ -1447,14 +1787,6 @@ namespace thimble {
 	void BigInteger::rightShift
 	( BigInteger & a , const BigInteger & b , int n ) {
 
-		// If output and input are of same reference, it is necessary to
-		// compute the right shift of a copy.
-		if ( &a == &b ) {
-			BigInteger tb = b;
-			rightShift(a,tb,n);
-			return;
-		}
-
 		// If the specified bit positions is negative, the right shift
 		// is interpreted as a left shift.
 		if ( n < 0 ) {
@@ -1462,7 +1794,8 @@ namespace thimble {
 			return;
 		}
 
-		// Backup of the sign.
+		// Backup of the sign; note that 'a' and 'b' may be of the same
+		// reference.
 		int s = b.sign();
 
 		// Length of unsigned 32-bit integers needed to represent the absolute
@@ -1474,22 +1807,31 @@ namespace thimble {
 		k = n/32L;
 		m = n%32L;
 
-		// Temporarily, let 'a' be of as many zero words which suffice to
-		// hold the result; we will normalize later.
-		a.clear();
+		// All bits are shifted out.
+		if ( k >= blen ) {
+			a.clear();
+			return;
+		}
+
 		a.ensureCapacity(blen-k);
-		a.size = blen-k;
 
-		// Adopt the right-shifted bits by computing the 'k' coefficients
-		// of the result.
+		// Adopt the right-shifted bits by computing the 'blen-k' coefficients
+		// of the result. The words are processed from the least significant
+		// to the most significant one such that each word of 'b' is read
+		// before it can be overwritten in case 'a' and 'b' are equal.
 		for ( int i = k ; i < blen ; i++ ) {
-			a.data[i-k] = (b.data[i]>>m);
-			if ( i+1 < blen ) {
-				a.data[i-k] += (b.data[i+1]&((1<<m)-1))<<(32-m);
+			uint32_t w = (b.data[i]>>m);
+			if ( m && i+1 < blen ) {
+				w |= b.data[i+1]<<(32-m);
 			}
+			a.data[i-k] = w;
 		}
 
+		// Clear the words that are no longer relevant.
+		memset(a.data+blen-k,0,(a.capacity-blen+k)*sizeof(uint32_t));
+
 		// There is no harm in normalizing the shift.
+		a.size = blen-k;
 		a.normalize();
 
 		// Adopt the backuped sign.
@@ -1614,6 +1956,10 @@ namespace thimble {
 					negate(c,c);
 				}
 
+			} else {
+				// If both summands are equal in its absolute size but of
+				// different sign, the sum is zero.
+				c.clear();
 			}
 		}
 	}
@@ -1716,8 +2062,7 @@ namespace thimble {
 
 			// Use the low-level function to compute the sum. The 'l-1'th
 			// coefficient can be both, zero and non-zero. Therefore, ...
-			c.data[l-1] = thimble::add
-				(c.data,a.data,a.getNumWords(),b.data,b.getNumWords());
+			c.data[l-1] = thimble::add(c.data,a.data,m,b.data,n);
 
 			// ..., we normalize the sum.
 			c.normalize();
@@ -1729,6 +2074,146 @@ namespace thimble {
 		}
 	}
 
+	/**
+	 * @brief
+	 *            Computes the product of the absolute values of two big
+	 *            integers of similar length with the Toom-Cook method
+	 *            (Toom-3).
+	 *
+	 * @details
+	 *            The absolute values are split into three pieces of
+	 *            <i>k</i> words each, i.e.,
+	 *            \f$|a|=a_0+a_1X+a_2X^2\f$ and
+	 *            \f$|b|=b_0+b_1X+b_2X^2\f$ where
+	 *            \f$X=2^{32\cdot k}\f$. The product polynomial is
+	 *            evaluated at the points \f$0,1,-1,-2\f$, and
+	 *            \f$\infty\f$ using five multiplications of integers
+	 *            of about <i>k</i> words and interpolated with the
+	 *            sequence of exact divisions proposed by Bodrato:
+	 *            <ul>
+	 *             <li>
+	 *              <b>M. Bodrato and A. Zanoni (2007)</b>. What about
+	 *              Toom-Cook matrices optimality? <i>Technical report,
+	 *              Centro "Vito Volterra", Universit&agrave; di Roma
+	 *              "Tor Vergata"</i>.
+	 *             </li>
+	 *            </ul>
+	 *            The five products are computed via
+	 *            \link BigInteger::mul()\endlink such that they are
+	 *            recursively computed with the Toom-Cook method if they
+	 *            are still large enough.
+	 *
+	 * @param c
+	 *            On output, the product \f$|a|\cdot|b|\f$; may be of
+	 *            the same reference as <i>a</i> or <i>b</i>.
+	 *
+	 * @param a
+	 *            First factor.
+	 *
+	 * @param b
+	 *            Second factor.
+	 *
+	 * @warning
+	 *            If not sufficient memory could be allocated, the
+	 *            method prints an error message to <code>stderr</code>
+	 *            and exits with status 'EXIT_FAILURE'.
+	 */
+	static void toom3Mul
+	( BigInteger & c , const BigInteger & a , const BigInteger & b ) {
+
+		int k = (std::max(a.getNumWords(),b.getNumWords())+2)/3;
+		int s = 32*k;
+
+		// *** BEGIN: split the absolute values into three pieces ***
+		BigInteger a0 , a1 , a2 , b0 , b1 , b2 , t;
+
+		BigInteger::abs(a0,a);
+		BigInteger::rightShift(a1,a0,s);
+		BigInteger::rightShift(a2,a1,s);
+		BigInteger::leftShift(t,a1,s);
+		BigInteger::sub(a0,a0,t);
+		BigInteger::leftShift(t,a2,s);
+		BigInteger::sub(a1,a1,t);
+
+		BigInteger::abs(b0,b);
+		BigInteger::rightShift(b1,b0,s);
+		BigInteger::rightShift(b2,b1,s);
+		BigInteger::leftShift(t,b1,s);
+		BigInteger::sub(b0,b0,t);
+		BigInteger::leftShift(t,b2,s);
+		BigInteger::sub(b1,b1,t);
+		// *** END: split the absolute values into three pieces ***
+
+		// *** BEGIN: evaluation ***
+		BigInteger p1 , pm1 , pm2 , q1 , qm1 , qm2;
+
+		// p(1) = a0+a1+a2 , p(-1) = a0-a1+a2 , p(-2) = 2*(p(-1)+a2)-a0
+		BigInteger::add(t,a0,a2);
+		BigInteger::add(p1,t,a1);
+		BigInteger::sub(pm1,t,a1);
+		BigInteger::add(pm2,pm1,a2);
+		BigInteger::leftShift(pm2,pm2,1);
+		BigInteger::sub(pm2,pm2,a0);
+
+		// Same for the second factor
+		BigInteger::add(t,b0,b2);
+		BigInteger::add(q1,t,b1);
+		BigInteger::sub(qm1,t,b1);
+		BigInteger::add(qm2,qm1,b2);
+		BigInteger::leftShift(qm2,qm2,1);
+		BigInteger::sub(qm2,qm2,b0);
+		// *** END: evaluation ***
+
+		// *** BEGIN: pointwise multiplication ***
+		BigInteger r0 , r1 , rm1 , rm2 , rinf;
+		BigInteger::mul(r0,a0,b0);
+		BigInteger::mul(r1,p1,q1);
+		BigInteger::mul(rm1,pm1,qm1);
+		BigInteger::mul(rm2,pm2,qm2);
+		BigInteger::mul(rinf,a2,b2);
+		// *** END: pointwise multiplication ***
+
+		// *** BEGIN: interpolation ***
+		BigInteger r2 , r3 , three(3);
+
+		// r3 = (r(-2)-r(1))/3
+		BigInteger::sub(r3,rm2,r1);
+		BigInteger::div(r3,r3,three);
+
+		// r1 = (r(1)-r(-1))/2
+		BigInteger::sub(r1,r1,rm1);
+		BigInteger::rightShift(r1,r1,1);
+
+		// r2 = r(-1)-r(0)
+		BigInteger::sub(r2,rm1,r0);
+
+		// r3 = (r2-r3)/2+2*r(inf)
+		BigInteger::sub(r3,r2,r3);
+		BigInteger::rightShift(r3,r3,1);
+		BigInteger::leftShift(t,rinf,1);
+		BigInteger::add(r3,r3,t);
+
+		// r2 = r2+r1-r(inf)
+		BigInteger::add(r2,r2,r1);
+		BigInteger::sub(r2,r2,rinf);
+
+		// r1 = r1-r3
+		BigInteger::sub(r1,r1,r3);
+		// *** END: interpolation ***
+
+		// *** BEGIN: recomposition ***
+		// c = (((r(inf)*X+r3)*X+r2)*X+r1)*X+r(0)
+		BigInteger::leftShift(t,rinf,s);
+		BigInteger::add(t,t,r3);
+		BigInteger::leftShift(t,t,s);
+		BigInteger::add(t,t,r2);
+		BigInteger::leftShift(t,t,s);
+		BigInteger::add(t,t,r1);
+		BigInteger::leftShift(t,t,s);
+		BigInteger::add(c,t,r0);
+		// *** END: recomposition ***
+	}
+
 	/**
 	 * @brief
 	 *            Computes the product of two big integers.
@@ -1739,39 +2224,238 @@ namespace thimble {
 	void BigInteger::mul
 	( BigInteger & c , const BigInteger & a , const BigInteger & b ) {
 
-		// To use the low-level function
-		// 'mul(uint32_t*,uint32_t*,int,uint32_t*,int)' the three arrays must
-		// not be equal or overlap. Thus, we make copies if there are equal
-		// references in which case we recursively call the method.
-		if ( &c == &a ) {
-			BigInteger ta = a;
-			mul(c,ta,b);
+		// The sign of the ouput.
+		int s = a.sign()*b.sign();
+
+		if ( s == 0 ) {
+			c.clear();
 			return;
-		} else if ( &c == &b ) {
-			BigInteger tb = b;
-			mul(c,a,tb);
+		}
+
+		int mw , nw;
+		mw = a.getNumWords();
+		nw = b.getNumWords();
+
+		// Large factors of similar length are multiplied with the
+		// Toom-Cook method.
+		if ( std::min(mw,nw) >= _TOOM3_THRESHOLD &&
+			 2*std::min(mw,nw) > std::max(mw,nw) ) {
+			toom3Mul(c,a,b);
+			if ( s < 0 ) {
+				negate(c,c);
+			}
 			return;
 		}
 
-		// The sign of the ouput.
-		int s = a.sign()*b.sign();
+		// Number of 64-bit limbs of the factors.
+		int m , n;
+		m = (mw+1)/2;
+		n = (nw+1)/2;
+
+		// Small products are computed in buffers on the stack; otherwise,
+		// the buffers are allocated on the heap.
+		uint64_t buf[20*_KARATSUBA_THRESHOLD];
+		uint64_t *A , *B , *C , *T;
+		bool onHeap = (size_t)(10*(m+n)+64) > sizeof(buf)/sizeof(uint64_t);
+		if ( onHeap ) {
+			A = (uint64_t*)malloc((10*(m+n)+64)*sizeof(uint64_t));
+			if ( A == NULL ) {
+				cerr << "BigInteger::mul: Out of memory." << endl;
+				exit(EXIT_FAILURE);
+			}
+		} else {
+			A = buf;
+		}
+		B = A+m;
+		C = B+n;
+		T = C+m+n;
+
+		// Pack the 32-bit words of the factors into 64-bit limbs. Because
+		// the factors are copied, 'c' is allowed to be of the same
+		// reference as 'a' or 'b'.
+		for ( int i = 0 ; i < mw ; i += 2 ) {
+			A[i/2] = (uint64_t)a.data[i] |
+					(i+1 < mw ? ((uint64_t)a.data[i+1])<<32 : 0);
+		}
+		for ( int i = 0 ; i < nw ; i += 2 ) {
+			B[i/2] = (uint64_t)b.data[i] |
+					(i+1 < nw ? ((uint64_t)b.data[i+1])<<32 : 0);
+		}
+
+		karatsubaMul64(C,A,m,B,n,T);
 
 		// Temporarily, let the size of the output be such that it can
 		// hold the product in any case. We will normalize later.
-		c.clear();
-		c.ensureCapacity(a.getNumWords()+b.getNumWords()+1);
-		c.size = a.getNumWords()+b.getNumWords()+1;
+		c.ensureCapacity(2*(m+n));
+		for ( int i = 0 ; i < m+n ; i++ ) {
+			c.data[2*i] = (uint32_t)(C[i]&0xFFFFFFFF);
+			c.data[2*i+1] = (uint32_t)(C[i]>>32);
+		}
+		memset(c.data+2*(m+n),0,(c.capacity-2*(m+n))*sizeof(uint32_t));
+		c.size = 2*(m+n);
 
-		// Call of low-level function.
-		thimble::mul(c.data,a.data,a.getNumWords(),b.data,b.getNumWords());
+		if ( onHeap ) {
+			free(A);
+		}
 
-		// The leading 'l-1'th coefficient can be zero.
-		// Thus we must normalize.
+		// The leading coefficients can be zero. Thus we must normalize.
 		c.normalize();
 
 		// Adopt the sign.
 		if ( s < 0 ) {
-			negate(c,c);
+			c.size = -c.size;
+		}
+	}
+
+	/**
+	 * @brief
+	 *            Computes an approximation of the reciprocal of a positive
+	 *            big integer via Newton iteration.
+	 *
+	 * @details
+	 *            Let <i>l</i> be the number of bits of <i>b</i>. The
+	 *            function computes <i>x</i> such that
+	 *            \f[
+	 *             x\approx\frac{2^{l+k}}{b}
+	 *            \f]
+	 *            up to an error of a few units. Only the leading
+	 *            \f$k+64\f$ bits of <i>b</i> are taken into account. An
+	 *            approximation of half the precision is computed
+	 *            recursively and refined by a Newton step
+	 *            \f$x\leftarrow y+y\cdot(1-by)\f$ (suitably scaled) which
+	 *            doubles the number of correct bits. Thus, the cost of
+	 *            the computation is dominated by the multiplications
+	 *            of the last Newton step.
+	 *
+	 * @param x
+	 *            On output, the approximation of the reciprocal.
+	 *
+	 * @param b
+	 *            Positive integer.
+	 *
+	 * @param k
+	 *            Precision in bits.
+	 *
+	 * @warning
+	 *            If not sufficient memory could be allocated, the
+	 *            method prints an error message to <code>stderr</code>
+	 *            and exits with status 'EXIT_FAILURE'.
+	 */
+	static void reciprocal( BigInteger & x , const BigInteger & b , int k ) {
+
+		// Number of guard bits
+		const int g = 32;
+
+		int l = b.numBits();
+
+		// Only the leading 'k+2g' bits of 'b' are relevant.
+		if ( l > k+2*g ) {
+			BigInteger bt;
+			BigInteger::rightShift(bt,b,l-k-2*g);
+			reciprocal(x,bt,k);
+			return;
+		}
+
+		// For small precision, the reciprocal is computed via long division.
+		if ( k <= 16*_NEWTON_THRESHOLD ) {
+			BigInteger::leftShift(x,1,l+k);
+			BigInteger::div(x,x,b);
+			return;
+		}
+
+		// y = 2^(l+h)/b
+		int h = k/2+g;
+		BigInteger y , e , t;
+		reciprocal(y,b,h);
+
+		// e = 2^(l+h)-b*y
+		BigInteger::mul(t,b,y);
+		BigInteger::leftShift(e,1,l+h);
+		BigInteger::sub(e,e,t);
+
+		// x = y*2^(k-h)+y*e/2^(l+2h-k)
+		BigInteger::mul(t,y,e);
+		BigInteger::rightShift(t,t,l+2*h-k);
+		BigInteger::leftShift(x,y,k-h);
+		BigInteger::add(x,x,t);
+	}
+
+	/**
+	 * @brief
+	 *            Computes the quotient and remainder of the absolute values
+	 *            of two big integers using an approximation of the
+	 *            reciprocal of the denominator.
+	 *
+	 * @details
+	 *            An approximation of the quotient is obtained by
+	 *            multiplying the leading bits of <i>|a|</i> with an
+	 *            approximation of the reciprocal of <i>|b|</i> as computed
+	 *            by <code>reciprocal()</code>. The approximation differs
+	 *            from the true quotient only by a few units which is
+	 *            corrected afterwards. Consequently, the cost of the
+	 *            division is a small multiple of the cost of a
+	 *            multiplication.
+	 *
+	 * @param q
+	 *            On output, \f$\lfloor|a|/|b|\rfloor\f$.
+	 *
+	 * @param r
+	 *            On output, \f$|a|-q\cdot|b|\f$.
+	 *
+	 * @param a
+	 *            Numerator whose absolute value is not smaller than the
+	 *            absolute value of <i>b</i>.
+	 *
+	 * @param b
+	 *            Non-zero denominator.
+	 *
+	 * @warning
+	 *            If not sufficient memory could be allocated, the
+	 *            method prints an error message to <code>stderr</code>
+	 *            and exits with status 'EXIT_FAILURE'.
+	 */
+	static void newtonDivRem
+	( BigInteger & q , BigInteger & r ,
+	  const BigInteger & a , const BigInteger & b ) {
+
+		// Number of guard bits
+		const int g = 32;
+
+		BigInteger u , v , x , t;
+		BigInteger::abs(u,a);
+		BigInteger::abs(v,b);
+
+		int la , lb , k , s;
+		la = u.numBits();
+		lb = v.numBits();
+
+		// The quotient has at most 'la-lb+1' bits.
+		k = la-lb+g;
+
+		// x = 2^(lb+k)/v
+		reciprocal(x,v,k);
+
+		// Only the leading bits of 'u' are relevant: The truncation
+		// changes the approximated quotient by less than one.
+		s = std::max(0,lb-2);
+
+		// q = (u/2^s)*x/2^(lb+k-s)
+		BigInteger::rightShift(t,u,s);
+		BigInteger::mul(q,t,x);
+		BigInteger::rightShift(q,q,lb+k-s);
+
+		// r = u-q*v
+		BigInteger::mul(t,q,v);
+		BigInteger::sub(r,u,t);
+
+		// Correct the approximation.
+		while ( r.sign() < 0 ) {
+			BigInteger::sub(q,q,1);
+			BigInteger::add(r,r,v);
+		}
+		while ( BigInteger::compare(r,v) >= 0 ) {
+			BigInteger::add(q,q,1);
+			BigInteger::sub(r,r,v);
 		}
 	}
 
@@ -1789,8 +2473,14 @@ namespace thimble {
 		if ( b.isZero() ) {
 			cerr << __FILE__ << "(" << __LINE__ << "): Division by zero." << endl;
 			exit(EXIT_FAILURE);
-		} if ( a.sign() > 0 && b.sign() > 0 && a.getNumWords() < b.getNumWords() ) {
-			c.clear();
+		} else if ( absCompare(a,b) < 0 ) {
+			// If the absolute value of the quotient is smaller than one,
+			// the quotient is -1 if it is negative and 0 otherwise.
+			if ( a.sign()*b.sign() < 0 ) {
+				c = -1;
+			} else {
+				c.clear();
+			}
 			return;
 		} else if ( b.getNumWords() == 1 ) {
 			BigInteger ta , tb;
@@ -1807,6 +2497,27 @@ namespace thimble {
 		// Sign of the quotient.
 		int s = a.sign() * b.sign();
 
+		// If both, denominator and quotient, are large, the quotient is
+		// computed from an approximation of the reciprocal of the
+		// denominator.
+		if ( n >= _NEWTON_THRESHOLD && m >= _NEWTON_THRESHOLD ) {
+
+			BigInteger r;
+			newtonDivRem(c,r,a,b);
+
+			if ( s < 0 ) {
+				// Because we want the quotient to be the floor of 'a/b',
+				// we increment the absolute value of the quotient if the
+				// remainder is non-zero.
+				if ( !r.isZero() ) {
+					add(c,c,1);
+				}
+				negate(c,c);
+			}
+
+			return;
+		}
+
 		// Using the low-level function
 		// 'div(uint32_t*,uint32_t*,uint32_t*,int,int)' modifies the input
 		// arrays. Thus, we must make of copy of the data of 'a' and 'b'
@@ -1958,6 +2669,59 @@ namespace thimble {
         }
 	}
 
+	/**
+	 * @brief
+	 *            Computes the product of all integers in a range using a
+	 *            product tree.
+	 *
+	 * @details
+	 *            The range is recursively split into halves such that
+	 *            the factors of each multiplication are of similar length
+	 *            which benefits from the fast multiplication methods.
+	 *            Consecutive integers whose product fits into 32 bits
+	 *            are multiplied as primitive integers.
+	 *
+	 * @param c
+	 *            On output, the product \f$lo\cdot(lo+1)\cdots hi\f$ or
+	 *            1 if <i>lo&gt;hi</i>.
+	 *
+	 * @param lo
+	 *            Smallest factor; must be positive.
+	 *
+	 * @param hi
+	 *            Largest factor.
+	 *
+	 * @warning
+	 *            If not sufficient memory could be allocated, the
+	 *            method prints an error message to <code>stderr</code>
+	 *            and exits with status 'EXIT_FAILURE'.
+	 */
+	static void rangeProduct( BigInteger & c , uint32_t lo , uint32_t hi ) {
+
+		if ( hi < lo + 16 ) {
+
+			c = 1;
+			uint64_t acc = 1;
+			for ( uint64_t i = lo ; i <= hi ; i++ ) {
+				if ( acc * i > (uint64_t)0xFFFFFFFF ) {
+					BigInteger::mul(c,c,(int64_t)acc);
+					acc = 1;
+				}
+				acc *= i;
+			}
+			BigInteger::mul(c,c,(int64_t)acc);
+
+			return;
+		}
+
+		uint32_t mid = lo + (hi-lo)/2;
+
+		BigInteger a , b;
+		rangeProduct(a,lo,mid);
+		rangeProduct(b,mid+1,hi);
+		BigInteger::mul(c,a,b);
+	}
+
 	/**
 	 * @brief
 	 *            Computes the factorial of an integer as a big integer.
@@ -1974,18 +2738,8 @@ namespace thimble {
 			exit(EXIT_FAILURE);
 		}
 
-		BigInteger a , b , c;
-
-		a.data[0] = 1;
-		for ( int i = 1 ; i <= n ; i++ ) {
-
-			// b = a*i;
-			c.data[0] = i;
-			mul(b,a,c);
-
-			// a<->b such that 'a<-a*i'
-			a.swap(b);
-		}
+		BigInteger a;
+		rangeProduct(a,1,n);
 
 		return a;
 	}
@@ -2018,26 +2772,18 @@ namespace thimble {
 			return binomial(n,n-k);
 		}
 
-		BigInteger num(1) , den(1) , tmp1 , tmp2;
+		BigInteger num , den;
 
-		// num = (n+1-1)*(n+1-2)*...*(n+1-k)
-		for ( int j = 1 ; j <= k ; j++ ) {
-			tmp1.data[0] = n+1-j;
-			mul(tmp2,num,tmp1);
-			num.swap(tmp2);
-		}
+		// num = (n+1-k)*(n+2-k)*...*n
+		rangeProduct(num,n+1-k,n);
 
 		// den = 1*2*...*k
-		for ( int j = 1 ; j <= k ; j++ ) {
-			tmp1.data[0] = j;
-			mul(tmp2,den,tmp1);
-			den.swap(tmp2);
-		}
+		rangeProduct(den,1,k);
 
-		// tmp1=\left({n\atop k}\right) = \prod_{j=1}^k (n+1-j)/j
-		div(tmp1,num,den);
+		// num=\left({n\atop k}\right) = \prod_{j=1}^k (n+1-j)/j
+		div(num,num,den);
 
-		return tmp1;
+		return num;
 	}
 
 	/**
@@ -588,62 +588,395 @@ namespace thimble {
 
     /**
      * @brief
-     *            Makes the matrix an upper triangular matrix using
-     *            elementary row and column operations.
+     *            Maximal number of columns that are processed at once by
+     *            the method of the Four Russians.
+     *
+     * @details
+     *            For each block of columns, a table of
+     *            \f$2^{\_M4RI\_K}\f$ row combinations is built; with the
+     *            value 8, the table for a row of a few thousand columns
+     *            still fits into the level-2 cache.
+     */
+    static const int _M4RI_K = 8;
+
+    /**
+     * @brief
+     *            Computes the (reduced) row echelon form of a binary matrix
+     *            whose rows are packed into 64-bit words.
+     *
+     * @details
+     *            The <i>i</i>th row is stored by
+     *            <code>A[i*W+0],...,A[i*W+W-1]</code> where the entry at
+     *            column <i>j</i> is bit <i>j%64</i> of word <i>j/64</i>.
+     *
+     *            The columns are processed in blocks of at
+     *            most \link _M4RI_K\endlink columns. In each block, pivots
+     *            are searched row by row where a candidate row is first
+     *            reduced by the pivot rows of the block found so far; the
+     *            pivot rows of the block are kept reduced among each other.
+     *            Then a table of all sums of the pivot rows is built and
+     *            each further row is cleared at the block's pivot columns
+     *            by adding one table entry.
+     *
+     * @param A
+     *            The packed matrix; on output its (reduced) row echelon
+     *            form.
+     *
+     * @param m
+     *            Number of rows.
+     *
+     * @param n
+     *            Number of columns.
+     *
+     * @param W
+     *            Number of 64-bit words per row.
+     *
+     * @param pivots
+     *            If not <code>NULL</code>, will contain the pivot
+     *            columns.
+     *
+     * @param reduced
+     *            Whether the rows above a pivot are cleared, too.
      *
      * @return
      *            The rank of the matrix.
+     *
+     * @warning
+     *            If not enough memory could be provided, an error
+     *            message is printed to <code>stderr</code> and the
+     *            program exits with status 'EXIT_FAILURE'.
      */
-    int BinaryMatrix::gauss() {
+    static int m4ri
+    ( uint64_t *A , int m , int n , int W , int *pivots , bool reduced ) {
+
+        uint64_t *T = (uint64_t*)malloc
+                ( ((size_t)1<<_M4RI_K) * (W>0?W:1) * sizeof(uint64_t) );
+        if ( T == NULL ) {
+            cerr << "BinaryMatrix::rowEchelon: out of memory." << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        int r = 0;
+        for ( int c = 0 ; c < n && r < m ; c += _M4RI_K ) {
+
+            int k = min(_M4RI_K,n-c);
+
+            // Rows of index 'r' and higher are zero left of column 'c';
+            // thus, row operations can start at word 'w0'.
+            int w0 = c/64;
+            int L = W-w0;
+
+            // Find the pivots of the current block
+            int pc[_M4RI_K];
+            int kk = 0;
+            for ( int col = c ; col < c+k && r+kk < m ; col++ ) {
 
-        int n;
-        n = min(numRows(),numCols());
+                int w = col/64;
+                uint64_t bit = ((uint64_t)1) << (col%64);
 
-        int k;
-        for ( k = 0 ; k < n ; k++ ) {
+                int i0 = -1;
+                for ( int i = r+kk ; i < m ; i++ ) {
 
-            bool p = false;
+                    uint64_t *row = A + (size_t)i*W;
 
-            // Attempt to find a pivot element.
-            int i0 = k , j0 = k;
-            for ( int j = k ; j < numCols() ; j++ ) {
-                for ( int i = k ; i < numRows() ; i++ ) {
-                    if ( getAt(i,j) ) { // Found a pivot
-                        p = true;
+                    // Reduce the candidate by the pivots found so far
+                    for ( int t = 0 ; t < kk ; t++ ) {
+                        if ( (row[pc[t]/64] >> (pc[t]%64)) & 0x1 ) {
+                            MathTools::mxor64
+                            (row+w0,row+w0,A+(size_t)(r+t)*W+w0,L);
+                        }
+                    }
+
+                    if ( row[w] & bit ) {
                         i0 = i;
-                        j0 = j;
                         break;
                     }
                 }
-                if ( p ) {
-                    break;
+
+                if ( i0 < 0 ) {
+                    continue;
+                }
+
+                uint64_t *prow = A + (size_t)(r+kk)*W;
+                if ( i0 != r+kk ) {
+                    uint64_t *row = A + (size_t)i0*W;
+                    for ( int l = w0 ; l < W ; l++ ) {
+                        uint64_t tmp = row[l];
+                        row[l] = prow[l];
+                        prow[l] = tmp;
+                    }
+                }
+
+                // Keep the pivot rows of the block reduced among each other
+                for ( int t = 0 ; t < kk ; t++ ) {
+                    uint64_t *row = A + (size_t)(r+t)*W;
+                    if ( row[w] & bit ) {
+                        MathTools::mxor64(row+w0,row+w0,prow+w0,L);
+                    }
+                }
+
+                pc[kk++] = col;
+            }
+
+            if ( kk == 0 ) {
+                continue;
+            }
+
+            // Table of all sums of the block's pivot rows; the entry
+            // 'idx' is the sum of the rows 'r+t' where bit 't' of 'idx'
+            // is set.
+            int size = 1 << kk;
+            memset(T,0,L*sizeof(uint64_t));
+            for ( int idx = 1 ; idx < size ; idx++ ) {
+                int t = MathTools::trailingZeros((uint64_t)idx);
+                MathTools::mxor64
+                (T+(size_t)idx*L,T+(size_t)(idx&(idx-1))*L,
+                 A+(size_t)(r+t)*W+w0,L);
+            }
+
+            // Clear the pivot columns in all other rows
+            for ( int i = (reduced?0:r+kk) ; i < m ; i++ ) {
+
+                if ( i == r ) {
+                    i += kk-1;
+                    continue;
+                }
+
+                uint64_t *row = A + (size_t)i*W;
+
+                int idx = 0;
+                for ( int t = 0 ; t < kk ; t++ ) {
+                    idx |= (int)((row[pc[t]/64] >> (pc[t]%64)) & 0x1) << t;
+                }
+
+                if ( idx != 0 ) {
+                    MathTools::mxor64(row+w0,row+w0,T+(size_t)idx*L,L);
                 }
             }
 
-            if ( !p ) {
-                // If no pivot has been been found, we are done.
-                break;
+            if ( pivots != NULL ) {
+                for ( int t = 0 ; t < kk ; t++ ) {
+                    pivots[r+t] = pc[t];
+                }
+            }
+
+            r += kk;
+        }
+
+        free(T);
+
+        return r;
+    }
+
+    /**
+     * @brief
+     *            Copies the rows of a matrix given by 32-bit words into an
+     *            array of rows packed into 64-bit words.
+     *
+     * @param A
+     *            Output array; the <i>i</i>th row starts at
+     *            <code>A[i*sa]</code>.
+     *
+     * @param sa
+     *            Number of 64-bit words between two consecutive rows of
+     *            <code>A</code>; at least <i>(N+1)/2</i>.
+     *
+     * @param data
+     *            Input array of <i>m*N</i> words.
+     *
+     * @param m
+     *            Number of rows.
+     *
+     * @param N
+     *            Number of 32-bit words per row.
+     */
+    static void pack64
+    ( uint64_t *A , int sa , const uint32_t *data , int m , int N ) {
+
+        int W = (N+1)/2;
+
+        for ( int i = 0 ; i < m ; i++ , A += sa , data += N ) {
+            for ( int l = 0 ; l < W ; l++ ) {
+                uint64_t v = data[2*l];
+                if ( 2*l+1 < N ) {
+                    v |= ((uint64_t)data[2*l+1]) << 32;
+                }
+                A[l] = v;
             }
+        }
+    }
+
+    /**
+     * @brief
+     *            Inverse of \link pack64()\endlink.
+     *
+     * @param data
+     *            Output array of <i>m*N</i> words.
+     *
+     * @param N
+     *            Number of 32-bit words per row.
+     *
+     * @param A
+     *            Input array; the <i>i</i>th row starts at
+     *            <code>A[i*sa]</code>.
+     *
+     * @param sa
+     *            Number of 64-bit words between two consecutive rows of
+     *            <code>A</code>.
+     *
+     * @param m
+     *            Number of rows.
+     */
+    static void unpack64
+    ( uint32_t *data , int N , const uint64_t *A , int sa , int m ) {
 
-            if ( k != j0 ) {
-                exchangeCols(k,j0);
+        for ( int i = 0 ; i < m ; i++ , A += sa , data += N ) {
+            for ( int l = 0 ; l < N ; l++ ) {
+                data[l] = (uint32_t)(A[l/2] >> (32*(l%2)));
             }
+        }
+    }
+
+    /**
+     * @brief
+     *            Makes the matrix an upper triangular matrix using
+     *            elementary row and column operations.
+     *
+     * @details
+     *            The elimination is performed
+     *            by \link rowEchelon()\endlink after which the pivot
+     *            columns are moved to the front.
+     *
+     * @return
+     *            The rank of the matrix.
+     *
+     * @warning
+     *            If not enough memory could be provided, an error
+     *            message is printed to <code>stderr</code> and the
+     *            program exits with status 'EXIT_FAILURE'.
+     */
+    int BinaryMatrix::gauss() {
 
-            if ( k != i0 ) {
-                exchangeRows(k,i0);
+        int m , n , N , W;
+        m = this->m;
+        n = this->n;
+        N = this->N;
+        W = (N+1)/2;
+
+        uint64_t *A = (uint64_t*)malloc( ((size_t)m * W + 1) * sizeof(uint64_t) );
+        int *pivots = (int*)malloc( (min(m,n)+1) * sizeof(int) );
+        int *perm = (int*)malloc( (n+1) * sizeof(int) );
+        uint64_t *row = (uint64_t*)malloc( (W+1) * sizeof(uint64_t) );
+        if ( A == NULL || pivots == NULL || perm == NULL || row == NULL ) {
+            cerr << "BinaryMatrix::gauss: out of memory." << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        pack64(A,W,this->data,m,N);
+
+        int r = m4ri(A,m,n,W,pivots,false);
+
+        // Column permutation moving the pivot columns to the front
+        // while keeping the order of the remaining columns.
+        for ( int j = 0 ; j < n ; j++ ) {
+            perm[j] = -1;
+        }
+        for ( int k = 0 ; k < r ; k++ ) {
+            perm[pivots[k]] = k;
+        }
+        for ( int j = 0 , l = r ; j < n ; j++ ) {
+            if ( perm[j] < 0 ) {
+                perm[j] = l++;
             }
+        }
+
+        // Only the first 'r' rows are non-zero; permute their columns
+        // by visiting their non-zero bits.
+        for ( int i = 0 ; i < r ; i++ ) {
+
+            uint64_t *Ai = A + (size_t)i*W;
 
-            // Now, the element at (k,k) is non-zero and
-            // we can eliminate the elements in further rows of the
-            // 'k'th column.
-            for ( int i = k+1 ; i < numRows() ; i++ ) {
-                if ( getAt(i,k) ) {
-                    addRow(k,i,k);
+            memset(row,0,W*sizeof(uint64_t));
+            for ( int l = 0 ; l < W ; l++ ) {
+                for ( uint64_t v = Ai[l] ; v != 0 ; v &= v-1 ) {
+                    int j = perm[64*l+MathTools::trailingZeros(v)];
+                    row[j/64] |= ((uint64_t)1) << (j%64);
                 }
             }
+            memcpy(Ai,row,W*sizeof(uint64_t));
+        }
+
+        unpack64(this->data,N,A,W,m);
+
+        free(A);
+        free(pivots);
+        free(perm);
+        free(row);
+
+        return r;
+    }
+
+    /**
+     * @brief
+     *            Brings the matrix into row echelon form using
+     *            elementary row operations only.
+     *
+     * @details
+     *            The elimination works on rows packed into 64-bit
+     *            words. Pivots are searched in blocks of up to eight
+     *            columns; for each block, a table of all combinations of
+     *            its pivot rows is built such that every other row is
+     *            reduced by a single table lookup and row addition
+     *            (method of the Four Russians).
+     *
+     *            On output, the first <i>r</i> rows are non-zero where
+     *            <i>r</i> is the rank of the matrix and the remaining
+     *            rows are zero. The leading entry of the <i>k</i>th
+     *            row is found at column <code>pivots[k]</code> where
+     *            <code>pivots[0]<pivots[1]<...<pivots[r-1]</code>.
+     *            If <code>reduced</code> is <code>true</code>, the
+     *            pivot columns are zero except at their pivot
+     *            row, i.e., the result is the reduced row echelon form.
+     *
+     * @param pivots
+     *            If not <code>NULL</code>, an array that can hold at
+     *            least min(\link numRows()\endlink,\link numCols()\endlink)
+     *            integers that will contain the pivot columns.
+     *
+     * @param reduced
+     *            Specifies whether the reduced row echelon form is
+     *            computed.
+     *
+     * @return
+     *            The rank of the matrix.
+     *
+     * @warning
+     *            If not enough memory could be provided, an error
+     *            message is printed to <code>stderr</code> and the
+     *            program exits with status 'EXIT_FAILURE'.
+     */
+    int BinaryMatrix::rowEchelon( int *pivots , bool reduced ) {
+
+        int m , N , W;
+        m = this->m;
+        N = this->N;
+        W = (N+1)/2;
+
+        uint64_t *A = (uint64_t*)malloc( ((size_t)m * W + 1) * sizeof(uint64_t) );
+        if ( A == NULL ) {
+            cerr << "BinaryMatrix::rowEchelon: out of memory." << endl;
+            exit(EXIT_FAILURE);
         }
 
-        return k;
+        pack64(A,W,this->data,m,N);
+
+        int r = m4ri(A,m,this->n,W,pivots,reduced);
+
+        unpack64(this->data,N,A,W,m);
+
+        free(A);
+
+        return r;
     }
 
     /**
@@ -660,9 +993,24 @@ namespace thimble {
      */
     int BinaryMatrix::rank() const {
 
-    	BinaryMatrix tmp(*this);
+        int m , N , W;
+        m = this->m;
+        N = this->N;
+        W = (N+1)/2;
+
+        uint64_t *A = (uint64_t*)malloc( ((size_t)m * W + 1) * sizeof(uint64_t) );
+        if ( A == NULL ) {
+            cerr << "BinaryMatrix::rank: out of memory." << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        pack64(A,W,this->data,m,N);
+
+        int r = m4ri(A,m,this->n,W,NULL,false);
+
+        free(A);
 
-    	return tmp.gauss();
+        return r;
     }
 
     /**
@@ -774,6 +1122,230 @@ namespace thimble {
         MathTools::mxor32(c.data,a.data,b.data, c.m*c.N );
     }
 
+    /**
+     * @brief
+     *            Number of 64-bit words of an output row that are
+     *            processed at once by \link m4rm()\endlink.
+     *
+     * @details
+     *            Bounds the size of the table of 256 row combinations
+     *            to 64 KB such that it stays in the level-2 cache.
+     */
+    static const int _M4RM_BLOCK = 32;
+
+    /**
+     * @brief
+     *            Minimal number of rows and of 64-bit words of the inner
+     *            and of the output dimension, respectively, for which a
+     *            product is split by Strassen-Winograd's method.
+     */
+    static const int _STRASSEN_ROWS = 2048;
+    static const int _STRASSEN_WORDS = 32;
+
+    /**
+     * @brief
+     *            Adds two blocks of rows packed into 64-bit words.
+     *
+     * @details
+     *            Computes <i>D=X+Y</i> where the blocks consist of
+     *            <i>m</i> rows of <i>w</i> words. The rows of a block
+     *            are <code>stride</code> words apart.
+     */
+    static void addBlock
+    ( uint64_t *D , int sd , const uint64_t *X , int sx ,
+      const uint64_t *Y , int sy , int m , int w ) {
+
+        for ( int i = 0 ; i < m ; i++ ) {
+            MathTools::mxor64
+            (D+(size_t)i*sd,X+(size_t)i*sx,Y+(size_t)i*sy,w);
+        }
+    }
+
+    /**
+     * @brief
+     *            Multiplies two matrices packed into 64-bit words
+     *            with the method of the Four Russians.
+     *
+     * @details
+     *            Computes <i>C=A*B</i> where <i>A</i> consists of
+     *            <i>m</i> rows of <i>ka</i> words, <i>B</i> of
+     *            <i>64*ka</i> rows of <i>nb</i> words and <i>C</i> of
+     *            <i>m</i> rows of <i>nb</i> words. For each group of
+     *            eight rows of <i>B</i>, all 256 sums of these rows are
+     *            tabulated; then each row of <i>C</i> is updated by the
+     *            table entry indexed by the corresponding byte of the
+     *            row of <i>A</i>. The columns of <i>C</i> are processed
+     *            in blocks of \link _M4RM_BLOCK\endlink words.
+     *
+     * @param T
+     *            Scratch space of <i>256*_M4RM_BLOCK</i> words.
+     */
+    static void m4rm
+    ( uint64_t *C , int sc , const uint64_t *A , int sa ,
+      const uint64_t *B , int sb , int m , int ka , int nb , uint64_t *T ) {
+
+        for ( int i = 0 ; i < m ; i++ ) {
+            memset(C+(size_t)i*sc,0,nb*sizeof(uint64_t));
+        }
+
+        for ( int c0 = 0 ; c0 < nb ; c0 += _M4RM_BLOCK ) {
+
+            int L = min(_M4RM_BLOCK,nb-c0);
+
+            for ( int k = 0 ; k < 64*ka ; k += 8 ) {
+
+                // Table of all sums of the rows 'k,...,k+7' of 'B'
+                memset(T,0,L*sizeof(uint64_t));
+                for ( int idx = 1 ; idx < 256 ; idx++ ) {
+                    int t = MathTools::trailingZeros((uint64_t)idx);
+                    MathTools::mxor64
+                    (T+idx*L,T+(idx&(idx-1))*L,B+(size_t)(k+t)*sb+c0,L);
+                }
+
+                for ( int i = 0 ; i < m ; i++ ) {
+                    int idx = (int)((A[(size_t)i*sa+k/64] >> (k%64)) & 0xFF);
+                    if ( idx != 0 ) {
+                        uint64_t *row = C+(size_t)i*sc+c0;
+                        MathTools::mxor64(row,row,T+idx*L,L);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief
+     *            Multiplies two matrices packed into 64-bit words
+     *            using Strassen-Winograd's method.
+     *
+     * @details
+     *            The arguments are as for \link m4rm()\endlink. If all
+     *            dimensions are even and large enough, the matrices are
+     *            split into quadrants and the product is computed from
+     *            seven products of quadrants following the schedule
+     *            of <b>Boyer, Dumas, Pernet, and Zhou (2009)</b>.
+     *            Memory efficient scheduling of Strassen-Winograd's
+     *            matrix multiplication algorithm. <i>Proc. ISSAC</i>,
+     *            pp. 55-62, that needs three temporary blocks per
+     *            level; otherwise, \link m4rm()\endlink is called.
+     *
+     * @warning
+     *            If not enough memory could be provided, an error
+     *            message is printed to <code>stderr</code> and the
+     *            program exits with status 'EXIT_FAILURE'.
+     */
+    static void strassen
+    ( uint64_t *C , int sc , const uint64_t *A , int sa ,
+      const uint64_t *B , int sb , int m , int ka , int nb , uint64_t *T ) {
+
+        if ( m < _STRASSEN_ROWS || ka < _STRASSEN_WORDS ||
+             nb < _STRASSEN_WORDS || m%2 || ka%2 || nb%2 ) {
+            m4rm(C,sc,A,sa,B,sb,m,ka,nb,T);
+            return;
+        }
+
+        int m2 , k2 , n2;
+        m2 = m/2;
+        k2 = ka/2;
+        n2 = nb/2;
+
+        const uint64_t *A11 , *A12 , *A21 , *A22;
+        A11 = A;
+        A12 = A+k2;
+        A21 = A+(size_t)m2*sa;
+        A22 = A21+k2;
+
+        const uint64_t *B11 , *B12 , *B21 , *B22;
+        B11 = B;
+        B12 = B+n2;
+        B21 = B+(size_t)64*k2*sb;
+        B22 = B21+n2;
+
+        uint64_t *C11 , *C12 , *C21 , *C22;
+        C11 = C;
+        C12 = C+n2;
+        C21 = C+(size_t)m2*sc;
+        C22 = C21+n2;
+
+        uint64_t *X , *Y , *Z;
+        X = (uint64_t*)malloc( (size_t)m2*k2*sizeof(uint64_t) );
+        Y = (uint64_t*)malloc( (size_t)64*k2*n2*sizeof(uint64_t) );
+        Z = (uint64_t*)malloc( (size_t)m2*n2*sizeof(uint64_t) );
+        if ( X == NULL || Y == NULL || Z == NULL ) {
+            cerr << "BinaryMatrix::mul: out of memory." << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        // Over the binary field, additions and subtractions agree.
+        addBlock(X,k2,A11,sa,A21,sa,m2,k2);            // S3 = A11 - A21
+        addBlock(Y,n2,B22,sb,B12,sb,64*k2,n2);         // T3 = B22 - B12
+        strassen(C21,sc,X,k2,Y,n2,m2,k2,n2,T);         // P7 = S3 * T3
+        addBlock(X,k2,A21,sa,A22,sa,m2,k2);            // S1 = A21 + A22
+        addBlock(Y,n2,B12,sb,B11,sb,64*k2,n2);         // T1 = B12 - B11
+        strassen(C22,sc,X,k2,Y,n2,m2,k2,n2,T);         // P5 = S1 * T1
+        addBlock(X,k2,X,k2,A11,sa,m2,k2);              // S2 = S1 - A11
+        addBlock(Y,n2,B22,sb,Y,n2,64*k2,n2);           // T2 = B22 - T1
+        strassen(C12,sc,X,k2,Y,n2,m2,k2,n2,T);         // P6 = S2 * T2
+        addBlock(X,k2,A12,sa,X,k2,m2,k2);              // S4 = A12 - S2
+        strassen(C11,sc,X,k2,B22,sb,m2,k2,n2,T);       // P3 = S4 * B22
+        strassen(Z,n2,A11,sa,B11,sb,m2,k2,n2,T);       // P1 = A11 * B11
+        addBlock(C12,sc,Z,n2,C12,sc,m2,n2);            // U2 = P1 + P6
+        addBlock(C21,sc,C12,sc,C21,sc,m2,n2);          // U3 = U2 + P7
+        addBlock(C12,sc,C12,sc,C22,sc,m2,n2);          // U4 = U2 + P5
+        addBlock(C22,sc,C21,sc,C22,sc,m2,n2);          // U7 = U3 + P5
+        addBlock(C12,sc,C12,sc,C11,sc,m2,n2);          // U5 = U4 + P3
+        addBlock(Y,n2,Y,n2,B21,sb,64*k2,n2);           // T4 = T2 - B21
+        strassen(C11,sc,A22,sa,Y,n2,m2,k2,n2,T);       // P4 = A22 * T4
+        addBlock(C21,sc,C21,sc,C11,sc,m2,n2);          // U6 = U3 - P4
+        strassen(C11,sc,A12,sa,B21,sb,m2,k2,n2,T);     // P2 = A12 * B21
+        addBlock(C11,sc,Z,n2,C11,sc,m2,n2);            // U1 = P1 + P2
+
+        free(X);
+        free(Y);
+        free(Z);
+    }
+
+    /**
+     * @brief
+     *            Transposes a matrix packed into 64-bit words.
+     *
+     * @details
+     *            The matrix <i>A</i> consists of <i>m</i> rows of
+     *            <i>wa</i> words and <i>n</i> columns; the
+     *            transpose <i>B</i> consists of <i>n</i> rows
+     *            of <i>wb</i> words where \f$wb\geq\lceil m/64\rceil\f$.
+     *            The matrix is processed in blocks of 64x64 bits each of
+     *            which is transposed by
+     *            \link MathTools::transpose64()\endlink.
+     */
+    static void transposePacked
+    ( uint64_t *B , int wb , const uint64_t *A , int wa , int m , int n ) {
+
+        uint64_t blk[64];
+
+        for ( int i0 = 0 ; i0 < m ; i0 += 64 ) {
+
+            int rows = min(64,m-i0);
+
+            for ( int l = 0 ; l < wa ; l++ ) {
+
+                for ( int r = 0 ; r < rows ; r++ ) {
+                    blk[r] = A[(size_t)(i0+r)*wa+l];
+                }
+                for ( int r = rows ; r < 64 ; r++ ) {
+                    blk[r] = 0;
+                }
+
+                MathTools::transpose64(blk);
+
+                int cols = min(64,n-64*l);
+                for ( int r = 0 ; r < cols ; r++ ) {
+                    B[(size_t)(64*l+r)*wb+i0/64] = blk[r];
+                }
+            }
+        }
+    }
+
     /**
      * @brief
      *           Determines the transpose of a binary matrix.
@@ -806,12 +1378,30 @@ namespace thimble {
 
         b.setDimension(n,m);
 
-        for ( int i = 0 ; i < m ; i++ ) {
-            for ( int j = 0 ; j < n ; j++ ) {
-                b.setAt(j,i,a.getAt(i,j));
-            }
+        if ( m == 0 || n == 0 ) {
+            return;
         }
 
+        int wa , wb;
+        wa = (a.N+1)/2;
+        wb = (b.N+1)/2;
+
+        uint64_t *A , *B;
+        A = (uint64_t*)malloc( (size_t)m*wa*sizeof(uint64_t) );
+        B = (uint64_t*)malloc( (size_t)n*wb*sizeof(uint64_t) );
+        if ( A == NULL || B == NULL ) {
+            cerr << "BinaryMatrix::transpose: out of memory." << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        pack64(A,wa,a.data,m,a.N);
+
+        transposePacked(B,wb,A,wa,m,n);
+
+        unpack64(b.data,b.N,B,wb,n);
+
+        free(A);
+        free(B);
     }
 
 
@@ -851,35 +1441,14 @@ namespace thimble {
     ( BinaryMatrix & c ,
       const BinaryMatrix & a , const BinaryMatrix & b ) {
 
-        if ( &c == &a || &c == &b ) {
-            BinaryMatrix tc;
-            mul_t(tc,a,b);
-            swap(c,tc);
-            return;
-        }
-
         if ( a.numCols() != b.numCols() ) {
             cerr << "BinaryMatrix::mul_t: incompatible dimensions." << endl;
             exit(EXIT_FAILURE);
         }
 
-        int m , n , N;
-        m = a.numRows();
-        n = b.numRows();
-        N = a.N;
-
-        c.setDimension(m,n);
-
-        uint32_t *A , *B;
-        for ( int i = 0 ; i < m ; i++ ) {
-            A = a.data + i * N;
-            for ( int j = 0 ; j < n ; j++ ) {
-                B = b.data + j * N;
-                if ( (MathTools::sprod32(A,B,N) & 0x1) ) {
-                    c.setAt(i,j);
-                }
-            }
-        }
+        BinaryMatrix tb;
+        transpose(tb,b);
+        mul(c,a,tb);
     }
 
 
@@ -918,9 +1487,64 @@ namespace thimble {
     ( BinaryMatrix & c ,
       const BinaryMatrix & a , const BinaryMatrix & b ) {
 
-        BinaryMatrix tb;
-        transpose(tb,b);
-        mul_t(c,a,tb);
+        if ( &c == &a || &c == &b ) {
+            BinaryMatrix tc;
+            mul(tc,a,b);
+            swap(c,tc);
+            return;
+        }
+
+        if ( a.numCols() != b.numRows() ) {
+            cerr << "BinaryMatrix::mul: incompatible dimensions." << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        int m , n;
+        m = a.numRows();
+        n = b.numCols();
+
+        c.setDimension(m,n);
+
+        if ( m == 0 || n == 0 || a.numCols() == 0 ) {
+            return;
+        }
+
+        // Pad the dimensions such that they remain even on all levels
+        // on which Strassen-Winograd's method splits the matrices.
+        int mp , kp , np;
+        mp = m;
+        kp = (a.N+1)/2;
+        np = (b.N+1)/2;
+        int d = 0;
+        while ( (mp>>d) >= _STRASSEN_ROWS && (kp>>d) >= _STRASSEN_WORDS &&
+                (np>>d) >= _STRASSEN_WORDS ) {
+            ++d;
+        }
+        mp = ((mp+(1<<d)-1)>>d)<<d;
+        kp = ((kp+(1<<d)-1)>>d)<<d;
+        np = ((np+(1<<d)-1)>>d)<<d;
+
+        uint64_t *A , *B , *C , *T;
+        A = (uint64_t*)calloc( (size_t)mp*kp , sizeof(uint64_t) );
+        B = (uint64_t*)calloc( (size_t)64*kp*np , sizeof(uint64_t) );
+        C = (uint64_t*)malloc( (size_t)mp*np*sizeof(uint64_t) );
+        T = (uint64_t*)malloc( 256*_M4RM_BLOCK*sizeof(uint64_t) );
+        if ( A == NULL || B == NULL || C == NULL || T == NULL ) {
+            cerr << "BinaryMatrix::mul: out of memory." << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        pack64(A,kp,a.data,m,a.N);
+        pack64(B,np,b.data,b.m,b.N);
+
+        strassen(C,np,A,kp,B,np,mp,kp,np,T);
+
+        unpack64(c.data,c.N,C,np,m);
+
+        free(A);
+        free(B);
+        free(C);
+        free(T);
     }
 
     /**
@@ -29,15 +29,19 @@
  * @author Benjamin Tams
  */
 
+#include "config.h"
 #include <stdint.h>
 #include <cstdlib>
 #include <cstring>
 #include <vector>
 #include <iostream>
-
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+#include <wmmintrin.h>
+#endif
 
 #include <thimble/math/MathTools.h>
 #include <thimble/math/numbertheory/BinaryPolynomial.h>
+#include <thimble/math/numbertheory/BinaryPolynomialModulus.h>
 
 using namespace std;
 
@@ -677,8 +681,8 @@ namespace thimble {
 
                 for ( int j = 0 ; j < size-e1 ; j++ ) {
                     this->data[j] = this->data[j+e1];
-                    this->data[j+e1] = 0;
                 }
+                memset(this->data+size-e1,0,e1*sizeof(uint32_t));
 
                 this->degree -= e1*32;
             }
@@ -688,7 +692,7 @@ namespace thimble {
 
                 int size = (this->degree+1)/32+((this->degree+1)%32?1:0);
 
-                uint32_t mask = (e0==31?0xFFFFFFFFu:((1<<(e0+1))-1)) , back;
+                uint32_t mask = (((uint32_t)1)<<e0)-1 , back;
 
                 this->data[0] >>= e0;
 
@@ -698,6 +702,8 @@ namespace thimble {
                     this->data[j-1] ^= back;
                     this->data[j] >>= e0;
                 }
+
+                this->degree -= e0;
             }
         }
     }
@@ -1065,47 +1071,123 @@ namespace thimble {
 
     /**
      * @brief
-     *           Low-level method for adding the product of two
-     *           polynomials, where one is degree not larger than 31,
-     *           to another polynomial.
+     *           Number of 64-bit words from which on polynomials are
+     *           multiplied using Karatsuba's method rather than the
+     *           schoolbook method.
+     */
+    static const int _KARATSUBA_THRESHOLD = 16;
+
+    /**
+     * @brief
+     *           Table mapping a byte to the 16-bit integer in which
+     *           the <i>i</i>th bit of the byte is moved to position
+     *           <i>2i</i>; used for squaring.
+     */
+    static const uint16_t _SPREAD_TABLE[256] = {
+        0x0000 , 0x0001 , 0x0004 , 0x0005 , 0x0010 , 0x0011 , 0x0014 , 0x0015 ,
+        0x0040 , 0x0041 , 0x0044 , 0x0045 , 0x0050 , 0x0051 , 0x0054 , 0x0055 ,
+        0x0100 , 0x0101 , 0x0104 , 0x0105 , 0x0110 , 0x0111 , 0x0114 , 0x0115 ,
+        0x0140 , 0x0141 , 0x0144 , 0x0145 , 0x0150 , 0x0151 , 0x0154 , 0x0155 ,
+        0x0400 , 0x0401 , 0x0404 , 0x0405 , 0x0410 , 0x0411 , 0x0414 , 0x0415 ,
+        0x0440 , 0x0441 , 0x0444 , 0x0445 , 0x0450 , 0x0451 , 0x0454 , 0x0455 ,
+        0x0500 , 0x0501 , 0x0504 , 0x0505 , 0x0510 , 0x0511 , 0x0514 , 0x0515 ,
+        0x0540 , 0x0541 , 0x0544 , 0x0545 , 0x0550 , 0x0551 , 0x0554 , 0x0555 ,
+        0x1000 , 0x1001 , 0x1004 , 0x1005 , 0x1010 , 0x1011 , 0x1014 , 0x1015 ,
+        0x1040 , 0x1041 , 0x1044 , 0x1045 , 0x1050 , 0x1051 , 0x1054 , 0x1055 ,
+        0x1100 , 0x1101 , 0x1104 , 0x1105 , 0x1110 , 0x1111 , 0x1114 , 0x1115 ,
+        0x1140 , 0x1141 , 0x1144 , 0x1145 , 0x1150 , 0x1151 , 0x1154 , 0x1155 ,
+        0x1400 , 0x1401 , 0x1404 , 0x1405 , 0x1410 , 0x1411 , 0x1414 , 0x1415 ,
+        0x1440 , 0x1441 , 0x1444 , 0x1445 , 0x1450 , 0x1451 , 0x1454 , 0x1455 ,
+        0x1500 , 0x1501 , 0x1504 , 0x1505 , 0x1510 , 0x1511 , 0x1514 , 0x1515 ,
+        0x1540 , 0x1541 , 0x1544 , 0x1545 , 0x1550 , 0x1551 , 0x1554 , 0x1555 ,
+        0x4000 , 0x4001 , 0x4004 , 0x4005 , 0x4010 , 0x4011 , 0x4014 , 0x4015 ,
+        0x4040 , 0x4041 , 0x4044 , 0x4045 , 0x4050 , 0x4051 , 0x4054 , 0x4055 ,
+        0x4100 , 0x4101 , 0x4104 , 0x4105 , 0x4110 , 0x4111 , 0x4114 , 0x4115 ,
+        0x4140 , 0x4141 , 0x4144 , 0x4145 , 0x4150 , 0x4151 , 0x4154 , 0x4155 ,
+        0x4400 , 0x4401 , 0x4404 , 0x4405 , 0x4410 , 0x4411 , 0x4414 , 0x4415 ,
+        0x4440 , 0x4441 , 0x4444 , 0x4445 , 0x4450 , 0x4451 , 0x4454 , 0x4455 ,
+        0x4500 , 0x4501 , 0x4504 , 0x4505 , 0x4510 , 0x4511 , 0x4514 , 0x4515 ,
+        0x4540 , 0x4541 , 0x4544 , 0x4545 , 0x4550 , 0x4551 , 0x4554 , 0x4555 ,
+        0x5000 , 0x5001 , 0x5004 , 0x5005 , 0x5010 , 0x5011 , 0x5014 , 0x5015 ,
+        0x5040 , 0x5041 , 0x5044 , 0x5045 , 0x5050 , 0x5051 , 0x5054 , 0x5055 ,
+        0x5100 , 0x5101 , 0x5104 , 0x5105 , 0x5110 , 0x5111 , 0x5114 , 0x5115 ,
+        0x5140 , 0x5141 , 0x5144 , 0x5145 , 0x5150 , 0x5151 , 0x5154 , 0x5155 ,
+        0x5400 , 0x5401 , 0x5404 , 0x5405 , 0x5410 , 0x5411 , 0x5414 , 0x5415 ,
+        0x5440 , 0x5441 , 0x5444 , 0x5445 , 0x5450 , 0x5451 , 0x5454 , 0x5455 ,
+        0x5500 , 0x5501 , 0x5504 , 0x5505 , 0x5510 , 0x5511 , 0x5514 , 0x5515 ,
+        0x5540 , 0x5541 , 0x5544 , 0x5545 , 0x5550 , 0x5551 , 0x5554 , 0x5555
+    };
+
+    /**
+     * @brief
+     *           Low-level method for adding the product of a polynomial
+     *           and a polynomial of degree not larger than 63 to
+     *           another polynomial.
+     *
+     * @details
+     *           The carry-less products are computed as in
+     *           \link MathTools::clmul64()\endlink but the table
+     *           of multiples of <i>a</i> is only built once for all
+     *           words in <i>B</i>.
      *
      * @param C
      *           The coefficients of the polynomial to which the
      *           product is added; should contain at least
-     *           <i>n+1</i> valid unsigned 32 bit integers.
+     *           <i>n+1</i> valid unsigned 64 bit integers.
      *
-     * @param A
+     * @param B
      *           The coefficients of the first factor polynomial;
-     *           should contain at least <i>n</i> valid unsinged 32 bit
+     *           should contain at least <i>n</i> valid unsigned 64 bit
      *           integers.
      *
      * @param n
-     *           The number of 32 bit words contained in <code>A</code>.
+     *           The number of 64 bit words contained in <code>B</code>.
      *
-     * @param b
+     * @param a
      *           The coefficients of the second factor polynomial being
-     *           of degree at most 31.
+     *           of degree at most 63.
      */
     static void addMul
-    ( register uint32_t *C , register const uint32_t *A , int n , uint32_t b ) {
+    ( uint64_t *C , const uint64_t *B , int n , uint64_t a ) {
 
-        register int i;
-        register uint32_t carry = 0;
-        register uint64_t c;
+        uint64_t u[16] , mask[3] , b , lo , hi , t;
 
-        for ( i = 0 ; i < n ; i++ , A++ , C++ ) {
-            c = MathTools::clmul(*A,b);
-            *C ^= (c&((uint32_t)0xFFFFFFFF))^carry;
-            carry = c >> 32;
+        u[0] = 0;
+        u[1] = a & 0x1FFFFFFFFFFFFFFFULL;
+        for ( int i = 2 ; i < 16 ; i += 2 ) {
+            u[i] = u[i/2] << 1;
+            u[i+1] = u[i] ^ u[1];
         }
+        for ( int i = 0 ; i < 3 ; i++ ) {
+            mask[i] = (uint64_t)0 - ((a >> (61+i)) & 1);
+        }
+
+        for ( int j = 0 ; j < n ; j++ ) {
 
-        *C ^= carry;
+            b = B[j];
+
+            lo = u[b & 0xF];
+            hi = 0;
+            for ( int i = 4 ; i < 64 ; i += 4 ) {
+                t = u[(b >> i) & 0xF];
+                lo ^= t << i;
+                hi ^= t >> (64-i);
+            }
+            for ( int i = 0 ; i < 3 ; i++ ) {
+                lo ^= (b << (61+i)) & mask[i];
+                hi ^= (b >> (3-i)) & mask[i];
+            }
+
+            C[j] ^= lo;
+            C[j+1] ^= hi;
+        }
     }
 
     /**
      * @brief
      *            Low-level method for computing the product
-     *            of two binary polynomials.
+     *            of two binary polynomials with the schoolbook
+     *            method.
      *
      * @details
      *            Stores the product of the polynomial
@@ -1115,33 +1197,179 @@ namespace thimble {
      * @param C
      *            The array in which the coefficients of the product
      *            is stored; should be able to hold at least
-     *            <i>m+n</i> unsigned 32 bit integers.
+     *            <i>m+n</i> unsigned 64 bit integers.
      *
      * @param A
      *            Coefficients of the first factor polynomial.
      *
      * @param m
-     *            Number of unsigned 32 bit words stored in <i>A</i>.
+     *            Number of unsigned 64 bit words stored in <i>A</i>.
      *
      * @param B
      *            Coefficients of the second factor polynomial.
      *
      * @param n
-     *            Number of unsigned 32 bit words stored in <i>B</i>.
-     *
+     *            Number of unsigned 64 bit words stored in <i>B</i>.
      */
     static void plainMul
-    ( register uint32_t *C ,
-      register const uint32_t *A , register int m ,
-      register const uint32_t *B , register int n ) {
+    ( uint64_t *C ,
+      const uint64_t *A , int m ,
+      const uint64_t *B , int n ) {
 
-        register int j;
+        memset(C,0,(m+n)*sizeof(uint64_t));
+
+        for ( int i = 0 ; i < m ; i++ ) {
+            addMul(C+i,B,n,A[i]);
+        }
+    }
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+    /**
+     * @brief
+     *            Same as \link plainMul()\endlink but uses the
+     *            'PCLMULQDQ' instruction for the products of the
+     *            64 bit words.
+     *
+     * @warning
+     *            Must only be called if
+     *            \link MathTools::hasPclmulqdq()\endlink returns
+     *            <code>true</code>.
+     */
+    __attribute__((target("pclmul,sse2")))
+    static void plainMulPclmulqdq
+    ( uint64_t *C ,
+      const uint64_t *A , int m ,
+      const uint64_t *B , int n ) {
+
+        __m128i a , p;
+
+        memset(C,0,(m+n)*sizeof(uint64_t));
+
+        for ( int i = 0 ; i < m ; i++ ) {
+            a = _mm_cvtsi64_si128((long long)A[i]);
+            for ( int j = 0 ; j < n ; j++ ) {
+                p = _mm_clmulepi64_si128
+                    (a,_mm_cvtsi64_si128((long long)B[j]),0x00);
+                C[i+j] ^= (uint64_t)_mm_cvtsi128_si64(p);
+                C[i+j+1] ^= (uint64_t)_mm_cvtsi128_si64
+                    (_mm_unpackhi_epi64(p,p));
+            }
+        }
+    }
+#endif
+
+    /**
+     * @brief
+     *            Low-level method for computing the product of two
+     *            binary polynomials of which one has less than
+     *            <code>_KARATSUBA_THRESHOLD</code> words.
+     *
+     * @details
+     *            Dispatches to \link plainMulPclmulqdq()\endlink if
+     *            the processor supports carry-less multiplication
+     *            and to \link plainMul()\endlink otherwise.
+     */
+    static inline void baseMul
+    ( uint64_t *C ,
+      const uint64_t *A , int m ,
+      const uint64_t *B , int n ) {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        if ( MathTools::hasPclmulqdq() ) {
+            plainMulPclmulqdq(C,A,m,B,n);
+            return;
+        }
+#endif
+        plainMul(C,A,m,B,n);
+    }
+
+    /**
+     * @brief
+     *            Low-level method for computing the product of two
+     *            binary polynomials with Karatsuba's method.
+     *
+     * @details
+     *            If both polynomials have at least
+     *            <code>_KARATSUBA_THRESHOLD</code> words and are of
+     *            similar length, they are split into halves
+     *            \f$A=A_0+X^{64h}A_1\f$ and \f$B=B_0+X^{64h}B_1\f$
+     *            and the product is obtained from the three products
+     *            \f$A_0B_0\f$, \f$A_1B_1\f$ and
+     *            \f$(A_0+A_1)(B_0+B_1)\f$. If one polynomial is much
+     *            shorter than the other, the longer one is cut into
+     *            pieces as long as the shorter one. Products of
+     *            polynomials one of which is shorter than
+     *            <code>_KARATSUBA_THRESHOLD</code> words are computed
+     *            by \link baseMul()\endlink.
+     *
+     * @param C
+     *            The array in which the coefficients of the product
+     *            is stored; should be able to hold at least
+     *            <i>m+n</i> unsigned 64 bit integers.
+     *
+     * @param A
+     *            Coefficients of the first factor polynomial.
+     *
+     * @param m
+     *            Number of unsigned 64 bit words stored in <i>A</i>.
+     *
+     * @param B
+     *            Coefficients of the second factor polynomial.
+     *
+     * @param n
+     *            Number of unsigned 64 bit words stored in <i>B</i>.
+     *
+     * @param T
+     *            Scratch space of at least <i>8(m+n)</i> unsigned
+     *            64 bit integers which must not overlap with the
+     *            other arrays.
+     */
+    static void karatsubaMul
+    ( uint64_t *C ,
+      const uint64_t *A , int m ,
+      const uint64_t *B , int n , uint64_t *T ) {
+
+        if ( m < n ) {
+            karatsubaMul(C,B,n,A,m,T);
+            return;
+        }
 
-        memset(C,0,(m+n)*sizeof(uint32_t));
+        if ( n < _KARATSUBA_THRESHOLD ) {
+            baseMul(C,A,m,B,n);
+            return;
+        }
+
+        int h = (m+1)/2;
 
-        for ( j = 0 ; j < m ; j++ , C++ , A++ ) {
-            addMul(C,B,n,*A);
+        if ( n <= h ) {
+
+            // Unbalanced case: Multiply pieces of 'A' consisting of
+            // 'n' words with 'B'
+            memset(C,0,(m+n)*sizeof(uint64_t));
+            for ( int i = 0 ; i < m ; i += n ) {
+                int l = m-i < n ? m-i : n;
+                karatsubaMul(T,A+i,l,B,n,T+l+n);
+                MathTools::mxor64(C+i,C+i,T,l+n);
+            }
+            return;
         }
+
+        // Low and high products
+        karatsubaMul(C,A,h,B,h,T);
+        karatsubaMul(C+2*h,A+h,m-h,B+h,n-h,T);
+
+        // Middle product '(A0+A1)*(B0+B1)'
+        memcpy(T,A,h*sizeof(uint64_t));
+        memcpy(T+h,B,h*sizeof(uint64_t));
+        MathTools::mxor64(T,T,A+h,m-h);
+        MathTools::mxor64(T+h,T+h,B+h,n-h);
+        karatsubaMul(T+2*h,T,h,T+h,h,T+4*h);
+
+        // Subtract low and high product from the middle product
+        // and add it at the right position
+        MathTools::mxor64(T+2*h,T+2*h,C,2*h);
+        MathTools::mxor64(T+2*h,T+2*h,C+2*h,m+n-2*h);
+        MathTools::mxor64(C+h,C+h,T+2*h,2*h);
     }
 
     /**
@@ -1153,6 +1381,13 @@ namespace thimble {
      *           by the product of the two polynomials <i>g</i>
      *           and <i>h</i>.
      *
+     *           The coefficients are multiplied in words of 64 bits
+     *           using the 'PCLMULQDQ' instruction if supported by the
+     *           processor; products of long polynomials are reduced
+     *           to products of shorter ones with Karatsuba's method.
+     *           If <i>g</i> and <i>h</i> are the same reference,
+     *           the \link sqr()\endlink function is used.
+     *
      * @param f
      *           Product of <i>g</i> and <i>h</i>.
      *
@@ -1172,6 +1407,11 @@ namespace thimble {
       const BinaryPolynomial & g ,
       const BinaryPolynomial & h ) {
 
+        if ( &g == &h ) {
+            sqr(f,g);
+            return;
+        }
+
         if ( &f == &g ) {
             BinaryPolynomial tg(g);
             mul(f,tg,h);
@@ -1188,15 +1428,105 @@ namespace thimble {
 
         if ( !g.isZero() && !h.isZero() ) {
 
-            int m , n;
-            m = (g.degree+1)/32+((g.degree+1)%32?1:0);
-            n = (h.degree+1)/32+((h.degree+1)%32?1:0);
-
-            f.ensureDegree(32*(m+n+1));
+            int mw , nw , m , n;
+            mw = (g.degree+1)/32+((g.degree+1)%32?1:0);
+            nw = (h.degree+1)/32+((h.degree+1)%32?1:0);
+            m = (mw+1)/2;
+            n = (nw+1)/2;
+
+            // Small products are computed in buffers on the stack
+            uint64_t buf[4*_KARATSUBA_THRESHOLD];
+            vector<uint64_t> heap;
+            uint64_t *A , *B , *C , *T;
+            if ( m < _KARATSUBA_THRESHOLD && n < _KARATSUBA_THRESHOLD ) {
+                A = buf;
+                T = NULL;
+            } else {
+                heap.resize(10*(m+n));
+                A = &(heap[0]);
+                T = A+2*(m+n);
+            }
+            B = A+m;
+            C = B+n;
+
+            // Combine pairs of 32 bit coefficient words
+            for ( int i = 0 ; i < mw ; i += 2 ) {
+                A[i/2] = g.data[i];
+                if ( i+1 < mw ) {
+                    A[i/2] |= (uint64_t)g.data[i+1] << 32;
+                }
+            }
+            for ( int i = 0 ; i < nw ; i += 2 ) {
+                B[i/2] = h.data[i];
+                if ( i+1 < nw ) {
+                    B[i/2] |= (uint64_t)h.data[i+1] << 32;
+                }
+            }
 
-            plainMul(f.data,g.data,m,h.data,n);
+            karatsubaMul(C,A,m,B,n,T);
 
             f.degree = g.degree+h.degree;
+            f.ensureDegree(f.degree);
+
+            int fw = (f.degree+1)/32+((f.degree+1)%32?1:0);
+            for ( int i = 0 ; i < fw ; i++ ) {
+                f.data[i] = (uint32_t)(C[i/2] >> (32*(i%2)));
+            }
+        }
+    }
+
+    /**
+     * @brief
+     *           Computes the square of a binary polynomial.
+     *
+     * @details
+     *           Since squaring is linear over the binary field, the
+     *           square of \f$\sum_jc_jX^j\f$ is \f$\sum_jc_jX^{2j}\f$
+     *           which is computed by spreading the bits of each byte
+     *           of coefficients using a look-up table.
+     *
+     * @param f
+     *           Square of <i>g</i>.
+     *
+     * @param g
+     *           Polynomial that is squared.
+     *
+     * @warning
+     *           If not enough memory could be provided, an error
+     *           message is printed to <code>stderr</code> and the
+     *           program exits with status 'EXIT_FAILURE'.
+     */
+    void BinaryPolynomial::sqr
+    ( BinaryPolynomial & f , const BinaryPolynomial & g ) {
+
+        if ( &f == &g ) {
+            BinaryPolynomial tg(g);
+            sqr(f,tg);
+            return;
+        }
+
+        f.setZero();
+
+        if ( !g.isZero() ) {
+
+            int m = (g.degree+1)/32+((g.degree+1)%32?1:0);
+
+            f.ensureDegree(2*g.degree);
+
+            uint32_t w;
+            for ( int i = 0 ; i < m ; i++ ) {
+                w = g.data[i];
+                f.data[2*i] =
+                    (uint32_t)_SPREAD_TABLE[w & 0xFF] |
+                    ((uint32_t)_SPREAD_TABLE[(w >> 8) & 0xFF] << 16);
+                if ( 2*i+1 < f.numWords ) {
+                    f.data[2*i+1] =
+                        (uint32_t)_SPREAD_TABLE[(w >> 16) & 0xFF] |
+                        ((uint32_t)_SPREAD_TABLE[w >> 24] << 16);
+                }
+            }
+
+            f.degree = 2*g.degree;
         }
     }
 
@@ -1269,21 +1599,33 @@ namespace thimble {
 
         // School-book division method
 
-        BinaryPolynomial tmp;
-        BinaryPolynomial c(b);
-
-        int n , m;
+        int n , m , bw;
         n = a.deg();
-        m = c.deg();
+        m = b.deg();
+        bw = (m+1)/32+((m+1)%32?1:0);
         r.assign(a);
         q.setZero();
 
+        // One word more for the shifted denominator
+        r.ensureDegree(n+32);
+
         for ( int j = n-m ; j >= 0 ; j-- ) {
-            if ( r.deg() == m+j ) {
+            if ( (r.data[(m+j)/32] >> ((m+j)%32)) & 1 ) {
+
                 q.setCoeff(j);
-                tmp.assign(c);
-                tmp.leftShift(j);
-                sub(r,r,tmp);
+
+                // Subtract 'X^j*b' word by word
+                int w = j/32 , s = j%32;
+                if ( s == 0 ) {
+                    for ( int i = 0 ; i < bw ; i++ ) {
+                        r.data[w+i] ^= b.data[i];
+                    }
+                } else {
+                    for ( int i = 0 ; i < bw ; i++ ) {
+                        r.data[w+i] ^= b.data[i] << s;
+                        r.data[w+i+1] ^= b.data[i] >> (32-s);
+                    }
+                }
             }
         }
 
@@ -1650,28 +1992,7 @@ namespace thimble {
             exit(EXIT_FAILURE);
         }
 
-        BinaryPolynomial a(n+n) , b(n+n) , tmp0(n+n) , tmp1(n+n);
-        a.setOne();
-        b.setOne();
-
-        for ( int j = 1 ; j < n+n ; j++ ) {
-            mul(tmp0,b,g);
-            divRem(tmp1,b,tmp0,f);
-            a.setCoeff(j,b.getCoeff(0));
-        }
-
-        BinaryPolynomial s(n) , t(n);
-        pade(s,t,a,n+n,n);
-
-
-        int d;
-        if ( s.deg()+1 > t.deg() ) {
-            d = s.deg()+1;
-        } else {
-            d = t.deg();
-        }
-
-        h = t.reverse(d);
+        BinaryPolynomialModulus(f).minPoly(h,g);
     }
 
     /**
@@ -1785,18 +2106,19 @@ namespace thimble {
             exit(EXIT_FAILURE);
         }
 
-        BinaryPolynomial
-                tmp0(f.degree+g.degree) , tmp1(f.degree+g.degree);
+        BinaryPolynomialModulus M(m);
+        BinaryPolynomial gm;
+        M.rem(gm,g);
 
         h.setZero();
         int d = f.deg();
 
         // Run Horner's method ...
         for ( int j = d ; j >= 0 ; j--  ) {
-            mul(tmp0,h,g);
-            tmp0.setCoeff(0,f.getCoeff(j)^tmp0.getCoeff(0));
+            mul(h,h,gm);
+            h.setCoeff(0,f.getCoeff(j)^h.getCoeff(0));
             // ... by incorporating a reduction.
-            divRem(tmp1,h,tmp0,m);
+            M.rem(h,h);
         }
     }
 
@@ -1923,19 +2245,18 @@ namespace thimble {
         // *******************************************
         // *** Step 1 (Algorithm 14.36 in [vzGth]) ***
         // *******************************************
+        BinaryPolynomialModulus F(*this);
+        BinaryPolynomial x;
+        x.setX();
         {
-            BinaryPolynomial a , a2 , tmp;
-            a.setCoeff(2);
-            for ( int j = 0 ; j < n-1 ; j++ ) {
-                mul(a2,a,a);
-                divRem(tmp,a,a2,*this);
-            }
+            BinaryPolynomial a;
+            F.frobenius(a,x,n);
             if ( !a.isX() ) {
                 return false;
             }
         }
 
-        BinaryPolynomial b , b2 , tmp , g;
+        BinaryPolynomial b , g;
 
 
         // *******************************************
@@ -1956,13 +2277,7 @@ namespace thimble {
                 // *******************************************
 
                 // ... compute 'b=x^(2^(n/t)) rem f'
-                int m = n/t;
-                b.setZero();
-                b.setCoeff(2);
-                for ( int j = 0 ; j < m-1 ; j++ ) {
-                    mul(b2,b,b);
-                    divRem(tmp,b,b2,*this);
-                }
+                F.frobenius(b,x,n/t);
 
                 // Compute 'b(X)-X'
                 b.data[0] ^= 2;
@@ -2039,7 +2354,8 @@ namespace thimble {
             exit(EXIT_FAILURE);
         }
 
-        BinaryPolynomial a(n) , g(n) , b(n) , b2(n+n) , T(n) , tmp(n);
+        BinaryPolynomialModulus F(*this);
+        BinaryPolynomial a(n) , g(n) , b(n) , T(n);
 
         // Iteration over Algorithm 14.8 until a proper factor reveals
         do {
@@ -2066,12 +2382,9 @@ namespace thimble {
             // modulo the polynomial 'f' to be factored; see Excercise
             // 14.36 in [vzGth]
             T.setZero();
+            b.assign(a);
             for ( int i = 0 ; i < d ; i++ ) {
-                mul(b,a,a);
-                for ( int j = 0 ; j < i ; j++ ) {
-                    mul(b2,b,b);
-                    divRem(tmp,b,b2,*this);
-                }
+                F.sqrMod(b,b);
                 add(T,T,b);
             }
 
@@ -2149,7 +2462,8 @@ namespace thimble {
     BinaryPolynomial BinaryPolynomial::splitIrreducibleDDF() const {
 
         int n = deg();
-        BinaryPolynomial h , g , tmp;
+        BinaryPolynomialModulus F(*this);
+        BinaryPolynomial h , g;
 
         h.setX();
 
@@ -2157,8 +2471,7 @@ namespace thimble {
 
         for ( int d = 1 ; d < n ; d++ ) {
 
-            mul(tmp,h,h);
-            rem(h,tmp,*this);
+            F.sqrMod(h,h);
 
             h.data[0] ^= 2;
             if ( h.degree == 1 ) {
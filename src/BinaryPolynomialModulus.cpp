@@ -0,0 +1,511 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file BinaryPolynomialModulus.cpp
+ *
+ * @brief
+ *            Implements the functionalities for fast and repeated
+ *            reduction of binary polynomials modulo a fixed polynomial
+ *            as provided by the 'BinaryPolynomialModulus.h' header.
+ *
+ * @author agent
+ */
+
+#include <stdint.h>
+#include <cstdlib>
+#include <vector>
+#include <iostream>
+
+#include <thimble/math/MathTools.h>
+#include <thimble/math/numbertheory/BinaryPolynomial.h>
+#include <thimble/math/numbertheory/BinaryPolynomialModulus.h>
+
+using namespace std;
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+    /**
+     * @brief
+     *           Maximal number of non-zero coefficients of a modulus
+     *           for which reduction is performed via shifts and
+     *           additions rather than Barrett reduction.
+     */
+    static const int _MAX_SPARSE_WEIGHT = 5;
+
+    /**
+     * @brief
+     *           Low-level method for reducing a polynomial modulo
+     *           a sparse modulus.
+     *
+     * @details
+     *           Starting with the most significant word, the
+     *           coefficients at positions <i>i</i> not smaller than
+     *           <i>n</i> are removed by adding
+     *           \f$X^{i-n}\cdot X^k\f$ for all <i>k</i> in
+     *           <i>taps</i>.
+     *
+     * @param t
+     *           The coefficients of the polynomial of degree
+     *           <i>d</i>; must be able to hold at least
+     *           <i>d/32+2</i> unsigned 32 bit integers.
+     *
+     * @param d
+     *           The degree of the polynomial.
+     *
+     * @param n
+     *           The degree of the modulus.
+     *
+     * @param taps
+     *           The exponents of the modulus' non-zero
+     *           coefficients smaller than <i>n</i>.
+     */
+    static void sparseReduce
+    ( uint32_t *t , int d , int n , const vector<int> & taps ) {
+
+        int numTaps = (int)taps.size();
+
+        for ( int j = d/32 ; j >= n/32 ; ) {
+
+            int lo = 32*j > n ? 32*j : n;
+            int s = lo-32*j;
+
+            uint32_t u = t[j] >> s;
+            if ( u == 0 ) {
+                j--;
+                continue;
+            }
+
+            // Clear the coefficients not smaller than 'lo' ...
+            t[j] ^= u << s;
+
+            // ... and add them multiplied by the lower terms
+            // of the modulus. Some of them may land in the
+            // 'j'th word again which is why 'j' is not decreased.
+            for ( int i = 0 ; i < numTaps ; i++ ) {
+                int p = lo-n+taps[i];
+                int w = p/32 , b = p%32;
+                t[w] ^= u << b;
+                if ( b != 0 ) {
+                    t[w+1] ^= u >> (32-b);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief
+     *           Removes all coefficients of a polynomial at positions
+     *           not smaller than a given bound.
+     *
+     * @param a
+     *           The polynomial that is replaced by its remainder
+     *           modulo \f$X^s\f$.
+     *
+     * @param s
+     *           Non-negative bound.
+     */
+    static void truncate( BinaryPolynomial & a , int s ) {
+
+        // *******************************************************************
+        // * WARNING: THIS METHOD USES A 'getData_nonconst()' METHOD WHICH ***
+        // * YOU SHOULD ONLY USE ON YOURSELF IF YOU REALLY KNOW WHAT YOU ARE *
+        // * DOING ***********************************************************
+        // *******************************************************************
+
+        int d = a.deg();
+        if ( d < s ) {
+            return;
+        }
+
+        uint32_t *data = a.getData_nonconst();
+
+        for ( int j = d/32 ; j > s/32 ; j-- ) {
+            data[j] = 0;
+        }
+        if ( s % 32 != 0 ) {
+            data[s/32] &= (((uint32_t)1) << (s%32))-1;
+        } else {
+            data[s/32] = 0;
+        }
+
+        a.degreeCouldBeSmaller();
+    }
+
+    /**
+     * @brief
+     *           Creates a modulus and precomputes the data needed
+     *           for fast reduction.
+     *
+     * @param f
+     *           The modulus polynomial.
+     *
+     * @warning
+     *           If <i>f</i> is zero, an error message is printed
+     *           to <code>stderr</code> and the program exits with
+     *           status 'EXIT_FAILURE'.
+     *
+     * @warning
+     *           If not enough memory could be provided, an error
+     *           message is printed to <code>stderr</code> and the
+     *           program exits with status 'EXIT_FAILURE'.
+     */
+    BinaryPolynomialModulus::BinaryPolynomialModulus
+    ( const BinaryPolynomial & f ) : f(f) {
+
+        if ( f.isZero() ) {
+            cerr << "BinaryPolynomialModulus: "
+                 << "modulus must be non-zero." << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        int n = f.deg();
+
+        if ( n > 0 && f.hammingWeight() <= _MAX_SPARSE_WEIGHT ) {
+            for ( int k = 0 ; k < n ; k++ ) {
+                if ( f.getCoeff(k) ) {
+                    this->taps.push_back(k);
+                }
+            }
+        }
+
+        // Modulus with no lower terms, i.e., 'X^n', is handled by
+        // Barrett reduction as well
+        if ( this->taps.empty() ) {
+            BinaryPolynomial x2n , tmp;
+            x2n.setCoeff(2*n);
+            divRem(this->mu,tmp,x2n,f);
+        }
+    }
+
+    /**
+     * @brief
+     *           Reduces a polynomial of degree smaller than
+     *           <i>2n</i> via Barrett reduction.
+     *
+     * @details
+     *           Write \f$a=a_1X^n+a_0\f$ with \f$\deg(a_0)<n\f$. Then
+     *           the quotient of <i>a</i> divided by the modulus
+     *           equals \f$\lfloor a_1\mu/X^n\rfloor\f$.
+     *
+     * @param r
+     *           On output, the remainder of <i>a</i> modulo the
+     *           modulus.
+     *
+     * @param a
+     *           Polynomial of degree smaller than <i>2n</i>.
+     *
+     * @param tmp1
+     *           Temporary polynomial.
+     *
+     * @param tmp2
+     *           Temporary polynomial.
+     *
+     * @warning
+     *           If not enough memory could be provided, an error
+     *           message is printed to <code>stderr</code> and the
+     *           program exits with status 'EXIT_FAILURE'.
+     */
+    void BinaryPolynomialModulus::barrett
+    ( BinaryPolynomial & r , const BinaryPolynomial & a ,
+      BinaryPolynomial & tmp1 , BinaryPolynomial & tmp2 ) const {
+
+        int n = this->f.deg();
+
+        tmp1.assign(a);
+        tmp1.rightShift(n);
+        mul(tmp2,tmp1,this->mu);
+        tmp2.rightShift(n);
+        mul(tmp1,tmp2,this->f);
+        add(r,a,tmp1);
+    }
+
+    /**
+     * @brief
+     *           Reduces a polynomial modulo the modulus.
+     *
+     * @param r
+     *           On output, the remainder of <i>a</i> divided by
+     *           the modulus.
+     *
+     * @param a
+     *           Polynomial of arbitrary degree.
+     *
+     * @warning
+     *           If not enough memory could be provided, an error
+     *           message is printed to <code>stderr</code> and the
+     *           program exits with status 'EXIT_FAILURE'.
+     */
+    void BinaryPolynomialModulus::rem
+    ( BinaryPolynomial & r , const BinaryPolynomial & a ) const {
+
+        // *******************************************************************
+        // * WARNING: THIS METHOD USES A 'getData_nonconst()' METHOD WHICH ***
+        // * YOU SHOULD ONLY USE ON YOURSELF IF YOU REALLY KNOW WHAT YOU ARE *
+        // * DOING ***********************************************************
+        // *******************************************************************
+
+        int n = this->f.deg() , d = a.deg();
+
+        if ( &r != &a ) {
+            r.assign(a);
+        }
+
+        if ( d < n ) {
+            return;
+        }
+
+        // Everything is divisible by a constant modulus
+        if ( n == 0 ) {
+            r.setZero();
+            return;
+        }
+
+        if ( isSparse() ) {
+            // One word more for the shifted terms
+            r.ensureDegree(d+32);
+            sparseReduce(r.getData_nonconst(),d,n,this->taps);
+            r.degreeCouldBeSmaller();
+            return;
+        }
+
+        BinaryPolynomial tmp1 , tmp2 , top;
+
+        // Reduce the leading '2n' coefficients until the degree
+        // is small enough for a single Barrett reduction
+        while ( r.deg() >= 2*n ) {
+            int s = r.deg()-2*n+1;
+            top.assign(r);
+            top.rightShift(s);
+            barrett(top,top,tmp1,tmp2);
+            top.leftShift(s);
+            truncate(r,s);
+            add(r,r,top);
+        }
+
+        barrett(r,r,tmp1,tmp2);
+    }
+
+    /**
+     * @brief
+     *           Computes the product of two polynomials modulo
+     *           the modulus.
+     *
+     * @param c
+     *           On output, the remainder of \f$a\cdot b\f$ divided
+     *           by the modulus.
+     *
+     * @param a
+     *           First factor.
+     *
+     * @param b
+     *           Second factor.
+     *
+     * @warning
+     *           If not enough memory could be provided, an error
+     *           message is printed to <code>stderr</code> and the
+     *           program exits with status 'EXIT_FAILURE'.
+     */
+    void BinaryPolynomialModulus::mulMod
+    ( BinaryPolynomial & c ,
+      const BinaryPolynomial & a , const BinaryPolynomial & b ) const {
+
+        mul(c,a,b);
+        rem(c,c);
+    }
+
+    /**
+     * @brief
+     *           Computes the square of a polynomial modulo the
+     *           modulus.
+     *
+     * @param c
+     *           On output, the remainder of \f$a^2\f$ divided
+     *           by the modulus.
+     *
+     * @param a
+     *           Polynomial that is squared.
+     *
+     * @warning
+     *           If not enough memory could be provided, an error
+     *           message is printed to <code>stderr</code> and the
+     *           program exits with status 'EXIT_FAILURE'.
+     */
+    void BinaryPolynomialModulus::sqrMod
+    ( BinaryPolynomial & c , const BinaryPolynomial & a ) const {
+
+        sqr(c,a);
+        rem(c,c);
+    }
+
+    /**
+     * @brief
+     *           Computes a power of a polynomial modulo the modulus.
+     *
+     * @details
+     *           The power is computed via left-to-right square
+     *           and multiply.
+     *
+     * @param c
+     *           On output, the remainder of \f$a^e\f$ divided
+     *           by the modulus.
+     *
+     * @param a
+     *           The base.
+     *
+     * @param e
+     *           The exponent.
+     *
+     * @warning
+     *           If not enough memory could be provided, an error
+     *           message is printed to <code>stderr</code> and the
+     *           program exits with status 'EXIT_FAILURE'.
+     */
+    void BinaryPolynomialModulus::powMod
+    ( BinaryPolynomial & c , const BinaryPolynomial & a , uint64_t e ) const {
+
+        BinaryPolynomial b;
+        rem(b,a);
+
+        c.setOne();
+        rem(c,c);
+
+        for ( int i = MathTools::numBits(e)-1 ; i >= 0 ; i-- ) {
+            sqrMod(c,c);
+            if ( (e >> i) & 1 ) {
+                mulMod(c,c,b);
+            }
+        }
+    }
+
+    /**
+     * @brief
+     *           Computes the <i>k</i>-fold iterated square of a
+     *           polynomial modulo the modulus.
+     *
+     * @details
+     *           The result equals \f$a^{2^k}\f$ modulo the modulus
+     *           which is the image of <i>a</i> under the
+     *           <i>k</i>th power of the Frobenius map.
+     *
+     * @param c
+     *           On output, the remainder of \f$a^{2^k}\f$ divided
+     *           by the modulus.
+     *
+     * @param a
+     *           Polynomial that is squared.
+     *
+     * @param k
+     *           Number of squarings.
+     *
+     * @warning
+     *           If <i>k</i> is negative, an error message is
+     *           printed to <code>stderr</code> and the program
+     *           exits with status 'EXIT_FAILURE'.
+     *
+     * @warning
+     *           If not enough memory could be provided, an error
+     *           message is printed to <code>stderr</code> and the
+     *           program exits with status 'EXIT_FAILURE'.
+     */
+    void BinaryPolynomialModulus::frobenius
+    ( BinaryPolynomial & c , const BinaryPolynomial & a , int k ) const {
+
+        if ( k < 0 ) {
+            cerr << "BinaryPolynomialModulus::frobenius: "
+                 << "number of squarings must be non-negative." << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        rem(c,a);
+
+        for ( int i = 0 ; i < k ; i++ ) {
+            sqrMod(c,c);
+        }
+    }
+
+    /**
+     * @brief
+     *           Computes the minimal polynomial of a polynomial
+     *           modulo the modulus.
+     *
+     * @details
+     *           Same as
+     *           \link BinaryPolynomial::minPolyMod()\endlink
+     *           but uses the precomputed data of this modulus for
+     *           the reductions.
+     *
+     * @param h
+     *           On output, the minimal polynomial of <i>g</i>
+     *           modulo the modulus.
+     *
+     * @param g
+     *           Polynomial of degree smaller than the modulus'
+     *           degree.
+     *
+     * @warning
+     *           If the degree of the modulus is smaller than 1,
+     *           an error message is printed to <code>stderr</code>
+     *           and the program exits with status 'EXIT_FAILURE'.
+     *
+     * @warning
+     *           If not enough memory could be provided, an error
+     *           message is printed to <code>stderr</code> and the
+     *           program exits with status 'EXIT_FAILURE'.
+     */
+    void BinaryPolynomialModulus::minPoly
+    ( BinaryPolynomial & h , const BinaryPolynomial & g ) const {
+
+        int n = this->f.deg();
+
+        if ( n < 1 ) {
+            cerr << "BinaryPolynomialModulus::minPoly: "
+                 << "modulus must be of degree greater than or equals 1."
+                 << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        BinaryPolynomial a(n+n) , b(n+n) , gr(n);
+        a.setOne();
+        b.setOne();
+        rem(gr,g);
+
+        // The sequence of the constant coefficients of 'g^j mod f'
+        for ( int j = 1 ; j < n+n ; j++ ) {
+            mulMod(b,b,gr);
+            a.setCoeff(j,b.getCoeff(0));
+        }
+
+        BinaryPolynomial s(n) , t(n);
+        pade(s,t,a,n+n,n);
+
+        int d;
+        if ( s.deg()+1 > t.deg() ) {
+            d = s.deg()+1;
+        } else {
+            d = t.deg();
+        }
+
+        h = t.reverse(d);
+    }
+}
@@ -45,6 +45,31 @@ using namespace std;
  */
 namespace thimble {
 
+    /**
+     * @brief
+     *            Returns the number of 64-bit words needed to encode a
+     *            binary vector of the specified length.
+     */
+    inline static int numWords64( int length ) {
+        return length/64+(length%64?1:0);
+    }
+
+    /**
+     * @brief
+     *            Sets the lowest <i>k</i> bits of the specified words
+     *            to 1; the remaining bits are unchanged.
+     */
+    static void setLowBits( uint64_t *data , int k ) {
+
+        int w = k/64;
+
+        memset(data,0xff,w*sizeof(uint64_t));
+
+        if ( k % 64 != 0 ) {
+            data[w] |= (((uint64_t)1)<<(k%64))-1;
+        }
+    }
+
     /**
      * @brief
      *            Standard constructor.
@@ -65,6 +90,7 @@ namespace thimble {
         this->data = NULL;
         this->length = 0;
         this->numWords = 0;
+        this->data32Valid = false;
 
         setLength(n);
     }
@@ -86,6 +112,7 @@ namespace thimble {
         this->data = NULL;
         this->length = 0;
         this->numWords = 0;
+        this->data32Valid = false;
         assign(v);
     }
 
@@ -120,11 +147,12 @@ namespace thimble {
 
         if ( this != &v ) {
 
-            int n = v.length/32+(v.length%32?1:0);
+            int n = numWords64(v.length);
 
             reserve(v.length);
-            memcpy(this->data,v.data,n*sizeof(uint32_t));
+            memcpy(this->data,v.data,n*sizeof(uint64_t));
             this->length = v.length;
+            this->data32Valid = false;
         }
     }
 
@@ -152,7 +180,7 @@ namespace thimble {
 
     	if ( this != &v ) {
 
-			int N = this->length/32 + (this->length%32?1:0);
+			int N = numWords64(this->length);
 
 			for ( int j = 0 ; j < N ; j++ ) {
 				if ( this->data[j] != v.data[j] ) {
@@ -182,16 +210,16 @@ namespace thimble {
 
         if ( length > 0 ) {
 
-            int numWords = length/32+(length%32?1:0);
+            int numWords = numWords64(length);
 
             if ( numWords > this->numWords ) {
 
                 if ( this->numWords > 0 ) {
-                    this->data = (uint32_t*)realloc
-                            (this->data,numWords*sizeof(uint32_t));
+                    this->data = (uint64_t*)realloc
+                            (this->data,numWords*sizeof(uint64_t));
                 } else {
-                    this->data = (uint32_t*)malloc
-                            (numWords*sizeof(uint32_t));
+                    this->data = (uint64_t*)malloc
+                            (numWords*sizeof(uint64_t));
                 }
 
                 if ( this->data == NULL ) {
@@ -243,24 +271,25 @@ namespace thimble {
         int oldLength , oldNumWords , newNumWords;
 
         oldLength = this->length;
-        oldNumWords = oldLength/32+(oldLength%32?1:0);
-        newNumWords = newLength/32+(newLength%32?1:0);
+        oldNumWords = numWords64(oldLength);
+        newNumWords = numWords64(newLength);
 
         // Initialize the new words (if any) as zeros.
         if ( newNumWords > oldNumWords ) {
-            memset(this->data+oldNumWords,0,(newNumWords-oldNumWords)*sizeof(uint32_t));
+            memset(this->data+oldNumWords,0,(newNumWords-oldNumWords)*sizeof(uint64_t));
         }
 
         // Pad the last bits of the latest word with zeros
-        if ( newLength % 32 != 0 ) {
-            uint32_t lb;
+        if ( newLength % 64 != 0 ) {
+            uint64_t lb;
             lb = 1;
-            lb <<= newLength%32;
+            lb <<= newLength%64;
             lb--;
             this->data[newNumWords-1] &= lb;
         }
 
         this->length = newLength;
+        this->data32Valid = false;
     }
 
 
@@ -293,10 +322,10 @@ namespace thimble {
 
         int j0 , j1;
 
-        j0 = j/32;
-        j1 = j%32;
+        j0 = j/64;
+        j1 = j%64;
 
-        return (this->data[j0]&((uint32_t)1<<j1))?true:false;
+        return (this->data[j0]&((uint64_t)1<<j1))?true:false;
     }
 
 
@@ -324,10 +353,11 @@ namespace thimble {
 
         int j0 , j1;
 
-        j0 = j/32;
-        j1 = j%32;
+        j0 = j/64;
+        j1 = j%64;
 
-        this->data[j0] |= (((uint32_t)1)<<j1);
+        this->data[j0] |= (((uint64_t)1)<<j1);
+        this->data32Valid = false;
     }
 
     /**
@@ -341,8 +371,8 @@ namespace thimble {
      *            function returns <code>false</code>.
      */
     bool BinaryVector::isZero() const {
-    	int s = this->length/32+(this->length%32?1:0);
-    	return MathTools::zeroTest32(this->data,s);
+    	int s = numWords64(this->length);
+    	return MathTools::zeroTest64(this->data,s);
     }
 
     /**
@@ -350,8 +380,9 @@ namespace thimble {
      *            Initialize all entries of this vector with 0.
      */
     void BinaryVector::setZero() {
-        int n = this->length / 32 + (this->length%32?1:0);
-        memset(this->data,0,n*sizeof(uint32_t));
+        int n = numWords64(this->length);
+        memset(this->data,0,n*sizeof(uint64_t));
+        this->data32Valid = false;
     }
 
     /**
@@ -414,10 +445,11 @@ namespace thimble {
 
         int j0 , j1;
 
-        j0 = j/32;
-        j1 = j%32;
+        j0 = j/64;
+        j1 = j%64;
 
-        this->data[j0] &= ~(((uint32_t)1)<<j1);
+        this->data[j0] &= ~(((uint64_t)1)<<j1);
+        this->data32Valid = false;
     }
 
 
@@ -467,20 +499,66 @@ namespace thimble {
      */
     void BinaryVector::random( bool tryRandom ) {
 
+        // Fill the 32-bit halves of the words in order such that
+        // the same random vectors as for a 32-bit word layout
+        // are produced
         int n = this->length/32+(this->length%32?1:0);
 
+        setZero();
         for ( int j = 0 ; j < n ; j++ ) {
-            this->data[j] = MathTools::rand32(tryRandom);
+            this->data[j/2] |=
+                ((uint64_t)MathTools::rand32(tryRandom)) << (32*(j%2));
         }
 
         // Set the most significant bits of the last word to
         // zero.
-        if ( this->length % 32 != 0 ) {
-            uint32_t lb;
-            lb = 1;
-            lb <<= this->length%32;
-            lb--;
-            this->data[n-1] &= lb;
+        if ( this->length % 64 != 0 ) {
+            this->data[(this->length-1)/64] &=
+                (((uint64_t)1) << (this->length%64)) - 1;
+        }
+    }
+
+    /**
+     * @brief
+     *            Copies the binary entries of the vector into an array
+     *            of 32-bit integers.
+     *
+     * @details
+     *            see 'BinaryVector.h'
+     */
+    void BinaryVector::getData32( uint32_t *words ) const {
+
+        int n = this->length/32+(this->length%32?1:0);
+
+        for ( int j = 0 ; j < n ; j++ ) {
+            words[j] = (uint32_t)(this->data[j/2] >> (32*(j%2)));
+        }
+    }
+
+    /**
+     * @brief
+     *            Replaces the binary entries of the vector by the
+     *            entries encoded in an array of 32-bit integers.
+     *
+     * @details
+     *            see 'BinaryVector.h'
+     */
+    void BinaryVector::setData32( const uint32_t *words , int numWords ) {
+
+        int n = this->length/32+(this->length%32?1:0);
+        if ( numWords > n ) {
+            numWords = n;
+        }
+
+        setZero();
+        for ( int j = 0 ; j < numWords ; j++ ) {
+            this->data[j/2] |= ((uint64_t)words[j]) << (32*(j%2));
+        }
+
+        // Clear the bits at positions not smaller than the length
+        if ( this->length % 64 != 0 ) {
+            this->data[(this->length-1)/64] &=
+                (((uint64_t)1) << (this->length%64)) - 1;
         }
     }
 
@@ -571,20 +649,7 @@ namespace thimble {
      */
     int BinaryVector::hammingWeight() const {
 
-    	int hw;
-    	int s;
-    	uint32_t *data;
-    	int j;
-
-    	hw = 0;
-    	s = (this->length/32) + (this->length%32?1:0);
-    	data = this->data;
-
-    	for ( j = 0 ; j < s ; j++ , data++ ) {
-    		hw += MathTools::hammingWeight(*data);
-    	}
-
-    	return hw;
+    	return MathTools::hw64(this->data,numWords64(this->length));
     }
 
     /**
@@ -624,10 +689,7 @@ namespace thimble {
     	}
 
     	setZero();
-
-    	for ( int j = 0 ; j < k ; j++ ) {
-    		setAt(j);
-    	}
+    	setLowBits(this->data,k);
     }
 
     /**
@@ -663,35 +725,48 @@ namespace thimble {
      */
     bool BinaryVector::bnext() {
 
-    	int n , i;
-
-    	n = getLength();
-
-    	i = 0;
-
-    	for ( int j = 0 ; j < n ; j++ ) {
-
-    		if ( getAt(j) ) {
-
-    			if ( j+1 >= n ) {
-    				return false;
-    			}
-
-    			clearAt(j);
+    	int n = getLength();
+    	int N = numWords64(n);
+    	uint64_t *data = this->data;
 
-    			if ( getAt(j+1) ) {
-    				setAt(i);
-    				++i;
-    			} else {
-    				setAt(j+1);
-    				return true;
-    			}
+    	this->data32Valid = false;
 
+    	// Position 'j' of the lowest 1
+    	int w = 0;
+    	while ( w < N && data[w] == 0 ) {
+    		++w;
+    	}
+    	if ( w >= N ) {
+    		return false;
+    	}
+    	int j = 64*w+MathTools::trailingZeros(data[w]);
+
+    	// Position 'e' of the first 0 after the run of 1s at 'j'
+    	uint64_t y = ~(data[w]>>(j%64));
+    	int e = y ? j+MathTools::trailingZeros(y) : j+64;
+    	while ( e == 64*(w+1) && w+1 < N ) {
+    		++w;
+    		y = ~data[w];
+    		if ( y ) {
+    			e += MathTools::trailingZeros(y);
+    			break;
     		}
+    		e += 64;
+    	}
 
+    	if ( e >= n ) {
+    		return false;
     	}
 
-    	return false;
+    	// Move the highest 1 of the run one position up and the
+    	// remaining 'e-j-1' 1s of the run to the bottom
+    	int we = e/64;
+    	memset(data,0,we*sizeof(uint64_t));
+    	data[we] &= ~((((uint64_t)1)<<(e%64))-1);
+    	data[we] |= ((uint64_t)1)<<(e%64);
+    	setLowBits(data,e-j-1);
+
+    	return true;
     }
 
     /**
@@ -747,7 +822,7 @@ namespace thimble {
      */
     void BinaryVector::swap( BinaryVector & v , BinaryVector & w ) {
 
-        uint32_t *data;
+        uint64_t *data;
         int length , numWords;
 
         data = v.data;
@@ -761,6 +836,8 @@ namespace thimble {
         w.data = data;
         w.length = length;
         w.numWords = numWords;
+        v.data32Valid = false;
+        w.data32Valid = false;
     }
 
     /**
@@ -800,7 +877,8 @@ namespace thimble {
 
         c.reserve(n);
 
-        MathTools::mxor32(c.data,a.data,b.data,n/32+(n%32?1:0));
+        MathTools::mxor64(c.data,a.data,b.data,numWords64(n));
+        c.data32Valid = false;
 
         c.length = n;
     }
@@ -835,7 +913,23 @@ namespace thimble {
             exit(EXIT_FAILURE);
         }
 
-        return MathTools::hd32(a.data,b.data,a.length/32+(a.length%32?1:0));
+        return MathTools::hd64(a.data,b.data,numWords64(a.length));
+    }
+
+    /**
+     * @brief
+     *            Determines the Hamming distances between a query
+     *            vector and each vector of a contiguous gallery.
+     *
+     * @details
+     *            see 'BinaryVector.h'
+     */
+    void BinaryVector::hammingDistanceBatch
+    ( int *d , const BinaryVector & query ,
+      const uint64_t *gallery , int num ) {
+
+        MathTools::hd64Batch
+        (d,query.data,gallery,numWords64(query.length),num);
     }
 
     /**
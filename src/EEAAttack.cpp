@@ -128,48 +128,82 @@ namespace thimble {
 		// Clear any previously result from the attack.
 		this->clear();
 
-		// Run the extended Euclidean algorithm ...
-		vector<SmallBinaryFieldPolynomial> R , P , Q;
-		xgcd(R,P,Q,V,W);
-
-		// .. and determine the relation that minimizes
-		// epsilon = deg(Q[j0]) where ...
-		int j0 = -1 , minEpsilon = INT_MAX;
-		for ( int j = 0 ; j < (int)R.size() ; j++ ) {
-			// ... R[j0] != 0  and deg(Q[j0])+k > R[j0].
-			if ( !R[j].isZero() && R[j].deg() < k + Q[j].deg() ) {
-				if ( Q[j].deg() < minEpsilon ) {
-					minEpsilon = Q[j].deg();
-					j0 = j;
-				}
+		// (Re-)allocate the workspace if the vaults are defined over
+		// a field different from the previous call.
+		const SmallBinaryField & gf = V.getField();
+		if ( this->workspace.size() != 7 ||
+			 &(this->workspace[0].getField()) != &gf ) {
+			this->workspace.assign(7,SmallBinaryFieldPolynomial(gf));
+		}
+		SmallBinaryFieldPolynomial & R   = this->workspace[0];
+		SmallBinaryFieldPolynomial & Q   = this->workspace[1];
+		SmallBinaryFieldPolynomial & R1  = this->workspace[2];
+		SmallBinaryFieldPolynomial & Q1  = this->workspace[3];
+		SmallBinaryFieldPolynomial & P   = this->workspace[4];
+		SmallBinaryFieldPolynomial & U   = this->workspace[5];
+		SmallBinaryFieldPolynomial & tmp = this->workspace[6];
+
+		// Run the extended Euclidean algorithm where each row fulfills
+		// R = P*V + Q*W. Along the rows, deg(R) strictly decreases while
+		// deg(Q) does not decrease. Consequently, the first row with
+		// R != 0 and deg(Q)+k > deg(R) is the relation that minimizes
+		// epsilon = deg(Q) and the remaining rows need not be computed.
+		R = V; Q.setZero();
+		R1 = W; Q1.setOne();
+
+		bool found = false;
+		while ( true ) {
+
+			if ( !R.isZero() && R.deg() < k + Q.deg() ) {
+				found = true;
+				break;
+			}
+
+			if ( R1.isZero() || R.deg() < 0 ) {
+				break;
 			}
+
+			divRem(U,tmp,R,R1);
+
+			R.swap(R1);
+			Q.swap(Q1);
+
+			R1.swap(tmp);
+
+			mul(tmp,U,Q);
+			sub(Q1,Q1,tmp);
 		}
 
-		// If none such j0 exist, the two vaults definitely do not
+		// If none such relation exist, the two vaults definitely do not
 		// protect feature sets that overlap in at least (t+k)/2
 		// elements and they are labeled as non-related.
-		if ( j0 < 0 ) {
+		if ( !found ) {
 			return false;
 		}
 
 		// Runs Step 3) of the algorithm.
-		SmallBinaryFieldPolynomial tmp(V.getField());
-		rem(tmp,V,Q[j0]);
+		rem(tmp,V,Q);
 		if ( tmp.deg() >= k ) {
 			return false;
 		}
 
-		// Now, the roots of Q[j0] and P[j0] form the
+		// The cofactor of V has not been tracked during the
+		// algorithm; it is recovered via P = (R - Q*W) / V.
+		mul(tmp,Q,W);
+		sub(tmp,R,tmp);
+		divRem(P,U,tmp,V);
+
+		// Now, the roots of Q and P form the
 		// differences of A\B and B\A, respectively, where
 		// A denotes the feature set protected by V and
 		// B the feature set protected by W.
 
 		// Allocate memory such that 'feature1' can store
 		// the elements of A\B.
-		if ( Q[j0].deg() == 0 ) {
+		if ( Q.deg() == 0 ) {
 			this->features1 = NULL;
 		} else {
-			this->features1 = (uint32_t*)malloc( Q[j0].deg() * sizeof(uint32_t) );
+			this->features1 = (uint32_t*)malloc( Q.deg() * sizeof(uint32_t) );
 			if ( this->features1 == NULL ) {
 				cerr << "PartialRecoveryAttack::perform: out of memory." << endl;
 				exit(EXIT_FAILURE);
@@ -178,20 +212,20 @@ namespace thimble {
 
 		// Allocate memory such that 'feature2' can store
 		// the elements of B\A.
-		if ( P[j0].deg() == 0 ) {
+		if ( P.deg() == 0 ) {
 			this->features2 = NULL;
 		} else {
-			this->features2 = (uint32_t*)malloc( P[j0].deg() * sizeof(uint32_t) );
+			this->features2 = (uint32_t*)malloc( P.deg() * sizeof(uint32_t) );
 			if ( this->features2 == NULL ) {
 				cerr << "PartialRecoveryAttack::perform: out of memory." << endl;
 				exit(EXIT_FAILURE);
 			}
 		}
 
-		// Find the roots of P[j0].
-		this->num_features2 = P[j0].findRoots(this->features2);
-		if ( this->num_features2 != P[j0].deg() ) {
-			// If P[j0] does not completely split into linear factors
+		// Find the roots of P.
+		this->num_features2 = P.findRoots(this->features2);
+		if ( this->num_features2 != P.deg() ) {
+			// If P does not completely split into linear factors
 			// the feature set protected by W that overlaps the feature set
 			// protected by V does not exist in the base field (but
 			// possibly in an extension). In any case, the two vaults
@@ -200,10 +234,10 @@ namespace thimble {
 			return false;
 		}
 
-		// Find the roots of Q[j0].
-		this->num_features1 = Q[j0].findRoots(this->features1);
-		if ( this->num_features1 != Q[j0].deg() ) {
-			// see above; the same as for P[j0]
+		// Find the roots of Q.
+		this->num_features1 = Q.findRoots(this->features1);
+		if ( this->num_features1 != Q.deg() ) {
+			// see above; the same as for P
 			clear();
 			return false;
 		}
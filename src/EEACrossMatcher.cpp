@@ -0,0 +1,236 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file EEACrossMatcher.cpp
+ *
+ * @brief
+ *            Implementation of a mechanism for cross-matching all pairs
+ *            of a gallery of instances of the <em>improved fuzzy vault
+ *            scheme</em> as provided by the 'EEACrossMatcher.h' header.
+ *
+ * @author agent
+ */
+
+#include <stdint.h>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <thimble/security/EEAAttack.h>
+#include <thimble/security/EEACrossMatcher.h>
+
+using namespace std;
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/*
+	 * see 'EEACrossMatcher.h' for the documentation.
+	 */
+	EEACrossMatchSink::~EEACrossMatchSink() {
+	}
+
+	/*
+	 * see 'EEACrossMatcher.h' for the documentation.
+	 */
+	EEACrossMatcher::EEACrossMatcher( int numThreads , int blockSize ) {
+
+		if ( numThreads < 0 || blockSize <= 0 ) {
+			cerr << "EEACrossMatcher: Bad arguments." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		if ( numThreads == 0 ) {
+			numThreads = (int)thread::hardware_concurrency();
+			if ( numThreads <= 0 ) {
+				numThreads = 1;
+			}
+		}
+
+		this->numThreads = numThreads;
+		this->blockSize = blockSize;
+	}
+
+	/**
+	 * @brief
+	 *            State shared by the threads of a run of
+	 *            \link EEACrossMatcher::crossMatch()\endlink.
+	 */
+	struct EEACrossMatchSchedule {
+
+		/**
+		 * @brief
+		 *            The gallery of vaults.
+		 */
+		const SmallBinaryFieldPolynomial *vaults;
+
+		/**
+		 * @brief
+		 *            The number of vaults in the gallery.
+		 */
+		int n;
+
+		/**
+		 * @brief
+		 *            The size of the secret polynomials.
+		 */
+		int k;
+
+		/**
+		 * @brief
+		 *            The number of vaults per block.
+		 */
+		int blockSize;
+
+		/**
+		 * @brief
+		 *            The tiles as pairs of block indices
+		 *            <i>(bi,bj)</i> with <i>bi&lt;=bj</i>.
+		 */
+		vector< pair<int,int> > tiles;
+
+		/**
+		 * @brief
+		 *            The index of the next tile to be processed.
+		 */
+		atomic<size_t> nextTile;
+
+		/**
+		 * @brief
+		 *            The sink receiving the related pairs.
+		 */
+		EEACrossMatchSink *sink;
+
+		/**
+		 * @brief
+		 *            Serializes the calls of the sink.
+		 */
+		mutex sinkMutex;
+
+		/**
+		 * @brief
+		 *            The number of related pairs.
+		 */
+		atomic<uint64_t> numRelated;
+	};
+
+	/**
+	 * @brief
+	 *            Processes tiles of a cross-matching schedule until all
+	 *            tiles have been handed out.
+	 *
+	 * @param schedule
+	 *            The shared state of the cross-matching.
+	 */
+	static void crossMatchWorker( EEACrossMatchSchedule *schedule ) {
+
+		// The attack, and thus its workspace, is reused for all pairs
+		// processed by this thread.
+		EEAAttack attack;
+
+		const SmallBinaryFieldPolynomial *vaults = schedule->vaults;
+		int n = schedule->n;
+		int k = schedule->k;
+		int blockSize = schedule->blockSize;
+
+		while ( true ) {
+
+			size_t tile = schedule->nextTile.fetch_add(1);
+			if ( tile >= schedule->tiles.size() ) {
+				break;
+			}
+
+			int i0 = schedule->tiles[tile].first * blockSize;
+			int j0 = schedule->tiles[tile].second * blockSize;
+			int i1 = min(i0 + blockSize,n);
+			int j1 = min(j0 + blockSize,n);
+
+			for ( int i = i0 ; i < i1 ; i++ ) {
+				for ( int j = max(j0,i+1) ; j < j1 ; j++ ) {
+
+					if ( attack.perform(vaults[i],vaults[j],k) ) {
+
+						schedule->numRelated.fetch_add(1);
+
+						lock_guard<mutex> lock(schedule->sinkMutex);
+						schedule->sink->report(i,j,attack);
+					}
+				}
+			}
+		}
+	}
+
+	/*
+	 * see 'EEACrossMatcher.h' for the documentation.
+	 */
+	uint64_t EEACrossMatcher::crossMatch
+	( const SmallBinaryFieldPolynomial *vaults , int n , int k ,
+	  EEACrossMatchSink & sink ) const {
+
+		if ( n < 0 ) {
+			cerr << "EEACrossMatcher::crossMatch: Bad arguments." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		EEACrossMatchSchedule schedule;
+		schedule.vaults = vaults;
+		schedule.n = n;
+		schedule.k = k;
+		schedule.blockSize = this->blockSize;
+		schedule.nextTile = 0;
+		schedule.sink = &sink;
+		schedule.numRelated = 0;
+
+		// Tiles of the upper triangle of the pair matrix; tiles along
+		// a row share the vaults of the row block.
+		int numBlocks = (n + this->blockSize - 1) / this->blockSize;
+		for ( int bi = 0 ; bi < numBlocks ; bi++ ) {
+			for ( int bj = bi ; bj < numBlocks ; bj++ ) {
+				schedule.tiles.push_back(make_pair(bi,bj));
+			}
+		}
+
+		// Do not start more threads than there are tiles.
+		int numThreads = this->numThreads;
+		if ( (size_t)numThreads > schedule.tiles.size() ) {
+			numThreads = (int)schedule.tiles.size();
+		}
+
+		if ( numThreads <= 1 ) {
+			crossMatchWorker(&schedule);
+		} else {
+			vector<thread> threads;
+			for ( int l = 0 ; l < numThreads ; l++ ) {
+				threads.push_back(thread(crossMatchWorker,&schedule));
+			}
+			for ( int l = 0 ; l < numThreads ; l++ ) {
+				threads[l].join();
+			}
+		}
+
+		return schedule.numRelated;
+	}
+}
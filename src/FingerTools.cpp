@@ -34,6 +34,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <cfloat>
+#include <cstring>
 #include <string>
 #include <algorithm>
 
@@ -41,6 +42,7 @@
 #include <thimble/math/RigidTransform.h>
 #include <thimble/image/Orientation.h>
 #include <thimble/finger/MinutiaeRecord.h>
+#include <thimble/finger/MinutiaeArrays.h>
 #include <thimble/finger/FingerTools.h>
 
 using namespace std;
@@ -117,21 +119,13 @@ namespace thimble {
 	 MinutiaeView FingerTools::eval
 	( const AffineTransform & f , const MinutiaeView & v ) {
 
-		 // First, make a copy of the input template to reserve
-		 // memory and to adopt the finger position, impression
-		 // type, and finger quality.
-		 MinutiaeView w = v;
+		 // Move the minutiae in bulk on their coordinate arrays which
+		 // also adopt the finger position, impression type, and finger
+		 // quality.
+		 MinutiaeArrays a(v);
+		 a.transform(f);
 
-		 // Remove all minutiae
-		 w.removeAllMinutiae();
-
-		 // Successively append the moved minutiae of the input
-		 // to the output
-		 for ( int i = 0 ; i < v.getMinutiaeCount() ; i++ ) {
-			 w.addMinutia(eval(f,v.getMinutia(i)));
-		 }
-
-		 return w;
+		 return a.toView();
 	}
 
 		/**
@@ -168,147 +162,60 @@ namespace thimble {
 
 	/**
 	 * @brief
-	 *            Computes the dissimilarity between 'v' and 'w'.
+	 *            Computes a similarity measure between two minutiae
+	 *            templates.
 	 *
 	 * @details
-	 *            This function is used by the functions
-	 *            \link
-	 *  FingerTools::dist(const MinutiaeView&v,const MinutiaeView&,int,double)
-	 *            \endlink
-	 *            and
-	 *            \link
-	 *  FingerTools:align(const MinutiaeView&v,const MinutiaeView&,int,double)
-	 *            \endlink.
-	 *            Unlike the user function
-	 *            \link
-	 *  FingerTools::dist(const MinutiaeView&v,const MinutiaeView&,int,double)
-	 *            \endlink
-	 *            it contains an additional parameter <code>distances</code>
-	 *            which is required to be an array that can hold at least
-	 *            <code>m</code> <code>double</code> values. This is to
-	 *            avoid frequent reallocations by the
-	 *            \link
-	 *  FingerTools:align(const MinutiaeView&v,const MinutiaeView&,int,double)
-	 *            \endlink
-	 *            which is imperformant. Because the function can be used to
-	 *            implement
-	 *            \link
-	 *  FingerTools::dist(const MinutiaeView&v,const MinutiaeView&,int,double)
-	 *            \endlink
-	 *            it is also used there to follow the minimal principle in
-	 *            programming.
-	 *            <br><br>
-	 *            The result is the sum of the distance between the
-     *            <i>m</i> minutiae pairs from <i>v</i> and <i>w</i> with
-	 *            minimal &quot;distance&quot; (by means of \link
-	 *             FingerTools::dist(const Minutia&,const Minutia&,double)
-	 *            \endlink).
-	 *            <br><br>
-	 *            More precisely, let <i>v[0],...,v[k-1]</i> and
-	 *            <i>w[0],...,w[l-1]</i> be the minutiae of <i>v</i> and
-	 *            <i>w</i>, respectively, such that
-	 *            <i>
-	 *             dist(v[i],w[i],angleWeight) <=
-	 *             dist(v[j],w[j],angleWeight)
-	 *            </i>
-	 *            if <i>i < j</i>. Then the result is
-	 *            <pre>
-	 *    dist(v[0],w[0],angleWeight)+...+dist(v[m-1],w[m-1],angleWeight).
-	 *            </pre>
-	 *            Note, that, contrary to
-	 *            \link
-	 *  FingerTools::dist(const MinutiaeView&v,const MinutiaeView&,int,double)
-	 *            \endlink
-	 *            here the template <i>v</i> and <i>w</i> are required to
-	 *            contain at least <i>m</i> minutiae where <i>m</i> is
-	 *            required to be strictly larger than 0.
-	 *
-	 * @param v
-	 *            First minutiae template.
-	 *
-	 * @param w
-	 *            Second minutiae template.
-	 *
-	 * @param m
-	 *            Number of minutiae correspondences between <i>v</i> and
-	 *            <i>w</i> that are taken into account.
-	 *
-	 * @param angleWeight
-	 *            Controls how significant the minutiae angles are taken
-	 *            into account.
-	 *
-	 * @param distances
-	 *            Pre-allocated array that can hold <i>m</i>
-	 *            <code>double</code> values for internal use.
-	 *
-	 * @return
-	 *            Dissimilarity between <i>v</i> and <i>w</i>.
-	 *
-	 * @warning
-	 *            If the prerequisites found in the details are not
-	 *            satisfied, the result and the behavior of the function is
-	 *            undocumented.
+	 *            see 'FingerTools.h'
 	 */
-	static double dist
+	double FingerTools::dist
 	( const MinutiaeView & v , const MinutiaeView & w ,
-	  int m , double angleWeight , double *distances ) {
-
-		// Initialize the array that keeps track if the 'm'
-		// most similar minutiae correspondences betwee 'v'
-		// and 'w'
-		for ( int i = 0 ; i < m ; i++ ) {
-			distances[i] = DBL_MAX;
-		}
-
-		// Iterate over all minutiae in 'v'
-		for ( int i = 0 ; i < v.getMinutiaeCount() ; i++ ) {
+	  int n , double angleWeight ) {
 
-			// Find the most similar minutia from 'w' to the 'i'th of 'v'
-			// as well as its distance
-			double minDist = DBL_MAX;
-			for ( int j = 0 ; j < w.getMinutiaeCount() ; j++ ) {
-				double d = FingerTools::dist
-						(v.getMinutia(i),w.getMinutia(j),angleWeight);
-				if ( d < minDist ) {
-					minDist = d;
-				}
-			}
+		return MinutiaeArrays::dist
+				(MinutiaeArrays(v),MinutiaeArrays(w),n,angleWeight);
+	}
 
-			// Insert the dissimilarity in 'distances' if it is among the
-			// 'm' minimal values
-			for ( int k = 0 ; k < m ; k++ ) {
-				if ( minDist < distances[k] ) {
-					for ( int l = m-1 ; l > k ; l-- ) {
-						distances[l] = distances[l-1];
-					}
-					distances[k] = minDist;
-					break;
-				}
-			}
-		}
+	/**
+	 * @brief
+	 *            Number of bins into which the rotation angles are
+	 *            quantized by the Hough transform of
+	 *  FingerTools::align(const MinutiaeView&,const MinutiaeView&,int,double).
+	 */
+	static const int HOUGH_ROTATION_BINS = 32;
 
-		// Sum up the values in 'distances' ...
-		double d = 0.0;
-		for ( int i = 0 ; i < m ; i++ ) {
-			if ( distances[i] < DBL_MAX ) {
-				d += distances[i];
-			}
-		}
+	/**
+	 * @brief
+	 *            Minimal side length of the translation bins of the
+	 *            Hough transform.
+	 */
+	static const double HOUGH_TRANSLATION_CELL = 16.0;
 
-		// ... which is the result.
-		return d;
-	}
+	/**
+	 * @brief
+	 *            Maximal number of translation bins per axis; if the
+	 *            translations spread further, the bins are enlarged.
+	 */
+	static const int HOUGH_MAX_TRANSLATION_CELLS = 64;
 
+	/**
+	 * @brief
+	 *            Number of top-scoring bins of the Hough transform whose
+	 *            correspondences (and those of their neighboring bins) are
+	 *            evaluated as candidate alignments.
+	 */
+	static const int HOUGH_PEAKS = 3;
 
 	/**
 	 * @brief
-	 *            Computes a similarity measure between two minutiae
-	 *            templates.
+	 *            Determines a spatial movement as an affine transform
+	 *            that aligns the minutiae in <code>w</code> to the
+	 *            minutiae in <code>v</code>.
 	 *
 	 * @details
 	 *            see 'FingerTools.h'
 	 */
-	double FingerTools::dist
+	AffineTransform FingerTools::align
 	( const MinutiaeView & v , const MinutiaeView & w ,
 	  int n , double angleWeight ) {
 
@@ -323,40 +230,188 @@ namespace thimble {
 			m = std::min(m,n);
 		}
 
-		// Special case
+		// Keeps track of the movement that minimizes the dissimilarity
+		// between 'v' and the moved 'w'.
+		AffineTransform f;
+
+		// Check for special case.
 		if ( m == 0 ) {
-			return 0.0;
+			return f;
 		}
 
-		// Allocate memory
-		double *distances = (double*)malloc(m*sizeof(double));
-		if ( distances == NULL ) {
-			cerr << "FingerTools:dist(const MinutiaeView&,"
+		// Number of votes
+		int numVotes = k*l;
+
+		// Allocate memory for the translations voted for and for the
+		// bins of the votes
+		double *buffer = (double*)malloc((m+2*numVotes)*sizeof(double));
+		int *votes = (int*)malloc(numVotes*sizeof(int));
+		if ( buffer == NULL || votes == NULL ) {
+			cerr << "FingerTools::align(const MinutiaeView&,"
 				 << "const MinutiaeView&,int,double): Out of memory."
 				 << endl;
 			exit(EXIT_FAILURE);
 		}
+		double *distances = buffer;
+		double *tx = distances+m , *ty = tx+numVotes;
+
+		// Coordinate arrays of 'v', 'w', and the moved 'w'
+		MinutiaeArrays va(v) , wa(w) , ua(w);
+		const double *vx = va.getX() , *vy = va.getY() , *vtheta = va.getAngles();
+		const double *wx = wa.getX() , *wy = wa.getY() , *wtheta = wa.getAngles();
+
+		// Rotation matrices at the centers of the rotation bins in the
+		// same convention as 'FingerTools::align(a,b)', i.e. the bin
+		// 'r' corresponds to a rotation of 'b' by the angle
+		// '-(r+0.5)*2*PI/HOUGH_ROTATION_BINS'
+		double cost[HOUGH_ROTATION_BINS] , sint[HOUGH_ROTATION_BINS];
+		for ( int r = 0 ; r < HOUGH_ROTATION_BINS ; r++ ) {
+			double delta = -(r+0.5)*(M_PI+M_PI)/HOUGH_ROTATION_BINS;
+			cost[r] = cos(delta);
+			sint[r] = sin(delta);
+		}
 
-		// Compute the sum
-		double d = thimble::dist(v,w,m,angleWeight,distances);
+		// Each correspondence between the 'i'th minutia of 'v' and the
+		// 'j'th minutia of 'w' votes for the rotation that maps the
+		// angle of the latter to the angle of the former and for the
+		// translation that, together with the rotation of its bin's
+		// center, maps the position of the latter to the former's.
+		double minX = DBL_MAX , maxX = -DBL_MAX;
+		double minY = DBL_MAX , maxY = -DBL_MAX;
+		for ( int i = 0 , s = 0 ; i < k ; i++ ) {
+			for ( int j = 0 ; j < l ; j++ , s++ ) {
+
+				double rotation = (vtheta[i]-wtheta[j])/(M_PI+M_PI);
+				rotation -= floor(rotation);
+				int r = (int)(rotation*HOUGH_ROTATION_BINS);
+				if ( r >= HOUGH_ROTATION_BINS ) {
+					r = HOUGH_ROTATION_BINS-1;
+				}
 
-		// Free memory
-		free(distances);
+				tx[s] = vx[i]-(cost[r]*wx[j]+sint[r]*wy[j]);
+				ty[s] = vy[i]-(-sint[r]*wx[j]+cost[r]*wy[j]);
+				votes[s] = r;
+
+				minX = std::min(minX,tx[s]);
+				maxX = std::max(maxX,tx[s]);
+				minY = std::min(minY,ty[s]);
+				maxY = std::max(maxY,ty[s]);
+			}
+		}
+
+		// Quantization of the translations
+		double cellSize = std::max
+			(HOUGH_TRANSLATION_CELL,
+			 std::max(maxX-minX,maxY-minY)/HOUGH_MAX_TRANSLATION_CELLS);
+		int nx = (int)((maxX-minX)/cellSize)+1;
+		int ny = (int)((maxY-minY)/cellSize)+1;
+		int numBins = HOUGH_ROTATION_BINS*ny*nx;
+
+		int *accumulator = (int*)calloc(numBins,sizeof(int));
+		if ( accumulator == NULL ) {
+			cerr << "FingerTools::align(const MinutiaeView&,"
+				 << "const MinutiaeView&,int,double): Out of memory."
+				 << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		// Cast the votes
+		for ( int s = 0 ; s < numVotes ; s++ ) {
+			int ix = std::min((int)((tx[s]-minX)/cellSize),nx-1);
+			int iy = std::min((int)((ty[s]-minY)/cellSize),ny-1);
+			votes[s] = (votes[s]*ny+iy)*nx+ix;
+			accumulator[votes[s]]++;
+		}
+
+		// Determine the top-scoring bins; each bin is only considered
+		// once by negating its score after it has been visited
+		int peaks[HOUGH_PEAKS] , scores[HOUGH_PEAKS];
+		for ( int p = 0 ; p < HOUGH_PEAKS ; p++ ) {
+			peaks[p] = -1;
+			scores[p] = 0;
+		}
+		for ( int s = 0 ; s < numVotes ; s++ ) {
+			int b = votes[s];
+			int score = accumulator[b];
+			if ( score <= 0 ) {
+				continue;
+			}
+			accumulator[b] = -score;
+			for ( int p = 0 ; p < HOUGH_PEAKS ; p++ ) {
+				if ( score > scores[p] ) {
+					for ( int q = HOUGH_PEAKS-1 ; q > p ; q-- ) {
+						peaks[q] = peaks[q-1];
+						scores[q] = scores[q-1];
+					}
+					peaks[p] = b;
+					scores[p] = score;
+					break;
+				}
+			}
+		}
+
+		// Mark the top-scoring bins and their neighbors; the rotation
+		// bins wrap around
+		memset(accumulator,0,numBins*sizeof(int));
+		for ( int p = 0 ; p < HOUGH_PEAKS && peaks[p] >= 0 ; p++ ) {
+			int ix = peaks[p] % nx;
+			int iy = (peaks[p] / nx) % ny;
+			int r = peaks[p] / (nx*ny);
+			for ( int dr = -1 ; dr <= 1 ; dr++ ) {
+				int rr = (r+dr+HOUGH_ROTATION_BINS) % HOUGH_ROTATION_BINS;
+				for ( int yy = std::max(iy-1,0) ; yy <= std::min(iy+1,ny-1) ; yy++ ) {
+					for ( int xx = std::max(ix-1,0) ; xx <= std::min(ix+1,nx-1) ; xx++ ) {
+						accumulator[(rr*ny+yy)*nx+xx] = 1;
+					}
+				}
+			}
+		}
+
+		// Keeps track of the minimal dissimilarity found.
+		double minDist = DBL_MAX;
+
+		// Refine by evaluating the correspondences that voted for the
+		// marked bins; the moved 'w' is computed in place in 'ua'
+		for ( int i = 0 , s = 0 ; i < k ; i++ ) {
+			for ( int j = 0 ; j < l ; j++ , s++ ) {
+
+				if ( accumulator[votes[s]] == 0 ) {
+					continue;
+				}
+
+				AffineTransform g =
+						FingerTools::align(v.getMinutia(i),w.getMinutia(j));
+
+				ua.assign(wa,g);
+
+				double d = MinutiaeArrays::dist(va,ua,m,angleWeight,distances);
+
+				if ( d < minDist ) {
+					minDist = d;
+					f.assign(g);
+				}
+			}
+		}
+
+		// Free memory, prior returning.
+		free(accumulator);
+		free(votes);
+		free(buffer);
 
-		// Return the result
-		return d;
+		return f;
 	}
 
 	/**
 	 * @brief
 	 *            Determines a spatial movement as an affine transform
 	 *            that aligns the minutiae in <code>w</code> to the
-	 *            minutiae in <code>v</code>.
+	 *            minutiae in <code>v</code> by examining all minutiae
+	 *            correspondences.
 	 *
 	 * @details
 	 *            see 'FingerTools.h'
 	 */
-	AffineTransform FingerTools::align
+	AffineTransform FingerTools::alignExhaustively
 	( const MinutiaeView & v , const MinutiaeView & w ,
 	  int n , double angleWeight ) {
 
@@ -383,41 +438,34 @@ namespace thimble {
 		// Allocate memory
 		double *distances = (double*)malloc(m*sizeof(double));
 		if ( distances == NULL ) {
-			cerr << "FingerTools::align(const MinutiaeView&,"
+			cerr << "FingerTools::alignExhaustively(const MinutiaeView&,"
 				 << "const MinutiaeView&,int,double): Out of memory."
 				 << endl;
 			exit(EXIT_FAILURE);
 		}
 
+		// Coordinate arrays of 'v', 'w', and the moved 'w'
+		MinutiaeArrays va(v) , wa(w) , ua(w);
+
 		// Keeps track of the minimal dissimilarity found.
 		double minDist = DBL_MAX;
 
-		// We will use 'u' to save the movement of 'w' under a
-		// candidate alignment; we will not use the function
-		// 'FingerTools::eval(f,w)' for performance reasons
-		// (using 'FingerTools::eval(f,w)' would cause frequent
-		//  allocation and frees which is imperformant)
-		MinutiaeView u = w;
-
 		// Iterate over all minutiae correspondence
-		for ( int i = 0 ; i < v.getMinutiaeCount() ; i++ ) {
-			for ( int j = 0 ; j < w.getMinutiaeCount() ; j++ ) {
+		for ( int i = 0 ; i < k ; i++ ) {
+			for ( int j = 0 ; j < l ; j++ ) {
 
 				// Determine the candidate alignment that moves the 'j'th
 				// minutia of 'w' to the 'i'th minutia of 'v'.
 				AffineTransform g =
 						FingerTools::align(v.getMinutia(i),w.getMinutia(j));
 
-				// Move 'w' under the candidate alignment 'g' and collect
-				// the moved minutiae in 'u'
-				u.removeAllMinutiae();
-				for ( int k = 0 ; k < w.getMinutiaeCount() ; k++ ) {
-					Minutia minutia = FingerTools::eval(g,w.getMinutia(k));
-					u.addMinutia(minutia);
-				}
+				// Move 'w' under the candidate alignment 'g'; the moved
+				// minutiae are computed in place such that no minutiae
+				// need to be constructed
+				ua.assign(wa,g);
 
-				// Determine the dissimilarity between 'v' and 'u'
-				double d = thimble::dist(v,u,m,angleWeight,distances);
+				// Determine the dissimilarity between 'v' and the moved 'w'
+				double d = MinutiaeArrays::dist(va,ua,m,angleWeight,distances);
 
 				// If the dissimilarity is smaller, update
 				if ( d < minDist ) {
@@ -44,7 +44,7 @@
 #include <thimble/ecc/ReedSolomonCode.h>
 #include <thimble/ecc/GuruswamiSudanDecoder.h>
 #include <thimble/security/AES.h>
-#include <thimble/security/SHA.h>
+#include <thimble/security/Hash.h>
 #include <thimble/security/FuzzyVaultTools.h>
 #include <thimble/security/FuzzyVault.h>
 
@@ -55,6 +55,14 @@ using namespace std;
  */
 namespace thimble {
 
+	/**
+	 * @brief
+	 *            Number of consecutive slow-down values whose derived
+	 *            keys are tried at once when opening a vault
+	 *            (see \link AES128::decryptBatch()\endlink).
+	 */
+	static const int _SLOW_DOWN_BATCH = 8;
+
 	/*
 	 * see 'FuzzyVault.h' for the documentation.
 	 */
@@ -192,7 +200,8 @@ namespace thimble {
 			}
 
 			// Copy hash value of secret polynomial
-			memcpy(this->hash,vault.hash,20);
+			this->hashAlgorithm = vault.hashAlgorithm;
+			memcpy(this->hash,vault.hash,Hash::MAX_DIGEST_SIZE);
 		}
 
 	}
@@ -217,6 +226,7 @@ namespace thimble {
 		SmallBinaryField *gfPtr = this->gfPtr;
 		uint8_t *vaultPolynomialData = this->vaultPolynomialData;
 		uint8_t *encryptedVaultPolynomialData = this->encryptedVaultPolynomialData;
+		HASH_ALGORITHM_T hashAlgorithm = this->hashAlgorithm;
 
 		// Copy primitive members of 'vault' to 'this'
 		this->n = vault.n;
@@ -225,6 +235,7 @@ namespace thimble {
 		this->gfPtr = vault.gfPtr;
 		this->vaultPolynomialData = vault.vaultPolynomialData;
 		this->encryptedVaultPolynomialData = vault.encryptedVaultPolynomialData;
+		this->hashAlgorithm = vault.hashAlgorithm;
 
 		// Copy backups to 'vault'
 		vault.n = n;
@@ -233,6 +244,7 @@ namespace thimble {
 		vault.gfPtr = gfPtr;
 		vault.vaultPolynomialData = vaultPolynomialData;
 		vault.encryptedVaultPolynomialData = encryptedVaultPolynomialData;
+		vault.hashAlgorithm = hashAlgorithm;
 
 		// SPECIAL CASE: Swap the 'slowDownFactor' fields using
 		// the 'BigInteger::swap' method.
@@ -240,10 +252,10 @@ namespace thimble {
 
 		// SPECIAL CASE: swap the secret polynomials' hash values
 		// via 'memcpy'
-		uint8_t hash[20];
-		memcpy(hash,this->hash,20);
-		memcpy(this->hash,vault.hash,20);
-		memcpy(vault.hash,hash,20);
+		uint8_t hash[Hash::MAX_DIGEST_SIZE];
+		memcpy(hash,this->hash,Hash::MAX_DIGEST_SIZE);
+		memcpy(this->hash,vault.hash,Hash::MAX_DIGEST_SIZE);
+		memcpy(vault.hash,hash,Hash::MAX_DIGEST_SIZE);
 
 		// SPECIAL CASE: Swap the 'permutation' fields using
 		// the 'Permutation::swap' method.
@@ -332,6 +344,26 @@ namespace thimble {
 		this->slowDownFactor = slowDownFactor;
 	}
 
+	/*
+	 * see 'FuzzyVault.h' for the documentation.
+	 */
+	void FuzzyVault::setHashAlgorithm( HASH_ALGORITHM_T algorithm ) {
+
+		if ( isEnrolled() ) {
+			cerr << "FuzzyVault::setHashAlgorithm: "
+				 << "already protected data; clear first." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		if ( !Hash::isValid(algorithm) ) {
+			cerr << "FuzzyVault::setHashAlgorithm: "
+				 << "invalid argument." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		this->hashAlgorithm = algorithm;
+	}
+
 	/*
 	 * see 'FuzzyVault.h' for the documentation.
 	 */
@@ -363,6 +395,13 @@ namespace thimble {
 		return this->slowDownFactor;
 	}
 
+	/*
+	 * see 'FuzzyVault.h' for the documentation.
+	 */
+	HASH_ALGORITHM_T FuzzyVault::getHashAlgorithm() const {
+		return this->hashAlgorithm;
+	}
+
 	/*
 	 * see 'FuzzyVault.h' for the documentation.
 	 */
@@ -394,7 +433,7 @@ namespace thimble {
 		SmallBinaryFieldPolynomial f(getField());
 		f.random(this->k,true);
 
-        SHA().hash(this->hash,f.getData(),f.deg()+1);
+        Hash(this->hashAlgorithm).hash(this->hash,f.getData(),f.deg()+1);
         updatePermutation();
 
 		SmallBinaryFieldPolynomial V(getField());
@@ -617,32 +656,74 @@ namespace thimble {
 			exit(EXIT_FAILURE);
 		}
 
+		// Practical slow-down factors fit into 64 bits and are iterated
+		// with a fixed-width counter; only oversized factors need to be
+		// iterated as big integers.
+		bool fixedWidth = this->slowDownFactor.numBits() <= 64;
+		uint64_t slowDownFactor64 = this->slowDownFactor.toUInt64();
+		uint64_t slowDownVal64 = 0;
+		BigInteger slowDownVal = 0;
+
+		// The vault data is decrypted under the keys of up to
+		// '_SLOW_DOWN_BATCH' slow-down values at once.
+		int m = vaultDataSize();
+		AES128 keys[_SLOW_DOWN_BATCH];
+		uint8_t *data = (uint8_t*)malloc
+				( _SLOW_DOWN_BATCH * m * sizeof(uint8_t) );
+		if ( data == NULL ) {
+			cerr << "FuzzyVault::open: "
+				 << "out of memory." << endl;
+			exit(EXIT_FAILURE);
+		}
+
 		// Iteration over possible slow-down values.
-		for ( BigInteger slowDownVal = 0 ;
-			  BigInteger::compare(slowDownVal,this->slowDownFactor) < 0 ;
-			  add(slowDownVal,slowDownVal,1) ) {
+		while ( !success &&
+				(fixedWidth ? slowDownVal64 < slowDownFactor64 :
+				 BigInteger::compare(slowDownVal,this->slowDownFactor) < 0) ) {
+
+			// Derive the keys of the next slow-down values ...
+			int num = 0;
+			while ( num < _SLOW_DOWN_BATCH &&
+					(fixedWidth ? slowDownVal64 < slowDownFactor64 :
+					 BigInteger::compare(slowDownVal,this->slowDownFactor) < 0) ) {
+				if ( fixedWidth ) {
+					keys[num++] = deriveKey(slowDownVal64++,this->hashAlgorithm);
+				} else {
+					keys[num++] = deriveKey(slowDownVal,this->hashAlgorithm);
+					add(slowDownVal,slowDownVal,1);
+				}
+			}
 
-			// Unpack the vault using the current slow-down value
-			// as the decryption key.
-			V = unpackVaultPolynomial(slowDownVal);
+			// ... and decrypt the vault data under all of them.
+			AES128::decryptBatch
+			(data,keys,num,this->vaultPolynomialData,m);
 
-			// Build unlocking set '{ (x[j],y[j]) }'
-			for ( int j = 0 ; j < s ; j++ ) {
-				// Do not forget to apply the application to the
-				// query feature set.
-				x[j] = _reorder(queryFeatures[j]);
-				y[j] = V.eval(x[j]);
-			}
+			for ( int l = 0 ; l < num ; l++ ) {
+
+				// Unpack the vault using the current slow-down value
+				// as the decryption key.
+				V = toVaultPolynomial(data+l*m);
+
+				// Build unlocking set '{ (x[j],y[j]) }'
+				for ( int j = 0 ; j < s ; j++ ) {
+					// Do not forget to apply the application to the
+					// query feature set.
+					x[j] = _reorder(queryFeatures[j]);
+					y[j] = V.eval(x[j]);
+				}
 
-			// Decoding attempt.
-			success = decode(f,x,y,s,getSecretSize(),getHash());
+				// Decoding attempt.
+				success = decode(f,x,y,s,getSecretSize(),getHash());
 
-			// We are done if the decoding attempt was successful
-			if ( success ) {
-				break;
+				// We are done if the decoding attempt was successful
+				if ( success ) {
+					break;
+				}
 			}
 		}
 
+		free(data);
+
 		// If the decoding attempt was successful and if
 		// the 'features' is non-NULL, ...
 		if ( success && features != NULL ) {
@@ -711,23 +792,77 @@ namespace thimble {
 			exit(EXIT_FAILURE);
 		}
 
-		AES128 aes = deriveKey(slowDownValue);
+		AES128 aes = deriveKey(slowDownValue,this->hashAlgorithm);
 
-		int t , d , n;
-		t = this->tmax;
-		d = this->gfPtr->getDegree();
-		n = vaultDataSize();
+		return decryptVaultPolynomial(aes);
+	}
+
+	/*
+	 * see 'FuzzyVault.h' for the documentation.
+	 */
+	SmallBinaryFieldPolynomial FuzzyVault::unpackVaultPolynomial
+		( uint64_t slowDownValue ) const {
+
+		if ( !isDecrypted() ) {
+			cerr << "FuzzyVault::unpackVaultPolynomial: "
+				 << "no decrypted vault data." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		if ( getSlowDownFactor().numBits() <= 64 &&
+			 slowDownValue >= getSlowDownFactor().toUInt64() ) {
+			cerr << "FuzzyVault::unpackVaultPolynomial: "
+				 << "slow-down value must be smaller than the "
+				 << "slow-down factor" << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		AES128 aes = deriveKey(slowDownValue,this->hashAlgorithm);
+
+		return decryptVaultPolynomial(aes);
+	}
+
+	/*
+	 * see 'FuzzyVault.h' for the documentation.
+	 */
+	SmallBinaryFieldPolynomial FuzzyVault::decryptVaultPolynomial
+		( AES128 & aes ) const {
+
+		int n = vaultDataSize();
 
 		uint8_t *data = (uint8_t*)malloc( n * sizeof(uint8_t) );
-		uint32_t *coeffs = (uint32_t*)malloc( t * sizeof(uint32_t ) );
-		if ( data == NULL || coeffs == NULL ) {
-			cerr << "FuzzyVault::createVaultPolynomialCandidate: "
+		if ( data == NULL ) {
+			cerr << "FuzzyVault::decryptVaultPolynomial: "
 				 << "out of memory." << endl;
 			exit(EXIT_FAILURE);
 		}
 
 		aes.decrypt(data,this->vaultPolynomialData,n);
 
+		SmallBinaryFieldPolynomial V = toVaultPolynomial(data);
+
+		free(data);
+
+		return V;
+	}
+
+	/*
+	 * see 'FuzzyVault.h' for the documentation.
+	 */
+	SmallBinaryFieldPolynomial FuzzyVault::toVaultPolynomial
+		( const uint8_t *data ) const {
+
+		int t , d;
+		t = this->tmax;
+		d = this->gfPtr->getDegree();
+
+		uint32_t *coeffs = (uint32_t*)malloc( t * sizeof(uint32_t ) );
+		if ( coeffs == NULL ) {
+			cerr << "FuzzyVault::toVaultPolynomial: "
+				 << "out of memory." << endl;
+			exit(EXIT_FAILURE);
+		}
+
 		// Unpack decrypted data into coefficient vector
 		split_into_bit_vectors(coeffs,data,t,d);
 
@@ -737,7 +872,6 @@ namespace thimble {
 			V.setCoeff(j,coeffs[j]);
 		}
 
-		free(data);
 		free(coeffs);
 
 		return V;
@@ -789,7 +923,7 @@ namespace thimble {
 	bool FuzzyVault::decode
 	( SmallBinaryFieldPolynomial & f ,
 	  const uint32_t *x , const uint32_t *y , int u , int k ,
-	  const uint8_t hash[20] ) const {
+	  const uint8_t *hash ) const {
 
 		if ( k > u ) {
 			return false;
@@ -797,33 +931,54 @@ namespace thimble {
 
 		int m = getGuruswamiSudanMultiplicity();
 
-		SHA sha;
-		uint8_t _hash[20];
+		Hash h(this->hashAlgorithm);
+		int digestSize = h.getDigestSize();
+		uint8_t _hash[Hash::MAX_DIGEST_SIZE];
 		SmallBinaryFieldPolynomial _f(f.getField());
 
+		// The code locator and interpolating polynomial are computed once
+		// and shared by the classical and the list decoding attempts
+		GuruswamiSudanDecoder dec;
+
 		if ( m >= 0 ) {
-			if ( ReedSolomonCode::decode(_f,x,y,u,k) ) {
-				sha.hash(_hash,_f.getData(),_f.deg()+1);
-				if ( memcmp(hash,_hash,20) == 0 ) {
+			dec.prepare(x,y,u,k,f.getField());
+			if ( ReedSolomonCode::decode
+					(_f,dec.getLocator(),dec.getInterpolant(),u,k) ) {
+				h.hash(_hash,_f.getData(),_f.deg()+1);
+				if ( memcmp(hash,_hash,digestSize) == 0 ) {
 					f = _f;
 					return true;
 				}
 			}
 		}
 
+		// Raise the multiplicity incrementally such that the interpolation
+		// for the previous multiplicity is reused
 		for ( int m0 = 1 ; m0 <= m ; m0++ ) {
 
-			GuruswamiSudanDecoder dec;
-
-			dec.decode(x,y,u,k,m0,f.getField());
+			dec.increaseMultiplicity();
 
-			for ( int j = 0 ; j < (int)dec.getDecodedList().size() ; j++ ) {
+			// Hash all candidates of the list at once
+			const std::vector<SmallBinaryFieldPolynomial> & list =
+					dec.getDecodedList();
+			int num = (int)list.size();
+			if ( num == 0 ) {
+				continue;
+			}
 
-				_f = dec.getDecodedList().at(j);
+			std::vector<const uint32_t*> data(num);
+			std::vector<uint64_t> sizes(num);
+			std::vector<uint8_t> hashes((size_t)num*digestSize);
+			for ( int j = 0 ; j < num ; j++ ) {
+				data[j] = list[j].getData();
+				sizes[j] = (uint64_t)(list[j].deg()+1);
+			}
+			Hash::hashBatch
+			(this->hashAlgorithm,&(hashes[0]),&(data[0]),&(sizes[0]),num);
 
-				sha.hash(_hash,_f.getData(),_f.deg()+1);
-				if ( memcmp(hash,_hash,20) == 0 ) {
-					f = _f;
+			for ( int j = 0 ; j < num ; j++ ) {
+				if ( memcmp(hash,&(hashes[(size_t)j*digestSize]),digestSize) == 0 ) {
+					f = list[j];
 					return true;
 				}
 			}
@@ -832,7 +987,8 @@ namespace thimble {
 		int D = getNumDecIts();
 
 		if ( D > 0 ) {
-			return FuzzyVaultTools::bfattack(f,x,y,u,k,hash,D);
+			return FuzzyVaultTools::bfattack
+					(f,x,y,u,k,hash,this->hashAlgorithm,D);
 		}
 
 		return false;
@@ -851,8 +1007,11 @@ namespace thimble {
 
 		int size = 0;
 
-		size += 4; // size for the header string 'FVR'.
+		size += 4; // size for the header string 'FVR' or 'FV2'.
 		size += 4;  // size for storing the result of 'getSizeInBytes()'
+		if ( this->hashAlgorithm != HASH_SHA1 ) {
+			size += 1; // size to encode 'hashAlgorithm'
+		}
 
 		// a byte encoding 8 bit flags; the 1st bit is reserved to encode
 		// whether the vault is encrypted or not
@@ -869,7 +1028,8 @@ namespace thimble {
 		// depending on whether the flag for an encrypted vault is set or not.
 		size += vaultDataSize();
 
-		size += 20; // size needed to store the secret polynomial's hash
+		// size needed to store the secret polynomial's hash
+		size += Hash::getDigestSize(this->hashAlgorithm);
 
 		return size;
 	}
@@ -888,8 +1048,10 @@ namespace thimble {
 		int sizeInBytes = getSizeInBytes() , offset = 0;
 		uint32_t tmp;
 
-		// Write header.
-		memcpy(data,"FVR",4);
+		// Write header. Vaults protected with SHA-1 are written in the
+		// original format; otherwise, a newer format version is written
+		// that records the hash function after the size.
+		memcpy(data,this->hashAlgorithm == HASH_SHA1 ? "FVR" : "FV2",4);
 		offset += 4;
 
 		// Write size in bytes
@@ -900,6 +1062,12 @@ namespace thimble {
 		data[offset+0] = tmp & 0xFF;
 		offset += 4;
 
+		// Write hash function
+		if ( this->hashAlgorithm != HASH_SHA1 ) {
+			data[offset] = (uint8_t)(this->hashAlgorithm);
+			offset += 1;
+		}
+
 		// Write flag byte
 		data[offset] = (isEncrypted()?1:0);
 		offset += 1;
@@ -957,8 +1125,9 @@ namespace thimble {
 		offset += vds;
 
 		// Write hash of secret polynomial
-		memcpy(data+offset,this->hash,20);
-		offset += 20;
+		int digestSize = Hash::getDigestSize(this->hashAlgorithm);
+		memcpy(data+offset,this->hash,digestSize);
+		offset += digestSize;
 
 		if ( offset != sizeInBytes ) {
 			cerr << "FuzzyVault::toBytes: "
@@ -983,7 +1152,8 @@ namespace thimble {
 		int offset = 0;
 
 		// Check if header is correct.
-		if ( memcmp(data,"FVR",4) != 0 ) {
+		bool hasAlgorithm = memcmp(data,"FV2",4) == 0;
+		if ( memcmp(data,"FVR",4) != 0 && !hasAlgorithm ) {
 			return false;
 		}
 		offset += 4;
@@ -1002,6 +1172,14 @@ namespace thimble {
 			return false;
 		}
 
+		// The newer format version records the hash function
+		if ( hasAlgorithm ) {
+			if ( offset+1 > sizeInBytes ) { return false; }
+			if ( !Hash::isValid(data[offset]) ) { return false; }
+			tmpVault.hashAlgorithm = (HASH_ALGORITHM_T)data[offset];
+			offset += 1;
+		}
+
 		// Read flag byte.
 		if ( offset+1 > sizeInBytes ) { return false; }
 		uint8_t flag = data[offset];
@@ -1104,9 +1282,10 @@ namespace thimble {
 		// *******************************************************************
 
 		// Read 'hash'
-		if ( sizeInBytes < offset+20 ) { return false; }
-		memcpy(tmpVault.hash,data+offset,20);
-		offset += 20;
+		int digestSize = Hash::getDigestSize(tmpVault.hashAlgorithm);
+		if ( sizeInBytes < offset+digestSize ) { return false; }
+		memcpy(tmpVault.hash,data+offset,digestSize);
+		offset += digestSize;
 
 		// Update the permutation which is selected pseudo-randomly using
 		// the hash value as seed.
@@ -1183,7 +1362,7 @@ namespace thimble {
 
 		if ( fread(data,1,(size_t)size,in) == (size_t)size ) {
 
-			if ( memcmp(data,"FVR",4) == 0 ) {
+			if ( memcmp(data,"FVR",4) == 0 || memcmp(data,"FV2",4) == 0 ) {
 
 				// Determine the size of the record.
 				size = (int)data[4]; size <<= 8;
@@ -1481,7 +1660,8 @@ namespace thimble {
 		this->slowDownFactor = 1;
 		this->vaultPolynomialData = NULL;
 		this->encryptedVaultPolynomialData = NULL;
-		memset(this->hash,0,20);
+		this->hashAlgorithm = HASH_SHA1;
+		memset(this->hash,0,Hash::MAX_DIGEST_SIZE);
 	}
 
 	/*
@@ -1547,7 +1727,7 @@ namespace thimble {
 		BigInteger slowDownVal; slowDownVal.random(this->slowDownFactor,true);
 
 		// Derive AES key from slow-down value.
-		AES128 aes = deriveKey(slowDownVal);
+		AES128 aes = deriveKey(slowDownVal,this->hashAlgorithm);
 
 		int t , d , n;
 		t = this->tmax;
@@ -1648,7 +1828,8 @@ namespace thimble {
 	/*
 	 * see 'FuzzyVault.h' for the documentation.
 	 */
-	AES128 FuzzyVault::deriveKey( const BigInteger & x ) {
+	AES128 FuzzyVault::deriveKey
+	( const BigInteger & x , HASH_ALGORITHM_T algorithm ) {
 
 		uint8_t *array = (uint8_t*)malloc( x.getSizeInBytes() );
 		if ( array == NULL ) {
@@ -1658,8 +1839,8 @@ namespace thimble {
 		}
 
 		x.toBytes(array);
-		uint8_t hash[20];
-		SHA().hash(hash,array,x.getSizeInBytes());
+		uint8_t hash[Hash::MAX_DIGEST_SIZE];
+		Hash(algorithm).hash(hash,array,x.getSizeInBytes());
 
 		AES128 aes(hash);
 
@@ -1668,6 +1849,29 @@ namespace thimble {
 		return aes;
 	}
 
+	/*
+	 * see 'FuzzyVault.h' for the documentation.
+	 */
+	AES128 FuzzyVault::deriveKey( uint64_t x , HASH_ALGORITHM_T algorithm ) {
+
+		// Same layout as 'BigInteger::toBytes': little endian bytes
+		// followed by at least one bit for the (positive) sign
+		uint8_t array[9];
+		int size = 0;
+		do {
+			array[size++] = (uint8_t)(x & 0xFF);
+			x >>= 8;
+		} while ( x != 0 );
+		if ( array[size-1] & 0x80 ) {
+			array[size++] = 0;
+		}
+
+		uint8_t hash[Hash::MAX_DIGEST_SIZE];
+		Hash(algorithm).hash(hash,array,size);
+
+		return AES128(hash);
+	}
+
 	/*
 	 * see 'FuzzyVault.h' for the documentation.
 	 */
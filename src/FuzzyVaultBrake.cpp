@@ -4,22 +4,23 @@
 #include <fstream>
 #include <cstring>
 #include <unordered_map>
+#include <thimble/math/IndexSampler.h>
 #include <thimble/security/SHA.h>
 #include <thimble/security/FuzzyVaultTools.h>
 #include <thimble/finger/FuzzyVaultBake.h>
 
 using namespace std;
 
-FuzzyVaultBake::FuzzyVaultBrake(int width, int height, int dpi) : ProtectedMinutiaeTemplate(width, height, dpi) {}
-FuzzyVaultBrake::FuzzyVaultBrake(BytesVault bv)
+FuzzyVaultBake::FuzzyVaultBake(int width, int height, int dpi) : ProtectedMinutiaeTemplate(width, height, dpi) {}
+FuzzyVaultBake::FuzzyVaultBake(BytesVault bv)
 {
     fromBytes(bv.data, bv.size);
 }
 
-BytesVault FuzzyVaultBrake::toBytesVault()
+BytesVault FuzzyVaultBake::toBytesVault()
 {
     uint8_t *data;
-    int size, wsize;
+    int size;
 
     // Initialize byte array ...
     size = getSizeInBytes();
@@ -36,7 +37,7 @@ BytesVault FuzzyVaultBrake::toBytesVault()
     return BytesVault(data, size);
 }
 
-uint32_t FuzzyVaultBrake::getf0(MinutiaeView view)
+uint32_t FuzzyVaultBake::getf0(MinutiaeView view)
 {
     SmallBinaryFieldPolynomial f(getField());
     if (!open(f, view))
@@ -50,7 +51,7 @@ uint32_t FuzzyVaultBrake::getf0(MinutiaeView view)
 /**
  * @brief Decode the secret polynomial from a query
  * Override the decode function of ProtectedMinutiaeTemplate to avoid using the stored hash of the secret polynomial
- * Hence, in FuzzyVaultBrake, no need to store this hash anymore, to avoid offline attacks on it.
+ * Hence, in FuzzyVaultBake, no need to store this hash anymore, to avoid offline attacks on it.
  *
  * @param f return the secret polynomial if the decoding is successful
  * @param x the query set
@@ -61,22 +62,12 @@ uint32_t FuzzyVaultBrake::getf0(MinutiaeView view)
  * @param maxIts number of tests to do in the main loop
  * @return true if the decode is successful, but it doesn't assure that f is the right secret polynomial
  */
-bool FuzzyVaultBrake::decode(SmallBinaryFieldPolynomial &f, const uint32_t *x, const uint32_t *y,
+bool FuzzyVaultBake::decode(SmallBinaryFieldPolynomial &f, const uint32_t *x, const uint32_t *y,
                             int n, int k, const uint8_t hash[20], int maxIts) const
 {
 
     SHA sha;
 
-    // Check whether we can choose random points from 'n'
-    // points using 'rand()'
-    if (n > RAND_MAX)
-    {
-        cerr << "FuzzyVault::bfattack: The number of vault points must be"
-             << " smaller than or equal RAND_MAX which is"
-             << RAND_MAX << "." << endl;
-        exit(EXIT_FAILURE);
-    }
-
     // Check whether the vault is of reasonable parameters
     if (n <= 0 || k <= 0 || k > n)
     {
@@ -87,45 +78,41 @@ bool FuzzyVaultBrake::decode(SmallBinaryFieldPolynomial &f, const uint32_t *x, c
         exit(EXIT_FAILURE);
     }
 
-    // Keeps track whether a polynomial was yet found or not
-    bool state = false;
-
     // Initialize space for the candidate polynomial
     SmallBinaryFieldPolynomial candidatePolynomial(f.getField());
     candidatePolynomial.ensureCapacity(k);
 
-    // Initalize space for the hash of the candidate polynomial
-    uint8_t candidateHash[20];
-
-    uint32_t *a, *b;
-    int *indices;
+    uint32_t *a, *b, *indices;
 
     // Allocate memory to select 'k' random vault
     // points
     a = (uint32_t *)malloc(k * sizeof(uint32_t));
     b = (uint32_t *)malloc(k * sizeof(uint32_t));
-    indices = (int *)malloc(k * sizeof(uint32_t));
+    indices = (uint32_t *)malloc(k * sizeof(uint32_t));
     if (a == NULL || b == NULL || indices == NULL)
     {
         cerr << "FuzzyVault::bfattack: Out of memory." << endl;
         exit(EXIT_FAILURE);
     }
 
+    // Sampler for choosing the vault points
+    IndexSampler sampler((uint32_t)n);
+
     unordered_map<uint32_t, int> result = {};
     pair<uint32_t, int> max = make_pair(0, -1);
 
     // Iterate at most 'maxIts' times
-    for (uint64_t it = 0; it < maxIts; it++)
+    for (int it = 0; it < maxIts; it++)
     {
 
         // Select pairwise different indices in the range
         // '0,...,n-1' and ...
-        FuzzyVaultTools::fastChooseIndicesAtRandom(indices, n, k);
+        sampler.choose(indices, (uint32_t)k);
 
         // ... set the selected vault points, correspondingly.
         for (int i = 0; i < k; i++)
         {
-            int j = indices[i];
+            uint32_t j = indices[i];
             a[i] = x[j];
             b[i] = y[j];
         }
@@ -174,7 +161,7 @@ bool FuzzyVaultBrake::decode(SmallBinaryFieldPolynomial &f, const uint32_t *x, c
     return true;
 }
 
-bool FuzzyVaultBrake::open(SmallBinaryFieldPolynomial &f, const MinutiaeView &view) const
+bool FuzzyVaultBake::open(SmallBinaryFieldPolynomial &f, const MinutiaeView &view) const
 {
     // Allocate memory to temporarily hold the feature set.
     uint32_t *B = (uint32_t *)malloc(this->tmax * sizeof(uint32_t));
@@ -217,11 +204,11 @@ bool FuzzyVaultBrake::open(SmallBinaryFieldPolynomial &f, const MinutiaeView &vi
     bool success = false;
 
     // TODO talk about slowDown
-    // The slowDown utility is not used with the FuzzyVaultBrake
+    // The slowDown utility is not used with the FuzzyVaultBake
     // If the slowDownFactor is higher than 1, the program decoding shouldn't work
     if (BigInteger::compare(slowDownFactor, BigInteger(1)) != 0)
     {
-        cerr << "Error: You cannot use the slowDown utility with FuzzyVaultBrake"
+        cerr << "Error: You cannot use the slowDown utility with FuzzyVaultBake"
              << "You must set slowDownFactor to 1" << endl;
         exit(EXIT_FAILURE);
     }
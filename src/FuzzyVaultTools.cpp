@@ -37,7 +37,8 @@
 #include <iostream>
 #include <vector>
 
-#include <thimble/math/BinomialIterator.h>
+#include <thimble/math/IndexSampler.h>
+#include <thimble/math/RevolvingDoorIterator.h>
 #include <thimble/math/numbertheory/SmallBinaryFieldPolynomial.h>
 #include <thimble/math/numbertheory/BigInteger.h>
 #include <thimble/security/SHA.h>
@@ -51,6 +52,14 @@ using namespace std;
 namespace thimble
 {
 
+	/**
+	 * @brief
+	 *            Number of candidate polynomials of which the hash values
+	 *            are computed at once by
+	 *            \link FuzzyVaultTools::bfattack()\endlink.
+	 */
+	static const int _BFATTACK_BATCH = 8;
+
 	/**
 	 * @brief
 	 *            Choose a subset of specified size from a finite field.
@@ -181,12 +190,10 @@ namespace thimble
 
 		for ( i = 0 ; i < k ; i++ ) {
 
-			j = MathTools::rand32(tryRandom) % (n-i);
+			// Partial Fisher-Yates shuffle
+			j = i + MathTools::rand32(tryRandom) % (n-i);
 			indices[i] = range[j];
-
-			for ( ; j+1 < n ; j++ ) {
-				range[j] = range[j+1];
-			}
+			range[j] = range[i];
 		}
 
 		free(range);
@@ -200,11 +207,13 @@ namespace thimble
 	 * @details
 	 *           The method essentially performs the same as the
 	 *           \link chooseIndicesAtRandom(int*,int,int,bool)\endlink method
-	 *           but assumes <code>tryRandom=false</code>. This enables to use
-	 *           <code>rand()</code> directly without frequently considering
-	 *           the cases for <code>tryRandom</code>. This may result in a
-	 *           more efficient version which is beneficial for, e.g., the
-	 *           brute-force attack.
+	 *           but assumes <code>tryRandom=false</code>. It wraps around an
+	 *           \link IndexSampler\endlink owned by the calling thread
+	 *           which is seeded using <code>rand()</code> on first use;
+	 *           a call costs <i>O(k)</i> operations as long as <code>n</code>
+	 *           does not change between calls. Long-running loops, e.g.,
+	 *           the brute-force attack, should hold an
+	 *           \link IndexSampler\endlink object directly.
 	 *
 	 * @param indices
 	 *           Will contain <code>k</code> pairwise distinct integers
@@ -217,8 +226,9 @@ namespace thimble
 	 *           Specifies the number of integers to be selected.
 	 *
 	 * @warning
-	 *            If <code>k</code> is greater than or equals <code>n</code>
-	 *            the method may never terminate.
+	 *            If <code>k</code> is greater than <code>n</code>, an error
+	 *            message is printed to <code>stderr</code> and the program
+	 *            exits with status 'EXIT_FAILURE'.
 	 *
 	 * @warning
 	 *            If <code>indices</code> cannot store at least <code>k</code>
@@ -228,30 +238,17 @@ namespace thimble
 	void FuzzyVaultTools::fastChooseIndicesAtRandom(register int *indices, register int n, register int k)
 	{
 
-		register bool alreadyChosen;
-		register int index;
-		register int i;
-		register int j;
+		// Each thread keeps a sampler of its own such that neither
+		// the index array is reallocated nor a lock is taken when
+		// the method is called repeatedly for the same range.
+		static thread_local IndexSampler sampler;
 
-		for (i = 0; i < k; i++)
+		if (sampler.getRange() != (uint32_t)n)
 		{
-
-			do
-			{
-				index = rand() % n;
-				alreadyChosen = false;
-				for (j = 0; j < i; j++)
-				{
-					if (indices[j] == index)
-					{
-						alreadyChosen = true;
-						break;
-					}
-				}
-			} while (alreadyChosen);
-
-			indices[i] = index;
+			sampler.setRange((uint32_t)n);
 		}
+
+		sampler.choose(indices, k);
 	}
 
 	/**
@@ -423,18 +420,48 @@ namespace thimble
 								   uint64_t maxIts)
 	{
 
-		SHA sha;
-
-		// Check whether we can choose random points from 'n'
-		// points using 'rand()'
-		if (n > RAND_MAX)
+		// Convert the hash value into the bytes output by
+		// 'SHA::hash(uint8_t[20],...)'
+		uint8_t hash8[20];
+		for (int i = 0; i < 20; i++)
 		{
-			cerr << "FuzzyVault::bfattack: The number of vault points must be"
-				 << " smaller than or equal RAND_MAX which is"
-				 << RAND_MAX << "." << endl;
-			exit(EXIT_FAILURE);
+			hash8[i] = (uint8_t)(hash[i / 4] >> (24 - 8 * (i % 4)));
 		}
 
+		return bfattack(f, x, y, n, k, hash8, HASH_SHA1, maxIts);
+	}
+
+	/**
+	 * @brief
+	 *            Attempts to break an instance of the fuzzy vault scheme.
+	 *
+	 * @details
+	 *            see 'FuzzyVaultTools.h'
+	 */
+	bool FuzzyVaultTools::bfattack(SmallBinaryFieldPolynomial &f,
+								   const uint32_t *x, const uint32_t *y,
+								   int n, int k, const uint8_t hash[20],
+								   uint64_t maxIts)
+	{
+
+		return bfattack(f, x, y, n, k, hash, HASH_SHA1, maxIts);
+	}
+
+	/**
+	 * @brief
+	 *            Attempts to break an instance of the fuzzy vault scheme
+	 *            of which secret polynomial is verified by a selectable
+	 *            hash function.
+	 *
+	 * @details
+	 *            see 'FuzzyVaultTools.h'
+	 */
+	bool FuzzyVaultTools::bfattack(SmallBinaryFieldPolynomial &f,
+								   const uint32_t *x, const uint32_t *y,
+								   int n, int k, const uint8_t *hash,
+								   HASH_ALGORITHM_T algorithm, uint64_t maxIts)
+	{
+
 		// Check whether the vault is of reasonable parameters
 		if (n <= 0 || k <= 0 || k > n)
 		{
@@ -448,59 +475,84 @@ namespace thimble
 		// Keeps track whether a polynomial was yet found or not
 		bool state = false;
 
-		// Initialize space for the candidate polynomial
-		SmallBinaryFieldPolynomial candidatePolynomial(f.getField());
-		candidatePolynomial.ensureCapacity(k);
+		// Initialize space for a batch of candidate polynomials
+		vector<SmallBinaryFieldPolynomial> candidatePolynomials
+			(_BFATTACK_BATCH, SmallBinaryFieldPolynomial(f.getField()));
+		for (int l = 0; l < _BFATTACK_BATCH; l++)
+		{
+			candidatePolynomials[l].ensureCapacity(k);
+		}
 
-		// Initalize space for the hash of the candidate polynomial
-		uint32_t candidateHash[5];
+		// Initalize space for the hash values of the candidate polynomials
+		int digestSize = Hash::getDigestSize(algorithm);
+		uint8_t candidateHashes[_BFATTACK_BATCH * Hash::MAX_DIGEST_SIZE];
+		const uint32_t *candidateData[_BFATTACK_BATCH];
+		uint64_t candidateSizes[_BFATTACK_BATCH];
 
-		uint32_t *a, *b;
-		int *indices;
+		uint32_t *a, *b, *indices;
 
 		// Allocate memory to select 'k' random vault
 		// points
 		a = (uint32_t *)malloc(k * sizeof(uint32_t));
 		b = (uint32_t *)malloc(k * sizeof(uint32_t));
-		indices = (int *)malloc(k * sizeof(uint32_t));
+		indices = (uint32_t *)malloc(k * sizeof(uint32_t));
 		if (a == NULL || b == NULL || indices == NULL)
 		{
 			cerr << "FuzzyVault::bfattack: Out of memory." << endl;
 			exit(EXIT_FAILURE);
 		}
 
-		// Iterate at most 'maxIts' times
-		for (uint64_t it = 0; it < maxIts; it++)
-		{
+		// Sampler for choosing the vault points; seeded via 'rand()'
+		// such that 'srand' reproduces the attack
+		IndexSampler sampler((uint32_t)n);
 
-			// Select pairwise different indices in the range
-			// '0,...,n-1' and ...
-			fastChooseIndicesAtRandom(indices, n, k);
+		// Iterate at most 'maxIts' times; the candidates of
+		// '_BFATTACK_BATCH' successive iterations are hashed at once
+		for (uint64_t it = 0; it < maxIts && !state;)
+		{
 
-			// ... set the selected vault points, correspondingly.
-			for (int i = 0; i < k; i++)
+			int num = 0;
+			for (; num < _BFATTACK_BATCH && it < maxIts; num++, it++)
 			{
-				int j = indices[i];
-				a[i] = x[j];
-				b[i] = y[j];
+
+				// Select pairwise different indices in the range
+				// '0,...,n-1' and ...
+				sampler.choose(indices, (uint32_t)k);
+
+				// ... set the selected vault points, correspondingly.
+				for (int i = 0; i < k; i++)
+				{
+					uint32_t j = indices[i];
+					a[i] = x[j];
+					b[i] = y[j];
+				}
+
+				// Determine the interpolation polynomial of the selected
+				// vault points
+				SmallBinaryFieldPolynomial &candidatePolynomial =
+					candidatePolynomials[num];
+				candidatePolynomial.interpolate(a, b, k);
+				candidateData[num] = candidatePolynomial.getData();
+				candidateSizes[num] = candidatePolynomial.deg() + 1;
 			}
 
-			// Determine the interpolation polynomial of the selected
-			// vault points and ...
-			candidatePolynomial.interpolate(a, b, k);
-			// ... compute its SHA-1 hash value
-			sha.hash(candidateHash,
-					 candidatePolynomial.getData(), candidatePolynomial.deg() + 1);
+			// Compute the hash values of the candidates
+			Hash::hashBatch(algorithm, candidateHashes, candidateData,
+							candidateSizes, num);
 
-			// Check whether the candidate polynomial's hash value
-			// agrees with the hash value of the secret polynomial.
-			if (memcmp(candidateHash, hash, 20) == 0)
+			for (int l = 0; l < num; l++)
 			{
-				// If true, assign 'f', update the 'state' and abort
-				// the loop.
-				f.assign(candidatePolynomial);
-				state = true;
-				break;
+				// Check whether the candidate polynomial's hash value
+				// agrees with the hash value of the secret polynomial.
+				if (memcmp(candidateHashes + l * digestSize, hash,
+						   digestSize) == 0)
+				{
+					// If true, assign 'f', update the 'state' and abort
+					// the loop.
+					f.assign(candidatePolynomials[l]);
+					state = true;
+					break;
+				}
 			}
 		}
 
@@ -514,104 +566,95 @@ namespace thimble
 
 	/**
 	 * @brief
-	 *            Attempts to break an instance of the fuzzy vault scheme.
+	 *            Replaces an interpolation point of a polynomial.
 	 *
 	 * @details
-	 *            see 'FuzzyVaultTools.h'
+	 *            Let <i>f</i> of degree smaller than <i>k</i> interpolate
+	 *            the points with abscissas <i>a[0],...,a[k-1]</i> and let
+	 *            \f$M(X)=\prod_{i}(X-a[i])\f$. If the point with abscissa
+	 *            <i>xp</i> is replaced by the point <i>(xq,yq)</i>, then
+	 *            \f$P(X)=M(X)/(X-xp)\f$ vanishes on all the remaining
+	 *            points and
+	 *            \f[
+	 *             f(X)+\frac{yq-f(xq)}{P(xq)}\cdot P(X)
+	 *            \f]
+	 *            interpolates the new points. Thus, the update costs
+	 *            <i>O(k)</i> field operations instead of <i>O(k^2)</i>
+	 *            operations for interpolating from scratch.
+	 *
+	 * @param c
+	 *            Array of <i>k</i> coefficients of <i>f</i> which are
+	 *            replaced by the coefficients of the updated polynomial.
+	 *
+	 * @param M
+	 *            Array of the <i>k+1</i> coefficients of the monic
+	 *            polynomial <i>M</i> which are replaced by the
+	 *            coefficients of the updated polynomial.
+	 *
+	 * @param P
+	 *            Array that can hold at least <i>k</i> coefficients used
+	 *            as buffer.
+	 *
+	 * @param k
+	 *            The number of interpolation points.
+	 *
+	 * @param xp
+	 *            Abscissa of the point that is removed.
+	 *
+	 * @param xq
+	 *            Abscissa of the point that is added; must be different
+	 *            from all abscissas of the remaining points.
+	 *
+	 * @param yq
+	 *            Ordinate of the point that is added.
+	 *
+	 * @param gf
+	 *            The finite field.
 	 */
-	bool FuzzyVaultTools::bfattack(SmallBinaryFieldPolynomial &f,
-								   const uint32_t *x, const uint32_t *y,
-								   int n, int k, const uint8_t hash[20],
-								   uint64_t maxIts)
+	static void swapInterpolationPoint(uint32_t *c, uint32_t *M, uint32_t *P, int k,
+									   uint32_t xp, uint32_t xq, uint32_t yq,
+									   const SmallBinaryField &gf)
 	{
 
-		SHA sha;
-
-		// Check whether we can choose random points from 'n'
-		// points using 'rand()'
-		if (n > RAND_MAX)
+		// P = M / (X - xp) via synthetic division; note that
+		// subtraction equals addition in characteristic 2
+		P[k - 1] = M[k];
+		for (int i = k - 1; i > 0; i--)
 		{
-			cerr << "FuzzyVault::bfattack: The number of vault points must be"
-				 << " smaller than or equal RAND_MAX which is"
-				 << RAND_MAX << "." << endl;
-			exit(EXIT_FAILURE);
+			P[i - 1] = M[i] ^ gf.mul(xp, P[i]);
 		}
 
-		// Check whether the vault is of reasonable parameters
-		if (n <= 0 || k <= 0 || k > n)
+		// Evaluate 'f' and 'P' at 'xq' using Horner's rule
+		uint32_t fq = 0, pq = 0;
+		for (int i = k - 1; i >= 0; i--)
 		{
-			cerr << "FuzzyVault::bfattack: The number of vault points must be"
-				 << " greater than zero. Furthermore, the size of the secret "
-				 << "polynomial must be greater than zero and smaller than "
-				 << "(or equal) to the vault's size" << endl;
-			exit(EXIT_FAILURE);
+			fq = gf.mul(fq, xq) ^ c[i];
+			pq = gf.mul(pq, xq) ^ P[i];
 		}
 
-		// Keeps track whether a polynomial was yet found or not
-		bool state = false;
-
-		// Initialize space for the candidate polynomial
-		SmallBinaryFieldPolynomial candidatePolynomial(f.getField());
-		candidatePolynomial.ensureCapacity(k);
-
-		// Initalize space for the hash of the candidate polynomial
-		uint8_t candidateHash[20];
-
-		uint32_t *a, *b;
-		int *indices;
-
-		// Allocate memory to select 'k' random vault
-		// points
-		a = (uint32_t *)malloc(k * sizeof(uint32_t));
-		b = (uint32_t *)malloc(k * sizeof(uint32_t));
-		indices = (int *)malloc(k * sizeof(uint32_t));
-		if (a == NULL || b == NULL || indices == NULL)
+		// 'P(xq)' vanishes only if 'xq' equals one of the remaining
+		// abscissas
+		if (pq == 0)
 		{
-			cerr << "FuzzyVault::bfattack: Out of memory." << endl;
+			cerr << "FuzzyVaultTools::bfdecode: The abscissas of the "
+				 << "unlocking set must be pairwise distinct." << endl;
 			exit(EXIT_FAILURE);
 		}
 
-		// Iterate at most 'maxIts' times
-		for (uint64_t it = 0; it < maxIts; it++)
+		// f += (yq - f(xq)) / P(xq) * P
+		uint32_t lambda = gf.mul(yq ^ fq, gf.inv(pq));
+		for (int i = 0; i < k; i++)
 		{
-
-			// Select pairwise different indices in the range
-			// '0,...,n-1' and ...
-			fastChooseIndicesAtRandom(indices, n, k);
-
-			// ... set the selected vault points, correspondingly.
-			for (int i = 0; i < k; i++)
-			{
-				int j = indices[i];
-				a[i] = x[j];
-				b[i] = y[j];
-			}
-
-			// Determine the interpolation polynomial of the selected
-			// vault points and ...
-			candidatePolynomial.interpolate(a, b, k);
-			// ... compute its SHA-1 hash value
-			sha.hash(candidateHash,
-					 candidatePolynomial.getData(), candidatePolynomial.deg() + 1);
-
-			// Check whether the candidate polynomial's hash value
-			// agrees with the hash value of the secret polynomial.
-			if (memcmp(candidateHash, hash, 20) == 0)
-			{
-				// If true, assign 'f', update the 'state' and abort
-				// the loop.
-				f.assign(candidatePolynomial);
-				state = true;
-				break;
-			}
+			c[i] ^= gf.mul(lambda, P[i]);
 		}
 
-		// Free memory
-		free(a);
-		free(b);
-		free(indices);
-
-		return state;
+		// M = P * (X - xq)
+		M[k] = P[k - 1];
+		for (int i = k - 1; i > 0; i--)
+		{
+			M[i] = P[i - 1] ^ gf.mul(xq, P[i]);
+		}
+		M[0] = gf.mul(xq, P[0]);
 	}
 
 	/**
@@ -628,6 +671,25 @@ namespace thimble
 								   int n, int k, const uint32_t hash[5])
 	{
 
+		return bfdecode(f, x, y, n, k, hash, 0, UINT64_MAX);
+	}
+
+	/**
+	 * @brief
+	 *            Attempts to decode a polynomial of degree smaller than
+	 *            <i>k</i> that interpolates <i>k</i> given points and
+	 *            that is of specified hash value where only the choices
+	 *            of a range of ranks are tested.
+	 *
+	 * @details
+	 *            see 'FuzzyVaultTools.h'
+	 */
+	bool FuzzyVaultTools::bfdecode(SmallBinaryFieldPolynomial &f,
+								   const uint32_t *x, const uint32_t *y,
+								   int n, int k, const uint32_t hash[5],
+								   uint64_t firstRank, uint64_t numRanks)
+	{
+
 		if (n < 0 || k < 0)
 		{
 			cerr << "FuzzyVaultTools::bfdecode: Bad arguments." << endl;
@@ -640,47 +702,93 @@ namespace thimble
 		}
 
 		SHA sha;
-		SmallBinaryFieldPolynomial candidatePolynomial(f.getField());
 		uint32_t candidateHash[5];
 
 		// Special case: The zero polynomial is not interpolated by any
 		// points
 		if (k == 0)
 		{
+			if (firstRank > 0 || numRanks == 0)
+			{
+				return false;
+			}
 			sha.hash(candidateHash, f.getData(), f.deg() + 1);
 			return memcmp(candidateHash, hash, 20) == 0;
 		}
 
+		// The iterator through all choices of 'k' out of 'n' points in
+		// revolving-door order; successive choices differ in one point
+		RevolvingDoorIterator it(n, k);
+		if (firstRank >= it.getCount() || numRanks == 0)
+		{
+			return false;
+		}
+		if (numRanks > it.getCount() - firstRank)
+		{
+			numRanks = it.getCount() - firstRank;
+		}
+
+		// If the number of choices exceeds 64 bits, the choice of
+		// 'firstRank' may not be determinable; then nothing is tested
+		if (!it.unrank(firstRank))
+		{
+			return false;
+		}
+
+		const SmallBinaryField &gf = f.getField();
+
 		// Keeps track whether a polynomial was yet found or not
 		bool state = false;
-		uint32_t *a, *b;
+		uint32_t *a, *b, *c, *M, *P;
 
-		// Allocate memory to select 'k' random vault
-		// points
+		// Allocate memory for the selected points, the coefficients of
+		// the candidate polynomial, the polynomial vanishing on the
+		// selected abscissas and a buffer
 		a = (uint32_t *)malloc(k * sizeof(uint32_t));
 		b = (uint32_t *)malloc(k * sizeof(uint32_t));
-		if (a == NULL || b == NULL)
+		c = (uint32_t *)malloc(k * sizeof(uint32_t));
+		M = (uint32_t *)malloc((k + 1) * sizeof(uint32_t));
+		P = (uint32_t *)malloc(k * sizeof(uint32_t));
+		if (a == NULL || b == NULL || c == NULL || M == NULL || P == NULL)
 		{
 			cerr << "FuzzyVaultTools::bfdecode: Out of memory." << endl;
 			exit(EXIT_FAILURE);
 		}
 
-		// The iterator that successfully iterates through all
-		// possible states of selected 'k' out of 'n' values
-		BinomialIterator<uint32_t> it(n, k);
+		// Interpolate the points of the first choice and ...
+		it.select(a, x);
+		it.select(b, y);
+		{
+			SmallBinaryFieldPolynomial candidatePolynomial(gf);
+			candidatePolynomial.interpolate(a, b, k);
+			for (int i = 0; i < k; i++)
+			{
+				c[i] = candidatePolynomial.getCoeff(i);
+			}
+		}
 
-		do
+		// ... compute the polynomial vanishing on their abscissas.
+		M[0] = 1;
+		for (int i = 0; i < k; i++)
 		{
+			M[i + 1] = M[i];
+			for (int j = i; j > 0; j--)
+			{
+				M[j] = M[j - 1] ^ gf.mul(a[i], M[j]);
+			}
+			M[0] = gf.mul(a[i], M[0]);
+		}
 
-			it.select(a, x);
-			it.select(b, y);
+		for (uint64_t r = 0;;)
+		{
 
-			// Determine the interpolation polynomial of the selected
-			// vault points and ...
-			candidatePolynomial.interpolate(a, b, k);
-			// ... compute its SHA-1 hash value
-			sha.hash(candidateHash,
-					 candidatePolynomial.getData(), candidatePolynomial.deg() + 1);
+			// Compute the SHA-1 hash value of the candidate polynomial
+			int size = k;
+			while (size > 0 && c[size - 1] == 0)
+			{
+				size--;
+			}
+			sha.hash(candidateHash, c, size);
 
 			// Check whether the candidate polynomial's hash value
 			// agrees with the hash value of the secret polynomial.
@@ -688,18 +796,35 @@ namespace thimble
 			{
 				// If true, assign 'f', update the 'state' and abort
 				// the loop.
-				f.assign(candidatePolynomial);
+				f.setZero();
+				for (int i = size - 1; i >= 0; i--)
+				{
+					f.setCoeff(i, c[i]);
+				}
 				state = true;
 				break;
 			}
 
-			// switch to the next state of the iterator; if the iterator
-			// has already reached its final state, we are done.
-		} while (it.next());
+			// Switch to the next choice; if the range has been processed
+			// or the iterator has reached its final state, we are done.
+			if (++r >= numRanks || !it.next())
+			{
+				break;
+			}
+
+			// Update the candidate polynomial by replacing the point
+			// that left the choice by the point that entered it.
+			int q = it.getAdded();
+			swapInterpolationPoint(c, M, P, k, x[it.getRemoved()],
+								   x[q], y[q], gf);
+		}
 
 		// Free memory
 		free(a);
 		free(b);
+		free(c);
+		free(M);
+		free(P);
 
 		return state;
 	}
@@ -120,6 +120,27 @@ namespace thimble {
 		vector<SmallBinaryFieldPolynomial> ps = roots(*(this->Qptr),k);
 		this->rootTime = clock() - this->rootTime;
 
+		setDecodedList(ps,x,y,n,k);
+
+		this->overallTime = clock()-this->overallTime;
+
+		return this->decodedList.size() > 0;
+	}
+
+	/**
+	 * @brief
+	 *            Keeps the polynomials found in the root step that
+	 *            interpolate at least <i>k+1</i> pairs and sorts them.
+	 *
+	 * @details
+	 *            see 'GuruswamiSudanDecoder.h'
+	 */
+	void GuruswamiSudanDecoder::setDecodedList
+	( const vector<SmallBinaryFieldPolynomial> & ps ,
+	  const uint32_t *x , const uint32_t *y , int n , int k ) {
+
+		this->decodedList.clear();
+
 		for ( int i = 0 ; i < (int)ps.size() ; i++ ) {
 
 			int hammingDistance = 0;
@@ -139,10 +160,6 @@ namespace thimble {
 		sort
 		(this->decodedList.begin(),this->decodedList.end(),
 		 DecodedPolynomialComparator(x,y,n));
-
-		this->overallTime = clock()-this->overallTime;
-
-		return this->decodedList.size() > 0;
 	}
 
 	/**
@@ -154,6 +171,10 @@ namespace thimble {
 		this->rootTime = 0;
 		this->overallTime = 0;
 		this->Qptr = NULL;
+		this->k = 0;
+		this->multiplicity = 0;
+		this->locatorPtr = NULL;
+		this->interpolantPtr = NULL;
 	}
 
 	/**
@@ -162,6 +183,8 @@ namespace thimble {
 	 */
 	GuruswamiSudanDecoder::~GuruswamiSudanDecoder() {
 		delete this->Qptr;
+		delete this->locatorPtr;
+		delete this->interpolantPtr;
 	}
 
 	/**
@@ -443,18 +466,68 @@ namespace thimble {
 
 	}
 
+	static void TrifonovBasis
+	( std::vector<SmallBinaryFieldBivariatePolynomial> & G ,
+	  const SmallBinaryFieldPolynomial & phi ,
+	  const SmallBinaryFieldPolynomial & T ,
+	  int k , const SmallBinaryField & gf ) {
+
+		G.clear();
+		G.push_back(SmallBinaryFieldBivariatePolynomial(phi));
+
+		SmallBinaryFieldPolynomial ONE(gf); ONE.setCoeff(0,1);
+		SmallBinaryFieldBivariatePolynomial tmp1(gf), tmp2(gf);
+
+		int j = 0;
+
+		for (;;) {
+
+			// Let 'tmp1(X,Y)<-Y-T(X)' and note that for binary fields
+			// there is no need to negate 'T(X)'.
+			tmp1.setY();
+			tmp1.setCoeffY(0,T);
+			leftShiftY(tmp1,tmp1,j);
+
+			TrifonovReduce(G,tmp1,k,gf);
+			j = G.size()-1;
+
+			tmp1.setZero();
+			tmp1.setCoeffY(j,ONE);
+			leadTerm(tmp2,G[j],1,k);
+			if ( tmp2.equals(tmp1) ) {
+				break;
+			}
+
+		}
+	}
+
+	static SmallBinaryFieldBivariatePolynomial TrifonovMinimal
+	( const std::vector<SmallBinaryFieldBivariatePolynomial> & B , int k ) {
+
+		SmallBinaryFieldBivariatePolynomial Q = B.front();
+		pair<int,int> dmin = Q.deg(1,k);
+
+		for ( int i = 1 ; i < (int)B.size() ; i++ ) {
+			std::pair<int,int> d = B[i].deg(1,k);
+			if ( WeightedDegreeCompare(d,dmin,1,k) < 0 ) {
+				Q = B[i];
+				dmin = d;
+			}
+		}
+
+		return Q;
+	}
+
 	static SmallBinaryFieldBivariatePolynomial TrifonovInterpolate
 	( const uint32_t *x , const uint32_t *y ,
 	  int n , int k , int r , const SmallBinaryField & gf ) {
 
-		SmallBinaryFieldBivariatePolynomial Q(gf);
 		SmallBinaryFieldPolynomial T(gf);
 		std::vector<SmallBinaryFieldBivariatePolynomial> G;
 
 		{
 			SmallBinaryFieldPolynomial phi(gf);
 			phi.buildFromRoots(x,n);
-			G.push_back(SmallBinaryFieldBivariatePolynomial(phi));
 
 			for ( int i = 0 ; i < n ; i++ ) {
 
@@ -476,34 +549,10 @@ namespace thimble {
 				mul(tmp,tmp,den);
 				add(T,T,tmp);
 			}
-		}
-
-		SmallBinaryFieldPolynomial ONE(gf); ONE.setCoeff(0,1);
-		SmallBinaryFieldBivariatePolynomial tmp1(gf), tmp2(gf);
-
-		int j = 0;
-
-		for (;;) {
-
-			// Let 'tmp1(X,Y)<-Y-T(X)' and note that for binary fields
-			// there is no need to negate 'T(X)'.
-			tmp1.setY();
-			tmp1.setCoeffY(0,T);
-			leftShiftY(tmp1,tmp1,j);
-
-			TrifonovReduce(G,tmp1,k,gf);
-			j = G.size()-1;
-
-			tmp1.setZero();
-			tmp1.setCoeffY(j,ONE);
-			leadTerm(tmp2,G[j],1,k);
-			if ( tmp2.equals(tmp1) ) {
-				break;
-			}
 
+			TrifonovBasis(G,phi,T,k,gf);
 		}
 
-
 		std::vector<SmallBinaryFieldBivariatePolynomial> B , C;
 		B = G;
 
@@ -521,18 +570,7 @@ namespace thimble {
 			}
 		}
 
-		Q = B.front();
-		pair<int,int> dmin = Q.deg(1,k);
-
-		for ( int i = 1 ; i < (int)B.size() ; i++ ) {
-			std::pair<int,int> d = B[i].deg(1,k);
-			if ( WeightedDegreeCompare(d,dmin,1,k) < 0 ) {
-				Q = B[i];
-				dmin = d;
-			}
-		}
-
-		return Q;
+		return TrifonovMinimal(B,k);
 	}
 
 	static vector<SmallBinaryFieldPolynomial> RothRuckensteinRoots
@@ -607,6 +645,136 @@ namespace thimble {
 	    return roots;
 	}
 
+	/**
+	 * @brief
+	 *            Prepares the decoder for attempts to solve a
+	 *            Reed-Solomon list decoding problem with increasing
+	 *            multiplicities.
+	 *
+	 * @details
+	 *            see 'GuruswamiSudanDecoder.h'
+	 */
+	void GuruswamiSudanDecoder::prepare
+	( const uint32_t *x , const uint32_t *y ,
+	  int n , int k , const SmallBinaryField & gf ) {
+
+		if ( n <= 0 || k <= 0 || k > n ) {
+			cerr << "GuruswamiSudanDecoder::prepare: Bad arguments." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		this->xs.assign(x,x+n);
+		this->ys.assign(y,y+n);
+		this->k = k;
+		this->multiplicity = 0;
+		this->basis.clear();
+		this->multiplicityBasis.clear();
+
+		delete this->locatorPtr;
+		delete this->interpolantPtr;
+		this->locatorPtr = new SmallBinaryFieldPolynomial(gf);
+		this->interpolantPtr = new SmallBinaryFieldPolynomial(gf);
+
+		this->locatorPtr->buildFromRoots(x,n);
+		this->interpolantPtr->interpolate(x,y,n);
+	}
+
+	/**
+	 * @brief
+	 *            Attempts to solve the prepared Reed-Solomon list decoding
+	 *            problem with the multiplicity increased by one.
+	 *
+	 * @details
+	 *            see 'GuruswamiSudanDecoder.h'
+	 */
+	bool GuruswamiSudanDecoder::increaseMultiplicity() {
+
+		if ( this->locatorPtr == NULL ) {
+			cerr << "GuruswamiSudanDecoder::increaseMultiplicity: "
+				 << "Decoder has not been prepared." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		this->overallTime = clock();
+
+		const SmallBinaryField & gf = this->locatorPtr->getField();
+		int n = (int)this->xs.size();
+
+		// Interpolation w.r.t. the '(1,k-1)'-weighted degree
+		this->interpolationTime = clock();
+		if ( this->multiplicity == 0 ) {
+			TrifonovBasis
+				(this->basis,*(this->locatorPtr),*(this->interpolantPtr),
+				 this->k-1,gf);
+			this->multiplicityBasis = this->basis;
+		} else {
+			// Multiply the basis for the previous multiplicity with the
+			// basis for multiplicity 1
+			int R = this->multiplicity+1;
+			std::vector<SmallBinaryFieldBivariatePolynomial> C;
+			TrifonovMerge
+				(C,this->multiplicityBasis,this->basis,n*(R*(R+1))/2,
+				 this->k-1,gf);
+			this->multiplicityBasis.swap(C);
+		}
+		++this->multiplicity;
+
+		delete this->Qptr;
+		this->Qptr = new SmallBinaryFieldBivariatePolynomial
+				(TrifonovMinimal(this->multiplicityBasis,this->k-1));
+		this->interpolationTime = clock()-this->interpolationTime;
+
+		this->rootTime = clock();
+		vector<SmallBinaryFieldPolynomial> ps = roots(*(this->Qptr),this->k);
+		this->rootTime = clock() - this->rootTime;
+
+		setDecodedList(ps,&(this->xs[0]),&(this->ys[0]),n,this->k);
+
+		this->overallTime = clock()-this->overallTime;
+
+		return this->decodedList.size() > 0;
+	}
+
+	/**
+	 * @brief
+	 *            Access the code locator polynomial computed by
+	 *            <code>prepare()</code>.
+	 *
+	 * @details
+	 *            see 'GuruswamiSudanDecoder.h'
+	 */
+	const SmallBinaryFieldPolynomial &
+	GuruswamiSudanDecoder::getLocator() const {
+
+		if ( this->locatorPtr == NULL ) {
+			cerr << "GuruswamiSudanDecoder::getLocator: "
+				 << "Decoder has not been prepared." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		return *(this->locatorPtr);
+	}
+
+	/**
+	 * @brief
+	 *            Access the interpolating polynomial computed by
+	 *            <code>prepare()</code>.
+	 *
+	 * @details
+	 *            see 'GuruswamiSudanDecoder.h'
+	 */
+	const SmallBinaryFieldPolynomial &
+	GuruswamiSudanDecoder::getInterpolant() const {
+
+		if ( this->interpolantPtr == NULL ) {
+			cerr << "GuruswamiSudanDecoder::getInterpolant: "
+				 << "Decoder has not been prepared." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		return *(this->interpolantPtr);
+	}
+
 	SmallBinaryFieldBivariatePolynomial GuruswamiSudanDecoder::interpolate
 	( const uint32_t *x , const uint32_t *y ,
 	  int n , int k , int m , const SmallBinaryField & gf ) const {
@@ -0,0 +1,219 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file Hash.cpp
+ *
+ * @brief
+ *            This file implements the functionalities provided by
+ *            'Hash.h' which provides a common interface to the hash
+ *            functions of the library.
+ *
+ * @details
+ *            see 'Hash.h'
+ *
+ * @author agent
+ */
+#include <stdint.h>
+#include <cstring>
+#include <iostream>
+
+#include <thimble/security/Hash.h>
+
+using namespace std;
+
+/**
+ * @brief The library's namespace
+ */
+namespace thimble {
+
+    /*
+     * see 'Hash.h' for the documentation.
+     */
+    Hash::Hash( HASH_ALGORITHM_T algorithm ) {
+
+        if ( !isValid(algorithm) ) {
+            cerr << "Hash: unknown hash function." << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        this->algorithm = algorithm;
+    }
+
+    /*
+     * see 'Hash.h' for the documentation.
+     */
+    HASH_ALGORITHM_T Hash::getAlgorithm() const {
+        return this->algorithm;
+    }
+
+    /*
+     * see 'Hash.h' for the documentation.
+     */
+    int Hash::getDigestSize() const {
+        return getDigestSize(this->algorithm);
+    }
+
+    /*
+     * see 'Hash.h' for the documentation.
+     */
+    int Hash::getDigestSize( HASH_ALGORITHM_T algorithm ) {
+        return algorithm == HASH_SHA1 ? 20 : 32;
+    }
+
+    /*
+     * see 'Hash.h' for the documentation.
+     */
+    bool Hash::isValid( int code ) {
+        return code == HASH_SHA1 || code == HASH_SHA256 ||
+               code == HASH_BLAKE2S;
+    }
+
+    /*
+     * see 'Hash.h' for the documentation.
+     */
+    void Hash::init() {
+
+        switch ( this->algorithm ) {
+        case HASH_SHA1:
+            this->sha.init();
+            break;
+        case HASH_SHA256:
+            this->sha256.init();
+            break;
+        case HASH_BLAKE2S:
+            this->blake2s.init();
+            break;
+        }
+    }
+
+    /*
+     * see 'Hash.h' for the documentation.
+     */
+    void Hash::update( const uint8_t *message , uint64_t n ) {
+
+        switch ( this->algorithm ) {
+        case HASH_SHA1:
+            this->sha.update(message,n);
+            break;
+        case HASH_SHA256:
+            this->sha256.update(message,n);
+            break;
+        case HASH_BLAKE2S:
+            this->blake2s.update(message,n);
+            break;
+        }
+    }
+
+    /*
+     * see 'Hash.h' for the documentation.
+     */
+    void Hash::update( const uint32_t *message , uint64_t n ) {
+
+        switch ( this->algorithm ) {
+        case HASH_SHA1:
+            this->sha.update(message,n);
+            break;
+        case HASH_SHA256:
+            this->sha256.update(message,n);
+            break;
+        case HASH_BLAKE2S:
+            this->blake2s.update(message,n);
+            break;
+        }
+    }
+
+    /*
+     * see 'Hash.h' for the documentation.
+     */
+    void Hash::final( uint8_t *digest ) {
+
+        switch ( this->algorithm ) {
+        case HASH_SHA1:
+            this->sha.final(digest);
+            break;
+        case HASH_SHA256:
+            this->sha256.final(digest);
+            break;
+        case HASH_BLAKE2S:
+            this->blake2s.final(digest);
+            break;
+        }
+    }
+
+    /*
+     * see 'Hash.h' for the documentation.
+     */
+    void Hash::hash( uint8_t *digest , const uint8_t *message , uint64_t n ) {
+
+        init();
+        update(message,n);
+        final(digest);
+    }
+
+    /*
+     * see 'Hash.h' for the documentation.
+     */
+    void Hash::hash( uint8_t *digest , const uint32_t *message , uint64_t n ) {
+
+        init();
+        update(message,n);
+        final(digest);
+    }
+
+    /*
+     * see 'Hash.h' for the documentation.
+     */
+    void Hash::hashBatch
+    ( HASH_ALGORITHM_T algorithm , uint8_t *digests ,
+      const uint32_t *const *messages , const uint64_t *n , int num ) {
+
+        switch ( algorithm ) {
+        case HASH_SHA1:
+            {
+                uint32_t h[8][5];
+                for ( int l0 = 0 ; l0 < num ; l0 += 8 ) {
+                    int lanes = num - l0 < 8 ? num - l0 : 8;
+                    SHA::hashBatch(h,messages+l0,n+l0,lanes);
+                    // Convert the words to big-endian bytes
+                    for ( int l = 0 ; l < lanes ; l++ ) {
+                        uint8_t *digest = digests + (l0+l)*20;
+                        for ( int i = 0 ; i < 20 ; i++ ) {
+                            digest[i] = (uint8_t)(h[l][i/4] >> (24-8*(i%4)));
+                        }
+                    }
+                }
+            }
+            break;
+        case HASH_BLAKE2S:
+            BLAKE2s::hashBatch((uint8_t(*)[32])digests,messages,n,num);
+            break;
+        default:
+            {
+                Hash hash(algorithm);
+                int size = hash.getDigestSize();
+                for ( int l = 0 ; l < num ; l++ ) {
+                    hash.hash(digests+l*size,messages[l],n[l]);
+                }
+            }
+            break;
+        }
+    }
+}
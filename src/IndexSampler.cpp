@@ -0,0 +1,173 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file IndexSampler.cpp
+ *
+ * @brief
+ *            Implementation of a class for repeatedly choosing subsets of
+ *            pairwise distinct indices at random as provided by the
+ *            'IndexSampler.h' header.
+ *
+ * @author agent
+ */
+
+#include <stdint.h>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <thimble/math/MathTools.h>
+#include <thimble/math/IndexSampler.h>
+
+using namespace std;
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/*
+	 * see 'IndexSampler.h' for the documentation.
+	 */
+	IndexSampler::IndexSampler( uint32_t n , bool tryRandom ) {
+
+		this->n = 0;
+		this->range = NULL;
+
+		seed(MathTools::rand64(tryRandom));
+		setRange(n);
+	}
+
+	/*
+	 * see 'IndexSampler.h' for the documentation.
+	 */
+	IndexSampler::IndexSampler( const IndexSampler & sampler ) {
+
+		this->n = 0;
+		this->range = NULL;
+
+		*this = sampler;
+	}
+
+	/*
+	 * see 'IndexSampler.h' for the documentation.
+	 */
+	IndexSampler::~IndexSampler() {
+		free(this->range);
+	}
+
+	/*
+	 * see 'IndexSampler.h' for the documentation.
+	 */
+	IndexSampler &IndexSampler::operator=( const IndexSampler & sampler ) {
+
+		if ( this != &sampler ) {
+
+			setRange(sampler.n);
+			memcpy(this->range,sampler.range,sampler.n*sizeof(uint32_t));
+			memcpy(this->state,sampler.state,sizeof(this->state));
+		}
+
+		return *this;
+	}
+
+	/*
+	 * see 'IndexSampler.h' for the documentation.
+	 */
+	void IndexSampler::setRange( uint32_t n ) {
+
+		if ( this->n != n ) {
+
+			free(this->range);
+			this->range = NULL;
+			this->n = 0;
+
+			if ( n > 0 ) {
+				this->range = (uint32_t*)malloc( (size_t)n * sizeof(uint32_t) );
+				if ( this->range == NULL ) {
+					cerr << "IndexSampler: out of memory." << endl;
+					exit(EXIT_FAILURE);
+				}
+			}
+
+			this->n = n;
+		}
+
+		for ( uint32_t i = 0 ; i < n ; i++ ) {
+			this->range[i] = i;
+		}
+	}
+
+	/*
+	 * see 'IndexSampler.h' for the documentation.
+	 */
+	void IndexSampler::seed( uint64_t seed ) {
+
+		// Expand the seed via SplitMix64 which never yields
+		// an all-zero state
+		for ( int i = 0 ; i < 4 ; i++ ) {
+			uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+			this->state[i] = z ^ (z >> 31);
+		}
+	}
+
+	/*
+	 * see 'IndexSampler.h' for the documentation.
+	 */
+	void IndexSampler::choose( uint32_t *indices , uint32_t k ) {
+
+		if ( k > this->n ) {
+			cerr << "IndexSampler::choose: cannot choose more indices "
+				 << "than the size of the range." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		uint32_t *range = this->range;
+		uint32_t n = this->n;
+
+		// Partial Fisher-Yates shuffle: after step 'i' the first 'i+1'
+		// entries of 'range' are the chosen indices; the array
+		// remains a permutation for the next draw.
+		for ( uint32_t i = 0 ; i < k ; i++ ) {
+			uint32_t j = i + uniform(n-i);
+			uint32_t tmp = range[j];
+			range[j] = range[i];
+			range[i] = tmp;
+			indices[i] = tmp;
+		}
+	}
+
+	/*
+	 * see 'IndexSampler.h' for the documentation.
+	 */
+	void IndexSampler::choose( int *indices , int k ) {
+
+		if ( k < 0 ) {
+			cerr << "IndexSampler::choose: number of indices must be "
+				 << "non-negative." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		choose((uint32_t*)indices,(uint32_t)k);
+	}
+}
@@ -29,6 +29,7 @@
  */
 
 #include <cstring>
+#include <vector>
 #include <iostream>
 
 #include <thimble/math/MathTools.h>
@@ -102,9 +103,12 @@ namespace thimble {
         y.setLength(m);
         y.setZero();
 
+        vector<uint32_t> xWords(N+1);
+        x.getData32(&(xWords[0]));
+
         const uint32_t *_A , *_x;
         _A = A.getData();
-        _x = x.getData();
+        _x = &(xWords[0]);
 
         // Runs 'm' scalar products
         for ( int i = 0 ; i < m ; i++ , _A += N ) {
@@ -309,71 +313,33 @@ namespace thimble {
      */
     void LinAlgTools::image( BinaryMatrix & B , const BinaryMatrix & A ) {
 
-        // Implementation follows Algorithm 2.3.2 in
-        // H. Cohen (1996). A Course in Computational Algebraic Number Theory.
-        // Springer-Verlag
-
-        BinaryMatrix M(A);
+        // The columns of 'A' at the pivot columns of its row echelon
+        // form are a basis of the image of 'A'.
+        BinaryMatrix C(A);
 
         int m , n;
         m = A.numRows();
         n = A.numCols();
 
-        // Step 1. [Initialize]
-
-        int r = 0;
-
-        int *c = (int*)malloc(m*sizeof(int));
-        if ( c == NULL ) {
+        int *pivots = (int*)malloc( (min(m,n)+1) * sizeof(int) );
+        if ( pivots == NULL ) {
             cerr << "LinAlgTools::image: out of memory." << endl;
             exit(EXIT_FAILURE);
         }
-        for ( int i = 0 ; i < m ; i++ ) {
-            c[i] = -1;
-        }
 
-        for (int k = 0 ; k < n ; k++ ) {
+        int r = C.rowEchelon(pivots,false);
 
-            // Step 2. [Scan column]
-            int j = -1;
+        BinaryMatrix tB(m,r);
+        for ( int l = 0 ; l < r ; l++ ) {
             for ( int i = 0 ; i < m ; i++ ) {
-                if ( c[i] < 0 && M.getAt(i,k) ) {
-                    j = i;
-                    break;
-                }
-            }
-
-            if ( j < 0 ) {
-                ++r;
-            } else {
-
-                // Step 3. [Eliminate]
-                for ( int i = 0 ; i < m ; i++ ) {
-                    if ( i != j ) {
-                        if ( M.getAt(i,k) ) {
-                            M.addRow(j,i);
-                        }
-                    }
+                if ( A.getAt(i,pivots[l]) ) {
+                    tB.setAt(i,l);
                 }
-
-                c[j] = k;
             }
         }
+        swap(B,tB);
 
-        // Step 5. [Output image]
-        B.setDimension(m,n-r);
-        for ( int j = 0 , l = 0 ; j < m ; j++ ) {
-            if ( c[j] >= 0 ) {
-                for ( int i = 0 ; i < m ; i++ ) {
-                    if ( A.getAt(i,c[j]) ) {
-                        B.setAt(i,l);
-                    }
-                }
-                ++l;
-            }
-        }
-
-        free(c);
+        free(pivots);
     }
 
     /**
@@ -394,85 +360,49 @@ namespace thimble {
      */
     void LinAlgTools::kernel( BinaryMatrix & B , const BinaryMatrix & A ) {
 
-        // Make a copy of 'A' in which Gauss elimination is performed inplace
+        // Reduced row echelon form of 'A'
         BinaryMatrix C(A);
 
-        // Permutation applied on the columns of 'A' to bring it in upper
-        // triangular form.
-        Permutation P(C.numCols());
-
-        int n;
-        n = min(C.numRows(),C.numCols());
-
-        int k;
-        for ( k = 0 ; k < n ; k++ ) {
-
-            bool p = false;
-
-            // Attempt to find a pivot element.
-            int i0 = k , j0 = k;
-            for ( int j = k ; j < C.numCols() ; j++ ) {
-                for ( int i = k ; i < C.numRows() ; i++ ) {
-                    if ( C.getAt(i,j) ) { // Found a pivot
-                        p = true;
-                        i0 = i;
-                        j0 = j;
-                        break;
-                    }
-                }
-                if ( p ) {
-                    break;
-                }
-            }
-
-            if ( !p ) {
-                // If no pivot has been been found, we are done.
-                break;
-            }
+        int m , n;
+        m = C.numRows();
+        n = C.numCols();
 
-            if ( k != j0 ) {
-                C.exchangeCols(k,j0);
-                P.exchange(k,j0);
-            }
+        int *pivots = (int*)malloc( (min(m,n)+1) * sizeof(int) );
+        int *freeCols = (int*)malloc( (n+1) * sizeof(int) );
+        if ( pivots == NULL || freeCols == NULL ) {
+            cerr << "LinAlgTools::kernel: out of memory." << endl;
+            exit(EXIT_FAILURE);
+        }
 
-            if ( k != i0 ) {
-                C.exchangeRows(k,i0);
-            }
+        int r = C.rowEchelon(pivots,true);
 
-            // Now, the element at (k,k) is non-zero and
-            // we can eliminate the elements in further rows of the
-            // 'k'th column.
-            for ( int i = k+1 ; i < C.numRows() ; i++ ) {
-                if ( C.getAt(i,k) ) {
-                    C.addRow(k,i,k);
-                }
+        // Columns without pivot
+        for ( int j = 0 , k = 0 , l = 0 ; j < n ; j++ ) {
+            if ( k < r && pivots[k] == j ) {
+                ++k;
+            } else {
+                freeCols[l++] = j;
             }
         }
 
-        BinaryMatrix PB;
-        PB.setDimension(C.numCols(),C.numCols()-k);
-
-        for ( int l = 0 ; l < PB.numCols() ; l++ ) {
-
-            PB.setAt(l+k,l);
-
-            for ( int i = k-1 ; i >= 0 ; i-- ) {
-
-                bool c = 0;
-                for ( int j = i+1 ; j <= l+k ; j++ ) {
-                    if ( PB.getAt(j,l) && C.getAt(i,j) ) {
-                        c ^= 1;
-                    }
-                }
-
-                if ( c ) {
-                    PB.setAt(i,l);
+        // For each free column 'j', the kernel contains the vector
+        // being 1 at 'j' and equal to the 'k'th row of 'C' at column
+        // 'j' at the pivot column 'pivots[k]'.
+        BinaryMatrix tB(n,n-r);
+        for ( int l = 0 ; l < n-r ; l++ ) {
+            tB.setAt(freeCols[l],l);
+        }
+        for ( int k = 0 ; k < r ; k++ ) {
+            for ( int l = 0 ; l < n-r ; l++ ) {
+                if ( C.getAt(k,freeCols[l]) ) {
+                    tB.setAt(pivots[k],l);
                 }
             }
         }
+        swap(B,tB);
 
-        mul(B,P,PB);
-
+        free(pivots);
+        free(freeCols);
     }
 
     /**
@@ -520,100 +450,44 @@ namespace thimble {
     		exit(EXIT_FAILURE);
     	}
 
-        // Make a copy of 'A' in which Gauss elimination is performed inplace
-        BinaryMatrix C(A);
-
-        // Make a copy of 'y' apply exchanges to its rows on performing
-        // Gaussian elimination.
-        BinaryVector z(y);
-
-        // Permutation applied on the columns of 'A' to bring it in upper
-        // triangular form.
-        Permutation P(C.numCols());
-
-        int n;
-        n = min(C.numRows(),C.numCols());
-
-        int k;
-        for ( k = 0 ; k < n ; k++ ) {
-
-            bool p = false;
-
-            // Attempt to find a pivot element.
-            int i0 = k , j0 = k;
-            for ( int j = k ; j < C.numCols() ; j++ ) {
-                for ( int i = k ; i < C.numRows() ; i++ ) {
-                    if ( C.getAt(i,j) ) { // Found a pivot
-                        p = true;
-                        i0 = i;
-                        j0 = j;
-                        break;
-                    }
-                }
-                if ( p ) {
-                    break;
-                }
-            }
-
-            if ( !p ) {
-                // If no pivot has been been found, we are done.
-                break;
-            }
-
-            if ( k != j0 ) {
-                C.exchangeCols(k,j0);
-                P.exchange(k,j0);
-            }
-
-            if ( k != i0 ) {
-            	z.exchange(k,i0);
-                C.exchangeRows(k,i0);
-            }
+        int m , n;
+        m = A.numRows();
+        n = A.numCols();
 
-            // Now, the element at (k,k) is non-zero and
-            // we can eliminate the elements in further rows of the
-            // 'k'th column.
-            bool zk = z.getAt(k);
-            for ( int i = k+1 ; i < C.numRows() ; i++ ) {
-                if ( C.getAt(i,k) ) {
-                	z.setAt(i,zk^z.getAt(i));
-                    C.addRow(k,i,k);
-                }
+        // Reduced row echelon form of the augmented matrix '(A|y)'
+        BinaryMatrix C , Y(m,1);
+        for ( int i = 0 ; i < m ; i++ ) {
+            if ( y.getAt(i) ) {
+                Y.setAt(i,0);
             }
         }
+        BinaryMatrix::concatCols(C,A,Y);
 
-        // Now 'C' is an upper triangular matrix and 'k' the rank of 'C'
-        // and thus of 'A'.
-
-        // Check if the system can be solved.
-        for ( int j = k ; j < z.getLength() ; j++ ) {
-        	// If any of the entries of 'z' at position higher
-        	// than the rank of 'C', is set, 'z' is not an element
-        	// of the image of 'C' and thus the system cannot be solved.
-        	if ( z.getAt(j) ) {
-        		return false;
-        	}
+        int *pivots = (int*)malloc( (min(m,n+1)+1) * sizeof(int) );
+        if ( pivots == NULL ) {
+            cerr << "LinAlgTools::solve: out of memory." << endl;
+            exit(EXIT_FAILURE);
         }
 
-        int N = C.numCols()/32+(C.numCols()%32?1:0);
-
-        x.setLength(C.numCols());
-
-        for ( int j = k - 1 ; j >= 0 ; j-- ) {
+        int r = C.rowEchelon(pivots,true);
 
-        	bool s = (MathTools::sprod32
-        			  (C.getData()+j*N,x.getData(),N)&0x1)?true:false;
+        // The system cannot be solved if the last column, which
+        // corresponds to 'y', is a pivot column.
+        bool solvable = (r == 0 || pivots[r-1] < n);
 
-        	bool zj = z.getAt(j);
-
-        	if ( (s && !zj) || (!s && zj) ) {
-        		x.setAt(j);
-        	}
+        if ( solvable ) {
+            // Setting the free variables to zero, the pivot variables
+            // are read off from the last column.
+            x.setLength(n);
+            x.setZero();
+            for ( int k = 0 ; k < r ; k++ ) {
+                x.setAt(pivots[k],C.getAt(k,n));
+            }
         }
 
-        mul(x,P,x);
+        free(pivots);
 
-        return true;
+        return solvable;
     }
 
     /**
@@ -656,9 +530,12 @@ namespace thimble {
         m = A.numRows();
         N = A.numCols()/32+(A.numCols()%32?1:0);
 
+        vector<uint32_t> vWords(N+1);
+        v.getData32(&(vWords[0]));
+
         const uint32_t *_A , *_v;
         _A = A.getData();
-        _v = v.getData();
+        _v = &(vWords[0]);
 
         // Runs 'm' scalar products
         for ( int i = 0 ; i < m ; i++ , _A += N ) {
@@ -39,6 +39,9 @@
 #include <stdint.h>
 #include <cmath>
 #include <iostream>
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+#include <immintrin.h>
+#endif
 
 #include <thimble/math/MathTools.h>
 
@@ -141,6 +144,9 @@ namespace thimble {
      */
     int MathTools::hammingWeight( register uint64_t n ) {
 
+#if defined(__GNUC__)
+        return __builtin_popcountll(n);
+#else
         // Brian Kernighan algorithm
 
         register int w = 0;
@@ -152,6 +158,7 @@ namespace thimble {
         }
 
         return w;
+#endif
     }
 
 	/**
@@ -197,6 +204,205 @@ namespace thimble {
 #endif
 	}
 
+    /**
+     * @brief
+     *            Computes the carry-less product of two 64-bit
+     *            integers.
+     *
+     * @details
+     *            The generic implementation processes the second
+     *            factor in windows of 4 bits using a table of the
+     *            16 carry-less multiples of the first factor.
+     *
+     * @param a
+     *            first factor
+     *
+     * @param b
+     *            second factor
+     *
+     * @param hi
+     *            On output, the upper 64 bits of the 128-bit
+     *            carry-less product of <code>a</code> and
+     *            <code>b</code>.
+     *
+     * @return    the lower 64 bits of the carry-less product of
+     *            <code>a</code> and <code>b</code>
+     */
+    uint64_t MathTools::clmul64( uint64_t a , uint64_t b , uint64_t & hi ) {
+
+        uint64_t u[16] , lo , t , mask;
+
+        // The multiples of the lower 61 bits of 'a' by polynomials of
+        // degree < 4 fit into 64 bits ...
+        u[0] = 0;
+        u[1] = a & 0x1FFFFFFFFFFFFFFFULL;
+        for ( int i = 2 ; i < 16 ; i += 2 ) {
+            u[i] = u[i/2] << 1;
+            u[i+1] = u[i] ^ u[1];
+        }
+
+        lo = u[b & 0xF];
+        hi = 0;
+        for ( int i = 4 ; i < 64 ; i += 4 ) {
+            t = u[(b >> i) & 0xF];
+            lo ^= t << i;
+            hi ^= t >> (64-i);
+        }
+
+        // ... and the upper 3 bits of 'a' are incorporated separately.
+        for ( int i = 61 ; i < 64 ; i++ ) {
+            mask = (uint64_t)0 - ((a >> i) & 1);
+            lo ^= (b << i) & mask;
+            hi ^= (b >> (64-i)) & mask;
+        }
+
+        return lo;
+    }
+
+    /**
+     * @brief
+     *            Tests whether the processor on which the program
+     *            runs supports the 'PCLMULQDQ' instruction.
+     *
+     * @details
+     *            see 'MathTools.h'
+     */
+    bool MathTools::hasPclmulqdq() {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        // Initializing 'cpuid' explicitly since we may be called from
+        // static initializers before the runtime did
+        static const bool has =
+            (__builtin_cpu_init(),__builtin_cpu_supports("pclmul") != 0);
+
+        return has;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief
+     *            Tests whether the processor on which the program
+     *            runs supports the 'AVX2' instruction set.
+     *
+     * @details
+     *            see 'MathTools.h'
+     */
+    bool MathTools::hasAvx2() {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        static const bool has =
+            (__builtin_cpu_init(),__builtin_cpu_supports("avx2") != 0);
+
+        return has;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief
+     *            Tests whether the processor on which the program
+     *            runs supports the 'POPCNT' instruction.
+     *
+     * @details
+     *            see 'MathTools.h'
+     */
+    bool MathTools::hasPopcnt() {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        static const bool has =
+            (__builtin_cpu_init(),__builtin_cpu_supports("popcnt") != 0);
+
+        return has;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief
+     *            Tests whether the processor on which the program
+     *            runs supports the 'AVX-512 VPOPCNTDQ' instructions.
+     *
+     * @details
+     *            see 'MathTools.h'
+     */
+    bool MathTools::hasAvx512Vpopcntdq() {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        static const bool has =
+            (__builtin_cpu_init(),
+             __builtin_cpu_supports("avx512f") != 0 &&
+             __builtin_cpu_supports("avx512vpopcntdq") != 0);
+
+        return has;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief
+     *            Tests whether the processor on which the program
+     *            runs supports the 'AES-NI' instructions.
+     *
+     * @details
+     *            see 'MathTools.h'
+     */
+    bool MathTools::hasAesni() {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        static const bool has =
+            (__builtin_cpu_init(),__builtin_cpu_supports("aes") != 0);
+
+        return has;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief
+     *            Tests whether the processor on which the program
+     *            runs supports the 'SHA' extensions.
+     *
+     * @details
+     *            see 'MathTools.h'
+     */
+    bool MathTools::hasSha() {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        static const bool has =
+            (__builtin_cpu_init(),__builtin_cpu_supports("sha") != 0);
+
+        return has;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief
+     *            Tests whether the processor on which the program
+     *            runs supports the 'SSSE3' instructions.
+     *
+     * @details
+     *            see 'MathTools.h'
+     */
+    bool MathTools::hasSsse3() {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        static const bool has =
+            (__builtin_cpu_init(),__builtin_cpu_supports("ssse3") != 0);
+
+        return has;
+#else
+        return false;
+#endif
+    }
+
 
     /**
      * @brief
@@ -400,6 +606,192 @@ namespace thimble {
         return hw;
     }
 
+    /**
+     * @brief
+     *            Signature of the kernels counting the 1s in
+     *            <code>(v,n)</code> or, if the template parameter
+     *            <code>XOR</code> is <code>true</code>, in the
+     *            bitwise xor of <code>(v,n)</code> and
+     *            <code>(w,n)</code>.
+     */
+    typedef int (*PopcountKernel)
+    ( const uint64_t *v , const uint64_t *w , int n );
+
+    /**
+     * @brief
+     *            Minimal number of 64-bit words for which the AVX2
+     *            kernel outperforms the scalar 'POPCNT' kernel.
+     */
+    static const int _AVX2_POPCOUNT_WORDS = 16;
+
+    /**
+     * @brief
+     *            Generic popcount kernel wrapping around
+     *            \link MathTools::hammingWeight()\endlink.
+     */
+    template<bool XOR>
+    static int popcountGeneric
+    ( const uint64_t *v , const uint64_t *w , int n ) {
+
+        int hw = 0;
+
+        for ( int i = 0 ; i < n ; i++ ) {
+            hw += MathTools::hammingWeight(XOR ? v[i]^w[i] : v[i]);
+        }
+
+        return hw;
+    }
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+    /**
+     * @brief
+     *            Popcount kernel using the 'POPCNT' instruction with
+     *            four independent accumulators.
+     *
+     * @warning
+     *            Must only be called if
+     *            \link MathTools::hasPopcnt()\endlink returns
+     *            <code>true</code>.
+     */
+    template<bool XOR>
+    __attribute__((target("popcnt")))
+    static int popcountPopcnt
+    ( const uint64_t *v , const uint64_t *w , int n ) {
+
+        uint64_t c0 = 0 , c1 = 0 , c2 = 0 , c3 = 0;
+        int i;
+
+        for ( i = 0 ; i+4 <= n ; i += 4 ) {
+            c0 += __builtin_popcountll(XOR ? v[i  ]^w[i  ] : v[i  ]);
+            c1 += __builtin_popcountll(XOR ? v[i+1]^w[i+1] : v[i+1]);
+            c2 += __builtin_popcountll(XOR ? v[i+2]^w[i+2] : v[i+2]);
+            c3 += __builtin_popcountll(XOR ? v[i+3]^w[i+3] : v[i+3]);
+        }
+
+        for ( ; i < n ; i++ ) {
+            c0 += __builtin_popcountll(XOR ? v[i]^w[i] : v[i]);
+        }
+
+        return (int)(c0+c1+c2+c3);
+    }
+
+    /**
+     * @brief
+     *            Popcount kernel using AVX2 where the bits of each
+     *            nibble are counted with a 16-entry table lookup
+     *            via 'VPSHUFB' and the byte counts are summed
+     *            via 'VPSADBW' (Mula's method).
+     *
+     * @warning
+     *            Must only be called if
+     *            \link MathTools::hasAvx2()\endlink returns
+     *            <code>true</code>.
+     */
+    template<bool XOR>
+    __attribute__((target("avx2,popcnt")))
+    static int popcountAvx2
+    ( const uint64_t *v , const uint64_t *w , int n ) {
+
+        const __m256i lookup = _mm256_setr_epi8
+            (0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4,
+             0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4);
+        const __m256i low = _mm256_set1_epi8(0x0f);
+        const __m256i zero = _mm256_setzero_si256();
+
+        __m256i acc = zero;
+        int i;
+
+        for ( i = 0 ; i+4 <= n ; i += 4 ) {
+
+            __m256i x = _mm256_loadu_si256((const __m256i*)(v+i));
+            if ( XOR ) {
+                x = _mm256_xor_si256
+                    (x,_mm256_loadu_si256((const __m256i*)(w+i)));
+            }
+
+            __m256i lo = _mm256_and_si256(x,low);
+            __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x,4),low);
+            __m256i c  = _mm256_add_epi8
+                (_mm256_shuffle_epi8(lookup,lo),
+                 _mm256_shuffle_epi8(lookup,hi));
+
+            acc = _mm256_add_epi64(acc,_mm256_sad_epu8(c,zero));
+        }
+
+        uint64_t hw =
+            (uint64_t)_mm256_extract_epi64(acc,0) +
+            (uint64_t)_mm256_extract_epi64(acc,1) +
+            (uint64_t)_mm256_extract_epi64(acc,2) +
+            (uint64_t)_mm256_extract_epi64(acc,3);
+
+        for ( ; i < n ; i++ ) {
+            hw += __builtin_popcountll(XOR ? v[i]^w[i] : v[i]);
+        }
+
+        return (int)hw;
+    }
+
+    /**
+     * @brief
+     *            Popcount kernel using the AVX-512 'VPOPCNTQ'
+     *            instruction; the tail is processed with a masked
+     *            load.
+     *
+     * @warning
+     *            Must only be called if
+     *            \link MathTools::hasAvx512Vpopcntdq()\endlink
+     *            returns <code>true</code>.
+     */
+    template<bool XOR>
+    __attribute__((target("avx512f,avx512vpopcntdq")))
+    static int popcountAvx512
+    ( const uint64_t *v , const uint64_t *w , int n ) {
+
+        __m512i acc = _mm512_setzero_si512();
+
+        for ( int i = 0 ; i < n ; i += 8 ) {
+
+            __mmask8 mask = (n-i >= 8) ? 0xff : (__mmask8)((1u<<(n-i))-1);
+
+            __m512i x = _mm512_maskz_loadu_epi64(mask,v+i);
+            if ( XOR ) {
+                x = _mm512_xor_si512(x,_mm512_maskz_loadu_epi64(mask,w+i));
+            }
+
+            acc = _mm512_add_epi64(acc,_mm512_popcnt_epi64(x));
+        }
+
+        uint64_t c[8];
+        _mm512_storeu_si512((void*)c,acc);
+
+        return (int)(c[0]+c[1]+c[2]+c[3]+c[4]+c[5]+c[6]+c[7]);
+    }
+#endif
+
+    /**
+     * @brief
+     *            Selects the fastest popcount kernel supported by the
+     *            processor for vectors of <code>n</code> 64-bit words.
+     */
+    template<bool XOR>
+    static PopcountKernel selectPopcountKernel( int n ) {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        if ( n >= 8 && MathTools::hasAvx512Vpopcntdq() ) {
+            return popcountAvx512<XOR>;
+        }
+        if ( n >= _AVX2_POPCOUNT_WORDS && MathTools::hasAvx2() ) {
+            return popcountAvx2<XOR>;
+        }
+        if ( MathTools::hasPopcnt() ) {
+            return popcountPopcnt<XOR>;
+        }
+#endif
+        (void)n;
+
+        return popcountGeneric<XOR>;
+    }
+
     /**
      * @brief
      *             Determines the Hamming weight of a bit-vector
@@ -420,16 +812,7 @@ namespace thimble {
     int MathTools::hw64
     ( register const uint64_t *v , register int n ) {
 
-        register int hw;
-        register int i;
-
-        hw = 0;
-
-        for ( i = 0 ; i < n ; i++ , v++ ) {
-            hw += hammingWeight(v[i]);
-        }
-
-        return hw;
+        return selectPopcountKernel<false>(n)(v,NULL,n);
     }
 
     /**
@@ -541,14 +924,25 @@ namespace thimble {
     ( register const uint64_t *v , register const uint64_t *w ,
       register int n ) {
 
-        register int hd = 0;
-        register int i;
+        return selectPopcountKernel<true>(n)(v,w,n);
+    }
 
-        for ( i = 0 ; i < n ; i++ ) {
-            hd += hammingWeight(v[i]^w[i]);
-        }
+    /**
+     * @brief
+     *             Determines the Hamming distances between a bit-vector
+     *             and each bit-vector of a contiguous gallery.
+     *
+     * @details
+     *             see 'MathTools.h'
+     */
+    void MathTools::hd64Batch
+    ( int *d , const uint64_t *v , const uint64_t *W , int n , int num ) {
 
-        return hd;
+        PopcountKernel kernel = selectPopcountKernel<true>(n);
+
+        for ( int l = 0 ; l < num ; l++ , W += n ) {
+            d[l] = kernel(v,W,n);
+        }
     }
 
     /**
@@ -650,6 +1044,68 @@ namespace thimble {
         return hd;
     }
 
+    /**
+     * @brief
+     *            Transposes a 64x64 bit matrix in place.
+     *
+     * @details
+     *            The matrix is given by 64 rows of which the
+     *            <i>i</i>th is stored in <code>A[i]</code> such that
+     *            the entry in the <i>j</i>th column is the
+     *            <i>j</i>th bit of <code>A[i]</code>. On output, the
+     *            <i>j</i>th bit of <code>A[i]</code> equals the
+     *            <i>i</i>th bit of the input <code>A[j]</code>.
+     *
+     *            The implementation swaps blocks of 32x32, 16x16,...,
+     *            1x1 bits following the recursive approach described
+     *            in <b>Warren (2012)</b>. <i>Hacker's Delight</i>,
+     *            2nd edition, Section 7-3.
+     *
+     * @param A
+     *            Array of 64 integers of 64-bit width.
+     */
+    void MathTools::transpose64( uint64_t *A ) {
+
+        uint64_t m = 0x00000000FFFFFFFFULL , t;
+
+        for ( int j = 32 ; j != 0 ; j >>= 1 , m ^= (m << j) ) {
+            for ( int k = 0 ; k < 64 ; k = ((k | j) + 1) & ~j ) {
+                // Swap the upper right with the lower left block
+                t = ((A[k] >> j) ^ A[k | j]) & m;
+                A[k | j] ^= t;
+                A[k] ^= (t << j);
+            }
+        }
+    }
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+    /**
+     * @brief
+     *            Same as \link MathTools::mxor64()\endlink but processes
+     *            256 bits per instruction.
+     *
+     * @warning
+     *            Must only be called if \link MathTools::hasAvx2()\endlink
+     *            returns <code>true</code>.
+     */
+    __attribute__((target("avx2")))
+    static void mxor64Avx2
+    ( uint64_t *out , const uint64_t *in1 , const uint64_t *in2 , int n ) {
+
+        int i;
+
+        for ( i = 0 ; i+4 <= n ; i += 4 ) {
+            __m256i a = _mm256_loadu_si256((const __m256i*)(in1+i));
+            __m256i b = _mm256_loadu_si256((const __m256i*)(in2+i));
+            _mm256_storeu_si256((__m256i*)(out+i),_mm256_xor_si256(a,b));
+        }
+
+        for ( ; i < n ; i++ ) {
+            out[i] = in1[i] ^ in2[i];
+        }
+    }
+#endif
+
     /**
      * @brief
      *            Performs exclusive or operations on arrays of 64-bit
@@ -688,6 +1144,13 @@ namespace thimble {
       register const uint64_t *in1 , register const uint64_t *in2 ,
       register int n ) {
 
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        if ( n >= 8 && hasAvx2() ) {
+            mxor64Avx2(out,in1,in2,n);
+            return;
+        }
+#endif
+
         register int i;
 
         for ( i = 0 ; i < n ; i++ , out++ , in1++ , in2++ ) {
@@ -0,0 +1,427 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file MinutiaeArrays.cpp
+ *
+ * @brief
+ *            Implements the functionalities from 'MinutiaeArrays.h' which
+ *            provides a class storing the minutiae of a template in
+ *            separate arrays.
+ *
+ * @author agent
+ */
+
+#define _USE_MATH_DEFINES
+#include <cstdlib>
+#include <cmath>
+#include <cfloat>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "config.h"
+
+#include <thimble/math/AffineTransform.h>
+#include <thimble/image/Orientation.h>
+#include <thimble/finger/MinutiaeRecord.h>
+#include <thimble/finger/MinutiaeArrays.h>
+
+using namespace std;
+
+/**
+ * @brief The library's namespace
+ */
+namespace thimble {
+
+	/**
+	 * @brief
+	 *            Creates an empty template with the same default
+	 *            attributes as an empty minutiae view.
+	 */
+	MinutiaeArrays::MinutiaeArrays() {
+		this->fingerPosition = UNKNOWN_FINGER;
+		this->viewNumber     = 0;
+		this->impressionType = LIVESCAN_PLAIN;
+		this->fingerQuality  = 100;
+	}
+
+	/**
+	 * @brief
+	 *            Creates the arrays of the minutiae of a view.
+	 */
+	MinutiaeArrays::MinutiaeArrays( const MinutiaeView & view ) {
+		assign(view);
+	}
+
+	/**
+	 * @brief
+	 *            Replaces the content of this instance by the
+	 *            minutiae and attributes of a view.
+	 */
+	void MinutiaeArrays::assign( const MinutiaeView & view ) {
+
+		this->fingerPosition = view.fingerPosition;
+		this->viewNumber     = view.viewNumber;
+		this->impressionType = view.impressionType;
+		this->fingerQuality  = view.fingerQuality;
+
+		int n = view.getMinutiaeCount();
+
+		this->x.resize(n);
+		this->y.resize(n);
+		this->angles.resize(n);
+		this->types.resize(n);
+		this->qualities.resize(n);
+
+		for ( int i = 0 ; i < n ; i++ ) {
+			const Minutia & minutia = view.minutiae[i];
+			this->x[i] = minutia.getX();
+			this->y[i] = minutia.getY();
+			this->angles[i] = minutia.getAngle();
+			this->types[i] = minutia.getType();
+			this->qualities[i] = minutia.getQuality();
+		}
+	}
+
+	/**
+	 * @brief
+	 *            Replaces the content of this instance by the minutiae
+	 *            of another instance moved by a spatial movement.
+	 */
+	void MinutiaeArrays::assign
+	( const MinutiaeArrays & a , const AffineTransform & f ) {
+
+		int n = a.getMinutiaeCount();
+
+		if ( this != &a ) {
+			this->fingerPosition = a.fingerPosition;
+			this->viewNumber     = a.viewNumber;
+			this->impressionType = a.impressionType;
+			this->fingerQuality  = a.fingerQuality;
+			this->x.resize(n);
+			this->y.resize(n);
+			this->angles.resize(n);
+			this->types.assign(a.types.begin(),a.types.end());
+			this->qualities.assign(a.qualities.begin(),a.qualities.end());
+		}
+
+		if ( n == 0 ) {
+			return;
+		}
+
+		// Move the positions; the loop is free of branches and calls such
+		// that it can be vectorized
+		const double *ax = &(a.x[0]) , *ay = &(a.y[0]);
+		double *fx = &(this->x[0]) , *fy = &(this->y[0]);
+		double fa = f.a , fb = f.b , fc = f.c , fd = f.d , fv = f.v , fw = f.w;
+		for ( int i = 0 ; i < n ; i++ ) {
+			double xi = ax[i] , yi = ay[i];
+			fx[i] = fa * xi + fb * yi + fv;
+			fy[i] = fc * xi + fd * yi + fw;
+		}
+
+		// Rotate the angles and normalize them in the same way as a
+		// 'Minutia' does
+		double rotation = f.getRotationAngle();
+		const double *atheta = &(a.angles[0]);
+		double *ftheta = &(this->angles[0]);
+		for ( int i = 0 ; i < n ; i++ ) {
+			double angle = atheta[i]+rotation;
+			if ( angle < 0.0 || angle >= M_PI+M_PI ) {
+				angle = atan2(sin(angle),cos(angle));
+				while ( angle < 0.0 ) {
+					angle += M_PI+M_PI;
+				}
+				while ( angle >= M_PI+M_PI ) {
+					angle -= M_PI+M_PI;
+				}
+			}
+			ftheta[i] = angle;
+		}
+	}
+
+	/**
+	 * @brief
+	 *            Converts the instance to a minutiae view.
+	 */
+	MinutiaeView MinutiaeArrays::toView() const {
+
+		MinutiaeView view;
+
+		view.fingerPosition = this->fingerPosition;
+		view.viewNumber     = this->viewNumber;
+		view.impressionType = this->impressionType;
+		view.fingerQuality  = this->fingerQuality;
+
+		int n = getMinutiaeCount();
+		view.minutiae.reserve(n);
+		for ( int i = 0 ; i < n ; i++ ) {
+			view.minutiae.push_back
+				(Minutia(this->x[i],this->y[i],this->angles[i],
+						 this->types[i],this->qualities[i]));
+		}
+
+		return view;
+	}
+
+	/**
+	 * @brief
+	 *            Constructs the <i>i</i>th minutia.
+	 */
+	Minutia MinutiaeArrays::getMinutia( int i ) const {
+
+		if ( i < 0 || i >= getMinutiaeCount() ) {
+			cerr << "MinutiaeArrays::getMinutia: "
+				 << "Accessed minutia is out of bounds." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		return Minutia(this->x[i],this->y[i],this->angles[i],
+					   this->types[i],this->qualities[i]);
+	}
+
+	/**
+	 * @brief
+	 *            Appends a minutia.
+	 */
+	void MinutiaeArrays::addMinutia( const Minutia & minutia ) {
+		this->x.push_back(minutia.getX());
+		this->y.push_back(minutia.getY());
+		this->angles.push_back(minutia.getAngle());
+		this->types.push_back(minutia.getType());
+		this->qualities.push_back(minutia.getQuality());
+	}
+
+	/**
+	 * @brief
+	 *            Removes all minutiae.
+	 */
+	void MinutiaeArrays::removeAllMinutiae() {
+		this->x.clear();
+		this->y.clear();
+		this->angles.clear();
+		this->types.clear();
+		this->qualities.clear();
+	}
+
+	/**
+	 * @brief
+	 *            Reserves the specified capacity of minutiae.
+	 */
+	void MinutiaeArrays::ensureCapacity( int capacity ) {
+		if ( capacity > 0 ) {
+			this->x.reserve(capacity);
+			this->y.reserve(capacity);
+			this->angles.reserve(capacity);
+			this->types.reserve(capacity);
+			this->qualities.reserve(capacity);
+		}
+	}
+
+	/**
+	 * @brief
+	 *            Moves all minutiae by a spatial movement.
+	 */
+	void MinutiaeArrays::transform( const AffineTransform & f ) {
+		assign(*this,f);
+	}
+
+	/**
+	 * @brief
+	 *            Represents all minutiae w.r.t. a directed reference
+	 *            point.
+	 */
+	void MinutiaeArrays::prealign( double x , double y , double direction ) {
+
+		AffineTransform f;
+
+		f.v = -x;
+		f.w = -y;
+		f.irotate(direction);
+
+		transform(f);
+	}
+
+	/**
+	 * @brief
+	 *            Represents all minutiae w.r.t. a directed reference
+	 *            point.
+	 */
+	void MinutiaeArrays::prealign( const DirectedPoint & p ) {
+		prealign(p.x,p.y,p.direction.getDirectionAngle());
+	}
+
+	/**
+	 * @brief
+	 *            Quantizes the positions and angles of all minutiae.
+	 */
+	void MinutiaeArrays::quantize( int angleQuanta ) {
+
+		if ( angleQuanta <= 0 ) {
+			cerr << "MinutiaeArrays::quantize: "
+				 << "Number of angle quanta must be positive." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		int n = getMinutiaeCount();
+
+		for ( int i = 0 ; i < n ; i++ ) {
+			this->x[i] = THIMBLE_ROUND(this->x[i]);
+			this->y[i] = THIMBLE_ROUND(this->y[i]);
+		}
+
+		for ( int i = 0 ; i < n ; i++ ) {
+			int q = (int)THIMBLE_ROUND
+					(this->angles[i] / (M_PI+M_PI) * (double)angleQuanta);
+			q %= angleQuanta;
+			this->angles[i] =
+				(M_PI+M_PI) * ( (double)q / (double)angleQuanta );
+		}
+	}
+
+	/**
+	 * @brief
+	 *            Returns a measure of dissimilarity between the
+	 *            <i>i</i>th minutia of <i>v</i> and the <i>j</i>th
+	 *            minutia of <i>w</i>.
+	 */
+	double MinutiaeArrays::dist
+	( const MinutiaeArrays & v , int i ,
+	  const MinutiaeArrays & w , int j , double angleWeight ) {
+
+		double dx , dy;
+		dx = v.x[i]-w.x[j];
+		dy = v.y[i]-w.y[j];
+
+		double dtheta = v.angles[i]-w.angles[j];
+		dtheta = std::min(std::abs(dtheta),std::abs(M_PI+M_PI-dtheta));
+
+		return sqrt(dx*dx+dy*dy)+angleWeight*dtheta;
+	}
+
+	/**
+	 * @brief
+	 *            Computes a similarity measure between two minutiae
+	 *            templates.
+	 */
+	double MinutiaeArrays::dist
+	( const MinutiaeArrays & v , const MinutiaeArrays & w ,
+	  int n , double angleWeight ) {
+
+		// Number of input minutiae
+		int k , l;
+		k = v.getMinutiaeCount();
+		l = w.getMinutiaeCount();
+
+		// Are 'n' summands possible?
+		int m = std::min(k,l);
+		if ( n > 0 ) {
+			m = std::min(m,n);
+		}
+
+		// Special case
+		if ( m == 0 ) {
+			return 0.0;
+		}
+
+		// Allocate memory
+		double *distances = (double*)malloc(m*sizeof(double));
+		if ( distances == NULL ) {
+			cerr << "MinutiaeArrays::dist: Out of memory." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		// Compute the sum
+		double d = dist(v,w,m,angleWeight,distances);
+
+		// Free memory
+		free(distances);
+
+		// Return the result
+		return d;
+	}
+
+	/**
+	 * @brief
+	 *            Computes a similarity measure between two minutiae
+	 *            templates using a pre-allocated array.
+	 */
+	double MinutiaeArrays::dist
+	( const MinutiaeArrays & v , const MinutiaeArrays & w ,
+	  int m , double angleWeight , double *distances ) {
+
+		int k , l;
+		k = v.getMinutiaeCount();
+		l = w.getMinutiaeCount();
+
+		// Initialize the array that keeps track if the 'm'
+		// most similar minutiae correspondences betwee 'v'
+		// and 'w'
+		for ( int i = 0 ; i < m ; i++ ) {
+			distances[i] = DBL_MAX;
+		}
+
+		const double *wx = w.getX() , *wy = w.getY() , *wtheta = w.getAngles();
+
+		// Iterate over all minutiae in 'v'
+		for ( int i = 0 ; i < k ; i++ ) {
+
+			double x = v.x[i] , y = v.y[i] , theta = v.angles[i];
+
+			// Find the most similar minutia from 'w' to the 'i'th of 'v'
+			// as well as its distance
+			double minDist = DBL_MAX;
+			for ( int j = 0 ; j < l ; j++ ) {
+				double dx = x-wx[j];
+				double dy = y-wy[j];
+				double dtheta = theta-wtheta[j];
+				dtheta = std::min(std::abs(dtheta),std::abs(M_PI+M_PI-dtheta));
+				double d = sqrt(dx*dx+dy*dy)+angleWeight*dtheta;
+				if ( d < minDist ) {
+					minDist = d;
+				}
+			}
+
+			// Insert the dissimilarity in 'distances' if it is among the
+			// 'm' minimal values
+			for ( int s = 0 ; s < m ; s++ ) {
+				if ( minDist < distances[s] ) {
+					for ( int t = m-1 ; t > s ; t-- ) {
+						distances[t] = distances[t-1];
+					}
+					distances[s] = minDist;
+					break;
+				}
+			}
+		}
+
+		// Sum up the values in 'distances' ...
+		double d = 0.0;
+		for ( int i = 0 ; i < m ; i++ ) {
+			if ( distances[i] < DBL_MAX ) {
+				d += distances[i];
+			}
+		}
+
+		// ... which is the result.
+		return d;
+	}
+}
@@ -106,6 +106,11 @@ namespace thimble {
 		this->vaultX = NULL;
 		this->vaultY = NULL;
 
+		// Initialize an empty grid
+		this->gridCellSize = 0.0;
+		this->gridCols = 0;
+		this->gridRows = 0;
+
 		// The finite field will be the finite field of 2^16 elements
 		this->gfPtr = new SmallBinaryField(16);
 
@@ -231,6 +236,11 @@ namespace thimble {
 			this->vaultMinutiae.push_back(selectedView.getMinutia(i));
 		}
 
+		// Index the genuine minutiae w.r.t. their position such that the
+		// distance of chaff candidates is only checked against nearby
+		// vault minutiae
+		buildGrid();
+
 		// Loop 'n-t' times to generate 'n-t' chaff minutiae
 		for ( int j = t ; j < this->n ; j++ ) {
 
@@ -241,24 +251,18 @@ namespace thimble {
 			for(;;) {
 
 				// First, generate a candidate for the chaff minutia
+				// uniformly over the region, i.e., independently of the
+				// genuine minutiae
 				Minutia chaff = generateChaffMinutia();
 
-				// Determine the minimal distance over all vault minutiae
-				// included in the vector 'vaultMinutiae'
-				double dmin = DBL_MAX;
-				for ( int i = 0 ; i < j ; i++ ) {
-					double d = dist(this->vaultMinutiae[i],chaff);
-					if ( d < dmin ) {
-						dmin = d;
-					}
-				}
-
-				// If the minimal distance is at least 'minInterVaultDistance'
-				// the chaff minutia is valid and the loop stops; otherwise
-				// the loop continues until a valid chaff minutia could be
-				// generated
-				if ( dmin > this->minInterVaultDistance ) {
+				// If the candidate keeps a distance larger than
+				// 'minInterVaultDistance' to all vault minutiae, which is
+				// checked only against the nearby ones, the chaff minutia
+				// is valid and the loop stops; otherwise the loop
+				// continues until a valid chaff minutia could be generated
+				if ( keepsMinimalInterVaultDistance(chaff) ) {
 					this->vaultMinutiae.push_back(chaff);
+					addToGrid();
 					break;
 				}
 			}
@@ -275,6 +279,10 @@ namespace thimble {
 			(this->vaultMinutiae.begin(),this->vaultMinutiae.end(),
 			 LexicographicalMinutiaComparator());
 
+		// Index the sorted vault minutiae w.r.t. their position for
+		// matching query minutiae on opening the vault
+		buildGrid();
+
 		// Now, generate a random polynomial of degree '<k'...
 		SmallBinaryFieldPolynomial f(getField());
 		f.random(this->k,this->tryRandom);
@@ -364,44 +372,32 @@ namespace thimble {
 			exit(EXIT_FAILURE);
 		}
 
+		// Determine the vault minutiae matching the query minutiae
+		vector<int> matches(t);
+		if ( t > 0 ) {
+			matchVaultMinutiae(&matches[0],selectedView,t);
+		}
+
+		// Keeps track of the vault points already contained in the
+		// unlocking set
+		vector<bool> contained(this->vaultMinutiae.size(),false);
+
 		// 's' will be the size of the unlocking set
 		int s = 0;
 		// Extract unlocking points by iterating over all query minutiae.
 		for ( int i = 0 ; i < t ; i++ ) {
 
-			// Determine the index and the distance of the vault minutiae
-			// that is of minimal distance to the query minutia
-			int minIndex = -1;
-			double minDistance = DBL_MAX;
-			for ( int j = 0 ; j < (int)(this->vaultMinutiae.size()) ; j++ ) {
-				double d = dist(selectedView.getMinutia(i),vaultMinutiae[j]);
-				if ( d < minDistance ) {
-					minIndex = j;
-					minDistance = d;
-				}
-			}
-
-			// If vault minutia matches the query minutia ...
-			if ( minDistance <= this->maxMatchDistance ) {
-
-				// ... check whether the corresponding unlocking point
-				// is already contained in the unlocking set. ...
-				bool alreadyContained = false;
-				for ( int j = 0 ; j < s ; j++ ) {
-					if ( x[j] == this->vaultX[minIndex] ) {
-						alreadyContained = true;
-						break;
-					}
-				}
-
-				// ... . If not, append the point at the end of the
-				// unlocking set.
-				if ( !alreadyContained ) {
-					x[s] = this->vaultX[minIndex];
-					y[s] = this->vaultY[minIndex];
-					++s;
-				}
-
+			int minIndex = matches[i];
+
+			// If a vault minutia matches the query minutia and the
+			// corresponding unlocking point is not already contained in
+			// the unlocking set, append the point at the end of the
+			// unlocking set.
+			if ( minIndex >= 0 && !contained[minIndex] ) {
+				contained[minIndex] = true;
+				x[s] = this->vaultX[minIndex];
+				y[s] = this->vaultY[minIndex];
+				++s;
 			}
 		}
 
@@ -417,6 +413,181 @@ namespace thimble {
 		return state;
 	}
 
+	/**
+	 * @brief
+	 *           Determines the grid cell of a minutia.
+	 *
+	 * @details
+	 *           see 'MinutiaeFuzzyVault.h'
+	 */
+	int MinutiaeFuzzyVault::gridCell( const Minutia & minutia ) const {
+
+		int cx = (int)floor(minutia.getX()/this->gridCellSize);
+		int cy = (int)floor(minutia.getY()/this->gridCellSize);
+		cx = min(max(cx,0),this->gridCols-1);
+		cy = min(max(cy,0),this->gridRows-1);
+
+		return cy * this->gridCols + cx;
+	}
+
+	/**
+	 * @brief
+	 *           Indexes the vault minutiae in a grid w.r.t. their
+	 *           position.
+	 *
+	 * @details
+	 *           see 'MinutiaeFuzzyVault.h'
+	 */
+	void MinutiaeFuzzyVault::buildGrid() {
+
+		// Cells of about the area per vault minutia
+		double cellSize = sqrt((double)this->width*(double)this->height/
+							   (double)max(this->n,1));
+		if ( cellSize < 1.0 ) {
+			cellSize = 1.0;
+		}
+
+		this->gridCellSize = cellSize;
+		this->gridCols = max(1,(int)ceil(this->width/cellSize));
+		this->gridRows = max(1,(int)ceil(this->height/cellSize));
+
+		this->gridHead.assign(this->gridCols*this->gridRows,-1);
+		this->gridNext.clear();
+		this->gridNext.reserve(this->n);
+
+		// Add the vault minutiae in reverse order such that each cell
+		// lists its minutiae with ascending index
+		int size = (int)this->vaultMinutiae.size();
+		this->gridNext.resize(size);
+		for ( int i = size-1 ; i >= 0 ; i-- ) {
+			int c = gridCell(this->vaultMinutiae[i]);
+			this->gridNext[i] = this->gridHead[c];
+			this->gridHead[c] = i;
+		}
+	}
+
+	/**
+	 * @brief
+	 *           Adds the last vault minutia to the grid.
+	 *
+	 * @details
+	 *           see 'MinutiaeFuzzyVault.h'
+	 */
+	void MinutiaeFuzzyVault::addToGrid() {
+
+		int i = (int)this->vaultMinutiae.size()-1;
+		int c = gridCell(this->vaultMinutiae[i]);
+
+		this->gridNext.push_back(this->gridHead[c]);
+		this->gridHead[c] = i;
+	}
+
+	/**
+	 * @brief
+	 *           Determines the vault minutia nearest to the given
+	 *           minutia within a maximal distance.
+	 *
+	 * @details
+	 *           see 'MinutiaeFuzzyVault.h'
+	 */
+	int MinutiaeFuzzyVault::findNearestVaultMinutia
+	( const Minutia & minutia , double maxDistance ) const {
+
+		double cellSize = this->gridCellSize;
+
+		// Range of cells containing all positions within distance
+		// 'maxDistance' of the minutia
+		int cx0 = (int)floor((minutia.getX()-maxDistance)/cellSize);
+		int cx1 = (int)floor((minutia.getX()+maxDistance)/cellSize);
+		int cy0 = (int)floor((minutia.getY()-maxDistance)/cellSize);
+		int cy1 = (int)floor((minutia.getY()+maxDistance)/cellSize);
+		cx0 = min(max(cx0,0),this->gridCols-1);
+		cx1 = min(max(cx1,0),this->gridCols-1);
+		cy0 = min(max(cy0,0),this->gridRows-1);
+		cy1 = min(max(cy1,0),this->gridRows-1);
+
+		// Nearest vault minutia among the candidates; ties are resolved in
+		// favour of the smaller index as if all vault minutiae were
+		// scanned in order.
+		int minIndex = -1;
+		double minDistance = DBL_MAX;
+		for ( int cy = cy0 ; cy <= cy1 ; cy++ ) {
+			for ( int cx = cx0 ; cx <= cx1 ; cx++ ) {
+				int c = cy * this->gridCols + cx;
+				for ( int j = this->gridHead[c] ; j >= 0 ; j = this->gridNext[j] ) {
+					double d = dist(minutia,this->vaultMinutiae[j]);
+					if ( d < minDistance ||
+						 ( d == minDistance && j < minIndex ) ) {
+						minIndex = j;
+						minDistance = d;
+					}
+				}
+			}
+		}
+
+		if ( minDistance <= maxDistance ) {
+			return minIndex;
+		} else {
+			return -1;
+		}
+	}
+
+	/**
+	 * @brief
+	 *           Checks whether a chaff candidate keeps the minimal
+	 *           inter-vault distance to all vault minutiae.
+	 *
+	 * @details
+	 *           see 'MinutiaeFuzzyVault.h'
+	 */
+	bool MinutiaeFuzzyVault::keepsMinimalInterVaultDistance
+	( const Minutia & chaff ) const {
+
+		double r = this->minInterVaultDistance;
+		double cellSize = this->gridCellSize;
+
+		// Range of cells containing all positions within distance 'r' of
+		// the candidate
+		int cx0 = (int)floor((chaff.getX()-r)/cellSize);
+		int cx1 = (int)floor((chaff.getX()+r)/cellSize);
+		int cy0 = (int)floor((chaff.getY()-r)/cellSize);
+		int cy1 = (int)floor((chaff.getY()+r)/cellSize);
+		cx0 = min(max(cx0,0),this->gridCols-1);
+		cx1 = min(max(cx1,0),this->gridCols-1);
+		cy0 = min(max(cy0,0),this->gridRows-1);
+		cy1 = min(max(cy1,0),this->gridRows-1);
+
+		for ( int cy = cy0 ; cy <= cy1 ; cy++ ) {
+			for ( int cx = cx0 ; cx <= cx1 ; cx++ ) {
+				int c = cy * this->gridCols + cx;
+				for ( int j = this->gridHead[c] ; j >= 0 ; j = this->gridNext[j] ) {
+					if ( dist(this->vaultMinutiae[j],chaff) <= r ) {
+						return false;
+					}
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief
+	 *           Determines for the first <i>t</i> minutiae of a query
+	 *           template the vault minutiae they match with.
+	 *
+	 * @details
+	 *           see 'MinutiaeFuzzyVault.h'
+	 */
+	void MinutiaeFuzzyVault::matchVaultMinutiae
+	( int *indices , const MinutiaeView & view , int t ) const {
+
+		for ( int i = 0 ; i < t ; i++ ) {
+			indices[i] = findNearestVaultMinutia
+				(view.getMinutia(i),this->maxMatchDistance);
+		}
+	}
+
 	/**
 	 * @brief
 	 *           Attempts to decode a polynomial given unlocking points.
@@ -738,6 +909,11 @@ namespace thimble {
 		free(this->vaultY);
 		this->vaultX = NULL;
 		this->vaultY = NULL;
+		this->gridCellSize = 0.0;
+		this->gridCols = 0;
+		this->gridRows = 0;
+		this->gridHead.clear();
+		this->gridNext.clear();
 		memset(this->hash,0,20);
 	}
 
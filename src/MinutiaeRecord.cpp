@@ -34,6 +34,7 @@
 
 #define _USE_MATH_DEFINES
 #include <stdint.h>
+#include <climits>
 #include <cstdio>
 #include <cstdlib>
 #include <cmath>
@@ -45,6 +46,7 @@
 #include "config.h"
 
 #include <thimble/finger/MinutiaeRecord.h>
+#include <thimble/finger/MinutiaeRecordView.h>
 
 using namespace std;
 
@@ -53,6 +55,36 @@ using namespace std;
  */
 namespace thimble {
 
+	/**
+	 * @brief
+	 *            Checks the four header bytes of a finger view as
+	 *            <code>MinutiaeRecordView::assign()</code> does.
+	 *
+	 * @param header
+	 *            The first four bytes of an encoded finger view.
+	 *
+	 * @return
+	 *            <code>true</code> if the finger position, the
+	 *            impression type and the quality are valid; otherwise,
+	 *            <code>false</code>.
+	 */
+	static bool isValidViewHeader( const unsigned char header[4] ) {
+
+		int impressionType = (header[1]>>4)&0xF;
+
+		if ( impressionType != 0 && impressionType != 1 &&
+			 impressionType != 2 && impressionType != 3 &&
+			 impressionType != 4 && impressionType != 8 ) {
+			return false;
+		}
+
+		if ( header[0] > 10 || header[2] > 100 || impressionType ) {
+			return false;
+		}
+
+		return true;
+	}
+
 	/**
 	 * @brief
 	 *            Initializes this minutia as specified.
@@ -166,19 +198,39 @@ namespace thimble {
 	 */
 	bool MinutiaeView::write( FILE *out ) const {
 
-		unsigned char header[4];
-		unsigned char minutiaData[6];
+		// Serialize the view into a buffer such that it is written
+		// with a single call
+		unsigned char data[4+6*255];
+		if ( this->minutiae.size() > 255 ) {
+			return false;
+		}
+
+		int size = write(data);
+		if ( size < 0 ) {
+			return false;
+		}
+
+		return fwrite(data,1,size,out) == (size_t)size;
+	}
+
+	/**
+	 * @brief
+	 *            Writes the minutiae view to the specified memory.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecord.h'
+	 */
+	int MinutiaeView::write( void *data ) const {
+
+		unsigned char *header = (unsigned char*)data;
+		unsigned char *minutiaData = header + 4;
 
 		header[0] = (unsigned char) this->fingerPosition;
 		header[1] = (unsigned char) (this->viewNumber + 0x10 * this->impressionType);
 		header[2] = (unsigned char) this->fingerQuality;
 		header[3] = (unsigned char) this->minutiae.size();
 
-		if ( fwrite(header,1,4,out) != 4 ) {
-			return false;
-		}
-
-		for (int i = 0; i < (int)(this->minutiae.size()) ; i++) {
+		for (int i = 0; i < (int)(this->minutiae.size()) ; i++ , minutiaData += 6) {
 
 			Minutia minutia = this->minutiae.at(i);
 
@@ -201,7 +253,7 @@ namespace thimble {
 			theta = minutia.angle;
 
 			if ( x < 0 || y < 0 || x >= (1<<14) || y >= (1<<14) ) {
-				return false;
+				return -1;
 			}
 
 			minutiaData[0] += (unsigned char) ((x >> 8) & 63);
@@ -212,13 +264,9 @@ namespace thimble {
 			minutiaData[4] = (unsigned char) THIMBLE_ROUND(theta / (M_PI + M_PI)
 					* 256.0);
 			minutiaData[5] = (unsigned char) minutia.quality;
-
-			if ( fwrite(minutiaData,1,6,out) != 6 ) {
-				return false;
-			}
 		}
 
-		return true;
+		return getSizeInBytes();
 	}
 
 	/**
@@ -230,66 +278,24 @@ namespace thimble {
 	 */
 	bool MinutiaeView::read( FILE *in ) {
 
-		unsigned char header[4];
+		// Read the header and then all minutiae at once
+		unsigned char data[4+6*255];
 
-		if ( fread(header,sizeof(unsigned char),4,in) != 4 )
-			return false;
-
-		int impressionType = (header[1]>>4)&0xF;
-
-		if ( impressionType != 0 && impressionType != 1 &&
-			 impressionType != 2 && impressionType != 3 &&
-			 impressionType != 4 && impressionType != 8 ) {
+		if ( fread(data,sizeof(unsigned char),4,in) != 4 ) {
 			return false;
 		}
 
-		if ( header[0] > 10 || header[2] > 100 || impressionType ) {
+		// Reject an invalid header before reading any further
+		if ( !isValidViewHeader(data) ) {
 			return false;
 		}
 
-		this->fingerPosition = (FINGER_POSITION_T)header[0];
-		this->viewNumber = header[1]&0xF;
-		this->impressionType = (FINGER_IMPRESSION_TYPE_T)impressionType;
-		this->fingerQuality = header[2];
-
-		int numMinutiae = header[3];
-
-		this->minutiae.assign(numMinutiae,Minutia());
-
-		unsigned char minutiaData[6];
-		for ( int i = 0 ; i < numMinutiae ; i++ ) {
-
-			if ( fread(minutiaData,sizeof(unsigned char),6,in) != 6 ) {
-				return false;
-			}
-
-			switch( (minutiaData[0]>>6) & 0x3 ) {
-			case 1:
-				this->minutiae[i].typ = ENDING_MINUTIA_TYPE;
-				break;
-			case 2:
-				this->minutiae[i].typ = BIFURCATION_MINUTIA_TYPE;
-				break;
-			default:
-				this->minutiae[i].typ = UNKNOWN_MINUTIA_TYPE;
-				break;
-			}
-
-			uint16_t x , y;
-			x = 0x100*(minutiaData[0]&((1<<6)-1)) + minutiaData[1];
-			y = 0x100*(minutiaData[2]&((1<<6)-1)) + minutiaData[3];
-
-			double angle = (M_PI+M_PI) * ( (double)minutiaData[4] / 256.0 );
-
-			uint8_t quality = minutiaData[5];
-
-			this->minutiae[i].x = x;
-			this->minutiae[i].y = y;
-			this->minutiae[i].angle = angle;
-			this->minutiae[i].quality = quality;
+		size_t numBytes = 6 * (size_t)data[3];
+		if ( fread(data+4,sizeof(unsigned char),numBytes,in) != numBytes ) {
+			return false;
 		}
 
-		return true;
+		return read(data) >= 0;
 	}
 
 	/**
@@ -311,11 +317,11 @@ namespace thimble {
 		if ( impressionType != 0 && impressionType != 1 &&
 			 impressionType != 2 && impressionType != 3 &&
 			 impressionType != 4 && impressionType != 8 ) {
-			return false;
+			return -1;
 		}
 
 		if ( header[0] > 10 || header[2] > 100 || impressionType ) {
-			return false;
+			return -1;
 		}
 
 		this->fingerPosition = (FINGER_POSITION_T)header[0];
@@ -360,7 +366,7 @@ namespace thimble {
 			this->minutiae[i].quality = quality;
 		}
 
-		return true;
+		return getSizeInBytes();
 	}
 
 	/**
@@ -651,7 +657,39 @@ namespace thimble {
 	 */
 	bool MinutiaeRecord::write( FILE *out ) const {
 
-		unsigned char header[24];
+		// Serialize the record into a buffer such that it is written
+		// with a single call
+		int size = getSizeInBytes();
+
+		unsigned char *data = (unsigned char*)malloc(size);
+		if ( data == NULL ) {
+			cerr << "MinutiaeRecord::write: Out of memory." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		bool state = toBytes(data,size) == size &&
+				fwrite(data,1,size,out) == (size_t)size;
+
+		free(data);
+
+		return state;
+	}
+
+	/**
+	 * @brief
+	 *            Writes the minutiae record to the specified memory.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecord.h'
+	 */
+	int MinutiaeRecord::toBytes( void *data , int capacity ) const {
+
+		int size = getSizeInBytes();
+		if ( capacity < size ) {
+			return -1;
+		}
+
+		unsigned char *header = (unsigned char*)data;
 
 		// First four bytes correspond to format identifier
 		header[0] = 'F';
@@ -666,7 +704,6 @@ namespace thimble {
 		header[7] = '\0';
 
 		// Next four bytes correspond to length of template in bytes
-		int size = getSizeInBytes();
 		header[8] = (unsigned char) ((size >> 24) & 0xFF);
 		header[9] = (unsigned char) ((size >> 16) & 0xFF);
 		header[10] = (unsigned char) ((size >> 8) & 0xFF);
@@ -736,17 +773,19 @@ namespace thimble {
 		header[22] = (unsigned char) (this->views.size());
 		header[23] = (unsigned char) (this->reservedByte);
 
-		if ( fwrite(header,1,24,out) != 24 ) {
-			return false;
-		}
-
+		unsigned char *dat = header + 24;
 		for (int i = 0; i < (int)(this->views.size()) ; i++) {
-			if ( !this->views.at(i).write(out) ) {
-				return false;
+			if ( this->views.at(i).getMinutiaeCount() > 255 ) {
+				return -1;
+			}
+			int viewSize = this->views.at(i).write(dat);
+			if ( viewSize < 0 ) {
+				return -1;
 			}
+			dat += viewSize;
 		}
 
-		return true;
+		return size;
 	}
 
 	bool MinutiaeRecord::write( const std::string & fileName ) const {
@@ -775,61 +814,52 @@ namespace thimble {
 	 */
 	bool MinutiaeRecord::read( FILE *in ) {
 
-		MinutiaeRecord record;
-
-		//Read the header
-		unsigned char header[24];
-		if ( fread(header,sizeof(unsigned char),24,in) != 24 ) {
+		// Read the record's data with one call for the header and two
+		// calls for each finger view and ...
+		vector<unsigned char> data(24);
+		if ( fread(&(data[0]),sizeof(unsigned char),24,in) != 24 ) {
 			return false;
 		}
 
-		// First four bytes correspond to format identifier
-		if ( header[0] != 'F' || header[1] != 'M' || header[2] != 'R' ||
-			 header[3] != '\0' ) {
+		// Reject anything that is not a record of the supported format
+		// and version before reading any further
+		if ( data[0] != 'F' || data[1] != 'M' || data[2] != 'R' ||
+			 data[3] != '\0' ) {
 			return false;
 		}
-
-		// Next four bytes correspond to version number
-		if ( header[4] != ' ' || header[5] != '2' || header[6] != '0' ||
-			 header[7] != '\0' ) {
+		if ( data[4] != ' ' || data[5] != '2' || data[6] != '0' ||
+			 data[7] != '\0' ) {
 			return false;
 		}
 
-		//int size = header[11]+0x100*(header[10]+0x100*(header[9]+0x100*header[8]));
-
-		record.captureEquipmentCertifications[0] = (header[12]&0x1?true:false);
-		record.captureEquipmentCertifications[1] = (header[12]&0x2?true:false);
-		record.captureEquipmentCertifications[2] = (header[12]&0x4?true:false);
-		record.captureEquipmentCertifications[3] = (header[12]&0x8?true:false);
-
-		record.captureDeviceTypeID[0]  = (header[12]&0x10?true:false);
-		record.captureDeviceTypeID[1]  = (header[12]&0x20?true:false);
-		record.captureDeviceTypeID[2]  = (header[12]&0x40?true:false);
-		record.captureDeviceTypeID[3]  = (header[12]&0x80?true:false);
-		record.captureDeviceTypeID[4]  = (header[13]&0x1?true:false);
-		record.captureDeviceTypeID[5]  = (header[13]&0x2?true:false);
-		record.captureDeviceTypeID[6]  = (header[13]&0x4?true:false);
-		record.captureDeviceTypeID[7]  = (header[13]&0x8?true:false);
-		record.captureDeviceTypeID[8]  = (header[13]&0x10?true:false);
-		record.captureDeviceTypeID[9]  = (header[13]&0x20?true:false);
-		record.captureDeviceTypeID[10] = (header[13]&0x40?true:false);
-		record.captureDeviceTypeID[11] = (header[13]&0x80?true:false);
-
-		record.sizeX = (int)header[15]+0x100*(int)header[14];
-		record.sizeY = (int)header[17]+0x100*(int)header[16];
-		record.resX = (int)header[19]+0x100*(int)header[18];
-		record.resY = (int)header[21]+0x100*(int)header[20];
-		record.reservedByte = header[23];
+		int numViews = data[22];
+		for ( int i = 0 ; i < numViews ; i++ ) {
 
-		int numViews = header[22];
+			size_t offset = data.size();
+			data.resize(offset+4);
+			if ( fread(&(data[offset]),sizeof(unsigned char),4,in) != 4 ||
+				 !isValidViewHeader(&(data[offset])) ) {
+				return false;
+			}
 
-		record.views.assign(numViews,MinutiaeView());
-		for ( int i = 0 ; i < numViews ; i++ ) {
-			if ( !record.views[i].read(in) ) {
+			size_t numBytes = 6 * (size_t)data[offset+3];
+			data.resize(offset+4+numBytes);
+			if ( numBytes > 0 &&
+				 fread(&(data[offset+4]),sizeof(unsigned char),numBytes,in)
+				 != numBytes ) {
 				return false;
 			}
 		}
 
+		// ... parse it from memory.
+		MinutiaeRecordView view;
+		if ( !view.assign(&(data[0]),(int)data.size()) ) {
+			return false;
+		}
+
+		MinutiaeRecord record;
+		view.decode(record);
+
 		*this = record;
 
 		return true;
@@ -849,72 +879,15 @@ namespace thimble {
 	 */
 	bool MinutiaeRecord::fromBytes( const void *data ) {
 
-		const unsigned char *dat = (unsigned char*)data;
-
-		MinutiaeRecord record;
-
-		//Read the header
-		unsigned char header[24];
-		header[0] = (unsigned char)dat[0];
-		header[1] = (unsigned char)dat[1];
-		header[2] = (unsigned char)dat[2];
-		header[3] = (unsigned char)dat[3];
-
-		memcpy(header,dat,24*sizeof(unsigned char));
-
-		// First four bytes correspond to format identifier
-		if ( header[0] != 'F' || header[1] != 'M' || header[2] != 'R' ||
-			 header[3] != '\0' ) {
+		// The size of the data is unknown; the view only accesses the
+		// bytes of the record, though.
+		MinutiaeRecordView view;
+		if ( !view.assign(data,INT_MAX) ) {
 			return false;
 		}
 
-		// Next four bytes correspond to version number
-		if ( header[4] != ' ' || header[5] != '2' || header[6] != '0' ||
-			 header[7] != '\0' ) {
-			return false;
-		}
-
-		//int size = header[11]+0x100*(header[10]+0x100*(header[9]+0x100*header[8]));
-
-		record.captureEquipmentCertifications[0] = (header[12]&0x1?true:false);
-		record.captureEquipmentCertifications[1] = (header[12]&0x2?true:false);
-		record.captureEquipmentCertifications[2] = (header[12]&0x4?true:false);
-		record.captureEquipmentCertifications[3] = (header[12]&0x8?true:false);
-
-		record.captureDeviceTypeID[0]  = (header[12]&0x10?true:false);
-		record.captureDeviceTypeID[1]  = (header[12]&0x20?true:false);
-		record.captureDeviceTypeID[2]  = (header[12]&0x40?true:false);
-		record.captureDeviceTypeID[3]  = (header[12]&0x80?true:false);
-		record.captureDeviceTypeID[4]  = (header[13]&0x1?true:false);
-		record.captureDeviceTypeID[5]  = (header[13]&0x2?true:false);
-		record.captureDeviceTypeID[6]  = (header[13]&0x4?true:false);
-		record.captureDeviceTypeID[7]  = (header[13]&0x8?true:false);
-		record.captureDeviceTypeID[8]  = (header[13]&0x10?true:false);
-		record.captureDeviceTypeID[9]  = (header[13]&0x20?true:false);
-		record.captureDeviceTypeID[10] = (header[13]&0x40?true:false);
-		record.captureDeviceTypeID[11] = (header[13]&0x80?true:false);
-
-		record.sizeX = (int)header[15]+0x100*(int)header[14];
-		record.sizeY = (int)header[17]+0x100*(int)header[16];
-		record.resX = (int)header[19]+0x100*(int)header[18];
-		record.resY = (int)header[21]+0x100*(int)header[20];
-		record.reservedByte = header[23];
-
-		int numViews = header[22];
-
-		dat += 24;
-
-		record.views.assign(numViews,MinutiaeView());
-		for ( int i = 0 ; i < numViews ; i++ ) {
-
-			int state = record.views[i].read((void*)dat);
-			if ( state < 0 ) {
-				return false;
-			}
-
-			dat += state;
-
-		}
+		MinutiaeRecord record;
+		view.decode(record);
 
 		*this = record;
 
@@ -0,0 +1,808 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file MinutiaeRecordArchive.cpp
+ *
+ * @brief
+ *            Implements the functionalities from
+ *            'thimble/finger/MinutiaeRecordArchive.h' which provides
+ *            classes for packing collections of minutiae records into
+ *            a single indexed archive file and for accessing them.
+ *
+ * @author agent
+ */
+
+#include <stdint.h>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <set>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "config.h"
+
+#include <thimble/misc/IOTools.h>
+#include <thimble/finger/MinutiaeRecord.h>
+#include <thimble/finger/MinutiaeRecordView.h>
+#include <thimble/finger/MinutiaeRecordArchive.h>
+
+using namespace std;
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/**
+	 * @brief
+	 *            Size of the archive's header in bytes.
+	 */
+	static const int ARCHIVE_HEADER_SIZE = 24;
+
+	/**
+	 * @brief
+	 *            Size of an entry of the archive's index in bytes.
+	 */
+	static const int ARCHIVE_ENTRY_SIZE = 24;
+
+	/**
+	 * @brief
+	 *            Version of the archive format written by
+	 *            \link MinutiaeRecordArchiveWriter\endlink.
+	 */
+	static const int ARCHIVE_VERSION = 1;
+
+	/**
+	 * @brief
+	 *            Reads a big-endian 16 bit integer.
+	 */
+	static inline uint32_t getU16( const uint8_t *p ) {
+		return ((uint32_t)p[0] << 8) | (uint32_t)p[1];
+	}
+
+	/**
+	 * @brief
+	 *            Reads a big-endian 32 bit integer.
+	 */
+	static inline uint32_t getU32( const uint8_t *p ) {
+		return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+			   ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+	}
+
+	/**
+	 * @brief
+	 *            Reads a big-endian 64 bit integer.
+	 */
+	static inline uint64_t getU64( const uint8_t *p ) {
+		return ((uint64_t)getU32(p) << 32) | (uint64_t)getU32(p+4);
+	}
+
+	/**
+	 * @brief
+	 *            Writes a big-endian 16 bit integer.
+	 */
+	static inline void putU16( uint8_t *p , uint32_t x ) {
+		p[0] = (uint8_t)(x >> 8);
+		p[1] = (uint8_t)x;
+	}
+
+	/**
+	 * @brief
+	 *            Writes a big-endian 32 bit integer.
+	 */
+	static inline void putU32( uint8_t *p , uint32_t x ) {
+		p[0] = (uint8_t)(x >> 24);
+		p[1] = (uint8_t)(x >> 16);
+		p[2] = (uint8_t)(x >> 8);
+		p[3] = (uint8_t)x;
+	}
+
+	/**
+	 * @brief
+	 *            Writes a big-endian 64 bit integer.
+	 */
+	static inline void putU64( uint8_t *p , uint64_t x ) {
+		putU32(p,(uint32_t)(x >> 32));
+		putU32(p+4,(uint32_t)x);
+	}
+
+	/**
+	 * @brief
+	 *            Writes the archive's header.
+	 */
+	static void writeHeader
+	( uint8_t *header , int count , uint64_t indexOffset , uint32_t namesSize ) {
+
+		header[0] = 'F';
+		header[1] = 'M';
+		header[2] = 'R';
+		header[3] = 'A';
+		putU16(header+4,ARCHIVE_VERSION);
+		putU16(header+6,0);
+		putU32(header+8,(uint32_t)count);
+		putU64(header+12,indexOffset);
+		putU32(header+20,namesSize);
+	}
+
+	/**
+	 * @brief
+	 *            Creates an empty archive.
+	 */
+	MinutiaeRecordArchive::MinutiaeRecordArchive() {
+		this->buffer = NULL;
+		clear();
+	}
+
+	/**
+	 * @brief
+	 *            Destructor.
+	 */
+	MinutiaeRecordArchive::~MinutiaeRecordArchive() {
+		clear();
+	}
+
+	/**
+	 * @brief
+	 *            Resets the archive to be empty and releases the
+	 *            memory held by it.
+	 */
+	void MinutiaeRecordArchive::clear() {
+		free(this->buffer);
+		this->buffer = NULL;
+		this->data = NULL;
+		this->size = 0;
+		this->count = 0;
+		this->index = NULL;
+		this->names = NULL;
+	}
+
+	/**
+	 * @brief
+	 *            Aborts the program if the record index is out of range.
+	 */
+	void MinutiaeRecordArchive::checkIndex( int i ) const {
+		if ( i < 0 || i >= this->count ) {
+			cerr << "MinutiaeRecordArchive: record index out of range."
+				 << endl;
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	/**
+	 * @brief
+	 *            Accesses an archive held in memory without copying it.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	bool MinutiaeRecordArchive::assign( const void *data , size_t size ) {
+
+		// Release a buffer read before unless it is the one assigned
+		if ( this->buffer != (const uint8_t*)data ) {
+			clear();
+		}
+
+		const uint8_t *dat = (const uint8_t*)data;
+
+		if ( dat == NULL || size < (size_t)ARCHIVE_HEADER_SIZE ) {
+			clear();
+			return false;
+		}
+
+		if ( dat[0] != 'F' || dat[1] != 'M' || dat[2] != 'R' ||
+			 dat[3] != 'A' || getU16(dat+4) != (uint32_t)ARCHIVE_VERSION ) {
+			clear();
+			return false;
+		}
+
+		uint64_t count = getU32(dat+8);
+		uint64_t indexOffset = getU64(dat+12);
+		uint64_t namesSize = getU32(dat+20);
+
+		if ( count > (uint64_t)INT_MAX ||
+			 indexOffset < (uint64_t)ARCHIVE_HEADER_SIZE ||
+			 indexOffset > (uint64_t)size ||
+			 (uint64_t)size - indexOffset <
+			 count * ARCHIVE_ENTRY_SIZE + namesSize ) {
+			clear();
+			return false;
+		}
+
+		const uint8_t *index = dat + indexOffset;
+
+		// The records must be stored contiguously in the order of the
+		// index; 'getPartition()' relies on this.
+		uint64_t expectedOffset = ARCHIVE_HEADER_SIZE;
+		for ( uint64_t i = 0 ; i < count ; i++ ) {
+
+			const uint8_t *entry = index + i * ARCHIVE_ENTRY_SIZE;
+
+			uint64_t offset = getU64(entry);
+			uint64_t recordSize = getU32(entry+8);
+			uint64_t nameOffset = getU32(entry+12);
+			uint64_t nameLength = getU16(entry+16);
+
+			if ( offset != expectedOffset ||
+				 recordSize > (uint64_t)INT_MAX ||
+				 indexOffset - offset < recordSize ||
+				 nameOffset + nameLength > namesSize ) {
+				clear();
+				return false;
+			}
+
+			expectedOffset = offset + recordSize;
+		}
+
+		this->data = dat;
+		this->size = size;
+		this->count = (int)count;
+		this->index = index;
+		this->names = index + count * ARCHIVE_ENTRY_SIZE;
+
+		return true;
+	}
+
+	/**
+	 * @brief
+	 *            Reads an archive file into memory.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	bool MinutiaeRecordArchive::read( const string & path ) {
+
+		clear();
+
+		FILE *in = IOTools::fopen(path.c_str(),"rb");
+		if ( in == NULL ) {
+			return false;
+		}
+
+		long fileSize = -1;
+		if ( fseek(in,0,SEEK_END) == 0 ) {
+			fileSize = ftell(in);
+		}
+		if ( fileSize < 0 || fseek(in,0,SEEK_SET) != 0 ) {
+			fclose(in);
+			return false;
+		}
+
+		this->buffer = (uint8_t*)malloc(max((size_t)fileSize,(size_t)1));
+		if ( this->buffer == NULL ) {
+			cerr << "MinutiaeRecordArchive::read: out of memory." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		bool success =
+			fread(this->buffer,1,(size_t)fileSize,in) == (size_t)fileSize;
+		fclose(in);
+
+		if ( !success ) {
+			clear();
+			return false;
+		}
+
+		return assign(this->buffer,(size_t)fileSize);
+	}
+
+	/**
+	 * @brief
+	 *            Returns the data of a record.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	const uint8_t *MinutiaeRecordArchive::getRecordData( int i ) const {
+		checkIndex(i);
+		return this->data + getU64(this->index + i * ARCHIVE_ENTRY_SIZE);
+	}
+
+	/**
+	 * @brief
+	 *            Returns the size of a record in bytes.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	int MinutiaeRecordArchive::getRecordSize( int i ) const {
+		checkIndex(i);
+		return (int)getU32(this->index + i * ARCHIVE_ENTRY_SIZE + 8);
+	}
+
+	/**
+	 * @brief
+	 *            Returns the name of a record.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	string MinutiaeRecordArchive::getName( int i ) const {
+		checkIndex(i);
+		const uint8_t *entry = this->index + i * ARCHIVE_ENTRY_SIZE;
+		return string
+			((const char*)this->names + getU32(entry+12),getU16(entry+16));
+	}
+
+	/**
+	 * @brief
+	 *            Returns the finger position of a record's first view.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	FINGER_POSITION_T MinutiaeRecordArchive::getFingerPosition( int i ) const {
+		checkIndex(i);
+		return (FINGER_POSITION_T)this->index[i * ARCHIVE_ENTRY_SIZE + 18];
+	}
+
+	/**
+	 * @brief
+	 *            Returns the finger quality of a record's first view.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	int MinutiaeRecordArchive::getFingerQuality( int i ) const {
+		checkIndex(i);
+		return (int)this->index[i * ARCHIVE_ENTRY_SIZE + 19];
+	}
+
+	/**
+	 * @brief
+	 *            Accesses a record without copying it.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	bool MinutiaeRecordArchive::getRecord
+	( MinutiaeRecordView & view , int i ) const {
+		return view.assign(getRecordData(i),getRecordSize(i));
+	}
+
+	/**
+	 * @brief
+	 *            Decodes a record.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	bool MinutiaeRecordArchive::getRecord
+	( MinutiaeRecord & record , int i ) const {
+
+		MinutiaeRecordView view;
+		if ( !getRecord(view,i) ) {
+			return false;
+		}
+
+		view.decode(record);
+		return true;
+	}
+
+	/**
+	 * @brief
+	 *            Determines a contiguous range of records to be processed
+	 *            by one of several workers.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	void MinutiaeRecordArchive::getPartition
+	( int & first , int & last , int part , int numParts ) const {
+
+		if ( numParts <= 0 || part < 0 || part >= numParts ) {
+			cerr << "MinutiaeRecordArchive::getPartition: "
+				 << "invalid partition." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		// An empty archive, which may not hold any data, has only
+		// empty ranges
+		if ( this->count == 0 ) {
+			first = last = 0;
+			return;
+		}
+
+		int bounds[2];
+		for ( int j = 0 ; j < 2 ; j++ ) {
+
+			int p = part + j;
+
+			if ( p == 0 ) {
+				bounds[j] = 0;
+				continue;
+			}
+			if ( p == numParts ) {
+				bounds[j] = this->count;
+				continue;
+			}
+
+			// Byte offset at which the 'p'-th range starts
+			uint64_t total = getU64(this->data+12) - ARCHIVE_HEADER_SIZE;
+			uint64_t target = ARCHIVE_HEADER_SIZE +
+				(total / numParts) * p + ((total % numParts) * p) / numParts;
+
+			// Binary search for the first record starting at or after
+			// 'target'; the offsets increase with the index.
+			int lo = 0 , hi = this->count;
+			while ( lo < hi ) {
+				int mid = lo + (hi - lo) / 2;
+				if ( getU64(this->index + mid * ARCHIVE_ENTRY_SIZE) < target ) {
+					lo = mid + 1;
+				} else {
+					hi = mid;
+				}
+			}
+			bounds[j] = lo;
+		}
+
+		first = bounds[0];
+		last = bounds[1];
+	}
+
+	/**
+	 * @brief
+	 *            Packs the minutiae record files of a directory into an
+	 *            archive.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	int MinutiaeRecordArchive::pack
+	( const string & archivePath , const string & directory ) {
+
+		// List the regular files of the directory
+		vector<filesystem::path> files;
+		error_code ec;
+		filesystem::directory_iterator it(directory,ec);
+		if ( ec ) {
+			return -1;
+		}
+		for ( ; it != filesystem::directory_iterator() ; it.increment(ec) ) {
+			if ( ec ) {
+				return -1;
+			}
+			if ( it->is_regular_file(ec) ) {
+				files.push_back(it->path());
+			}
+		}
+		sort(files.begin(),files.end());
+
+		MinutiaeRecordArchiveWriter writer;
+		if ( !writer.open(archivePath) ) {
+			return -1;
+		}
+
+		vector<uint8_t> fileData;
+		MinutiaeRecordView view;
+		for ( size_t i = 0 ; i < files.size() ; i++ ) {
+
+			FILE *in = IOTools::fopen(files[i].string().c_str(),"rb");
+			if ( in == NULL ) {
+				writer.abort();
+				return -1;
+			}
+
+			long fileSize = -1;
+			if ( fseek(in,0,SEEK_END) == 0 ) {
+				fileSize = ftell(in);
+			}
+			if ( fileSize < 0 || fseek(in,0,SEEK_SET) != 0 ) {
+				fclose(in);
+				writer.abort();
+				return -1;
+			}
+
+			// Files too large to be a minutiae record are skipped
+			if ( fileSize > INT_MAX ) {
+				fclose(in);
+				continue;
+			}
+
+			fileData.resize(max((size_t)fileSize,(size_t)1));
+			bool success =
+				fread(fileData.data(),1,(size_t)fileSize,in) == (size_t)fileSize;
+			fclose(in);
+			if ( !success ) {
+				writer.abort();
+				return -1;
+			}
+
+			if ( !view.assign(fileData.data(),(int)fileSize) ) {
+				continue;
+			}
+
+			if ( !writer.add
+					(fileData.data(),(int)fileSize,files[i].filename().string()) ) {
+				writer.abort();
+				return -1;
+			}
+		}
+
+		int count = writer.getRecordCount();
+
+		// An archive that could not be completed is removed as well
+		if ( !writer.close() ) {
+			filesystem::remove(archivePath,ec);
+			return -1;
+		}
+
+		return count;
+	}
+
+	/**
+	 * @brief
+	 *            Writes each record of an archive to an individual file
+	 *            in a directory.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	int MinutiaeRecordArchive::unpack
+	( const string & directory , const string & archivePath ) {
+
+		MinutiaeRecordArchive archive;
+		if ( !archive.read(archivePath) ) {
+			return -1;
+		}
+
+		error_code ec;
+		filesystem::create_directories(directory,ec);
+		if ( ec ) {
+			return -1;
+		}
+
+		// The names of the files written so far
+		set<string> written;
+
+		for ( int i = 0 ; i < archive.getRecordCount() ; i++ ) {
+
+			// Only the last component of the name is used; records
+			// without a usable name or whose name has already been
+			// written are named after their index.
+			string name = filesystem::path(archive.getName(i)).filename().string();
+			if ( name.empty() || name == "." || name == ".." ||
+				 written.count(name) > 0 ) {
+				char defaultName[32];
+				snprintf(defaultName,sizeof(defaultName),"%08d.fmr",i);
+				name = defaultName;
+			}
+			if ( !written.insert(name).second ) {
+				return -1;
+			}
+
+			string path = (filesystem::path(directory) / name).string();
+
+			FILE *out = IOTools::fopen(path.c_str(),"wb");
+			if ( out == NULL ) {
+				return -1;
+			}
+
+			size_t recordSize = (size_t)archive.getRecordSize(i);
+			bool success =
+				fwrite(archive.getRecordData(i),1,recordSize,out) == recordSize;
+			success = (fclose(out) == 0) && success;
+
+			if ( !success ) {
+				return -1;
+			}
+		}
+
+		return archive.getRecordCount();
+	}
+
+	/**
+	 * @brief
+	 *            Creates a writer with no archive open.
+	 */
+	MinutiaeRecordArchiveWriter::MinutiaeRecordArchiveWriter() {
+		this->out = NULL;
+		this->offset = 0;
+		this->count = 0;
+	}
+
+	/**
+	 * @brief
+	 *            Destructor; closes the archive if it is still open.
+	 */
+	MinutiaeRecordArchiveWriter::~MinutiaeRecordArchiveWriter() {
+		close();
+	}
+
+	/**
+	 * @brief
+	 *            Creates an archive file and writes a preliminary header.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	bool MinutiaeRecordArchiveWriter::open( const string & path ) {
+
+		close();
+
+		this->out = IOTools::fopen(path.c_str(),"wb");
+		if ( this->out == NULL ) {
+			return false;
+		}
+		this->path = path;
+
+		// The header is completed on 'close()'
+		uint8_t header[ARCHIVE_HEADER_SIZE];
+		writeHeader(header,0,0,0);
+		if ( fwrite(header,1,ARCHIVE_HEADER_SIZE,this->out) !=
+			 (size_t)ARCHIVE_HEADER_SIZE ) {
+			abort();
+			return false;
+		}
+
+		this->offset = ARCHIVE_HEADER_SIZE;
+		this->index.clear();
+		this->names.clear();
+		this->count = 0;
+
+		return true;
+	}
+
+	/**
+	 * @brief
+	 *            Appends a record to the archive.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	bool MinutiaeRecordArchiveWriter::add
+	( const MinutiaeRecord & record , const string & name ) {
+
+		int recordSize = record.getSizeInBytes();
+
+		this->recordBuffer.resize(recordSize);
+		if ( record.toBytes(this->recordBuffer.data(),recordSize) < 0 ) {
+			return false;
+		}
+
+		return add(this->recordBuffer.data(),recordSize,name);
+	}
+
+	/**
+	 * @brief
+	 *            Appends an encoded record to the archive.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	bool MinutiaeRecordArchiveWriter::add
+	( const void *data , int size , const string & name ) {
+
+		if ( this->out == NULL || this->count == INT_MAX ||
+			 name.size() > 0xFFFF ||
+			 (uint64_t)this->names.size() + name.size() > 0xFFFFFFFF ) {
+			return false;
+		}
+
+		MinutiaeRecordView view;
+		if ( !view.assign(data,size) ) {
+			return false;
+		}
+
+		// A partly written record would leave the file out of step
+		// with 'offset'; hence, the archive is discarded.
+		if ( fwrite(data,1,(size_t)size,this->out) != (size_t)size ) {
+			abort();
+			return false;
+		}
+
+		uint8_t entry[ARCHIVE_ENTRY_SIZE];
+		putU64(entry,this->offset);
+		putU32(entry+8,(uint32_t)size);
+		putU32(entry+12,(uint32_t)this->names.size());
+		putU16(entry+16,(uint32_t)name.size());
+		if ( view.getViewCount() > 0 ) {
+			entry[18] = (uint8_t)view.getFingerPosition(0);
+			entry[19] = (uint8_t)view.getFingerQuality(0);
+		} else {
+			entry[18] = (uint8_t)UNKNOWN_FINGER;
+			entry[19] = 0;
+		}
+		putU32(entry+20,0);
+
+		this->index.insert(this->index.end(),entry,entry+ARCHIVE_ENTRY_SIZE);
+		this->names.insert(this->names.end(),name.begin(),name.end());
+		this->offset += (uint64_t)size;
+		this->count++;
+
+		return true;
+	}
+
+	/**
+	 * @brief
+	 *            Writes the index, completes the header and closes the
+	 *            archive file.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	bool MinutiaeRecordArchiveWriter::close() {
+
+		if ( this->out == NULL ) {
+			return false;
+		}
+
+		// 'fwrite' must not be passed the null pointer of an empty vector
+		bool success =
+			(this->index.empty() ||
+			 fwrite(this->index.data(),1,this->index.size(),this->out) ==
+				this->index.size()) &&
+			(this->names.empty() ||
+			 fwrite(this->names.data(),1,this->names.size(),this->out) ==
+				this->names.size());
+
+		if ( success ) {
+			uint8_t header[ARCHIVE_HEADER_SIZE];
+			writeHeader
+				(header,this->count,this->offset,(uint32_t)this->names.size());
+			success = fseek(this->out,0,SEEK_SET) == 0 &&
+				fwrite(header,1,ARCHIVE_HEADER_SIZE,this->out) ==
+					(size_t)ARCHIVE_HEADER_SIZE;
+		}
+
+		success = (fclose(this->out) == 0) && success;
+
+		this->out = NULL;
+		this->path.clear();
+		this->offset = 0;
+		this->index.clear();
+		this->names.clear();
+		this->count = 0;
+
+		return success;
+	}
+
+	/**
+	 * @brief
+	 *            Closes the archive file without completing it and
+	 *            removes the file.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordArchive.h'
+	 */
+	void MinutiaeRecordArchiveWriter::abort() {
+
+		if ( this->out == NULL ) {
+			return;
+		}
+
+		fclose(this->out);
+
+		error_code ec;
+		filesystem::remove(this->path,ec);
+
+		this->out = NULL;
+		this->path.clear();
+		this->offset = 0;
+		this->index.clear();
+		this->names.clear();
+		this->count = 0;
+	}
+}
@@ -0,0 +1,362 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file MinutiaeRecordView.cpp
+ *
+ * @brief
+ *            Implements the functionalities from
+ *            'thimble/finger/MinutiaeRecordView.h' which provides a class
+ *            for accessing minutiae records in ISO 19794-2:2005 format
+ *            directly in memory.
+ *
+ * @author agent
+ */
+
+#include <stdint.h>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <iostream>
+
+#include "config.h"
+
+#include <thimble/finger/MinutiaeRecord.h>
+#include <thimble/finger/MinutiaeArrays.h>
+#include <thimble/finger/MinutiaeRecordView.h>
+
+using namespace std;
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/**
+	 * @brief
+	 *            Access the angle of the current minutia.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordView.h'
+	 */
+	double RawMinutiaIterator::getAngle() const {
+		return (M_PI + M_PI) * ((double)this->current[4] / 256.0);
+	}
+
+	/**
+	 * @brief
+	 *            Creates an empty view.
+	 */
+	MinutiaeRecordView::MinutiaeRecordView() {
+		clear();
+	}
+
+	/**
+	 * @brief
+	 *            Resets the view to be empty.
+	 */
+	void MinutiaeRecordView::clear() {
+		this->data = NULL;
+		this->size = 0;
+		this->viewCount = 0;
+	}
+
+	/**
+	 * @brief
+	 *            Parses the header of a minutiae record held in
+	 *            memory.
+	 *
+	 * @details
+	 *            see 'MinutiaeRecordView.h'
+	 */
+	bool MinutiaeRecordView::assign( const void *data , int size ) {
+
+		clear();
+
+		const uint8_t *dat = (const uint8_t*)data;
+
+		if ( dat == NULL || size < 24 ) {
+			return false;
+		}
+
+		// First four bytes correspond to format identifier
+		if ( dat[0] != 'F' || dat[1] != 'M' || dat[2] != 'R' ||
+			 dat[3] != '\0' ) {
+			return false;
+		}
+
+		// Next four bytes correspond to version number
+		if ( dat[4] != ' ' || dat[5] != '2' || dat[6] != '0' ||
+			 dat[7] != '\0' ) {
+			return false;
+		}
+
+		int viewCount = dat[22];
+
+		// Walk over the finger views and validate their headers
+		int offset = 24;
+		for ( int v = 0 ; v < viewCount ; v++ ) {
+
+			if ( size - offset < 4 ) {
+				return false;
+			}
+
+			const uint8_t *header = dat + offset;
+
+			int impressionType = (header[1]>>4)&0xF;
+
+			if ( impressionType != 0 && impressionType != 1 &&
+				 impressionType != 2 && impressionType != 3 &&
+				 impressionType != 4 && impressionType != 8 ) {
+				return false;
+			}
+
+			if ( header[0] > 10 || header[2] > 100 || impressionType ) {
+				return false;
+			}
+
+			int viewSize = 4 + 6 * (int)header[3];
+			if ( size - offset < viewSize ) {
+				return false;
+			}
+
+			this->viewOffsets[v] = offset;
+			offset += viewSize;
+		}
+
+		this->data = dat;
+		this->size = offset;
+		this->viewCount = viewCount;
+
+		return true;
+	}
+
+	/**
+	 * @brief
+	 *            Access the width of the fingerprint images the
+	 *            record corresponds to.
+	 */
+	int MinutiaeRecordView::getWidth() const {
+		return isEmpty() ? 0 : (int)this->data[15]+0x100*(int)this->data[14];
+	}
+
+	/**
+	 * @brief
+	 *            Access the height of the fingerprint images the
+	 *            record corresponds to.
+	 */
+	int MinutiaeRecordView::getHeight() const {
+		return isEmpty() ? 0 : (int)this->data[17]+0x100*(int)this->data[16];
+	}
+
+	/**
+	 * @brief
+	 *            Access the horizontal resolution in pixels per
+	 *            centimeter.
+	 */
+	int MinutiaeRecordView::getHorizontalResolution() const {
+		return isEmpty() ? 0 : (int)this->data[19]+0x100*(int)this->data[18];
+	}
+
+	/**
+	 * @brief
+	 *            Access the vertical resolution in pixels per
+	 *            centimeter.
+	 */
+	int MinutiaeRecordView::getVerticalResolution() const {
+		return isEmpty() ? 0 : (int)this->data[21]+0x100*(int)this->data[20];
+	}
+
+	/**
+	 * @brief
+	 *            Checks whether a finger view index is valid.
+	 */
+	void MinutiaeRecordView::checkView( int v ) const {
+		if ( v < 0 || v >= this->viewCount ) {
+			cerr << "MinutiaeRecordView: finger view index out of range."
+				 << endl;
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	/**
+	 * @brief
+	 *            Access the finger position of a finger view.
+	 */
+	FINGER_POSITION_T MinutiaeRecordView::getFingerPosition( int v ) const {
+		checkView(v);
+		return (FINGER_POSITION_T)this->data[this->viewOffsets[v]];
+	}
+
+	/**
+	 * @brief
+	 *            Access the view number of a finger view.
+	 */
+	int MinutiaeRecordView::getViewNumber( int v ) const {
+		checkView(v);
+		return this->data[this->viewOffsets[v]+1]&0xF;
+	}
+
+	/**
+	 * @brief
+	 *            Access the impression type of a finger view.
+	 */
+	FINGER_IMPRESSION_TYPE_T MinutiaeRecordView::getImpressionType
+	( int v ) const {
+		checkView(v);
+		return (FINGER_IMPRESSION_TYPE_T)
+				((this->data[this->viewOffsets[v]+1]>>4)&0xF);
+	}
+
+	/**
+	 * @brief
+	 *            Access the finger quality of a finger view.
+	 */
+	int MinutiaeRecordView::getFingerQuality( int v ) const {
+		checkView(v);
+		return this->data[this->viewOffsets[v]+2];
+	}
+
+	/**
+	 * @brief
+	 *            Access the number of minutiae of a finger view.
+	 */
+	int MinutiaeRecordView::getMinutiaeCount( int v ) const {
+		checkView(v);
+		return this->data[this->viewOffsets[v]+3];
+	}
+
+	/**
+	 * @brief
+	 *            Creates an iterator over the minutiae of a finger
+	 *            view.
+	 */
+	RawMinutiaIterator MinutiaeRecordView::getMinutiae( int v ) const {
+
+		checkView(v);
+
+		RawMinutiaIterator it;
+		it.data = this->data + this->viewOffsets[v] + 4;
+		it.count = this->data[this->viewOffsets[v]+3];
+
+		return it;
+	}
+
+	/**
+	 * @brief
+	 *            Decodes a finger view into separate arrays.
+	 */
+	void MinutiaeRecordView::decode( MinutiaeArrays & arrays , int v ) const {
+
+		checkView(v);
+
+		arrays.fingerPosition = getFingerPosition(v);
+		arrays.viewNumber = getViewNumber(v);
+		arrays.impressionType = getImpressionType(v);
+		arrays.fingerQuality = getFingerQuality(v);
+
+		int n = getMinutiaeCount(v);
+
+		arrays.x.resize(n);
+		arrays.y.resize(n);
+		arrays.angles.resize(n);
+		arrays.types.resize(n);
+		arrays.qualities.resize(n);
+
+		RawMinutiaIterator it = getMinutiae(v);
+		while ( it.next() ) {
+			int i = it.getIndex();
+			arrays.x[i] = it.getX();
+			arrays.y[i] = it.getY();
+			arrays.angles[i] = it.getAngle();
+			arrays.types[i] = it.getType();
+			arrays.qualities[i] = it.getQuality();
+		}
+	}
+
+	/**
+	 * @brief
+	 *            Decodes a finger view.
+	 */
+	void MinutiaeRecordView::decode( MinutiaeView & view , int v ) const {
+
+		checkView(v);
+
+		view.fingerPosition = getFingerPosition(v);
+		view.viewNumber = getViewNumber(v);
+		view.impressionType = getImpressionType(v);
+		view.fingerQuality = getFingerQuality(v);
+
+		view.minutiae.resize(getMinutiaeCount(v));
+
+		RawMinutiaIterator it = getMinutiae(v);
+		while ( it.next() ) {
+			Minutia & minutia = view.minutiae[it.getIndex()];
+			minutia.x = it.getX();
+			minutia.y = it.getY();
+			minutia.angle = it.getAngle();
+			minutia.typ = it.getType();
+			minutia.quality = it.getQuality();
+		}
+	}
+
+	/**
+	 * @brief
+	 *            Decodes the whole record.
+	 */
+	void MinutiaeRecordView::decode( MinutiaeRecord & record ) const {
+
+		if ( isEmpty() ) {
+			cerr << "MinutiaeRecordView::decode: view is empty." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		const uint8_t *header = this->data;
+
+		record.captureEquipmentCertifications[0] = (header[12]&0x1?true:false);
+		record.captureEquipmentCertifications[1] = (header[12]&0x2?true:false);
+		record.captureEquipmentCertifications[2] = (header[12]&0x4?true:false);
+		record.captureEquipmentCertifications[3] = (header[12]&0x8?true:false);
+
+		record.captureDeviceTypeID[0]  = (header[12]&0x10?true:false);
+		record.captureDeviceTypeID[1]  = (header[12]&0x20?true:false);
+		record.captureDeviceTypeID[2]  = (header[12]&0x40?true:false);
+		record.captureDeviceTypeID[3]  = (header[12]&0x80?true:false);
+		record.captureDeviceTypeID[4]  = (header[13]&0x1?true:false);
+		record.captureDeviceTypeID[5]  = (header[13]&0x2?true:false);
+		record.captureDeviceTypeID[6]  = (header[13]&0x4?true:false);
+		record.captureDeviceTypeID[7]  = (header[13]&0x8?true:false);
+		record.captureDeviceTypeID[8]  = (header[13]&0x10?true:false);
+		record.captureDeviceTypeID[9]  = (header[13]&0x20?true:false);
+		record.captureDeviceTypeID[10] = (header[13]&0x40?true:false);
+		record.captureDeviceTypeID[11] = (header[13]&0x80?true:false);
+
+		record.sizeX = getWidth();
+		record.sizeY = getHeight();
+		record.resX = getHorizontalResolution();
+		record.resY = getVerticalResolution();
+		record.reservedByte = header[23];
+
+		record.views.resize(this->viewCount);
+		for ( int v = 0 ; v < this->viewCount ; v++ ) {
+			decode(record.views[v],v);
+		}
+	}
+}
@@ -154,9 +154,7 @@ namespace thimble {
         f.setCoeff(n-1);
 
         // Binary copy
-        memcpy
-        (f.getData_nonconst(),v.getData(),
-         (n/32+(n%32?1:0))*sizeof(uint32_t));
+        v.getData32(f.getData_nonconst());
 
         // Since upper coefficients may be zero, the degree could
         // be scmaller
@@ -198,12 +196,6 @@ namespace thimble {
      */
     void NTTools::conv( BinaryVector & v , const BinaryPolynomial & f ) {
 
-        // *******************************************************************
-        // * WARNING: THIS METHOD USES A 'getData_nonconst()' METHOD WHICH ***
-        // * YOU SHOULD ONLY USE ON YOURSELF IF YOU REALLY KNOW WHAT YOU ARE *
-        // * DOING ***********************************************************
-        // *******************************************************************
-
         int n = f.deg()+1;
 
         if ( n > v.getLength() ) {
@@ -212,10 +204,6 @@ namespace thimble {
             exit(EXIT_FAILURE);
         }
 
-        v.setZero();
-
-        memcpy
-        (v.getData_nonconst(),f.getData(),
-         (n/32+(n%32?1:0))*sizeof(uint32_t));
+        v.setData32(f.getData(),n/32+(n%32?1:0));
     }
 }
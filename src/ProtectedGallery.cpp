@@ -0,0 +1,867 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ProtectedGallery.cpp
+ *
+ * @brief
+ *            Implements the functionalities from
+ *            'thimble/finger/ProtectedGallery.h' which is a mechanism
+ *            for identifying a query minutiae template against a gallery
+ *            of protected minutiae templates.
+ *
+ * @author agent
+ */
+
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <thimble/ecc/ReedSolomonCode.h>
+#include <thimble/finger/MinutiaeRecord.h>
+#include <thimble/finger/ProtectedMinutiaeTemplate.h>
+#include <thimble/finger/ProtectedGallery.h>
+#include <thimble/math/numbertheory/BigInteger.h>
+#include <thimble/math/numbertheory/SmallBinaryFieldPolynomial.h>
+#include <thimble/security/Hash.h>
+
+using namespace std;
+
+/**
+ * @brief The library's namespace.
+ */
+namespace thimble {
+
+	/*
+	 * see 'ProtectedGallery.h' for the documentation.
+	 */
+	ProtectedGallery::ProtectedGallery( int numThreads ) {
+
+		if ( numThreads < 0 ) {
+			cerr << "ProtectedGallery: Bad arguments." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		if ( numThreads == 0 ) {
+			numThreads = (int)thread::hardware_concurrency();
+			if ( numThreads <= 0 ) {
+				numThreads = 1;
+			}
+		}
+
+		this->numThreads = numThreads;
+		this->maxDecodingAttempts = 0;
+	}
+
+	/**
+	 * @brief
+	 *            Determines whether two protected minutiae templates
+	 *            quantize minutiae templates in the same way.
+	 *
+	 * @param vault1
+	 *            The first template.
+	 *
+	 * @param vault2
+	 *            The second template.
+	 *
+	 * @return
+	 *            <code>true</code> if the quantization parameters of
+	 *            both templates agree; otherwise <code>false</code>.
+	 */
+	static bool haveSameQuantization
+	( const ProtectedMinutiaeTemplate & vault1 ,
+	  const ProtectedMinutiaeTemplate & vault2 ) {
+
+		return vault1.getWidth() == vault2.getWidth() &&
+			   vault1.getHeight() == vault2.getHeight() &&
+			   vault1.getGridDist() == vault2.getGridDist() &&
+			   vault1.getNumAngleQuanta() == vault2.getNumAngleQuanta() &&
+			   vault1.getMaxGenuineFeatures() ==
+					   vault2.getMaxGenuineFeatures();
+	}
+
+	/*
+	 * see 'ProtectedGallery.h' for the documentation.
+	 */
+	int ProtectedGallery::add( const ProtectedMinutiaeTemplate & vault ) {
+
+		if ( !vault.isDecrypted() ) {
+			cerr << "ProtectedGallery::add: "
+				 << "template is not enrolled or encrypted." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		int index = addTemplate(vault);
+		this->indexed.push_back(0);
+
+		return index;
+	}
+
+	/*
+	 * see 'ProtectedGallery.h' for the documentation.
+	 */
+	int ProtectedGallery::add
+	( const ProtectedMinutiaeTemplate & vault , const MinutiaeView & view ) {
+
+		if ( !vault.isDecrypted() ) {
+			cerr << "ProtectedGallery::add: "
+				 << "template is not enrolled or encrypted." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		int index = addTemplate(vault);
+		this->indexed.push_back(1);
+
+		// Append the template to the lists of its quantized features
+		vector<uint32_t> B(vault.getMaxGenuineFeatures());
+		B.resize(vault.quantize(B.data(),view));
+
+		int offset = this->groupOffsets[this->groups[index]];
+		for ( size_t j = 0 ; j < B.size() ; j++ ) {
+			this->postings[offset+B[j]].push_back(index);
+		}
+
+		return index;
+	}
+
+	/*
+	 * see 'ProtectedGallery.h' for the documentation.
+	 */
+	int ProtectedGallery::addTemplate( const ProtectedMinutiaeTemplate & vault ) {
+
+		// Find the group of templates with the same quantization and ...
+		int group = -1;
+		for ( int l = 0 ; l < (int)this->groupRepresentatives.size() ; l++ ) {
+			if ( haveSameQuantization
+					(this->vaults[this->groupRepresentatives[l]],vault) ) {
+				group = l;
+				break;
+			}
+		}
+
+		// ... create a new one if there is none.
+		if ( group < 0 ) {
+			group = (int)this->groupRepresentatives.size();
+			this->groupRepresentatives.push_back((int)this->vaults.size());
+			this->groupOffsets.push_back((int)this->postings.size());
+			this->postings.resize
+				(this->postings.size()+vault.getVaultSize());
+		}
+
+		this->vaults.push_back(vault);
+		this->groups.push_back(group);
+
+		return (int)this->vaults.size()-1;
+	}
+
+	/*
+	 * see 'ProtectedGallery.h' for the documentation.
+	 */
+	void ProtectedGallery::setMaxDecodingAttempts( int maxDecodingAttempts ) {
+
+		if ( maxDecodingAttempts < 0 ) {
+			cerr << "ProtectedGallery::setMaxDecodingAttempts: "
+				 << "must be non-negative." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		this->maxDecodingAttempts = maxDecodingAttempts;
+	}
+
+	/*
+	 * see 'ProtectedGallery.h' for the documentation.
+	 */
+	const ProtectedMinutiaeTemplate & ProtectedGallery::getTemplate
+	( int index ) const {
+
+		if ( index < 0 || index >= (int)this->vaults.size() ) {
+			cerr << "ProtectedGallery::getTemplate: "
+				 << "index out of range." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		return this->vaults[index];
+	}
+
+	/*
+	 * see 'ProtectedGallery.h' for the documentation.
+	 */
+	void ProtectedGallery::clear() {
+		this->vaults.clear();
+		this->groups.clear();
+		this->groupRepresentatives.clear();
+		this->indexed.clear();
+		this->groupOffsets.clear();
+		this->postings.clear();
+	}
+
+	/**
+	 * @brief
+	 *            The maximal number of words of all unlocking sets that
+	 *            are kept between the two passes of
+	 *            \link ProtectedGallery::identifyFirst()\endlink; the
+	 *            unlocking sets of templates that exceed this budget are
+	 *            rebuilt in the second pass.
+	 */
+	static const int64_t _MAX_KEPT_UNLOCKING_WORDS = ((int64_t)1) << 24;
+
+	/**
+	 * @brief
+	 *            The number of slow-down values whose vault polynomials
+	 *            are unpacked at once.
+	 */
+	static const int _SLOW_DOWN_BATCH = 8;
+
+	/**
+	 * @brief
+	 *            Attempts to decode an unlocking set of a template.
+	 *
+	 * @param f
+	 *            Will contain the secret polynomial on success.
+	 *
+	 * @param score
+	 *            Will contain the number of unlocking pairs lying on
+	 *            <i>f</i> on success.
+	 *
+	 * @param vault
+	 *            The template.
+	 *
+	 * @param x
+	 *            The abscissas of the unlocking set.
+	 *
+	 * @param y
+	 *            The ordinates of the unlocking set.
+	 *
+	 * @param t
+	 *            The size of the unlocking set.
+	 *
+	 * @param locator
+	 *            The polynomial vanishing on <code>x</code>.
+	 *
+	 * @param interpolant
+	 *            If not <code>NULL</code>, the polynomial of degree
+	 *            smaller than <i>t</i> interpolating the unlocking set
+	 *            which is decoded with the classical Reed-Solomon
+	 *            decoder followed by a check against the template's
+	 *            hash value.
+	 *
+	 * @param randomized
+	 *            Whether the template's
+	 *            \link ProtectedMinutiaeTemplate::decode()\endlink is
+	 *            run if the classical decoder has not been run or has
+	 *            failed.
+	 *
+	 * @return
+	 *            <code>true</code> if the unlocking set has been decoded;
+	 *            otherwise <code>false</code>.
+	 */
+	static bool decodeUnlockingSet
+	( SmallBinaryFieldPolynomial & f , int & score ,
+	  const ProtectedMinutiaeTemplate & vault ,
+	  const uint32_t *x , const uint32_t *y , int t ,
+	  const SmallBinaryFieldPolynomial & locator ,
+	  const SmallBinaryFieldPolynomial *interpolant , bool randomized ) {
+
+		int k = vault.getSecretSize();
+		bool success = false;
+
+		if ( interpolant != NULL &&
+			 ReedSolomonCode::decode(f,locator,*interpolant,t,k) ) {
+			HASH_ALGORITHM_T algorithm = vault.getHashAlgorithm();
+			uint8_t hash[Hash::MAX_DIGEST_SIZE];
+			Hash(algorithm).hash(hash,f.getData(),f.deg()+1);
+			success = memcmp
+				(hash,vault.getHash(),Hash::getDigestSize(algorithm)) == 0;
+		}
+
+		if ( !success && randomized ) {
+			success = vault.decode
+				(f,x,y,t,k,vault.getHash(),
+				 vault.getNumberOfDecodingIterations());
+		}
+
+		if ( success ) {
+			score = 0;
+			for ( int j = 0 ; j < t ; j++ ) {
+				if ( f.eval(x[j]) == y[j] ) {
+					++score;
+				}
+			}
+		}
+
+		return success;
+	}
+
+	/**
+	 * @brief
+	 *            Attempts to open a template of the gallery with a
+	 *            quantized query.
+	 *
+	 * @details
+	 *            For each slow-down value of the template, the unlocking
+	 *            set is built and decoded by
+	 *            \link decodeUnlockingSet()\endlink. The vault
+	 *            polynomials of up to eight slow-down values are
+	 *            unpacked at once as by
+	 *            \link ProtectedMinutiaeTemplate::open()\endlink.
+	 *
+	 *            If <code>kept</code> is not <code>NULL</code> and not
+	 *            empty, it contains the unlocking sets of all slow-down
+	 *            values from a previous call, which are decoded instead
+	 *            of being rebuilt; otherwise, if <code>keep</code> is
+	 *            <code>true</code>, the unlocking sets that could not be
+	 *            decoded are appended to <code>kept</code>.
+	 *
+	 * @param f
+	 *            Will contain the secret polynomial on success.
+	 *
+	 * @param score
+	 *            Will contain the number of unlocking pairs lying on
+	 *            <i>f</i> on success.
+	 *
+	 * @param vault
+	 *            The template.
+	 *
+	 * @param B
+	 *            The quantized query.
+	 *
+	 * @param t
+	 *            The number of elements in <code>B</code>.
+	 *
+	 * @param x
+	 *            Buffer that can hold <i>t</i> elements.
+	 *
+	 * @param y
+	 *            Buffer that can hold <i>t</i> elements.
+	 *
+	 * @param classical
+	 *            Whether the classical Reed-Solomon decoder is run.
+	 *
+	 * @param randomized
+	 *            Whether the template's decoder is run.
+	 *
+	 * @param kept
+	 *            The unlocking sets kept from a previous call or
+	 *            <code>NULL</code>.
+	 *
+	 * @param keep
+	 *            Whether the unlocking sets are appended to
+	 *            <code>kept</code>.
+	 *
+	 * @return
+	 *            <code>true</code> if the template has been opened;
+	 *            otherwise <code>false</code>.
+	 */
+	static bool openGalleryVault
+	( SmallBinaryFieldPolynomial & f , int & score ,
+	  const ProtectedMinutiaeTemplate & vault ,
+	  const uint32_t *B , int t , uint32_t *x , uint32_t *y ,
+	  bool classical , bool randomized ,
+	  vector<uint32_t> *kept , bool keep ) {
+
+		if ( t < vault.getSecretSize() ) {
+			return false;
+		}
+
+		// The permutation process of the template does not depend on
+		// the slow-down value.
+		for ( int j = 0 ; j < t ; j++ ) {
+			x[j] = vault.reorder(B[j]);
+		}
+
+		// The interpolant of an unlocking set is the remainder of the
+		// vault polynomial modulo the polynomial vanishing on the
+		// abscissas, which is cheaper than interpolating the set.
+		SmallBinaryFieldPolynomial locator(vault.getField());
+		SmallBinaryFieldPolynomial interpolant(vault.getField());
+		if ( classical ) {
+			locator.buildFromRoots(x,t);
+		}
+
+		// Decode the unlocking sets of a previous call
+		if ( kept != NULL && !kept->empty() ) {
+			for ( size_t offset = 0 ; offset < kept->size() ; offset += t ) {
+				const uint32_t *y = kept->data()+offset;
+				if ( classical ) {
+					interpolant.interpolate(x,y,t);
+				}
+				if ( decodeUnlockingSet
+						(f,score,vault,x,y,t,locator,
+						 classical ? &interpolant : NULL,randomized) ) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		const BigInteger & slowDownFactor = vault.getSlowDownFactor();
+		bool fixedWidth = slowDownFactor.numBits() <= 64;
+		uint64_t slowDownFactor64 = slowDownFactor.toUInt64();
+		uint64_t slowDownVal64 = 0;
+		BigInteger slowDownVal = 0;
+
+		vector<SmallBinaryFieldPolynomial> V
+				(_SLOW_DOWN_BATCH,SmallBinaryFieldPolynomial(vault.getField()));
+
+		while ( fixedWidth ?
+				slowDownVal64 < slowDownFactor64 :
+				BigInteger::compare(slowDownVal,slowDownFactor) < 0 ) {
+
+			int num;
+			if ( fixedWidth ) {
+				num = (int)min
+					((uint64_t)_SLOW_DOWN_BATCH,slowDownFactor64-slowDownVal64);
+				vault.unpackVaultPolynomials(V.data(),slowDownVal64,num);
+				slowDownVal64 += num;
+			} else {
+				num = 1;
+				V[0] = vault.unpackVaultPolynomial(slowDownVal);
+				add(slowDownVal,slowDownVal,1);
+			}
+
+			for ( int l = 0 ; l < num ; l++ ) {
+
+				// Build the unlocking set in one multipoint evaluation
+				V[l].eval(y,x,t);
+
+				if ( classical ) {
+					SmallBinaryFieldPolynomial::rem(interpolant,V[l],locator);
+				}
+
+				if ( decodeUnlockingSet
+						(f,score,vault,x,y,t,locator,
+						 classical ? &interpolant : NULL,randomized) ) {
+					return true;
+				}
+
+				if ( keep ) {
+					kept->insert(kept->end(),y,y+t);
+				}
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief
+	 *            State shared by the threads of an identification run.
+	 */
+	struct ProtectedGallerySchedule {
+
+		/**
+		 * @brief
+		 *            The templates of the gallery.
+		 */
+		const vector<ProtectedMinutiaeTemplate> *vaults;
+
+		/**
+		 * @brief
+		 *            The quantization group of each template.
+		 */
+		const vector<int> *groups;
+
+		/**
+		 * @brief
+		 *            The quantized query for each group.
+		 */
+		vector< vector<uint32_t> > features;
+
+		/**
+		 * @brief
+		 *            The maximal number of elements of a quantized
+		 *            query.
+		 */
+		int maxFeatures;
+
+		/**
+		 * @brief
+		 *            Whether the classical Reed-Solomon decoder is run in
+		 *            the current pass.
+		 */
+		bool classical;
+
+		/**
+		 * @brief
+		 *            Whether the templates' decoders are run in the
+		 *            current pass.
+		 */
+		bool randomized;
+
+		/**
+		 * @brief
+		 *            Whether the unlocking sets of the first pass are
+		 *            kept for the second pass.
+		 */
+		bool keep;
+
+		/**
+		 * @brief
+		 *            The unlocking sets kept for each template.
+		 */
+		vector< vector<uint32_t> > kept;
+
+		/**
+		 * @brief
+		 *            The number of words that may still be kept in
+		 *            \link kept\endlink.
+		 */
+		atomic<int64_t> keepBudget;
+
+		/**
+		 * @brief
+		 *            Whether the identification stops on the first
+		 *            opened template.
+		 */
+		bool firstHit;
+
+		/**
+		 * @brief
+		 *            The templates in the order in which they are
+		 *            decoded.
+		 */
+		vector<int> order;
+
+		/**
+		 * @brief
+		 *            Whether a template has been opened.
+		 */
+		vector<char> opened;
+
+		/**
+		 * @brief
+		 *            The position in \link order\endlink of the next
+		 *            template to be processed in the current pass.
+		 */
+		atomic<int> next;
+
+		/**
+		 * @brief
+		 *            Set to stop all threads.
+		 */
+		atomic<bool> stop;
+
+		/**
+		 * @brief
+		 *            The candidates found so far.
+		 */
+		vector<ProtectedGalleryCandidate> *candidates;
+
+		/**
+		 * @brief
+		 *            Serializes the insertion of candidates.
+		 */
+		mutex candidatesMutex;
+	};
+
+	/**
+	 * @brief
+	 *            Processes templates of the current pass of an
+	 *            identification until all templates have been handed out.
+	 *
+	 * @param schedule
+	 *            The shared state of the identification.
+	 */
+	static void identifyWorker( ProtectedGallerySchedule *schedule ) {
+
+		vector<uint32_t> x(schedule->maxFeatures+1);
+		vector<uint32_t> y(schedule->maxFeatures+1);
+
+		int n = (int)schedule->order.size();
+
+		while ( !schedule->stop ) {
+
+			int l = schedule->next.fetch_add(1);
+			if ( l >= n ) {
+				break;
+			}
+			int i = schedule->order[l];
+
+			// The second pass only considers the templates that have
+			// not been opened by the classical decoder.
+			if ( schedule->opened[i] ) {
+				continue;
+			}
+
+			const ProtectedMinutiaeTemplate & vault = schedule->vaults->at(i);
+			const vector<uint32_t> & B =
+					schedule->features[schedule->groups->at(i)];
+
+			SmallBinaryFieldPolynomial f(vault.getField());
+			int score;
+
+			// Reserve the memory for keeping the unlocking sets of all
+			// slow-down values if the budget allows so.
+			vector<uint32_t> *kept = NULL;
+			bool keep = false;
+			if ( schedule->keep ) {
+				kept = &(schedule->kept[i]);
+				if ( schedule->classical &&
+					 (int)B.size() >= vault.getSecretSize() &&
+					 vault.getSlowDownFactor().numBits() <= 32 ) {
+					int64_t words = (int64_t)vault.getSlowDownFactor().toUInt64()
+							* (int64_t)B.size();
+					if ( schedule->keepBudget.fetch_sub(words) >= words ) {
+						keep = true;
+					} else {
+						schedule->keepBudget.fetch_add(words);
+					}
+				}
+			}
+
+			bool success = openGalleryVault
+					(f,score,vault,B.data(),(int)B.size(),
+					 x.data(),y.data(),schedule->classical,
+					 schedule->randomized,kept,keep);
+
+			// The kept unlocking sets are not needed after the second
+			// pass or if the template has been opened.
+			if ( kept != NULL && (success || !keep) ) {
+				vector<uint32_t>().swap(*kept);
+			}
+
+			if ( success ) {
+
+				schedule->opened[i] = 1;
+
+				ProtectedGalleryCandidate candidate = { i , score , f };
+
+				lock_guard<mutex> lock(schedule->candidatesMutex);
+				schedule->candidates->push_back(candidate);
+				if ( schedule->firstHit ) {
+					schedule->stop = true;
+				}
+			}
+		}
+	}
+
+	/*
+	 * see 'ProtectedGallery.h' for the documentation.
+	 */
+	void ProtectedGallery::run
+	( vector<ProtectedGalleryCandidate> & candidates ,
+	  const MinutiaeView & view , bool firstHit ) const {
+
+		candidates.clear();
+
+		int n = (int)this->vaults.size();
+
+		ProtectedGallerySchedule schedule;
+		schedule.vaults = &(this->vaults);
+		schedule.groups = &(this->groups);
+		schedule.maxFeatures = 0;
+		schedule.firstHit = firstHit;
+		schedule.opened.assign(n,0);
+		schedule.stop = false;
+		schedule.candidates = &candidates;
+
+		// Quantize the query once per group
+		schedule.features.resize(this->groupRepresentatives.size());
+		for ( size_t l = 0 ; l < this->groupRepresentatives.size() ; l++ ) {
+
+			const ProtectedMinutiaeTemplate & vault =
+					this->vaults[this->groupRepresentatives[l]];
+
+			vector<uint32_t> & B = schedule.features[l];
+			B.resize(vault.getMaxGenuineFeatures());
+			B.resize(vault.quantize(B.data(),view));
+
+			schedule.maxFeatures = max(schedule.maxFeatures,(int)B.size());
+		}
+
+		// Accumulate the overlap of the query with the indexed templates
+		vector<int> overlaps(n,0);
+		for ( size_t l = 0 ; l < this->groupRepresentatives.size() ; l++ ) {
+			const vector<uint32_t> & B = schedule.features[l];
+			int offset = this->groupOffsets[l];
+			for ( size_t j = 0 ; j < B.size() ; j++ ) {
+				const vector<int> & list = this->postings[offset+B[j]];
+				for ( size_t h = 0 ; h < list.size() ; h++ ) {
+					++overlaps[list[h]];
+				}
+			}
+		}
+
+		// Indexed templates that have fewer correct unlocking pairs than
+		// their secret size cannot be opened; the others are decoded in
+		// the order of their overlap ...
+		vector< pair<int,int> > ranking;
+		for ( int i = 0 ; i < n ; i++ ) {
+			if ( this->indexed[i] &&
+				 overlaps[i] >= this->vaults[i].getSecretSize() ) {
+				ranking.push_back(make_pair(-overlaps[i],i));
+			}
+		}
+		sort(ranking.begin(),ranking.end());
+		if ( this->maxDecodingAttempts > 0 &&
+			 (int)ranking.size() > this->maxDecodingAttempts ) {
+			ranking.resize(this->maxDecodingAttempts);
+		}
+		for ( size_t l = 0 ; l < ranking.size() ; l++ ) {
+			schedule.order.push_back(ranking[l].second);
+		}
+
+		// ... before the templates that have not been indexed.
+		for ( int i = 0 ; i < n ; i++ ) {
+			if ( !this->indexed[i] ) {
+				schedule.order.push_back(i);
+			}
+		}
+
+		// Do not start more threads than there are templates.
+		int numThreads = min(this->numThreads,(int)schedule.order.size());
+
+		// If the first opened template is sought, the cheap classical
+		// decoder is run on all templates before the templates' decoders
+		// are run on the remaining ones; the unlocking sets of the first
+		// pass are kept for the second. Otherwise, all templates are
+		// decoded anyway and each unlocking set is passed to both
+		// decoders in a single pass.
+		int numPasses = firstHit ? 2 : 1;
+		schedule.keep = firstHit;
+		if ( firstHit ) {
+			schedule.kept.resize(n);
+		}
+		schedule.keepBudget = _MAX_KEPT_UNLOCKING_WORDS;
+
+		for ( int pass = 0 ; pass < numPasses && !schedule.stop ; pass++ ) {
+
+			schedule.classical = pass == 0;
+			schedule.randomized = !firstHit || pass == 1;
+			schedule.next = 0;
+
+			if ( numThreads <= 1 ) {
+				identifyWorker(&schedule);
+			} else {
+				vector<thread> threads;
+				for ( int l = 0 ; l < numThreads ; l++ ) {
+					threads.push_back(thread(identifyWorker,&schedule));
+				}
+				for ( int l = 0 ; l < numThreads ; l++ ) {
+					threads[l].join();
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief
+	 *            Orders positions in a list of candidates by descending
+	 *            score and ascending index of the candidates.
+	 */
+	struct ProtectedGalleryRanking {
+
+		/**
+		 * @brief
+		 *            The candidates.
+		 */
+		const vector<ProtectedGalleryCandidate> *candidates;
+
+		/**
+		 * @brief
+		 *            Compares two positions.
+		 *
+		 * @param l1
+		 *            The first position.
+		 *
+		 * @param l2
+		 *            The second position.
+		 *
+		 * @return
+		 *            <code>true</code> if the candidate at <code>l1</code>
+		 *            is ranked before the candidate at <code>l2</code>;
+		 *            otherwise <code>false</code>.
+		 */
+		bool operator()( int l1 , int l2 ) const {
+
+			const ProtectedGalleryCandidate & c1 = candidates->at(l1);
+			const ProtectedGalleryCandidate & c2 = candidates->at(l2);
+
+			if ( c1.score != c2.score ) {
+				return c1.score > c2.score;
+			}
+
+			return c1.index < c2.index;
+		}
+	};
+
+	/*
+	 * see 'ProtectedGallery.h' for the documentation.
+	 */
+	int ProtectedGallery::identify
+	( vector<ProtectedGalleryCandidate> & candidates ,
+	  const MinutiaeView & view , int maxCandidates ) const {
+
+		vector<ProtectedGalleryCandidate> found;
+
+		run(found,view,false);
+
+		// The secrets of candidates of templates from different groups
+		// may be defined over different fields and cannot be assigned
+		// to each other; thus, positions are sorted instead.
+		vector<int> order(found.size());
+		for ( int l = 0 ; l < (int)order.size() ; l++ ) {
+			order[l] = l;
+		}
+		ProtectedGalleryRanking ranking;
+		ranking.candidates = &found;
+		sort(order.begin(),order.end(),ranking);
+
+		int num = (int)order.size();
+		if ( maxCandidates > 0 && num > maxCandidates ) {
+			num = maxCandidates;
+		}
+
+		candidates.clear();
+		for ( int l = 0 ; l < num ; l++ ) {
+			candidates.push_back(found[order[l]]);
+		}
+
+		return num;
+	}
+
+	/*
+	 * see 'ProtectedGallery.h' for the documentation.
+	 */
+	bool ProtectedGallery::identifyFirst
+	( ProtectedGalleryCandidate & candidate ,
+	  const MinutiaeView & view ) const {
+
+		vector<ProtectedGalleryCandidate> candidates;
+
+		run(candidates,view,true);
+
+		if ( candidates.empty() ) {
+			return false;
+		}
+
+		candidate.index = candidates[0].index;
+		candidate.score = candidates[0].score;
+		candidate.secret.swap(candidates[0].secret);
+
+		return true;
+	}
+}
@@ -40,7 +40,7 @@
 #include <iostream>
 
 #include <thimble/misc/IOTools.h>
-#include <thimble/security/SHA.h>
+#include <thimble/security/Hash.h>
 #include <thimble/security/AES.h>
 #include <thimble/ecc/ReedSolomonCode.h>
 #include <thimble/ecc/GuruswamiSudanDecoder.h>
@@ -60,6 +60,14 @@ using namespace std;
  */
 namespace thimble {
 
+	/**
+	 * @brief
+	 *            Number of consecutive slow-down values whose derived
+	 *            keys are tried at once when opening a vault
+	 *            (see \link AES128::decryptBatch()\endlink).
+	 */
+	static const int _SLOW_DOWN_BATCH = 8;
+
 	/**
 	 * @brief
 	 *            Standard constructor.
@@ -234,7 +242,8 @@ namespace thimble {
 			}
 
 			// Copy hash value of secret polynomial
-			memcpy(this->hash,vault.hash,20);
+			this->hashAlgorithm = vault.hashAlgorithm;
+			memcpy(this->hash,vault.hash,Hash::MAX_DIGEST_SIZE);
 
 			// Copy permutation by using its assignment operator
 			this->permutation = vault.permutation;
@@ -393,11 +402,11 @@ namespace thimble {
 		SmallBinaryFieldPolynomial f(getField());
 		f.random(this->k,true);
 
-		// save its SHA-1 hash value
-        SHA().hash(this->hash,f.getData(),f.deg()+1);
+		// save its hash value
+        Hash(this->hashAlgorithm).hash(this->hash,f.getData(),f.deg()+1);
 
         // Derive a record-specific permutation using the
-        // SHA-1 hash value as seed
+        // hash value as seed
         updatePermutation();
 
 		uint32_t *A = (uint32_t*)malloc( 10 * this->tmax * sizeof(uint32_t) );
@@ -827,30 +836,70 @@ namespace thimble {
 
 		// Iterate of candidates of slow-down values until
 		// decoding is successful or the whole slow-down range
-		// has been tested
-		for ( BigInteger slowDownVal = 0 ;
-			  BigInteger::compare(slowDownVal,this->slowDownFactor) < 0 ;
-			  add(slowDownVal,slowDownVal,1) ) {
+		// has been tested. Practical slow-down factors fit into 64 bits
+		// and are iterated with a fixed-width counter; only oversized
+		// factors need to be iterated as big integers.
+		bool fixedWidth = this->slowDownFactor.numBits() <= 64;
+		uint64_t slowDownFactor64 = this->slowDownFactor.toUInt64();
+		uint64_t slowDownVal64 = 0;
+		BigInteger slowDownVal = 0;
+
+		// The vault data is decrypted under the keys of up to
+		// '_SLOW_DOWN_BATCH' slow-down values at once.
+		int n = vaultDataSize();
+		AES128 keys[_SLOW_DOWN_BATCH];
+		uint8_t *data = (uint8_t*)malloc
+				( _SLOW_DOWN_BATCH * n * sizeof(uint8_t) );
+		if ( data == NULL ) {
+			cerr << "ProtectedMinutiaeRecord::open: "
+				 << "Out of memory." << endl;
+            exit(EXIT_FAILURE);
+		}
 
-			SmallBinaryFieldPolynomial V = unpackVaultPolynomial(slowDownVal);
+		while ( !success &&
+				(fixedWidth ? slowDownVal64 < slowDownFactor64 :
+				 BigInteger::compare(slowDownVal,this->slowDownFactor) < 0) ) {
+
+			// Derive the keys of the next slow-down values ...
+			int num = 0;
+			while ( num < _SLOW_DOWN_BATCH &&
+					(fixedWidth ? slowDownVal64 < slowDownFactor64 :
+					 BigInteger::compare(slowDownVal,this->slowDownFactor) < 0) ) {
+				if ( fixedWidth ) {
+					keys[num++] = deriveKey(slowDownVal64++,this->hashAlgorithm);
+				} else {
+					keys[num++] = deriveKey(slowDownVal,this->hashAlgorithm);
+					add(slowDownVal,slowDownVal,1);
+				}
+			}
 
-			// Build unlocking set and ...
-			for ( int j = 0 ; j < t ; j++ ) {
+			// ... and decrypt the vault data under all of them.
+			AES128::decryptBatch
+			(data,keys,num,this->vaultPolynomialData,n);
 
-				// ... don't forget to apply the permutation process
-				x[j] = _reorder(B[j]);
+			for ( int l = 0 ; l < num ; l++ ) {
 
-				y[j] = V.eval(x[j]);
-			}
+				SmallBinaryFieldPolynomial V = toVaultPolynomial(data+l*n);
+
+				// Build unlocking set and ...
+				for ( int j = 0 ; j < t ; j++ ) {
+
+					// ... don't forget to apply the permutation process
+					x[j] = _reorder(B[j]);
 
-			// Attempt to decode the unlocking set
-			success = decode(f,x,y,t,this->k,this->hash,this->m);
+					y[j] = V.eval(x[j]);
+				}
+
+				// Attempt to decode the unlocking set
+				success = decode(f,x,y,t,this->k,this->hash,this->m);
 
-			if ( success ) {
-				break;
+				if ( success ) {
+					break;
+				}
 			}
 		}
 
+		free(data);
 		free(x);
 		free(y);
 
@@ -901,11 +950,11 @@ namespace thimble {
 	 *             than <i>k</i>.
 	 *
 	 * @param hash
-	 *             160-bit hash value of the correct secret polynomial
+	 *             Hash value of the correct secret polynomial
 	 *             <i>f</i>, that has been originally computed via an
 	 *             equivalent to
 	 *             <code>
-	 *              SHA().hash(hash,f.getData(),f.deg()+1)
+	 *              Hash(getHashAlgorithm()).hash(hash,f.getData(),f.deg()+1)
 	 *             </code>
 	 *
 	 * @param m
@@ -933,37 +982,58 @@ namespace thimble {
 	bool ProtectedMinutiaeRecord::decode
 	( SmallBinaryFieldPolynomial & f ,
 	  const uint32_t *x , const uint32_t *y ,
-	  int t , int k , const uint8_t hash[20] , int m ) const {
+	  int t , int k , const uint8_t *hash , int m ) const {
 
 		if ( k > t ) {
 			return false;
 		}
 
-		SHA sha;
-		uint8_t _hash[20];
+		Hash h(this->hashAlgorithm);
+		int digestSize = h.getDigestSize();
+		uint8_t _hash[Hash::MAX_DIGEST_SIZE];
 		SmallBinaryFieldPolynomial _f(f.getField());
 
-		if ( ReedSolomonCode::decode(_f,x,y,t,k) ) {
-			sha.hash(_hash,_f.getData(),_f.deg()+1);
-			if ( memcmp(hash,_hash,20) == 0 ) {
+		// The code locator and interpolating polynomial are computed once
+		// and shared by the classical and the list decoding attempts
+		GuruswamiSudanDecoder dec;
+		dec.prepare(x,y,t,k,getField());
+
+		if ( ReedSolomonCode::decode
+				(_f,dec.getLocator(),dec.getInterpolant(),t,k) ) {
+			h.hash(_hash,_f.getData(),_f.deg()+1);
+			if ( memcmp(hash,_hash,digestSize) == 0 ) {
 				f = _f;
 				return true;
 			}
 		}
 
+		// Raise the multiplicity incrementally such that the interpolation
+		// for the previous multiplicity is reused
 		for ( int m0 = 1 ; m0 <= m ; m0++ ) {
 
-			GuruswamiSudanDecoder dec;
+			dec.increaseMultiplicity();
 
-			dec.decode(x,y,t,k,m0,getField());
-
-			for ( int j = 0 ; j < (int)dec.getDecodedList().size() ; j++ ) {
+			// Hash all candidates of the list at once
+			const std::vector<SmallBinaryFieldPolynomial> & list =
+					dec.getDecodedList();
+			int num = (int)list.size();
+			if ( num == 0 ) {
+				continue;
+			}
 
-				_f = dec.getDecodedList().at(j);
+			std::vector<const uint32_t*> data(num);
+			std::vector<uint64_t> sizes(num);
+			std::vector<uint8_t> hashes((size_t)num*digestSize);
+			for ( int j = 0 ; j < num ; j++ ) {
+				data[j] = list[j].getData();
+				sizes[j] = (uint64_t)(list[j].deg()+1);
+			}
+			Hash::hashBatch
+			(this->hashAlgorithm,&(hashes[0]),&(data[0]),&(sizes[0]),num);
 
-				sha.hash(_hash,_f.getData(),_f.deg()+1);
-				if ( memcmp(hash,_hash,20) == 0 ) {
-					f = _f;
+			for ( int j = 0 ; j < num ; j++ ) {
+				if ( memcmp(hash,&(hashes[(size_t)j*digestSize]),digestSize) == 0 ) {
+					f = list[j];
 					return true;
 				}
 			}
@@ -1601,6 +1671,41 @@ namespace thimble {
 		this->slowDownFactor = slowDownFactor;
 	}
 
+	/**
+	 * @brief
+	 *            Specifies the hash function by which the secret key
+	 *            is verified and from which the keys of the slow-down
+	 *            mechanism are derived.
+	 *
+	 * @param algorithm
+	 *            The hash function.
+	 *
+	 * @warning
+	 *            If this protected minutiae record object already
+	 *            contains protected data, i.e.,
+	 *            if \link isEnrolled()\endlink returns <code>true</code>,
+	 *            or if <code>algorithm</code> is not a valid hash
+	 *            function, an error message will be printed to
+	 *            <code>stderr</code> and the program exits with status
+	 *            'EXIT_FAILURE'.
+	 */
+	void ProtectedMinutiaeRecord::setHashAlgorithm( HASH_ALGORITHM_T algorithm ) {
+
+		if ( isEnrolled() ) {
+			cerr << "ProtectedMinutiaeRecord::setHashAlgorithm: "
+				 << "parameter cannot be changed after enrollment." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		if ( !Hash::isValid(algorithm) ) {
+			cerr << "ProtectedMinutiaeRecord::setHashAlgorithm: "
+				 << "unknown hash function." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		this->hashAlgorithm = algorithm;
+	}
+
 	/**
 	 * @brief
 	 *             Access the distance of the hexagonal grid used
@@ -1732,6 +1837,19 @@ namespace thimble {
 		return this->slowDownFactor;
 	}
 
+	/**
+	 * @brief
+	 *            Access the hash function by which the secret key is
+	 *            verified.
+	 *
+	 * @return
+	 *            The hash function of this protected minutiae record.
+	 */
+	HASH_ALGORITHM_T ProtectedMinutiaeRecord::getHashAlgorithm() const {
+
+		return this->hashAlgorithm;
+	}
+
 	/**
 	 * @brief
 	 *             Access the vector of hexagonal grid points centered in
@@ -1953,23 +2071,145 @@ namespace thimble {
 			exit(EXIT_FAILURE);
 		}
 
-		AES128 aes = deriveKey(slowDownValue);
+		AES128 aes = deriveKey(slowDownValue,this->hashAlgorithm);
 
-		int t , d , n;
-		t = this->t;
-		d = this->gfPtr->getDegree();
-		n = vaultDataSize();
+		return decryptVaultPolynomial(aes);
+	}
+
+	/**
+	 * @brief
+	 *            Unpacks the vault polynomial for a slow-down value
+	 *            given as an unsigned 64-bit integer.
+	 *
+	 * @details
+	 *            Works as
+	 *            \link unpackVaultPolynomial(const BigInteger&)const\endlink
+	 *            but without any big integer arithmetic. For the same
+	 *            slow-down value, both functions derive the same key
+	 *            and thus return the same candidate. The function is
+	 *            used by \link open()\endlink if the slow-down factor
+	 *            fits into 64 bits.
+	 *
+	 * @param slowDownVal
+	 *            A guess for the slow-down value.
+	 *
+	 * @return
+	 *            A candidate for the correct vault polynomial (which is
+	 *            correct if the guess for the slow-down value is correct).
+	 *
+	 * @warning
+	 *            If this object does not contain (a candidate) for decrypted
+	 *            vault polynomial data, i.e.,
+	 *            if \link isDecrypted()\endlink returns <code>false</code>,
+	 *            then an error message will be printed to
+	 *            <code>stderr</code> and the program exits with status
+	 *            'EXIT_FAILURE'.
+	 *
+	 * @warning
+	 *            If <code>slowDownVal</code> is greater than or equals
+	 *            \link getSlowDownFactor()\endlink, then an
+	 *            error message will be printed to <code>stderr</code> and
+	 *            the program exits with status 'EXIT_FAILURE'.
+	 *
+	 * @warning
+	 *            If not enough memory could be allocated, an error message
+	 *            will be printed to <code>stderr</code> and the program
+	 *            exits with status 'EXIT_FAILURE'.
+	 */
+	SmallBinaryFieldPolynomial ProtectedMinutiaeRecord::unpackVaultPolynomial
+	( uint64_t slowDownValue ) const {
+
+		if ( !isDecrypted() ) {
+			cerr << "ProtectedMinutiaeRecord::unpackVaultPolynomial: "
+				 << "no decrypted vault data." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		if ( getSlowDownFactor().numBits() <= 64 &&
+			 slowDownValue >= getSlowDownFactor().toUInt64() ) {
+			cerr << "ProtectedMinutiaeRecord::unpackVaultPolynomial: "
+				 << "slow-down value must be smaller than the "
+				 << "slow-down factor" << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		AES128 aes = deriveKey(slowDownValue,this->hashAlgorithm);
+
+		return decryptVaultPolynomial(aes);
+	}
+
+	/**
+	 * @brief
+	 *            Decrypts and unpacks the vault polynomial using the
+	 *            specified AES key.
+	 *
+	 * @details
+	 *            Helper for both variants
+	 *            of \link unpackVaultPolynomial()\endlink after the key
+	 *            has been derived from the slow-down value.
+	 *
+	 * @param aes
+	 *            The key derived from a guess of the slow-down value.
+	 *
+	 * @return
+	 *            A candidate for the vault polynomial.
+	 *
+	 * @warning
+	 *            If not enough memory could be allocated, an error message
+	 *            will be printed to <code>stderr</code> and the program
+	 *            exits with status 'EXIT_FAILURE'.
+	 */
+	SmallBinaryFieldPolynomial ProtectedMinutiaeRecord::decryptVaultPolynomial
+	( AES128 & aes ) const {
+
+		int n = vaultDataSize();
 
 		uint8_t *data = (uint8_t*)malloc( n * sizeof(uint8_t) );
-		uint32_t *coeffs = (uint32_t*)malloc( t * sizeof(uint32_t ) );
-		if ( data == NULL || coeffs == NULL ) {
-			cerr << "ProtectedMinutiaeRecord::createVaultPolynomialCandidate: "
+		if ( data == NULL ) {
+			cerr << "ProtectedMinutiaeRecord::decryptVaultPolynomial: "
 				 << "out of memory." << endl;
 			exit(EXIT_FAILURE);
 		}
 
 		aes.decrypt(data,this->vaultPolynomialData,n);
 
+		SmallBinaryFieldPolynomial V = toVaultPolynomial(data);
+
+		free(data);
+
+		return V;
+	}
+
+	/**
+	 * @brief
+	 *            Unpacks the vault polynomial from decrypted vault data.
+	 *
+	 * @param data
+	 *            Array of \link vaultDataSize()\endlink bytes decrypted
+	 *            with a key derived from a guess of the slow-down value.
+	 *
+	 * @return
+	 *            A candidate for the vault polynomial.
+	 *
+	 * @warning
+	 *            If not enough memory could be allocated, an error message
+	 *            will be printed to <code>stderr</code> and the program
+	 *            exits with status 'EXIT_FAILURE'.
+	 */
+	SmallBinaryFieldPolynomial ProtectedMinutiaeRecord::toVaultPolynomial
+	( const uint8_t *data ) const {
+
+		int t , d;
+		t = this->t;
+		d = this->gfPtr->getDegree();
+
+		uint32_t *coeffs = (uint32_t*)malloc( t * sizeof(uint32_t ) );
+		if ( coeffs == NULL ) {
+			cerr << "ProtectedMinutiaeRecord::toVaultPolynomial: "
+				 << "out of memory." << endl;
+			exit(EXIT_FAILURE);
+		}
+
 		// Unpack decrypted data into coefficient vector
 		split_into_bit_vectors(coeffs,data,t,d);
 
@@ -1979,7 +2219,6 @@ namespace thimble {
 			V.setCoeff(j,coeffs[j]);
 		}
 
-		free(data);
 		free(coeffs);
 
 		return V;
@@ -1987,13 +2226,15 @@ namespace thimble {
 
 	/**
 	 * @brief
-	 *             Access the SHA-1 hash value of the secret key
+	 *             Access the hash value of the secret key
 	 *             generated on enrollment used to obfuscate the
 	 *             correct minutiae record's quantization.
 	 *
 	 * @return
-	 *             The SHA-1 hash value of the secret key used to
-	 *             obfuscate the correct minutiae template's quantization.
+	 *             The hash value of the secret key used to obfuscate
+	 *             the correct minutiae template's quantization; its
+	 *             size is <code>Hash::getDigestSize(getHashAlgorithm())</code>
+	 *             bytes, i.e., 20 bytes for the default SHA-1.
 	 *
 	 * @warning
 	 *             If \link isEnrolled()\endlink returns
@@ -2206,7 +2447,7 @@ namespace thimble {
 
 		this->t = -1;
 
-		memset(this->hash,0,20);
+		memset(this->hash,0,Hash::MAX_DIGEST_SIZE);
 	}
 
 	/**
@@ -2234,6 +2475,9 @@ namespace thimble {
 		int size = 0;
 
 		size += 10; // size for the header
+		if ( this->hashAlgorithm != HASH_SHA1 ) {
+			size += 1; // size to encode 'hashAlgorithm'
+		}
 		size += 2; // size to encode 'width'
 		size += 2; // size to encode 'height'
 		size += 2; // size to encode 'dpi'
@@ -2247,7 +2491,7 @@ namespace thimble {
 		size += 2; // size to encode 't'
 		size += 1; // size to encode whether the vault is encrypted or not
 		size += vaultDataSize(); // size to encode the vault data
-		size += 20; // size to encode hash value of the secret polynomial.
+		size += Hash::getDigestSize(this->hashAlgorithm); // size to encode hash value of the secret polynomial.
 
 		return size;
 	}
@@ -2293,9 +2537,18 @@ namespace thimble {
 
 
 
-		// Write header
-		memcpy(data,"PMR140822",10);
-		offset = 10;
+		// Write header; records protected with SHA-1 are written in the
+		// original format; otherwise, a newer format version is written
+		// that records the hash function after the header.
+		if ( this->hashAlgorithm == HASH_SHA1 ) {
+			memcpy(data,"PMR140822",10);
+			offset = 10;
+		} else {
+			memcpy(data,"PMR261017",10);
+			offset = 10;
+			data[offset] = (uint8_t)(this->hashAlgorithm);
+			offset += 1;
+		}
 
 		// Write 'width'
 		tmp = (uint32_t)(this->width);
@@ -2378,8 +2631,9 @@ namespace thimble {
 		offset += n;
 
 		// Write hash of secret polynomial
-		memcpy(data+offset,this->hash,20);
-		offset += 20;
+		int digestSize = Hash::getDigestSize(this->hashAlgorithm);
+		memcpy(data+offset,this->hash,digestSize);
+		offset += digestSize;
 
 		return offset;
 	}
@@ -2446,6 +2700,14 @@ namespace thimble {
 
 		offset += 10;
 
+		// The newer format version records the hash function
+		if ( memcmp(data,"PMR261017",10) == 0 ) {
+			if ( size < offset+1 ) { return -1; }
+			if ( !Hash::isValid(data[offset]) ) { return -1; }
+			tmp.hashAlgorithm = (HASH_ALGORITHM_T)data[offset];
+			offset += 1;
+		}
+
 		// Read and check 'width'
 		if ( size < offset+2 ) { return -1; }
 		tmp.width = (int)data[offset]; tmp.width <<= 8; tmp.width += (int)data[offset+1];
@@ -2579,9 +2841,10 @@ namespace thimble {
 		// *******************************************************************
 
 		// Read 'hash'
-		if ( size < offset+20 ) { return -1; }
-		memcpy(tmp.hash,data+offset,20);
-		offset += 20;
+		int digestSize = Hash::getDigestSize(tmp.hashAlgorithm);
+		if ( size < offset+digestSize ) { return -1; }
+		memcpy(tmp.hash,data+offset,digestSize);
+		offset += digestSize;
 
 		// Update the permutation which is selected pseudo-randomly using
 		// the hash value as seed.
@@ -2746,6 +3009,14 @@ namespace thimble {
 					return -1;
 				}
 			}
+
+			// The newer format version records the hash function
+			if ( memcmp(header,"PMR261017",10) == 0 ) {
+				if ( (c=fgetc(in)) < 0 ) { return -1; }
+				if ( !Hash::isValid(c) ) { return -1; }
+				tmp.hashAlgorithm = (HASH_ALGORITHM_T)c;
+				offset += 1;
+			}
 		}
 
 		offset += 10;
@@ -2916,10 +3187,11 @@ namespace thimble {
 		// *******************************************************************
 
 		// Read 'hash'
-		if ( fread(tmp.hash,1,20,in) != 20 ) {
+		int digestSize = Hash::getDigestSize(tmp.hashAlgorithm);
+		if ( fread(tmp.hash,1,digestSize,in) != (size_t)digestSize ) {
 			return -1;
 		}
-		offset += 20;
+		offset += digestSize;
 
 		tmp.updatePermutation();
 
@@ -3015,6 +3287,7 @@ namespace thimble {
 		int t = vault1.t;
 		uint8_t *vaultPolynomialData = vault1.vaultPolynomialData;
 		uint8_t *encryptedVaultPolynomialData = vault1.encryptedVaultPolynomialData;
+		HASH_ALGORITHM_T hashAlgorithm = vault1.hashAlgorithm;
 
 		// Copy the members of 'view2' into 'view1'
 		vault1.width = vault2.width;
@@ -3030,6 +3303,7 @@ namespace thimble {
 		vault1.t =vault2.t;
 		vault1.vaultPolynomialData = vault2.vaultPolynomialData;
 		vault1.encryptedVaultPolynomialData = vault2.encryptedVaultPolynomialData;
+		vault1.hashAlgorithm = vault2.hashAlgorithm;
 
 		// Copy temporary member variables to 'view2'
 		vault2.width = width;
@@ -3045,6 +3319,7 @@ namespace thimble {
 		vault2.t = t;
 		vault2.vaultPolynomialData = vaultPolynomialData;
 		vault2.encryptedVaultPolynomialData = encryptedVaultPolynomialData;
+		vault2.hashAlgorithm = hashAlgorithm;
 
 		// SPECIAL CASE: Swap the 'slowDownFactor' fields using
 		// the 'BigInteger::swap' method.
@@ -3052,10 +3327,10 @@ namespace thimble {
 
 		// SPECIAL CASE: swap the secret polynomials' hash values
 		// via 'memcpy'
-		uint8_t hash[20];
-		memcpy(hash,vault1.hash,20);
-		memcpy(vault1.hash,vault2.hash,20);
-		memcpy(vault2.hash,hash,20);
+		uint8_t hash[Hash::MAX_DIGEST_SIZE];
+		memcpy(hash,vault1.hash,Hash::MAX_DIGEST_SIZE);
+		memcpy(vault1.hash,vault2.hash,Hash::MAX_DIGEST_SIZE);
+		memcpy(vault2.hash,hash,Hash::MAX_DIGEST_SIZE);
 
 		// SPECIAL CASE: Swap the 'permutation' fields using
 		// the 'Permutation::swap' method.
@@ -3089,8 +3364,9 @@ namespace thimble {
 		this->t = -1;
 		this->vaultPolynomialData = NULL;
 		this->encryptedVaultPolynomialData = NULL;
+		this->hashAlgorithm = HASH_SHA1;
 
-		memset(this->hash,0,20);
+		memset(this->hash,0,Hash::MAX_DIGEST_SIZE);
 	}
 
 	/**
@@ -3321,7 +3597,7 @@ namespace thimble {
 		BigInteger slowDownVal; slowDownVal.random(this->slowDownFactor,true);
 
 		// Derive AES key from slow-down value.
-		AES128 aes = deriveKey(slowDownVal);
+		AES128 aes = deriveKey(slowDownVal,this->hashAlgorithm);
 
 		int t , d , n;
 		t = this->t;
@@ -3404,15 +3680,19 @@ namespace thimble {
 	 * @details
 	 *            The bytes of the specified integer are extracted
 	 *            via the \link BigInteger::toBytes() x.toBytes()\endlink
-	 *            method and then its \link SHA SHA hash value\endlink
-	 *            is computed; the first 16 bytes of the value
-	 *            are used to define the \link AES128 AES key\endlink
-	 *            returned by this function.
+	 *            method and then its hash value is computed; the
+	 *            first 16 bytes of the value are used to define the
+	 *            \link AES128 AES key\endlink returned by this
+	 *            function.
 	 *
 	 * @param x
 	 *            The integer of which an AES key is computed with
 	 *            this function.
 	 *
+	 * @param algorithm
+	 *            The hash function of which the first 16 bytes of the
+	 *            hash value of <code>x</code> form the key.
+	 *
 	 * @return
 	 *            The AES key derived from <code>x</code>.
 	 *
@@ -3421,7 +3701,8 @@ namespace thimble {
 	 *             is printed <code>stderr</code> and the program exits
 	 *             with status 'EXIT_FAILURE'
 	 */
-	AES128 ProtectedMinutiaeRecord::deriveKey( const BigInteger & x ) {
+	AES128 ProtectedMinutiaeRecord::deriveKey
+	( const BigInteger & x , HASH_ALGORITHM_T algorithm ) {
 
 		uint8_t *array = (uint8_t*)malloc( x.getSizeInBytes() );
 		if ( array == NULL ) {
@@ -3431,8 +3712,8 @@ namespace thimble {
 		}
 
 		x.toBytes(array);
-		uint8_t hash[20];
-		SHA().hash(hash,array,x.getSizeInBytes());
+		uint8_t hash[Hash::MAX_DIGEST_SIZE];
+		Hash(algorithm).hash(hash,array,x.getSizeInBytes());
 
 		AES128 aes(hash);
 
@@ -3441,6 +3722,52 @@ namespace thimble {
 		return aes;
 	}
 
+	/**
+	 * @brief
+	 *            Derives an AES key from the specified unsigned
+	 *            64-bit integer.
+	 *
+	 * @details
+	 *            The key agrees with the key returned
+	 *            by \link deriveKey(const BigInteger&,HASH_ALGORITHM_T)\endlink
+	 *            for the same integer, i.e., the hashed bytes are
+	 *            the same as written by
+	 *            \link BigInteger::toBytes()\endlink; but these are
+	 *            written to a stack buffer without creating a
+	 *            \link BigInteger\endlink.
+	 *
+	 * @param x
+	 *            The integer of which an AES key is computed with
+	 *            this function.
+	 *
+	 * @param algorithm
+	 *            The hash function of which the first 16 bytes of the
+	 *            hash value of <code>x</code> form the key.
+	 *
+	 * @return
+	 *            The AES key derived from <code>x</code>.
+	 */
+	AES128 ProtectedMinutiaeRecord::deriveKey
+	( uint64_t x , HASH_ALGORITHM_T algorithm ) {
+
+		// Same layout as 'BigInteger::toBytes': little endian bytes
+		// followed by at least one bit for the (positive) sign
+		uint8_t array[9];
+		int size = 0;
+		do {
+			array[size++] = (uint8_t)(x & 0xFF);
+			x >>= 8;
+		} while ( x != 0 );
+		if ( array[size-1] & 0x80 ) {
+			array[size++] = 0;
+		}
+
+		uint8_t hash[Hash::MAX_DIGEST_SIZE];
+		Hash(algorithm).hash(hash,array,size);
+
+		return AES128(hash);
+	}
+
 	/**
 	 * @brief
 	 *           Store the concatenation of a sequence of <i>d</i>-bit
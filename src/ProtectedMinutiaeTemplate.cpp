@@ -33,6 +33,7 @@
 
 #define _USE_MATH_DEFINES
 #include <stdint.h>
+#include <algorithm>
 #include <cmath>
 #include <cfloat>
 #include <cstring>
@@ -43,7 +44,7 @@
 #include <thimble/math/HexagonalGrid.h>
 #include <thimble/math/Permutation.h>
 #include <thimble/math/RandomGenerator.h>
-#include <thimble/security/SHA.h>
+#include <thimble/security/Hash.h>
 #include <thimble/security/AES.h>
 #include <thimble/security/FuzzyVaultTools.h>
 #include <thimble/finger/MinutiaeRecord.h>
@@ -57,6 +58,14 @@ using namespace std;
 namespace thimble
 {
 
+	/**
+	 * @brief
+	 *            Number of consecutive slow-down values whose derived
+	 *            keys are tried at once when opening a vault
+	 *            (see \link AES128::decryptBatch()\endlink).
+	 */
+	static const int _SLOW_DOWN_BATCH = 8;
+
 	/**
 	 * @brief
 	 *            Standard constructor.
@@ -88,7 +97,8 @@ namespace thimble
 		this->t = -1;
 		this->vaultPolynomialData = NULL;
 		this->encryptedVaultPolynomialData = NULL;
-		memset(this->hash, 0, 20);
+		this->hashAlgorithm = HASH_SHA1;
+		memset(this->hash, 0, Hash::MAX_DIGEST_SIZE);
 		this->is_initialized = false;
 	}
 
@@ -164,7 +174,8 @@ namespace thimble
 		this->t = -1;
 		this->vaultPolynomialData = NULL;
 		this->encryptedVaultPolynomialData = NULL;
-		memset(this->hash, 0, 20);
+		this->hashAlgorithm = HASH_SHA1;
+		memset(this->hash, 0, Hash::MAX_DIGEST_SIZE);
 		this->is_initialized = false;
 
 		*this = vault;
@@ -373,7 +384,8 @@ namespace thimble
 			}
 
 			// Copy hash value of secret polynomial
-			memcpy(this->hash, vault.hash, 20);
+			this->hashAlgorithm = vault.hashAlgorithm;
+			memcpy(this->hash, vault.hash, Hash::MAX_DIGEST_SIZE);
 
 			// Copy permutation by using its assignment operator
 			this->permutation = vault.permutation;
@@ -421,6 +433,7 @@ namespace thimble
 		uint8_t *vaultPolynomialData = vault1.vaultPolynomialData;
 		uint8_t *encryptedVaultPolynomialData =
 			vault1.encryptedVaultPolynomialData;
+		HASH_ALGORITHM_T hashAlgorithm = vault1.hashAlgorithm;
 		bool is_initialized = vault1.is_initialized;
 
 		// Copy the members of 'vault2' into 'vault1'
@@ -439,6 +452,7 @@ namespace thimble
 		vault1.vaultPolynomialData = vault2.vaultPolynomialData;
 		vault1.encryptedVaultPolynomialData =
 			vault2.encryptedVaultPolynomialData;
+		vault1.hashAlgorithm = vault2.hashAlgorithm;
 		vault1.is_initialized = vault2.is_initialized;
 
 		// Copy temporary member variables to 'vault2'
@@ -457,14 +471,15 @@ namespace thimble
 		vault2.vaultPolynomialData = vaultPolynomialData;
 		vault2.encryptedVaultPolynomialData =
 			encryptedVaultPolynomialData;
+		vault2.hashAlgorithm = hashAlgorithm;
 		vault2.is_initialized = is_initialized;
 
 		// SPECIAL CASE: swap the secret polynomials' hash values
 		// via 'memcpy'
-		uint8_t hash[20];
-		memcpy(hash, vault1.hash, 20);
-		memcpy(vault1.hash, vault2.hash, 20);
-		memcpy(vault2.hash, hash, 20);
+		uint8_t hash[Hash::MAX_DIGEST_SIZE];
+		memcpy(hash, vault1.hash, Hash::MAX_DIGEST_SIZE);
+		memcpy(vault1.hash, vault2.hash, Hash::MAX_DIGEST_SIZE);
+		memcpy(vault2.hash, hash, Hash::MAX_DIGEST_SIZE);
 		// SPECIAL CASE: Swap the 'permutation' fields using
 		// the 'Permutation::swap' method.
 		Permutation::swap(vault1.permutation, vault2.permutation);
@@ -675,8 +690,8 @@ namespace thimble
 		SmallBinaryFieldPolynomial f(getField());
 		f.random(this->k, true);
 
-		// save its SHA-1 hash value
-		SHA().hash(this->hash, f.getData(), f.deg() + 1);
+		// save its hash value
+		Hash(this->hashAlgorithm).hash(this->hash, f.getData(), f.deg() + 1);
 
 		// Generate user-specific public permutation process
 		updatePermutation();
@@ -1083,33 +1098,73 @@ namespace thimble
 
 		// Iterate of candidates of slow-down values until
 		// decoding is successful or the whole slow-down range
-		// has been tested
-		for (BigInteger slowDownVal = 0;
-			 BigInteger::compare(slowDownVal, this->slowDownFactor) < 0;
-			 add(slowDownVal, slowDownVal, 1))
+		// has been tested. Practical slow-down factors fit into 64 bits
+		// and are iterated with a fixed-width counter; only oversized
+		// factors need to be iterated as big integers.
+		bool fixedWidth = this->slowDownFactor.numBits() <= 64;
+		uint64_t slowDownFactor64 = this->slowDownFactor.toUInt64();
+		uint64_t slowDownVal64 = 0;
+		BigInteger slowDownVal = 0;
+
+		// The vault data is decrypted under the keys of up to
+		// '_SLOW_DOWN_BATCH' slow-down values at once.
+		int n = vaultDataSize();
+		AES128 keys[_SLOW_DOWN_BATCH];
+		uint8_t *data = (uint8_t *)malloc(_SLOW_DOWN_BATCH * n * sizeof(uint8_t));
+		if (data == NULL)
 		{
+			cerr << "ProtectedMinutiaeTemplate::open: "
+				 << "Out of memory." << endl;
+			exit(EXIT_FAILURE);
+		}
 
-			SmallBinaryFieldPolynomial V = unpackVaultPolynomial(slowDownVal);
+		while (!success && (fixedWidth ? slowDownVal64 < slowDownFactor64 : BigInteger::compare(slowDownVal, this->slowDownFactor) < 0))
+		{
 
-			// Build unlocking set and ...
-			for (int j = 0; j < t; j++)
+			// Derive the keys of the next slow-down values ...
+			int num = 0;
+			while (num < _SLOW_DOWN_BATCH && (fixedWidth ? slowDownVal64 < slowDownFactor64 : BigInteger::compare(slowDownVal, this->slowDownFactor) < 0))
 			{
-
-				// ... don't forget to apply the permutation process
-				x[j] = _reorder(B[j]);
-
-				y[j] = V.eval(x[j]);
+				if (fixedWidth)
+				{
+					keys[num++] = deriveKey(slowDownVal64++, this->hashAlgorithm);
+				}
+				else
+				{
+					keys[num++] = deriveKey(slowDownVal, this->hashAlgorithm);
+					add(slowDownVal, slowDownVal, 1);
+				}
 			}
 
-			// Attempt to decode the unlocking set
-			success = decode(f, x, y, t, this->k, this->hash, this->D);
+			// ... and decrypt the vault data under all of them.
+			AES128::decryptBatch(data, keys, num, this->vaultPolynomialData, n);
 
-			if (success)
+			for (int l = 0; l < num; l++)
 			{
-				break;
+
+				SmallBinaryFieldPolynomial V = toVaultPolynomial(data + l * n);
+
+				// Build unlocking set and ...
+				for (int j = 0; j < t; j++)
+				{
+
+					// ... don't forget to apply the permutation process
+					x[j] = _reorder(B[j]);
+
+					y[j] = V.eval(x[j]);
+				}
+
+				// Attempt to decode the unlocking set
+				success = decode(f, x, y, t, this->k, this->hash, this->D);
+
+				if (success)
+				{
+					break;
+				}
 			}
 		}
 
+		free(data);
 		free(x);
 		free(y);
 
@@ -1150,11 +1205,11 @@ namespace thimble
 	 *             than <i>k</i>.
 	 *
 	 * @param hash
-	 *             160-bit hash value of the correct secret polynomial
+	 *             Hash value of the correct secret polynomial
 	 *             <i>f</i>, that has been originally computed via an
 	 *             equivalent to
 	 *             <code>
-	 *              SHA().hash(hash,f.getData(),f.deg()+1)
+	 *              Hash(getHashAlgorithm()).hash(hash,f.getData(),f.deg()+1)
 	 *             </code>
 	 *
 	 * @param D
@@ -1165,7 +1220,7 @@ namespace thimble
 	 *             otherwise, the function returns <code>false</code>.
 	 */
 	bool ProtectedMinutiaeTemplate::decode(SmallBinaryFieldPolynomial &f, const uint32_t *x, const uint32_t *y,
-										   int t, int k, const uint8_t hash[20], int D) const
+										   int t, int k, const uint8_t *hash, int D) const
 	{
 		{
 
@@ -1179,7 +1234,8 @@ namespace thimble
 			// Essentially, the randomized decoder consists
 			// of the first 'D' steps of a randomized brute-force
 			// attack.
-			return FuzzyVaultTools::bfattack(f, x, y, t, k, hash, D);
+			return FuzzyVaultTools::bfattack(f, x, y, t, k, hash,
+											 this->hashAlgorithm, D);
 		}
 	}
 
@@ -1867,24 +1923,209 @@ namespace thimble
 			exit(EXIT_FAILURE);
 		}
 
-		AES128 aes = deriveKey(slowDownValue);
+		AES128 aes = deriveKey(slowDownValue, this->hashAlgorithm);
 
-		int t, d, n;
-		t = this->t;
-		d = this->gfPtr->getDegree();
-		n = vaultDataSize();
+		return decryptVaultPolynomial(aes);
+	}
+
+	/**
+	 * @brief
+	 *            Unpacks the vault polynomial for a slow-down value
+	 *            given as an unsigned 64-bit integer.
+	 *
+	 * @details
+	 *            Works as
+	 *            \link unpackVaultPolynomial(const BigInteger&)const\endlink
+	 *            but without any big integer arithmetic. For the same
+	 *            slow-down value, both functions derive the same key
+	 *            and thus return the same candidate. The function is
+	 *            used by \link open()\endlink if the slow-down factor
+	 *            fits into 64 bits.
+	 *
+	 * @param slowDownVal
+	 *            A guess for the slow-down value.
+	 *
+	 * @return
+	 *            A candidate for the correct vault polynomial (which is
+	 *            correct if the guess for the slow-down value is correct).
+	 *
+	 * @warning
+	 *            If this object does not contain (a candidate) for decrypted
+	 *            vault polynomial data, i.e.,
+	 *            if \link isDecrypted()\endlink returns <code>false</code>,
+	 *            then an error message will be printed to
+	 *            <code>stderr</code> and the program exits with status
+	 *            'EXIT_FAILURE'.
+	 *
+	 * @warning
+	 *            If <code>slowDownVal</code> is greater than or equals
+	 *            \link getSlowDownFactor()\endlink, then an
+	 *            error message will be printed to <code>stderr</code> and
+	 *            the program exits with status 'EXIT_FAILURE'.
+	 *
+	 * @warning
+	 *            If not enough memory could be allocated, an error message
+	 *            will be printed to <code>stderr</code> and the program
+	 *            exits with status 'EXIT_FAILURE'.
+	 */
+	SmallBinaryFieldPolynomial ProtectedMinutiaeTemplate::unpackVaultPolynomial(uint64_t slowDownValue) const
+	{
+
+		if (!isDecrypted())
+		{
+			cerr << "ProtectedMinutiaeTemplate::unpackVaultPolynomial: "
+				 << "no decrypted vault data." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		if (getSlowDownFactor().numBits() <= 64 &&
+			slowDownValue >= getSlowDownFactor().toUInt64())
+		{
+			cerr << "ProtectedMinutiaeTemplate::unpackVaultPolynomial: "
+				 << "slow-down value must be smaller than the "
+				 << "slow-down factor" << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		AES128 aes = deriveKey(slowDownValue, this->hashAlgorithm);
+
+		return decryptVaultPolynomial(aes);
+	}
+
+	/**
+	 * @brief
+	 *            Unpacks the vault polynomials for consecutive
+	 *            slow-down values.
+	 *
+	 * @details
+	 *            see 'ProtectedMinutiaeTemplate.h'
+	 */
+	void ProtectedMinutiaeTemplate::unpackVaultPolynomials(SmallBinaryFieldPolynomial *V, uint64_t slowDownValue, int num) const
+	{
+
+		if (!isDecrypted())
+		{
+			cerr << "ProtectedMinutiaeTemplate::unpackVaultPolynomials: "
+				 << "no decrypted vault data." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		if (num < 0 ||
+			(getSlowDownFactor().numBits() <= 64 &&
+			 (slowDownValue > getSlowDownFactor().toUInt64() ||
+			  (uint64_t)num > getSlowDownFactor().toUInt64() - slowDownValue)))
+		{
+			cerr << "ProtectedMinutiaeTemplate::unpackVaultPolynomials: "
+				 << "slow-down values must be smaller than the "
+				 << "slow-down factor" << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		int n = vaultDataSize();
+		AES128 keys[_SLOW_DOWN_BATCH];
+		uint8_t *data = (uint8_t *)malloc(_SLOW_DOWN_BATCH * n * sizeof(uint8_t));
+		if (data == NULL)
+		{
+			cerr << "ProtectedMinutiaeTemplate::unpackVaultPolynomials: "
+				 << "out of memory." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		for (int l0 = 0; l0 < num; l0 += _SLOW_DOWN_BATCH)
+		{
+
+			int batch = min(num - l0, _SLOW_DOWN_BATCH);
+
+			for (int l = 0; l < batch; l++)
+			{
+				keys[l] = deriveKey(slowDownValue + l0 + l, this->hashAlgorithm);
+			}
+
+			AES128::decryptBatch(data, keys, batch, this->vaultPolynomialData, n);
+
+			for (int l = 0; l < batch; l++)
+			{
+				V[l0 + l] = toVaultPolynomial(data + l * n);
+			}
+		}
+
+		free(data);
+	}
+
+	/**
+	 * @brief
+	 *            Decrypts and unpacks the vault polynomial using the
+	 *            specified AES key.
+	 *
+	 * @details
+	 *            Helper for both variants
+	 *            of \link unpackVaultPolynomial()\endlink after the key
+	 *            has been derived from the slow-down value.
+	 *
+	 * @param aes
+	 *            The key derived from a guess of the slow-down value.
+	 *
+	 * @return
+	 *            A candidate for the vault polynomial.
+	 *
+	 * @warning
+	 *            If not enough memory could be allocated, an error message
+	 *            will be printed to <code>stderr</code> and the program
+	 *            exits with status 'EXIT_FAILURE'.
+	 */
+	SmallBinaryFieldPolynomial ProtectedMinutiaeTemplate::decryptVaultPolynomial(AES128 &aes) const
+	{
+
+		int n = vaultDataSize();
 
 		uint8_t *data = (uint8_t *)malloc(n * sizeof(uint8_t));
-		uint32_t *coeffs = (uint32_t *)malloc(t * sizeof(uint32_t));
-		if (data == NULL || coeffs == NULL)
+		if (data == NULL)
 		{
-			cerr << "ProtectedMinutiaeTemplate::createVaultPolynomialCandidate: "
+			cerr << "ProtectedMinutiaeTemplate::decryptVaultPolynomial: "
 				 << "out of memory." << endl;
 			exit(EXIT_FAILURE);
 		}
 
 		aes.decrypt(data, this->vaultPolynomialData, n);
 
+		SmallBinaryFieldPolynomial V = toVaultPolynomial(data);
+
+		free(data);
+
+		return V;
+	}
+
+	/**
+	 * @brief
+	 *            Unpacks the vault polynomial from decrypted vault data.
+	 *
+	 * @param data
+	 *            Array of \link vaultDataSize()\endlink bytes decrypted
+	 *            with a key derived from a guess of the slow-down value.
+	 *
+	 * @return
+	 *            A candidate for the vault polynomial.
+	 *
+	 * @warning
+	 *            If not enough memory could be allocated, an error message
+	 *            will be printed to <code>stderr</code> and the program
+	 *            exits with status 'EXIT_FAILURE'.
+	 */
+	SmallBinaryFieldPolynomial ProtectedMinutiaeTemplate::toVaultPolynomial(const uint8_t *data) const
+	{
+
+		int t, d;
+		t = this->t;
+		d = this->gfPtr->getDegree();
+
+		uint32_t *coeffs = (uint32_t *)malloc(t * sizeof(uint32_t));
+		if (coeffs == NULL)
+		{
+			cerr << "ProtectedMinutiaeTemplate::toVaultPolynomial: "
+				 << "out of memory." << endl;
+			exit(EXIT_FAILURE);
+		}
+
 		// Unpack decrypted data into coefficient vector
 		split_into_bit_vectors(coeffs, data, t, d);
 
@@ -1895,7 +2136,6 @@ namespace thimble
 			V.setCoeff(j, coeffs[j]);
 		}
 
-		free(data);
 		free(coeffs);
 
 		return V;
@@ -1934,13 +2174,15 @@ namespace thimble
 
 	/**
 	 * @brief
-	 *             Access the SHA-1 hash value of the secret key
+	 *             Access the hash value of the secret key
 	 *             generated on enrollment used to obfuscate the
 	 *             correct minutiae template's quantization.
 	 *
 	 * @return
-	 *             The SHA-1 hash value of the secret key used to
-	 *             obfuscate the correct minutiae template's quantization.
+	 *             The hash value of the secret key used to obfuscate
+	 *             the correct minutiae template's quantization; its
+	 *             size is <code>Hash::getDigestSize(getHashAlgorithm())</code>
+	 *             bytes, i.e., 20 bytes for the default SHA-1.
 	 *
 	 * @warning
 	 *             If \link isEnrolled()\endlink returns
@@ -1962,6 +2204,19 @@ namespace thimble
 		return this->hash;
 	}
 
+	/**
+	 * @brief
+	 *             Access the hash function by which the secret key is
+	 *             verified.
+	 *
+	 * @return
+	 *             The hash function of this protected minutiae template.
+	 */
+	HASH_ALGORITHM_T ProtectedMinutiaeTemplate::getHashAlgorithm() const
+	{
+		return this->hashAlgorithm;
+	}
+
 	/**
 	 * @brief
 	 *             Change the dimension of the fingerprint images
@@ -2344,6 +2599,42 @@ namespace thimble
 		this->slowDownFactor = slowDownFactor;
 	}
 
+	/**
+	 * @brief
+	 *            Specifies the hash function by which the secret key
+	 *            is verified and from which the keys of the slow-down
+	 *            mechanism are derived.
+	 *
+	 * @param algorithm
+	 *            The hash function.
+	 *
+	 * @warning
+	 *            If this protected minutiae template object already
+	 *            contains protected data, i.e.,
+	 *            if \link isEnrolled()\endlink returns <code>true</code>,
+	 *            an error message will be printed to <code>stderr</code>
+	 *            and the program exits with status 'EXIT_FAILURE'.
+	 */
+	void ProtectedMinutiaeTemplate::setHashAlgorithm(HASH_ALGORITHM_T algorithm)
+	{
+
+		if (!Hash::isValid(algorithm))
+		{
+			cerr << "ProtectedMinutiaeTemplate::setHashAlgorithm: "
+				 << "unknown hash function." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		if (isEnrolled())
+		{
+			cerr << "ProtectedMinutiaeTemplate::setHashAlgorithm: "
+				 << "parameter must be specified before enrolment." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		this->hashAlgorithm = algorithm;
+	}
+
 	/**
 	 * @brief
 	 *             Clears all data that is related with a minutiae
@@ -2371,8 +2662,8 @@ namespace thimble
 		this->vaultPolynomialData = NULL;
 		this->encryptedVaultPolynomialData = NULL;
 
-		// zero 160 bit hash value
-		memset(this->hash, 0, 20);
+		// zero hash value
+		memset(this->hash, 0, Hash::MAX_DIGEST_SIZE);
 
 		// There is no count for the non-leading coefficients
 		// in the vault polynomial thus set to -1.
@@ -2406,6 +2697,10 @@ namespace thimble
 		int size = 0;
 
 		size += 10;										   // size for the header
+		if (this->hashAlgorithm != HASH_SHA1)
+		{
+			size += 1; // size to encode 'hashAlgorithm'
+		}
 		size += 2;										   // size to encode 'width'
 		size += 2;										   // size to encode 'height'
 		size += 1;										   // size to encode 'fingerPosition'
@@ -2420,7 +2715,7 @@ namespace thimble
 		size += 1;										   // size to encode whether vault is encrypted or not
 		size += 4 + this->slowDownFactor.getSizeInBytes(); // size to encode the slow-down factor
 		size += vaultDataSize();						   // size to encoded vault data.
-		size += 20;										   // size to encode hash value of secret polynomial
+		size += Hash::getDigestSize(this->hashAlgorithm);  // size to encode hash value of secret polynomial
 
 		return size;
 	}
@@ -2461,9 +2756,21 @@ namespace thimble
 
 		uint32_t tmp;
 
-		memcpy(data, "PMT140818", 10);
-
-		offset = 10;
+		// Templates protected with SHA-1 are written in the original
+		// format; otherwise, a newer format version is written that
+		// records the hash function after the header.
+		if (this->hashAlgorithm == HASH_SHA1)
+		{
+			memcpy(data, "PMT140818", 10);
+			offset = 10;
+		}
+		else
+		{
+			memcpy(data, "PMT261017", 10);
+			offset = 10;
+			data[offset] = (uint8_t)(this->hashAlgorithm);
+			offset += 1;
+		}
 
 		// Write 'width'
 		tmp = (uint32_t)(this->width);
@@ -2569,8 +2876,9 @@ namespace thimble
 		offset += n;
 
 		// Write seed of secret polynomial
-		memcpy(data + offset, this->hash, 20);
-		offset += 20;
+		int digestSize = Hash::getDigestSize(this->hashAlgorithm);
+		memcpy(data + offset, this->hash, digestSize);
+		offset += digestSize;
 
 		return offset;
 	}
@@ -2637,6 +2945,21 @@ namespace thimble
 
 		offset += 10;
 
+		// The newer format version records the hash function
+		if (memcmp(data, "PMT261017", 10) == 0)
+		{
+			if (size < offset + 1)
+			{
+				return -1;
+			}
+			if (!Hash::isValid(data[offset]))
+			{
+				return -1;
+			}
+			tmp.hashAlgorithm = (HASH_ALGORITHM_T)data[offset];
+			offset += 1;
+		}
+
 		// Read and check 'width'
 		if (size < offset + 2)
 		{
@@ -2853,12 +3176,13 @@ namespace thimble
 		offset += n + 1;
 
 		// Read 'hash'
-		if (size < offset + 20)
+		int digestSize = Hash::getDigestSize(tmp.hashAlgorithm);
+		if (size < offset + digestSize)
 		{
 			return -1;
 		}
-		memcpy(tmp.hash, data + offset, 20);
-		offset += 20;
+		memcpy(tmp.hash, data + offset, digestSize);
+		offset += digestSize;
 
 		tmp.updatePermutation();
 
@@ -3033,6 +3357,21 @@ namespace thimble
 					return -1;
 				}
 			}
+
+			// The newer format version records the hash function
+			if (memcmp(header, "PMT261017", 10) == 0)
+			{
+				if ((c = fgetc(in)) < 0)
+				{
+					return -1;
+				}
+				if (!Hash::isValid(c))
+				{
+					return -1;
+				}
+				tmp.hashAlgorithm = (HASH_ALGORITHM_T)c;
+				offset += 1;
+			}
 		}
 
 		offset += 10;
@@ -3328,11 +3667,12 @@ namespace thimble
 		// *******************************************************************
 
 		// Read 'hash'
-		if (fread(tmp.hash, 1, 20, in) != 20)
+		int digestSize = Hash::getDigestSize(tmp.hashAlgorithm);
+		if (fread(tmp.hash, 1, digestSize, in) != (size_t)digestSize)
 		{
 			return -1;
 		}
-		offset += 20;
+		offset += digestSize;
 
 		tmp.updatePermutation();
 
@@ -3409,23 +3749,62 @@ namespace thimble
 	int ProtectedMinutiaeTemplate::overlap(const uint32_t *array1, int t1, const uint32_t *array2, int t2)
 	{
 
+		if (t1 <= 0 || t2 <= 0)
+		{
+			return 0;
+		}
+
+		// Sort copies of both arrays such that common elements can be
+		// counted by a single merge pass.
+		uint32_t *a = (uint32_t *)malloc((t1 + t2) * sizeof(uint32_t));
+		if (a == NULL)
+		{
+			cerr << "ProtectedMinutiaeTemplate::overlap: "
+				 << "out of memory." << endl;
+			exit(EXIT_FAILURE);
+		}
+		uint32_t *b = a + t1;
+
+		memcpy(a, array1, t1 * sizeof(uint32_t));
+		memcpy(b, array2, t2 * sizeof(uint32_t));
+		sort(a, a + t1);
+		sort(b, b + t2);
+
 		// Counts the number of common elements
 		int omega = 0;
 
-		// Iterate over all pairs
-		for (int i = 0; i < t1; i++)
+		int i = 0, j = 0;
+		while (i < t1 && j < t2)
 		{
-			for (int j = 0; j < t2; j++)
+			if (a[i] < b[j])
 			{
-
-				// Increment in case the two elements are equal
-				if (array1[i] == array2[j])
+				++i;
+			}
+			else if (a[i] > b[j])
+			{
+				++j;
+			}
+			else
+			{
+				// Every pair of equal elements counts; thus, the
+				// multiplicities of an element in both arrays are
+				// multiplied.
+				uint32_t c = a[i];
+				int m1 = 0, m2 = 0;
+				for (; i < t1 && a[i] == c; i++)
+				{
+					++m1;
+				}
+				for (; j < t2 && b[j] == c; j++)
 				{
-					++omega;
+					++m2;
 				}
+				omega += m1 * m2;
 			}
 		}
 
+		free(a);
+
 		return omega;
 	}
 
@@ -3457,8 +3836,9 @@ namespace thimble
 		this->vaultPolynomialData = NULL;
 		this->slowDownFactor = BigInteger(1);
 		this->encryptedVaultPolynomialData = NULL;
+		this->hashAlgorithm = HASH_SHA1;
 
-		memset(this->hash, 0, 20);
+		memset(this->hash, 0, Hash::MAX_DIGEST_SIZE);
 
 		updateGrid();
 		updateField();
@@ -3786,7 +4166,7 @@ namespace thimble
 		slowDownVal.random(this->slowDownFactor, true);
 
 		// Derive AES key from slow-down value.
-		AES128 aes = deriveKey(slowDownVal);
+		AES128 aes = deriveKey(slowDownVal, this->hashAlgorithm);
 
 		int t, d, n;
 		t = this->t;
@@ -3880,6 +4260,10 @@ namespace thimble
 	 *            The integer of which an AES key is computed with
 	 *            this function.
 	 *
+	 * @param algorithm
+	 *            The hash function of which the first 16 bytes of the
+	 *            hash value of <code>x</code> form the key.
+	 *
 	 * @return
 	 *            The AES key derived from <code>x</code>.
 	 *
@@ -3888,7 +4272,7 @@ namespace thimble
 	 *             is printed <code>stderr</code> and the program exits
 	 *             with status 'EXIT_FAILURE'
 	 */
-	AES128 ProtectedMinutiaeTemplate::deriveKey(const BigInteger &x)
+	AES128 ProtectedMinutiaeTemplate::deriveKey(const BigInteger &x, HASH_ALGORITHM_T algorithm)
 	{
 
 		uint8_t *array = (uint8_t *)malloc(x.getSizeInBytes());
@@ -3900,8 +4284,8 @@ namespace thimble
 		}
 
 		x.toBytes(array);
-		uint8_t hash[20];
-		SHA().hash(hash, array, x.getSizeInBytes());
+		uint8_t hash[Hash::MAX_DIGEST_SIZE];
+		Hash(algorithm).hash(hash, array, x.getSizeInBytes());
 
 		AES128 aes(hash);
 
@@ -3910,6 +4294,54 @@ namespace thimble
 		return aes;
 	}
 
+	/**
+	 * @brief
+	 *            Derives an AES key from the specified unsigned
+	 *            64-bit integer.
+	 *
+	 * @details
+	 *            The key agrees with the key returned
+	 *            by \link deriveKey(const BigInteger&,HASH_ALGORITHM_T)\endlink
+	 *            for the same integer, i.e., the hashed bytes are
+	 *            the same as written by
+	 *            \link BigInteger::toBytes()\endlink; but these are
+	 *            written to a stack buffer without creating a
+	 *            \link BigInteger\endlink.
+	 *
+	 * @param x
+	 *            The integer of which an AES key is computed with
+	 *            this function.
+	 *
+	 * @param algorithm
+	 *            The hash function of which the first 16 bytes of the
+	 *            hash value of <code>x</code> form the key.
+	 *
+	 * @return
+	 *            The AES key derived from <code>x</code>.
+	 */
+	AES128 ProtectedMinutiaeTemplate::deriveKey(uint64_t x, HASH_ALGORITHM_T algorithm)
+	{
+
+		// Same layout as 'BigInteger::toBytes': little endian bytes
+		// followed by at least one bit for the (positive) sign
+		uint8_t array[9];
+		int size = 0;
+		do
+		{
+			array[size++] = (uint8_t)(x & 0xFF);
+			x >>= 8;
+		} while (x != 0);
+		if (array[size - 1] & 0x80)
+		{
+			array[size++] = 0;
+		}
+
+		uint8_t hash[Hash::MAX_DIGEST_SIZE];
+		Hash(algorithm).hash(hash, array, size);
+
+		return AES128(hash);
+	}
+
 	/**
 	 * @brief
 	 *           Store the concatenation of a sequence of <i>d</i>-bit
@@ -65,6 +65,28 @@ namespace thimble {
 		 SmallBinaryFieldPolynomial g1(f.getField());
 		 g1.interpolate(x,y,n);
 
+		 return gaodecode(f,g0,g1,n,k);
+	}
+
+	/**
+	 * @brief
+	 *            Attempts to decode a (possibly perturbed
+	 *            Reed-Solomon code <i>in original view</i> given by its
+	 *            code locator and interpolating polynomial.
+	 *
+	 * @details
+	 *            see 'ReedSolomonCode.h'
+	 */
+	bool ReedSolomonCode::gaodecode
+	( SmallBinaryFieldPolynomial & f ,
+	  const SmallBinaryFieldPolynomial & g0 ,
+	  const SmallBinaryFieldPolynomial & g1 , int n , int k ) {
+
+		if ( n <= 0 || k <= 0 || k > n ) {
+			cerr << "ReedSolomonCode::gaodecode: Bad arguments." << endl;
+			exit(EXIT_FAILURE);
+		}
+
 		 SmallBinaryFieldPolynomial
 		 	 g(f.getField()) ,
 		 	 u(f.getField()) ,
@@ -0,0 +1,240 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file RevolvingDoorIterator.cpp
+ *
+ * @brief
+ *            Implements functionalities provided by
+ *            'RevolvingDoorIterator.h' which provides a mechanism for
+ *            iterating through all choices of <i>k</i> elements from a
+ *            vector of size <i>n</i> in revolving-door order.
+ *
+ * @author agent
+ */
+
+#include <stdint.h>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <thimble/math/RevolvingDoorIterator.h>
+
+using namespace std;
+
+namespace thimble {
+
+	/*
+	 * see 'RevolvingDoorIterator.h' for the documentation.
+	 */
+	RevolvingDoorIterator::RevolvingDoorIterator( int n , int k ) {
+
+		// Check if arguments are reasonable.
+		if ( n < 0 || k < 0 || n < k ) {
+			cerr << "RevolvingDoorIterator: Bad arguments." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		this->n = n;
+		this->k = k;
+
+		this->indices = (int*)malloc( (k+2) * sizeof(int) );
+		this->binomials = (uint64_t*)malloc
+				( (size_t)(n+1) * (size_t)(k+1) * sizeof(uint64_t) );
+		if ( this->indices == NULL || this->binomials == NULL ) {
+			cerr << "RevolvingDoorIterator: Out of memory." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		// Pascal's triangle restricted to 'i<=k' where entries that
+		// cannot be represented by 64 bits saturate at 'UINT64_MAX'
+		uint64_t *C = this->binomials;
+		for ( int x = 0 ; x <= n ; x++ ) {
+			C[x*(k+1)] = 1;
+			for ( int i = 1 ; i <= k ; i++ ) {
+				if ( x == 0 ) {
+					C[i] = 0;
+				} else {
+					uint64_t a = C[(x-1)*(k+1)+i-1];
+					uint64_t b = C[(x-1)*(k+1)+i];
+					C[x*(k+1)+i] = a + b < a ? UINT64_MAX : a + b;
+				}
+			}
+		}
+		this->count = C[n*(k+1)+k];
+
+		unrank(0);
+	}
+
+	/*
+	 * see 'RevolvingDoorIterator.h' for the documentation.
+	 */
+	RevolvingDoorIterator::RevolvingDoorIterator
+	( const RevolvingDoorIterator & it ) {
+
+		this->n = 0;
+		this->k = 0;
+		this->indices = NULL;
+		this->binomials = NULL;
+
+		*this = it;
+	}
+
+	/*
+	 * see 'RevolvingDoorIterator.h' for the documentation.
+	 */
+	RevolvingDoorIterator::~RevolvingDoorIterator() {
+		free(this->indices);
+		free(this->binomials);
+	}
+
+	/*
+	 * see 'RevolvingDoorIterator.h' for the documentation.
+	 */
+	RevolvingDoorIterator &RevolvingDoorIterator::operator=
+	( const RevolvingDoorIterator & it ) {
+
+		if ( this != &it ) {
+
+			size_t numBinomials = (size_t)(it.n+1) * (size_t)(it.k+1);
+
+			int *indices = (int*)realloc(this->indices,(it.k+2)*sizeof(int));
+			uint64_t *binomials = (uint64_t*)realloc
+					(this->binomials,numBinomials*sizeof(uint64_t));
+			if ( indices == NULL || binomials == NULL ) {
+				cerr << "RevolvingDoorIterator: Out of memory." << endl;
+				exit(EXIT_FAILURE);
+			}
+
+			memcpy(indices,it.indices,(it.k+2)*sizeof(int));
+			memcpy(binomials,it.binomials,numBinomials*sizeof(uint64_t));
+
+			this->n = it.n;
+			this->k = it.k;
+			this->indices = indices;
+			this->binomials = binomials;
+			this->rank = it.rank;
+			this->count = it.count;
+			this->removed = it.removed;
+			this->added = it.added;
+		}
+
+		return *this;
+	}
+
+	/*
+	 * see 'RevolvingDoorIterator.h' for the documentation.
+	 */
+	bool RevolvingDoorIterator::next() {
+
+		if ( this->rank + 1 >= this->count ) {
+			return false;
+		}
+
+		int k = this->k;
+		int *t = this->indices;
+
+		// Successor in revolving-door order (Kreher and Stinson,
+		// Algorithm 2.13) where, in contrast to the original
+		// formulation, the chosen values are counted from 0; 't[0]'
+		// as well as 't[k+1]' are auxiliary.
+		t[k+1] = this->n;
+
+		int j = 1;
+		while ( j <= k && t[j] == j-1 ) {
+			j++;
+		}
+
+		if ( (k - j) % 2 != 0 ) {
+			if ( j == 1 ) {
+				this->removed = t[1];
+				t[1]--;
+				this->added = t[1];
+			} else {
+				this->removed = j > 2 ? j-3 : 0;
+				this->added = j-1;
+				t[j-1] = j-1;
+				t[j-2] = j-2;
+			}
+		} else {
+			if ( t[j+1] != t[j] + 1 ) {
+				this->removed = j > 1 ? j-2 : t[1];
+				this->added = t[j] + 1;
+				t[j-1] = t[j];
+				t[j]++;
+			} else {
+				this->removed = t[j+1];
+				this->added = j-1;
+				t[j+1] = t[j];
+				t[j] = j-1;
+			}
+		}
+
+		this->rank++;
+
+		return true;
+	}
+
+	/*
+	 * see 'RevolvingDoorIterator.h' for the documentation.
+	 */
+	bool RevolvingDoorIterator::unrank( uint64_t rank ) {
+
+		if ( rank >= this->count ) {
+			cerr << "RevolvingDoorIterator::unrank: Rank out of range."
+				 << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		int k = this->k;
+		const uint64_t *C = this->binomials;
+		int *t = this->indices;
+
+		// Kreher and Stinson, Algorithm 2.12; if the number of choices
+		// fits in 64 bits, the coefficients 'C(x+1,i)' are bounded by
+		// it and, hence, never saturated. Otherwise, the choice is only
+		// determined if none of them is saturated, which is checked
+		// before the state is modified.
+		for ( int pass = 0 ; pass < 2 ; pass++ ) {
+			uint64_t r = rank;
+			int x = this->n;
+			for ( int i = k ; i >= 1 ; i-- ) {
+				while ( C[x*(k+1)+i] > r ) {
+					x--;
+				}
+				if ( C[(x+1)*(k+1)+i] == UINT64_MAX ) {
+					return false;
+				}
+				if ( pass == 1 ) {
+					t[i] = x;
+				}
+				r = C[(x+1)*(k+1)+i] - r - 1;
+			}
+		}
+
+		t[0] = -1;
+		t[k+1] = this->n;
+		this->rank = rank;
+		this->removed = -1;
+		this->added = -1;
+
+		return true;
+	}
+}
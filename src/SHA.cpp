@@ -31,12 +31,17 @@
  *
  * @author Benjamin Tams
  */
+#include "config.h"
 #include <stdint.h>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+#include <immintrin.h>
+#endif
 
+#include <thimble/math/MathTools.h>
 #include <thimble/security/SHA.h>
 
 using namespace std;
@@ -48,336 +53,672 @@ namespace thimble {
 
     /**
      * @brief
-     *            Standard constructor.
+     *            Initial hash value (see Section 5.3.1 in FIPS 180-2).
      */
-    SHA::SHA() {
-        this->buffer = NULL;
-        this->L = 0;
-        this->size = 0;
+    static const uint32_t _SHA1_IV[5] =
+        { 0x67452301 , 0xEFCDAB89 , 0x98BADCFE , 0x10325476 , 0xC3D2E1F0 };
+
+    /**
+     * @brief
+     *            Circular left shift operation.
+     *
+     * @details
+     *            The operation is defined as
+     *            \f$rotl^n(x)=(x << n) or (x >> (w - n))\$f where
+     *            \f$w\f$ denotes the width of the integer \f$x\f$, i.e.
+     *            (32 bits in our case) and << and >> denote the binary left
+     *            shift and right shift operation, respectively.
+     *
+     * @param x
+     *            The integer that is shifted.
+     *
+     * @param n
+     *            The number of of bits to be shifted.
+     *
+     * @return
+     *            The circular left shift of the 32-bit integer <code>x</code>
+     *            by <code>n</code> bits.
+     */
+    inline static uint32_t rotl32( uint32_t x , int n ) {
+        return (x << n) | (x >> (32 - n));
     }
 
     /**
      * @brief
-     *            Destructor.
+     *            Interprets four bytes as a big-endian 32-bit integer.
      */
-    SHA::~SHA() {
-        free(this->buffer);
+    inline static uint32_t load32be( const uint8_t *p ) {
+        return (((uint32_t)p[0])<<24) | (((uint32_t)p[1])<<16) |
+               (((uint32_t)p[2])<<8)  |  ((uint32_t)p[3]);
+    }
+
+    /**
+     * @brief
+     *            Writes a 32-bit integer as four big-endian bytes.
+     */
+    inline static void store32be( uint8_t *p , uint32_t x ) {
+        p[0] = (uint8_t)(x>>24);
+        p[1] = (uint8_t)(x>>16);
+        p[2] = (uint8_t)(x>>8);
+        p[3] = (uint8_t)x;
     }
 
     /**
      * @brief
-     *            Ensures that this %SHA object can buffer a message of
-     *            specified bit length.
+     *            Updates an intermediate hash value by the 16 words of
+     *            one message block (Section 6.1.2 in FIPS 180-2).
      *
-     * @details
-     *            The value \link L\endlink will be updated indicating
-     *            the number of bytes that the
-     *            array \link buffer\endlink must be able to store in
-     *            order to hash a message of the specified bit length.
-     *            If needed, the array \link buffer\endlink will be
-     *            reallocated in which case the
-     *            integer \link size\endlink is increased.
-     *
-     * @param l
-     *            The number of bits of a message that this %SHA object
-     *            must be able to hash.
+     * @param H
+     *            The intermediate hash value that is updated.
      *
-     * @warning
-     *            If not enough memory could be provided, an error
-     *            message is printed to <code>stderr</code> and the
-     *            program exits with status 'EXIT_FAILURE'.
+     * @param M
+     *            The 16 words of the message block.
+     */
+    static void compressBlock( uint32_t H[5] , const uint32_t M[16] ) {
+
+        uint32_t W[80];
+        uint32_t a , b , c , d , e , f , T;
+
+        // Step 1. Prepare the message schedule
+        memcpy(W,M,16*sizeof(uint32_t));
+        for ( int i = 16 ; i < 80 ; i++ ) {
+            W[i] = rotl32( W[i-3] ^ W[i-8] ^ W[i-14] ^ W[i-16] , 1 );
+        }
+
+        // Step 2. Initialize the five working variables with the
+        // the (i-1)-st hash value
+        a = H[0];
+        b = H[1];
+        c = H[2];
+        d = H[3];
+        e = H[4];
+
+        // Step 3. The rounds are split into their four stages to avoid
+        // selecting the round function and constant in every round.
+        for ( int t = 0 ; t < 20 ; t++ ) {
+            f = (b&c) ^ ((~b)&d);
+            T = rotl32(a,5) + f + e + 0x5A827999 + W[t];
+            e = d; d = c; c = rotl32(b,30); b = a; a = T;
+        }
+        for ( int t = 20 ; t < 40 ; t++ ) {
+            f = b ^ c ^ d;
+            T = rotl32(a,5) + f + e + 0x6ED9EBA1 + W[t];
+            e = d; d = c; c = rotl32(b,30); b = a; a = T;
+        }
+        for ( int t = 40 ; t < 60 ; t++ ) {
+            f = (b&c) ^ (b&d) ^ (c&d);
+            T = rotl32(a,5) + f + e + 0x8F1BBCDC + W[t];
+            e = d; d = c; c = rotl32(b,30); b = a; a = T;
+        }
+        for ( int t = 60 ; t < 80 ; t++ ) {
+            f = b ^ c ^ d;
+            T = rotl32(a,5) + f + e + 0xCA62C1D6 + W[t];
+            e = d; d = c; c = rotl32(b,30); b = a; a = T;
+        }
+
+        // Step 4. Compute the i-th intermediate hash value
+        H[0] += a;
+        H[1] += b;
+        H[2] += c;
+        H[3] += d;
+        H[4] += e;
+    }
+
+    /**
+     * @brief
+     *            Portable implementation of \link compress()\endlink.
+     */
+    static void compressGeneric
+    ( uint32_t H[5] , const uint8_t *blocks , uint64_t numBlocks ) {
+
+        uint32_t M[16];
+
+        for ( uint64_t j = 0 ; j < numBlocks ; j++ , blocks += 64 ) {
+            for ( int i = 0 ; i < 16 ; i++ ) {
+                M[i] = load32be(blocks+4*i);
+            }
+            compressBlock(H,M);
+        }
+    }
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+    /**
+     * @brief
+     *            Performs four rounds of SHA-1 with the 'SHA' extensions.
+     *
+     * @details
+     *            The template parameter <code>G</code> denotes the group
+     *            of rounds <code>4G,...,4G+3</code>. The message schedule
+     *            for the subsequent groups is advanced in the four
+     *            registers <code>m[0],...,m[3]</code> in parallel.
      */
-    void SHA::prepareMessageBits( uint64_t l ) {
-
-        // The message will be padded by '100...0' where the number of zeros
-        // is equals 'k' which is the smallest non-negative solution to
-        // the equation 'l+k+1=448 mod 512'
-        uint64_t k;
-        if ( (l+1)%512 <= 448 ) {
-            k = 448-(l+1)%512;
+    template<int G>
+    __attribute__((target("sha,sse4.1")))
+    inline static void sha1RoundsNi
+    ( __m128i & abcd , __m128i & e0 , __m128i & e1 , __m128i m[4] ) {
+
+        __m128i & e    = (G%2 == 0) ? e0 : e1;
+        __m128i & next = (G%2 == 0) ? e1 : e0;
+
+        if ( G == 0 ) {
+            e = _mm_add_epi32(e,m[0]);
         } else {
-            k = 448+(512-(l+1)%512);
+            e = _mm_sha1nexte_epu32(e,m[G%4]);
+        }
+        next = abcd;
+        if ( G >= 3 && G <= 18 ) {
+            m[(G+1)%4] = _mm_sha1msg2_epu32(m[(G+1)%4],m[G%4]);
+        }
+        abcd = _mm_sha1rnds4_epu32(abcd,e,G/5);
+        if ( G >= 1 && G <= 16 ) {
+            m[(G+3)%4] = _mm_sha1msg1_epu32(m[(G+3)%4],m[G%4]);
         }
+        if ( G >= 2 && G <= 17 ) {
+            m[(G+2)%4] = _mm_xor_si128(m[(G+2)%4],m[G%4]);
+        }
+    }
+
+    /**
+     * @brief
+     *            Implementation of \link compress()\endlink using the
+     *            'SHA' extensions.
+     */
+    __attribute__((target("sha,sse4.1")))
+    static void compressShaNi
+    ( uint32_t H[5] , const uint8_t *blocks , uint64_t numBlocks ) {
+
+        const __m128i bswap =
+            _mm_set_epi64x(0x0001020304050607LL,0x08090A0B0C0D0E0FLL);
+
+        __m128i abcd = _mm_shuffle_epi32
+            (_mm_loadu_si128((const __m128i*)H),0x1B);
+        __m128i e0 = _mm_set_epi32((int)H[4],0,0,0);
+        __m128i e1;
+        __m128i m[4];
 
-        // The padded message's length will be 'l+k+1+64'. Thus, the number
-        // of blocks that are processed is 'N=(l+k+1+64)/512'.
-        uint64_t N = (l+k+1+64)/512;
-
-        // Check whether the buffer for the padded message has to be reallocated
-        if ( (size_t)(N*64) > size ) {
-            size = (size_t)(N*64);
-            if ( buffer == NULL )
-                buffer =
-                   (uint32_t*)malloc( size * sizeof(uint8_t) );
-            else
-                buffer =
-                   (uint32_t*)realloc( buffer , size * sizeof(uint8_t) );
-            if ( buffer == NULL ) {
-                cerr << __FILE__ << "(" << __LINE__ << "): out of memory."
-                        << endl;
-                exit(EXIT_FAILURE);
+        for ( uint64_t j = 0 ; j < numBlocks ; j++ , blocks += 64 ) {
+
+            __m128i abcdSave = abcd;
+            __m128i eSave = e0;
+
+            for ( int i = 0 ; i < 4 ; i++ ) {
+                m[i] = _mm_shuffle_epi8
+                    (_mm_loadu_si128((const __m128i*)(blocks+16*i)),bswap);
             }
+
+            sha1RoundsNi<0> (abcd,e0,e1,m);
+            sha1RoundsNi<1> (abcd,e0,e1,m);
+            sha1RoundsNi<2> (abcd,e0,e1,m);
+            sha1RoundsNi<3> (abcd,e0,e1,m);
+            sha1RoundsNi<4> (abcd,e0,e1,m);
+            sha1RoundsNi<5> (abcd,e0,e1,m);
+            sha1RoundsNi<6> (abcd,e0,e1,m);
+            sha1RoundsNi<7> (abcd,e0,e1,m);
+            sha1RoundsNi<8> (abcd,e0,e1,m);
+            sha1RoundsNi<9> (abcd,e0,e1,m);
+            sha1RoundsNi<10>(abcd,e0,e1,m);
+            sha1RoundsNi<11>(abcd,e0,e1,m);
+            sha1RoundsNi<12>(abcd,e0,e1,m);
+            sha1RoundsNi<13>(abcd,e0,e1,m);
+            sha1RoundsNi<14>(abcd,e0,e1,m);
+            sha1RoundsNi<15>(abcd,e0,e1,m);
+            sha1RoundsNi<16>(abcd,e0,e1,m);
+            sha1RoundsNi<17>(abcd,e0,e1,m);
+            sha1RoundsNi<18>(abcd,e0,e1,m);
+            sha1RoundsNi<19>(abcd,e0,e1,m);
+
+            e0 = _mm_sha1nexte_epu32(e0,eSave);
+            abcd = _mm_add_epi32(abcd,abcdSave);
         }
 
-        this->L = N * 16;
+        _mm_storeu_si128((__m128i*)H,_mm_shuffle_epi32(abcd,0x1B));
+        H[4] = (uint32_t)_mm_extract_epi32(e0,3);
+    }
+
+    /**
+     * @brief
+     *            Circular left shift of eight 32-bit integers.
+     */
+    template<int N>
+    __attribute__((target("avx2")))
+    inline static __m256i rotl32x8( __m256i x ) {
+        return _mm256_or_si256(_mm256_slli_epi32(x,N),_mm256_srli_epi32(x,32-N));
     }
 
     /**
      * @brief
-     *            Copies message of bytes to \link buffer\endlink, appends
-     *            the bit 1 to the buffer and pads the bit sequence by
-     *            0 bits until the bit-length of the buffered message
-     *            becomes a multiple of 512.
+     *            Updates eight intermediate hash values simultaneously
+     *            by one message block each using the 'AVX2' instructions.
+     *
+     * @param S
+     *            The intermediate hash values where <code>S[i][l]</code>
+     *            denotes the <code>i</code>th word of the
+     *            <code>l</code>th hash value.
+     *
+     * @param M
+     *            The message blocks where <code>M[i][l]</code>
+     *            denotes the <code>i</code>th word of the
+     *            <code>l</code>th block.
+     *
+     * @param mask
+     *            Only the hash values with <code>mask[l]</code> being
+     *            non-zero are updated.
+     */
+    __attribute__((target("avx2")))
+    static void compressAvx2
+    ( uint32_t S[5][8] , const uint32_t M[16][8] , const int32_t mask[8] ) {
+
+        __m256i W[16];
+        for ( int i = 0 ; i < 16 ; i++ ) {
+            W[i] = _mm256_loadu_si256((const __m256i*)M[i]);
+        }
+
+        __m256i H[5];
+        for ( int i = 0 ; i < 5 ; i++ ) {
+            H[i] = _mm256_loadu_si256((const __m256i*)S[i]);
+        }
+
+        __m256i a = H[0] , b = H[1] , c = H[2] , d = H[3] , e = H[4];
+        __m256i f , K , T;
+
+        for ( int t = 0 ; t < 80 ; t++ ) {
+
+            if ( t >= 16 ) {
+                W[t&15] = rotl32x8<1>
+                    (_mm256_xor_si256
+                        (_mm256_xor_si256(W[(t-3)&15],W[(t-8)&15]),
+                         _mm256_xor_si256(W[(t-14)&15],W[t&15])));
+            }
+
+            if ( t < 20 ) {
+                f = _mm256_xor_si256
+                    (_mm256_and_si256(b,c),_mm256_andnot_si256(b,d));
+                K = _mm256_set1_epi32(0x5A827999);
+            } else if ( t < 40 ) {
+                f = _mm256_xor_si256(_mm256_xor_si256(b,c),d);
+                K = _mm256_set1_epi32(0x6ED9EBA1);
+            } else if ( t < 60 ) {
+                f = _mm256_or_si256
+                    (_mm256_and_si256(b,c),
+                     _mm256_and_si256(d,_mm256_or_si256(b,c)));
+                K = _mm256_set1_epi32((int)0x8F1BBCDC);
+            } else {
+                f = _mm256_xor_si256(_mm256_xor_si256(b,c),d);
+                K = _mm256_set1_epi32((int)0xCA62C1D6);
+            }
+
+            T = _mm256_add_epi32
+                (_mm256_add_epi32(rotl32x8<5>(a),f),
+                 _mm256_add_epi32(_mm256_add_epi32(e,K),W[t&15]));
+            e = d;
+            d = c;
+            c = rotl32x8<30>(b);
+            b = a;
+            a = T;
+        }
+
+        const __m256i sel = _mm256_loadu_si256((const __m256i*)mask);
+        const __m256i v[5] = { a , b , c , d , e };
+        for ( int i = 0 ; i < 5 ; i++ ) {
+            __m256i x = _mm256_add_epi32(H[i],v[i]);
+            _mm256_storeu_si256
+                ((__m256i*)S[i],_mm256_blendv_epi8(H[i],x,sel));
+        }
+    }
+#endif
+
+    /**
+     * @brief
+     *            Updates an intermediate hash value by consecutive
+     *            64-byte message blocks.
      *
      * @details
-     *            The value \link L\endlink will hold the number of
-     *            padded bytes stored in \link buffer\endlink.
+     *            If the processor supports the 'SHA' extensions, they
+     *            are used; otherwise, a portable implementation is used.
      *
-     * @param message
-     *            An array containing <code>n</code> 8-bit integers,
-     *            i.e., bytes, of type <code>uint8_t</code>.
+     * @param H
+     *            The intermediate hash value that is updated.
      *
-     * @param n
-     *            Number of bytes stored in <code>message</code>.
+     * @param blocks
+     *            Contains <code>64*numBlocks</code> message bytes.
      *
-     * @warning
-     *            If not enough memory could be provided, an error
-     *            message is printed to <code>stderr</code> and the
-     *            program exits with status 'EXIT_FAILURE'.
+     * @param numBlocks
+     *            The number of message blocks.
+     */
+    static void compress
+    ( uint32_t H[5] , const uint8_t *blocks , uint64_t numBlocks ) {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        if ( MathTools::hasSha() ) {
+            compressShaNi(H,blocks,numBlocks);
+            return;
+        }
+#endif
+        compressGeneric(H,blocks,numBlocks);
+    }
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+    /**
+     * @brief
+     *            Returns the number of 64-byte blocks of the padded
+     *            message of <code>numBytes</code> bytes.
+     */
+    inline static uint64_t numPaddedBlocks( uint64_t numBytes ) {
+        return (numBytes+8) / 64 + 1;
+    }
+
+    /**
+     * @brief
+     *            Extracts the words of the <code>b</code>th block of the
+     *            padded message of <code>n</code> bytes.
+     */
+    static void paddedBlock
+    ( uint32_t M[16] , const uint8_t *message , uint64_t n , uint64_t b ) {
+
+        uint64_t offset = 64*b;
+
+        if ( offset + 64 <= n ) {
+            for ( int i = 0 ; i < 16 ; i++ ) {
+                M[i] = load32be(message+offset+4*i);
+            }
+            return;
+        }
+
+        memset(M,0,16*sizeof(uint32_t));
+        for ( int i = 0 ; i < 64 ; i++ ) {
+            uint64_t pos = offset + i;
+            uint32_t byte;
+            if ( pos < n ) {
+                byte = message[pos];
+            } else if ( pos == n ) {
+                byte = 0x80;
+            } else {
+                break;
+            }
+            M[i/4] |= byte << (24-8*(i%4));
+        }
+
+        if ( b + 1 == numPaddedBlocks(n) ) {
+            M[14] = (uint32_t)((8*n)>>32);
+            M[15] = (uint32_t)(8*n);
+        }
+    }
+
+    /**
+     * @brief
+     *            Extracts the words of the <code>b</code>th block of the
+     *            padded message of <code>n</code> 32-bit integers.
+     */
+    static void paddedBlock
+    ( uint32_t M[16] , const uint32_t *message , uint64_t n , uint64_t b ) {
+
+        uint64_t offset = 16*b;
+
+        for ( int i = 0 ; i < 16 ; i++ ) {
+            uint64_t pos = offset + i;
+            if ( pos < n ) {
+                M[i] = message[pos];
+            } else if ( pos == n ) {
+                M[i] = ((uint32_t)1)<<31;
+            } else {
+                M[i] = 0;
+            }
+        }
+
+        if ( b + 1 == numPaddedBlocks(4*n) ) {
+            M[14] = (uint32_t)((32*n)>>32);
+            M[15] = (uint32_t)(32*n);
+        }
+    }
+#endif
+
+    /**
+     * @brief
+     *            Implementation of both \link SHA::hashBatch()\endlink
+     *            functions.
      *
-     * @warning
-     *            If <code>message</code> does not hold at least
-     *            <code>n</code> valid integers of type
-     *            <code>uint8_t</code>, the behavior of this
-     *            method is undocumented.
+     * @details
+     *            The messages are processed in groups of eight. Each
+     *            message block is transposed into a lane of the
+     *            'AVX2' kernel; lanes of shorter messages are masked
+     *            out once their last block has been processed.
      */
-    void SHA::padMessage( const uint8_t *message , uint64_t n ) {
+    template<typename T>
+    static void hashBatchImpl
+    ( uint32_t h[][5] , const T *const *messages ,
+      const uint64_t *n , int num , int bytesPerElement ) {
 
-        // Length of message in bits
-        uint64_t l = 8*n;
-
-        // Ensure that this SHA's buffer is large enough to hash
-        // a message of 'l' bits.
-        prepareMessageBits(l);
-
-        memset(this->buffer,0,(size_t)(L*sizeof(uint32_t)));
-
-        // Convert the message by intepreting the message's bytes as big-endian
-        // 32 bit words.
-        for ( uint64_t i = 0 , k = 0 ; i < n ; i += 4 , k++ ) {
-            this->buffer[k] = ((uint32_t)(message[i]))<<24;
-            if ( i+1 < n ) {
-                this->buffer[k] += ((uint32_t)(message[i+1]))<<16;
-                if ( i+2 < n ) {
-                    this->buffer[k] += ((uint32_t)(message[i+2]))<<8;
-                    if ( i+3 < n ) {
-                        this->buffer[k] += ((uint32_t)(message[i+3]));
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        if ( MathTools::hasAvx2() ) {
+
+            uint32_t S[5][8];
+            uint32_t M[16][8];
+            uint32_t block[16];
+            int32_t mask[8];
+            uint64_t numBlocks[8];
+
+            for ( int l0 = 0 ; l0 < num ; l0 += 8 ) {
+
+                int lanes = num - l0 < 8 ? num - l0 : 8;
+
+                uint64_t maxBlocks = 0;
+                for ( int l = 0 ; l < lanes ; l++ ) {
+                    numBlocks[l] = numPaddedBlocks(bytesPerElement*n[l0+l]);
+                    if ( numBlocks[l] > maxBlocks ) {
+                        maxBlocks = numBlocks[l];
+                    }
+                }
+
+                for ( int i = 0 ; i < 5 ; i++ ) {
+                    for ( int l = 0 ; l < 8 ; l++ ) {
+                        S[i][l] = _SHA1_IV[i];
+                    }
+                }
+
+                for ( uint64_t b = 0 ; b < maxBlocks ; b++ ) {
+                    for ( int l = 0 ; l < 8 ; l++ ) {
+                        if ( l < lanes && b < numBlocks[l] ) {
+                            paddedBlock(block,messages[l0+l],n[l0+l],b);
+                            mask[l] = -1;
+                        } else {
+                            memset(block,0,16*sizeof(uint32_t));
+                            mask[l] = 0;
+                        }
+                        for ( int i = 0 ; i < 16 ; i++ ) {
+                            M[i][l] = block[i];
+                        }
+                    }
+                    compressAvx2(S,M,mask);
+                }
+
+                for ( int l = 0 ; l < lanes ; l++ ) {
+                    for ( int i = 0 ; i < 5 ; i++ ) {
+                        h[l0+l][i] = S[i][l];
                     }
                 }
             }
+            return;
         }
+#endif
 
-        // Append the bit '1' to the end of the message
-        if ( n%4 == 0 ) {
-            this->buffer[n/4] = ((uint32_t)1)<<31;
-        } else {
-            this->buffer[(n-1)/4] += ((uint32_t)1)<<(31-8*(n%4));
+        SHA sha;
+        for ( int l = 0 ; l < num ; l++ ) {
+            sha.hash(h[l],messages[l],n[l]);
         }
+    }
 
-        // Append the 64-bit block that is equal to the number 'l' expressed
-        // using a binary representation (see Section 5.1.1. in FIPS 180-2).
-        this->buffer[this->L-1] |= l&0xFFFFFFFF;
-        this->buffer[this->L-2] |= l>>32;
+    /**
+     * @brief
+     *            Standard constructor.
+     */
+    SHA::SHA() {
+        init();
+    }
+
+    /**
+     * @brief
+     *            Destructor.
+     */
+    SHA::~SHA() {
+        memset(this->block,0,64);
     }
 
     /**
      * @brief
-     *            Copies a message of 32-bit integers
-     *            to \link buffer\endlink, appends the bit 1 to the buffer
-     *            and pads the bit sequence by 0 bits until the bit-length
-     *            of the buffered message becomes a multiple of 512.
+     *            Resets this %SHA object such that a new message can
+     *            be hashed incrementally.
      *
      * @details
-     *            The value \link L\endlink will hold the number of
-     *            padded bytes stored in \link buffer\endlink.
+     *            After initialization, the message is passed in
+     *            arbitrary pieces to \link update()\endlink and the
+     *            hash value is obtained by \link final()\endlink.
+     *            No heap memory is used in this process.
+     */
+    void SHA::init() {
+        memcpy(this->H,_SHA1_IV,5*sizeof(uint32_t));
+        this->L = 0;
+    }
+
+    /**
+     * @brief
+     *            Appends bytes to the message being hashed.
      *
      * @param message
-     *            An array containing <code>n</code> 32-bit integers,
-     *            i.e., bytes, of type <code>uint8_t</code>.
+     *            Contains at least <code>n</code> valid bytes that
+     *            are appended to the message.
      *
      * @param n
-     *            Number of 32-bit integers stored in
-     *            <code>message</code>.
-     *
-     * @warning
-     *            If not enough memory could be provided, an error
-     *            message is printed to <code>stderr</code> and the
-     *            program exits with status 'EXIT_FAILURE'.
+     *            Number of valid bytes contained in <code>message</code>
      *
      * @warning
-     *            If <code>message</code> does not hold at least
-     *            <code>n</code> valid integers of type
-     *            <code>uint32_t</code>, the behavior of this
-     *            method is undocumented.
+     *            If <code>message</code> contains no <code>n</code> valid
+     *            bytes the method runs into undocumented behavior.
      */
-    void SHA::padMessage( const uint32_t *message , uint64_t n ) {
-
-        // Length of message in bits
-        uint64_t l = 32*n;
+    void SHA::update( const uint8_t *message , uint64_t n ) {
 
-        // Ensure that this SHA's buffer is large enough to hash
-        // a message of 'l' bits.
-        prepareMessageBits(l);
+        int r = (int)(this->L % 64);
+        this->L += n;
 
-        // Initialize the buffer and ...
-        memcpy(this->buffer,message,(size_t)(n*sizeof(uint32_t)));
-        // ... pad the message.
-        memset(this->buffer+n,0,(size_t)((L-n)*sizeof(uint32_t)));
+        // Complete a partially buffered block first
+        if ( r > 0 ) {
+            uint64_t c = 64 - r;
+            if ( n < c ) {
+                memcpy(this->block+r,message,(size_t)n);
+                return;
+            }
+            memcpy(this->block+r,message,(size_t)c);
+            compress(this->H,this->block,1);
+            message += c;
+            n -= c;
+        }
 
-        // Append the bit '1' to the end of the message
-        this->buffer[n] = ((uint32_t)1)<<31;
+        // Compress complete blocks directly from the message ...
+        compress(this->H,message,n/64);
 
-        // Append the 64-bit block that is equal to the number 'l' expressed
-        // using a binary representation (see Section 5.1.1. in FIPS 180-2).
-        this->buffer[this->L-1] |= l&0xFFFFFFFF;
-        this->buffer[this->L-2] |= l>>32;
+        // ... and buffer the remainder.
+        memcpy(this->block,message+(n/64)*64,(size_t)(n%64));
     }
 
     /**
      * @brief
-     *            Circular left shift operation.
+     *            Appends 32-bit integers to the message being hashed.
      *
      * @details
-     *            The operation is defined as
-     *            \f$rotl^n(x)=(x << n) or (x >> (w - n))\$f where
-     *            \f$w\f$ denotes the width of the integer \f$x\f$, i.e.
-     *            (32 bits in our case) and << and >> denote the binary left
-     *            shift and right shift operation, respectively.
+     *            Each integer contributes its four bytes in big-endian
+     *            order such that hashing the integers in one piece
+     *            yields the same value as
+     *            \link hash(uint32_t[5],const uint32_t*,uint64_t)
+     *            \endlink.
      *
-     * @param x
-     *            The integer that is shifted.
+     * @param message
+     *            Contains at least <code>n</code> valid integers of
+     *            type <code>uint32_t</code> that are appended to the
+     *            message.
      *
      * @param n
-     *            The number of of bits to be shifted.
+     *            Number of valid 32-bit integers contained in
+     *            <code>message</code>
      *
-     * @return
-     *            The circular left shift of the 32-bit integer <code>x</code>
-     *            by <code>n</code> bits.
+     * @warning
+     *            If <code>message</code> contains no <code>n</code> valid
+     *            integers the method runs into undocumented behavior.
      */
-    inline static uint32_t rotl32( register uint32_t x , int n ) {
-        return (x << n) | (x >> (32 - n));
+    void SHA::update( const uint32_t *message , uint64_t n ) {
+
+        uint8_t bytes[64];
+
+        while ( n > 0 ) {
+            int c = n < 16 ? (int)n : 16;
+            for ( int i = 0 ; i < c ; i++ ) {
+                store32be(bytes+4*i,message[i]);
+            }
+            update(bytes,4*c);
+            message += c;
+            n -= c;
+        }
     }
 
     /**
      * @brief
-     *            Computes the hash of the padded message stored by this
-     *            %SHA object and stores the result in the specified
-     *            output array.
+     *            Pads the message passed since the last call of
+     *            \link init()\endlink and outputs its SHA-1 hash
+     *            value.
+     *
+     * @details
+     *            Afterwards, this %SHA object is initialized again.
      *
      * @param h
-     *            An array that is capable to hold 5 integers of type
-     *            <code>uint32_t</code> to which the hash value
-     *            of the buffered message is stored.
+     *            Will contain the SHA-1 hash value of the message.
      */
-    void SHA::hash( uint32_t h[5] ) {
-
-        uint32_t H0 , H1 , H2 , H3 , H4 , a , b , c , d , e , f , K , T;
-
-        // Initial values (see Section 5.3.1 in FIPS 180-2)
-        H0 = 0x67452301;
-        H1 = 0xEFCDAB89;
-        H2 = 0x98BADCFE;
-        H3 = 0x10325476;
-        H4 = 0xC3D2E1F0;
-
-        // ******************************************************************
-        // *** BEGIN: SHA-1 Hash Computation (Section 6.2.1 in FIPS 180-2) **
-        // ******************************************************************
-
-        // Iterate over the message block
-        for ( uint64_t j = 0 ; j < L ; j += 16 ) {
+    void SHA::final( uint32_t h[5] ) {
 
-            // Step 1. Prepare the message schedule
-            memcpy(W,buffer+j,16*sizeof(uint32_t));
-            for ( int i = 16 ; i < 80 ; i++ ) {
-                W[i] = rotl32( W[i-3] ^ W[i-8] ^ W[i-14] ^ W[i-16] , 1 );
-            }
-
-            // Step 2. Initialize the five working variables with the
-            // the (i-1)-st hash value
-            a = H0;
-            b = H1;
-            c = H2;
-            d = H3;
-            e = H4;
-
-            // Step 3.
-            for ( int t = 0 ; t < 80 ; t++ ) {
-
-                if ( t < 20 ) {
-                    f = (b&c) ^ ((~b)&d);
-                    K = 0x5A827999;
-                } else if ( t < 40 ) {
-                    f = b ^ c ^ d;
-                    K = 0x6ED9EBA1;
-                } else if ( t < 60 ) {
-                    f = (b&c) ^ (b&d) ^ (c&d);
-                    K = 0x8F1BBCDC;
-                } else {
-                    f = b ^  c ^ d;
-                    K = 0xCA62C1D6;
-                }
-
-                T = rotl32(a,5) + f + e + K + W[t];
-                e = d;
-                d = c;
-                c = rotl32(b,30);
-                b = a;
-                a = T;
-            }
-
-            // Step 4. Compute the i-th intermediate hash value
-            H0 += a;
-            H1 += b;
-            H2 += c;
-            H3 += d;
-            H4 += e;
+        // Length of message in bits
+        uint64_t l = 8*this->L;
+        int r = (int)(this->L % 64);
+
+        // Append the bit '1' to the end of the message and pad by '0'
+        // bits until 64 bits are left in the last block (see Section
+        // 5.1.1. in FIPS 180-2).
+        this->block[r++] = 0x80;
+        if ( r > 56 ) {
+            memset(this->block+r,0,64-r);
+            compress(this->H,this->block,1);
+            r = 0;
         }
+        memset(this->block+r,0,56-r);
 
-        // ******************************************************************
-        // **** END: SHA-1 Hash Computation (Section 6.2.1 in FIPS 180-2) ***
-        // ******************************************************************
+        // Append the 64-bit block that is equal to the number 'l' expressed
+        // using a binary representation.
+        store32be(this->block+56,(uint32_t)(l>>32));
+        store32be(this->block+60,(uint32_t)l);
+        compress(this->H,this->block,1);
 
         // Output
-        h[0] = H0;
-        h[1] = H1;
-        h[2] = H2;
-        h[3] = H3;
-        h[4] = H4;
+        memcpy(h,this->H,5*sizeof(uint32_t));
+
+        init();
     }
 
     /**
      * @brief
-     *            Computes the hash of the padded message stored by this
-     *            %SHA object and stores the result in the specified
-     *            output array.
+     *            Pads the message passed since the last call of
+     *            \link init()\endlink and outputs its SHA-1 hash
+     *            value.
+     *
+     * @details
+     *            Afterwards, this %SHA object is initialized again.
      *
      * @param h
-     *            An array that is capable to hold 20 integers of type
-     *            <code>uint8_t</code> to which the hash value
-     *            of the buffered message is stored.
+     *            Will contain the SHA-1 hash value of the message.
      */
-    void SHA::hash( uint8_t h[20] ) {
+    void SHA::final( uint8_t h[20] ) {
 
         uint32_t tmp[5];
 
-        hash(tmp);
+        final(tmp);
 
         for ( int i = 0 ; i < 5 ; i++ ) {
-            for ( int j = 3 ; j >= 0 ; j-- ) {
-                h[i*4+j] = tmp[i] & 0xFF;
-                tmp[i] >>= 8;
-            }
+            store32be(h+4*i,tmp[i]);
         }
     }
 
@@ -402,22 +743,14 @@ namespace thimble {
      *            Number of valid bytes contained in <code>message</code>
      *
      * @warning
-     *            If not sufficient memory could be provided to compute
-     *            the result an error message is printed to
-     *            <code>stderr</code> and the program exits with status
-     *            -1.
-     *
-     * @warning
      *            If <code>message</code> contains no <code>n</code> valid
      *            bytes the method runs into undocumented behavior.
      */
      void SHA::hash( uint32_t h[5] , const uint8_t *message , uint64_t n ) {
 
-         // Pad the message in the buffer ...
-         padMessage(message,n);
-
-         // ... and hash from the buffer
-         hash(h);
+         init();
+         update(message,n);
+         final(h);
      }
 
      /**
@@ -444,22 +777,14 @@ namespace thimble {
       *            <code>message</code>
       *
       * @warning
-      *            If not sufficient memory could be provided to compute
-      *            the result an error message is printed to
-      *            <code>stderr</code> and the program exits with status
-      *            -1.
-      *
-      * @warning
       *            If <code>message</code> contains no <code>n</code> valid
       *            bytes the method runs into undocumented behavior.
       */
      void SHA::hash( uint32_t h[5] , const uint32_t *message, uint64_t n ) {
 
-         // Pad the message in the buffer ...
-         padMessage(message,n);
-
-         // ... and hash from the buffer
-         hash(h);
+         init();
+         update(message,n);
+         final(h);
      }
 
      /**
@@ -483,20 +808,14 @@ namespace thimble {
       *            Number of valid bytes contained in <code>message</code>
       *
       * @warning
-      *            If not sufficient memory could be provided to compute
-      *            the result an error message is printed to
-      *            <code>stderr</code> and the program exits with status
-      *            -1.
-      *
-      * @warning
       *            If <code>message</code> contains no <code>n</code> valid
       *            bytes the method runs into undocumented behavior.
       */
      void SHA::hash( uint8_t h[20] , const uint8_t *message , uint64_t n ) {
 
-         padMessage(message,n);
-
-         hash(h);
+         init();
+         update(message,n);
+         final(h);
      }
 
      /**
@@ -523,25 +842,57 @@ namespace thimble {
       *            <code>message</code>
       *
       * @warning
-      *            If not sufficient memory could be provided to compute
-      *            the result an error message is printed to
-      *            <code>stderr</code> and the program exits with status
-      *            -1.
-      *
-      * @warning
       *            If <code>message</code> contains no <code>n</code> valid
       *            bytes the method runs into undocumented behavior.
       */
      void SHA::hash( uint8_t h[20] , const uint32_t *message , uint64_t n ) {
 
-         padMessage(message,n);
+         init();
+         update(message,n);
+         final(h);
+     }
 
-         hash(h);
+     /**
+      * @brief
+      *            Computes the SHA-1 hash values of several independent
+      *            messages at once.
+      *
+      * @details
+      *            see 'SHA.h'
+      */
+     void SHA::hashBatch
+     ( uint32_t h[][5] , const uint32_t *const *messages ,
+       const uint64_t *n , int num ) {
+
+         hashBatchImpl(h,messages,n,num,4);
      }
 
-}
+     /**
+      * @brief
+      *            Computes the SHA-1 hash values of several independent
+      *            messages at once.
+      *
+      * @details
+      *            see 'SHA.h'
+      */
+     void SHA::hashBatch
+     ( uint8_t h[][20] , const uint8_t *const *messages ,
+       const uint64_t *n , int num ) {
 
+         uint32_t tmp[8][5];
 
+         for ( int l0 = 0 ; l0 < num ; l0 += 8 ) {
 
+             int lanes = num - l0 < 8 ? num - l0 : 8;
 
+             hashBatchImpl(tmp,messages+l0,n+l0,lanes,1);
 
+             for ( int l = 0 ; l < lanes ; l++ ) {
+                 for ( int i = 0 ; i < 5 ; i++ ) {
+                     store32be(h[l0+l]+4*i,tmp[l][i]);
+                 }
+             }
+         }
+     }
+
+}
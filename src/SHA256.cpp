@@ -0,0 +1,389 @@
+/*
+ *  THIMBLE --- Research Library for Development and Analysis of
+ *  Fingerprint-Based Biometric Cryptosystems.
+ *
+ *  Copyright 2026 agent
+ *
+ *  THIMBLE is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of
+ *  the License, or (at your option) any later version.
+ *
+ *  THIMBLE is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with THIMBLE. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SHA256.cpp
+ *
+ * @brief
+ *            This file implements the functionalities provided by
+ *            'SHA256.h' which provides a mechanism for computing the
+ *            SHA-256 hash value of data.
+ *
+ * @details
+ *            see 'SHA256.h'
+ *
+ * @author agent
+ */
+#include "config.h"
+#include <stdint.h>
+#include <cstring>
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+#include <immintrin.h>
+#endif
+
+#include <thimble/math/MathTools.h>
+#include <thimble/security/SHA256.h>
+
+using namespace std;
+
+/**
+ * @brief The library's namespace
+ */
+namespace thimble {
+
+    /**
+     * @brief
+     *            Initial hash value (see Section 5.3.2 in FIPS 180-2).
+     */
+    static const uint32_t _SHA256_IV[8] = {
+        0x6A09E667 , 0xBB67AE85 , 0x3C6EF372 , 0xA54FF53A ,
+        0x510E527F , 0x9B05688C , 0x1F83D9AB , 0x5BE0CD19 };
+
+    /**
+     * @brief
+     *            Round constants (see Section 4.2.2 in FIPS 180-2).
+     */
+    static const uint32_t _SHA256_K[64] = {
+        0x428A2F98 , 0x71374491 , 0xB5C0FBCF , 0xE9B5DBA5 ,
+        0x3956C25B , 0x59F111F1 , 0x923F82A4 , 0xAB1C5ED5 ,
+        0xD807AA98 , 0x12835B01 , 0x243185BE , 0x550C7DC3 ,
+        0x72BE5D74 , 0x80DEB1FE , 0x9BDC06A7 , 0xC19BF174 ,
+        0xE49B69C1 , 0xEFBE4786 , 0x0FC19DC6 , 0x240CA1CC ,
+        0x2DE92C6F , 0x4A7484AA , 0x5CB0A9DC , 0x76F988DA ,
+        0x983E5152 , 0xA831C66D , 0xB00327C8 , 0xBF597FC7 ,
+        0xC6E00BF3 , 0xD5A79147 , 0x06CA6351 , 0x14292967 ,
+        0x27B70A85 , 0x2E1B2138 , 0x4D2C6DFC , 0x53380D13 ,
+        0x650A7354 , 0x766A0ABB , 0x81C2C92E , 0x92722C85 ,
+        0xA2BFE8A1 , 0xA81A664B , 0xC24B8B70 , 0xC76C51A3 ,
+        0xD192E819 , 0xD6990624 , 0xF40E3585 , 0x106AA070 ,
+        0x19A4C116 , 0x1E376C08 , 0x2748774C , 0x34B0BCB5 ,
+        0x391C0CB3 , 0x4ED8AA4A , 0x5B9CCA4F , 0x682E6FF3 ,
+        0x748F82EE , 0x78A5636F , 0x84C87814 , 0x8CC70208 ,
+        0x90BEFFFA , 0xA4506CEB , 0xBEF9A3F7 , 0xC67178F2 };
+
+    /**
+     * @brief
+     *            Circular right shift of a 32-bit integer by
+     *            <code>n</code> bits.
+     */
+    inline static uint32_t rotr32( uint32_t x , int n ) {
+        return (x >> n) | (x << (32 - n));
+    }
+
+    /**
+     * @brief
+     *            Interprets four bytes as a big-endian 32-bit integer.
+     */
+    inline static uint32_t load32be( const uint8_t *p ) {
+        return (((uint32_t)p[0])<<24) | (((uint32_t)p[1])<<16) |
+               (((uint32_t)p[2])<<8)  |  ((uint32_t)p[3]);
+    }
+
+    /**
+     * @brief
+     *            Writes a 32-bit integer as four big-endian bytes.
+     */
+    inline static void store32be( uint8_t *p , uint32_t x ) {
+        p[0] = (uint8_t)(x>>24);
+        p[1] = (uint8_t)(x>>16);
+        p[2] = (uint8_t)(x>>8);
+        p[3] = (uint8_t)x;
+    }
+
+    /**
+     * @brief
+     *            Portable implementation of \link compress()\endlink
+     *            (see Section 6.2.2 in FIPS 180-2).
+     */
+    static void compressGeneric
+    ( uint32_t H[8] , const uint8_t *blocks , uint64_t numBlocks ) {
+
+        uint32_t W[64];
+
+        for ( uint64_t j = 0 ; j < numBlocks ; j++ , blocks += 64 ) {
+
+            // Step 1. Prepare the message schedule
+            for ( int t = 0 ; t < 16 ; t++ ) {
+                W[t] = load32be(blocks+4*t);
+            }
+            for ( int t = 16 ; t < 64 ; t++ ) {
+                uint32_t s0 = rotr32(W[t-15],7) ^ rotr32(W[t-15],18) ^
+                              (W[t-15] >> 3);
+                uint32_t s1 = rotr32(W[t-2],17) ^ rotr32(W[t-2],19) ^
+                              (W[t-2] >> 10);
+                W[t] = W[t-16] + s0 + W[t-7] + s1;
+            }
+
+            // Step 2. Initialize the eight working variables
+            uint32_t a = H[0] , b = H[1] , c = H[2] , d = H[3];
+            uint32_t e = H[4] , f = H[5] , g = H[6] , h = H[7];
+
+            // Step 3.
+            for ( int t = 0 ; t < 64 ; t++ ) {
+                uint32_t S1 = rotr32(e,6) ^ rotr32(e,11) ^ rotr32(e,25);
+                uint32_t ch = (e&f) ^ ((~e)&g);
+                uint32_t T1 = h + S1 + ch + _SHA256_K[t] + W[t];
+                uint32_t S0 = rotr32(a,2) ^ rotr32(a,13) ^ rotr32(a,22);
+                uint32_t maj = (a&b) ^ (a&c) ^ (b&c);
+                uint32_t T2 = S0 + maj;
+                h = g; g = f; f = e; e = d + T1;
+                d = c; c = b; b = a; a = T1 + T2;
+            }
+
+            // Step 4. Compute the intermediate hash value
+            H[0] += a; H[1] += b; H[2] += c; H[3] += d;
+            H[4] += e; H[5] += f; H[6] += g; H[7] += h;
+        }
+    }
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+    /**
+     * @brief
+     *            Performs four rounds of SHA-256 with the 'SHA'
+     *            extensions.
+     *
+     * @details
+     *            The template parameter <code>G</code> denotes the group
+     *            of rounds <code>4G,...,4G+3</code>. The message schedule
+     *            for the subsequent groups is advanced in the four
+     *            registers <code>m[0],...,m[3]</code> in parallel.
+     */
+    template<int G>
+    __attribute__((target("sha,sse4.1")))
+    inline static void sha256RoundsNi
+    ( __m128i & abef , __m128i & cdgh , __m128i m[4] ) {
+
+        __m128i msg = _mm_add_epi32
+            (m[G%4],_mm_loadu_si128((const __m128i*)(_SHA256_K+4*G)));
+        cdgh = _mm_sha256rnds2_epu32(cdgh,abef,msg);
+        if ( G >= 3 && G <= 14 ) {
+            __m128i tmp = _mm_alignr_epi8(m[G%4],m[(G+3)%4],4);
+            m[(G+1)%4] = _mm_add_epi32(m[(G+1)%4],tmp);
+            m[(G+1)%4] = _mm_sha256msg2_epu32(m[(G+1)%4],m[G%4]);
+        }
+        msg = _mm_shuffle_epi32(msg,0x0E);
+        abef = _mm_sha256rnds2_epu32(abef,cdgh,msg);
+        if ( G >= 1 && G <= 12 ) {
+            m[(G+3)%4] = _mm_sha256msg1_epu32(m[(G+3)%4],m[G%4]);
+        }
+    }
+
+    /**
+     * @brief
+     *            Implementation of \link compress()\endlink using the
+     *            'SHA' extensions.
+     */
+    __attribute__((target("sha,sse4.1")))
+    static void compressShaNi
+    ( uint32_t H[8] , const uint8_t *blocks , uint64_t numBlocks ) {
+
+        const __m128i bswap =
+            _mm_set_epi64x(0x0C0D0E0F08090A0BLL,0x0405060700010203LL);
+
+        // Rearrange the state words into the 'ABEF' and 'CDGH' layout
+        // expected by the round instructions
+        __m128i tmp  = _mm_shuffle_epi32
+            (_mm_loadu_si128((const __m128i*)H),0xB1);
+        __m128i cdgh = _mm_shuffle_epi32
+            (_mm_loadu_si128((const __m128i*)(H+4)),0x1B);
+        __m128i abef = _mm_alignr_epi8(tmp,cdgh,8);
+        cdgh = _mm_blend_epi16(cdgh,tmp,0xF0);
+
+        __m128i m[4];
+
+        for ( uint64_t j = 0 ; j < numBlocks ; j++ , blocks += 64 ) {
+
+            __m128i abefSave = abef;
+            __m128i cdghSave = cdgh;
+
+            for ( int i = 0 ; i < 4 ; i++ ) {
+                m[i] = _mm_shuffle_epi8
+                    (_mm_loadu_si128((const __m128i*)(blocks+16*i)),bswap);
+            }
+
+            sha256RoundsNi<0> (abef,cdgh,m);
+            sha256RoundsNi<1> (abef,cdgh,m);
+            sha256RoundsNi<2> (abef,cdgh,m);
+            sha256RoundsNi<3> (abef,cdgh,m);
+            sha256RoundsNi<4> (abef,cdgh,m);
+            sha256RoundsNi<5> (abef,cdgh,m);
+            sha256RoundsNi<6> (abef,cdgh,m);
+            sha256RoundsNi<7> (abef,cdgh,m);
+            sha256RoundsNi<8> (abef,cdgh,m);
+            sha256RoundsNi<9> (abef,cdgh,m);
+            sha256RoundsNi<10>(abef,cdgh,m);
+            sha256RoundsNi<11>(abef,cdgh,m);
+            sha256RoundsNi<12>(abef,cdgh,m);
+            sha256RoundsNi<13>(abef,cdgh,m);
+            sha256RoundsNi<14>(abef,cdgh,m);
+            sha256RoundsNi<15>(abef,cdgh,m);
+
+            abef = _mm_add_epi32(abef,abefSave);
+            cdgh = _mm_add_epi32(cdgh,cdghSave);
+        }
+
+        // Restore the order 'ABCD' and 'EFGH'
+        tmp  = _mm_shuffle_epi32(abef,0x1B);
+        cdgh = _mm_shuffle_epi32(cdgh,0xB1);
+        _mm_storeu_si128((__m128i*)H,_mm_blend_epi16(tmp,cdgh,0xF0));
+        _mm_storeu_si128((__m128i*)(H+4),_mm_alignr_epi8(cdgh,tmp,8));
+    }
+#endif
+
+    /**
+     * @brief
+     *            Updates an intermediate hash value by consecutive
+     *            64-byte message blocks.
+     *
+     * @details
+     *            If the processor supports the 'SHA' extensions, they
+     *            are used; otherwise, a portable implementation is used.
+     */
+    static void compress
+    ( uint32_t H[8] , const uint8_t *blocks , uint64_t numBlocks ) {
+
+#ifdef THIMBLE_GCC_X86_CPU_DISPATCH
+        if ( MathTools::hasSha() ) {
+            compressShaNi(H,blocks,numBlocks);
+            return;
+        }
+#endif
+        compressGeneric(H,blocks,numBlocks);
+    }
+
+    /*
+     * see 'SHA256.h' for the documentation.
+     */
+    SHA256::SHA256() {
+        init();
+    }
+
+    /*
+     * see 'SHA256.h' for the documentation.
+     */
+    SHA256::~SHA256() {
+        memset(this->block,0,64);
+    }
+
+    /*
+     * see 'SHA256.h' for the documentation.
+     */
+    void SHA256::init() {
+        memcpy(this->H,_SHA256_IV,8*sizeof(uint32_t));
+        this->L = 0;
+    }
+
+    /*
+     * see 'SHA256.h' for the documentation.
+     */
+    void SHA256::update( const uint8_t *message , uint64_t n ) {
+
+        int r = (int)(this->L % 64);
+        this->L += n;
+
+        // Complete a partially buffered block first
+        if ( r > 0 ) {
+            uint64_t c = 64 - r;
+            if ( n < c ) {
+                memcpy(this->block+r,message,(size_t)n);
+                return;
+            }
+            memcpy(this->block+r,message,(size_t)c);
+            compress(this->H,this->block,1);
+            message += c;
+            n -= c;
+        }
+
+        // Compress complete blocks directly from the message ...
+        compress(this->H,message,n/64);
+
+        // ... and buffer the remainder.
+        memcpy(this->block,message+(n/64)*64,(size_t)(n%64));
+    }
+
+    /*
+     * see 'SHA256.h' for the documentation.
+     */
+    void SHA256::update( const uint32_t *message , uint64_t n ) {
+
+        uint8_t bytes[64];
+
+        while ( n > 0 ) {
+            int c = n < 16 ? (int)n : 16;
+            for ( int i = 0 ; i < c ; i++ ) {
+                store32be(bytes+4*i,message[i]);
+            }
+            update(bytes,4*c);
+            message += c;
+            n -= c;
+        }
+    }
+
+    /*
+     * see 'SHA256.h' for the documentation.
+     */
+    void SHA256::final( uint8_t h[32] ) {
+
+        // Length of message in bits
+        uint64_t l = 8*this->L;
+        int r = (int)(this->L % 64);
+
+        // Append the bit '1' and pad by '0' bits until 64 bits are
+        // left in the last block (see Section 5.1.1. in FIPS 180-2).
+        this->block[r++] = 0x80;
+        if ( r > 56 ) {
+            memset(this->block+r,0,64-r);
+            compress(this->H,this->block,1);
+            r = 0;
+        }
+        memset(this->block+r,0,56-r);
+
+        store32be(this->block+56,(uint32_t)(l>>32));
+        store32be(this->block+60,(uint32_t)l);
+        compress(this->H,this->block,1);
+
+        // Output
+        for ( int i = 0 ; i < 8 ; i++ ) {
+            store32be(h+4*i,this->H[i]);
+        }
+
+        init();
+    }
+
+    /*
+     * see 'SHA256.h' for the documentation.
+     */
+    void SHA256::hash( uint8_t h[32] , const uint8_t *message , uint64_t n ) {
+
+        init();
+        update(message,n);
+        final(h);
+    }
+
+    /*
+     * see 'SHA256.h' for the documentation.
+     */
+    void SHA256::hash( uint8_t h[32] , const uint32_t *message , uint64_t n ) {
+
+        init();
+        update(message,n);
+        final(h);
+    }
+}
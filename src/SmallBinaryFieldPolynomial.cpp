@@ -381,6 +381,42 @@ namespace thimble {
 		return 0;
 	}
 
+	/**
+	 * @brief
+	 *            Evaluates the polynomial at multiple field elements.
+	 *
+	 * @details
+	 *            see 'SmallBinaryFieldPolynomial.h'
+	 */
+	void SmallBinaryFieldPolynomial::eval
+	( uint32_t *y , const uint32_t *x , int n ) const {
+
+		int d = deg();
+
+		if ( d < 0 ) {
+			for ( int j = 0 ; j < n ; j++ ) {
+				y[j] = 0;
+			}
+			return;
+		}
+
+		const SmallBinaryField & gf = *(this->gfPtr);
+
+		// Horner's method with the coefficient loop outside such that
+		// the steps for the different points are independent
+		uint32_t c = this->coefficients[d];
+		for ( int j = 0 ; j < n ; j++ ) {
+			y[j] = c;
+		}
+
+		for ( int i = d-1 ; i >= 0 ; i-- ) {
+			c = this->coefficients[i];
+			for ( int j = 0 ; j < n ; j++ ) {
+				y[j] = gf.mul(y[j],x[j]) ^ c;
+			}
+		}
+	}
+
 	/**
 	 * @brief
 	 *            Computes the polynomial of minimal degree that
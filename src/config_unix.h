@@ -67,6 +67,31 @@
  */
 //#define THIMBLE_GCC_X86_PCLMULQDQ
 
+/*
+ * If 'THIMBLE_GCC_X86_CPU_DISPATCH' is defined, some low-level
+ * kernels, e.g., the base case of the multiplication of
+ * 'thimble::BinaryPolynomial', are compiled a second time for
+ * instruction set extensions such as 'PCLMULQDQ'. Which of the
+ * variants is used is decided at runtime by querying 'cpuid'. In
+ * contrast to 'THIMBLE_GCC_X86_PCLMULQDQ' the compiled library
+ * thus still runs on machines without these extensions, which is
+ * why we define it whenever GCC compiles for x86-64.
+ */
+#if defined(__GNUC__) && defined(__x86_64__)
+#define THIMBLE_GCC_X86_CPU_DISPATCH
+#endif
+
+/*
+ * If 'THIMBLE_AES_LOOKUP_TABLES' is defined, 'thimble::AES128'
+ * encrypts and decrypts single blocks with lookup tables
+ * when 'AES-NI' is not available, which is faster than the
+ * bitsliced implementation used otherwise. However, the tables
+ * are indexed by secret data such that the running time of the
+ * cipher leaks the key through the cache. Therefore, we leave it
+ * undefined.
+ */
+//#define THIMBLE_AES_LOOKUP_TABLES
+
 /*
  * We use a makro controlling the interface to open a file to
  * avoid warnings when Microsoft Visual C++ Express 2010 is